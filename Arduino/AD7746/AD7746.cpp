@@ -6,6 +6,7 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - add continuous conversion, ready-gated burst reads and moving average
 //     2012-04-01 - initial release
 
 /* ============================================
@@ -39,6 +40,10 @@ THE SOFTWARE.
  */
 AD7746::AD7746() {
     devAddr = AD7746_DEFAULT_ADDRESS;
+    readyPin = -1;
+    windowSize = 1;
+    windowCount = windowNext = 0;
+    windowSum = 0;
 }
 
 /** Specific address constructor.
@@ -48,6 +53,10 @@ AD7746::AD7746() {
  */
 AD7746::AD7746(uint8_t address) {
     devAddr = address;
+    readyPin = -1;
+    windowSize = 1;
+    windowCount = windowNext = 0;
+    windowSum = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -106,6 +115,112 @@ uint32_t AD7746::getCapacitance() {
 }
 
 
+/** Get the status register.
+ * RDY, RDYVT and RDYCAP read 0 while a finished conversion is unread.
+ * @return STATUS register value
+ * @see AD7746_RA_STATUS
+ */
+uint8_t AD7746::getStatus() {
+    I2Cdev::readByte(devAddr, AD7746_RA_STATUS, buffer);
+    return buffer[0];
+}
+
+/** Set the conversion mode (idle, continuous, single, calibration).
+ * Only the MD bits of the configuration register are changed.
+ * @param mode AD7746_MD_* value
+ * @see AD7746_MD_CONTINUOUS_CONVERSION
+ */
+void AD7746::setMode(uint8_t mode) {
+    I2Cdev::writeBits(devAddr, AD7746_RA_CONFIGURATION, AD7746_MD_BIT_2, 3, mode);
+}
+
+/** Set the capacitive channel digital filter (conversion time).
+ * Longer conversions are filtered on the chip itself and lower the noise at
+ * the cost of sample rate; 11ms gives the highest rate at about 90Hz.
+ * @param capf AD7746_CAPF_* value
+ */
+void AD7746::setCapFilter(uint8_t capf) {
+    I2Cdev::writeBits(devAddr, AD7746_RA_CONFIGURATION, AD7746_CAPF_BIT_2, 3, capf >> AD7746_CAPF_BIT_0);
+}
+
+/** Use the RDY output to gate reads.
+ * With a pin set, the *IfReady() calls only touch the bus once the RDY line
+ * has gone low, so polling a continuous conversion costs no bus traffic
+ * until a result is waiting.
+ * @param pin Arduino pin wired to RDY, -1 to poll the status byte instead
+ */
+void AD7746::setReadyPin(int8_t pin) {
+    readyPin = pin;
+    if (pin >= 0) {
+        pinMode(pin, INPUT);
+        digitalWrite(pin, HIGH); // internal pull-up
+    }
+}
+
+/** Read the capacitive result if a new one is available.
+ * The status byte and the three capacitance bytes come in one burst read,
+ * so a fresh sample costs a single transaction and a stale one is never
+ * returned. Results are also fed to the moving average.
+ * @param capacitance Raw 24-bit capacitance code, set when a new result was read
+ * @return True if a new result was read
+ * @see setAveraging()
+ */
+bool AD7746::getCapacitanceIfReady(uint32_t *capacitance) {
+    if (!readIfReady(4, 1 << AD7746_RDYCAP_BIT)) return false;
+    *capacitance = ((uint32_t)buffer[1] << 16) | ((uint32_t)buffer[2] << 8) | (uint32_t)buffer[3];
+    addSample(*capacitance);
+    return true;
+}
+
+/** Read the capacitive and voltage/temperature results in one burst, once
+ * both channel conversions are finished.
+ * @param capacitance Raw 24-bit capacitance code
+ * @param vt Raw 24-bit VT channel code
+ * @return True if new results were read
+ */
+bool AD7746::getCapacitanceAndVtIfReady(uint32_t *capacitance, uint32_t *vt) {
+    if (!readIfReady(7, 1 << AD7746_RDY_BIT)) return false;
+    *capacitance = ((uint32_t)buffer[1] << 16) | ((uint32_t)buffer[2] << 8) | (uint32_t)buffer[3];
+    *vt = ((uint32_t)buffer[4] << 16) | ((uint32_t)buffer[5] << 8) | (uint32_t)buffer[6];
+    addSample(*capacitance);
+    return true;
+}
+
+/** Set the moving average window for getAverageCapacitance().
+ * Changing the window restarts the average.
+ * @param samples Window length, 1 to AD7746_AVERAGE_MAX
+ */
+void AD7746::setAveraging(uint8_t samples) {
+    if (samples < 1) samples = 1;
+    if (samples > AD7746_AVERAGE_MAX) samples = AD7746_AVERAGE_MAX;
+    windowSize = samples;
+    windowCount = windowNext = 0;
+    windowSum = 0;
+}
+
+/** Get the mean of the last results read by the *IfReady() calls.
+ * Until the window has filled, the mean covers the samples seen so far.
+ * @return Averaged raw capacitance code (0 before the first result)
+ */
+uint32_t AD7746::getAverageCapacitance() {
+    return windowCount ? windowSum / windowCount : 0;
+}
+
+// burst read length bytes from STATUS when the readyMask bit (active low) is clear
+bool AD7746::readIfReady(uint8_t length, uint8_t readyMask) {
+    if (readyPin >= 0 && digitalRead(readyPin) != LOW) return false;
+    if (I2Cdev::readBytes(devAddr, AD7746_RA_STATUS, length, buffer) != (int8_t)length) return false;
+    return !(buffer[0] & readyMask);
+}
+
+void AD7746::addSample(uint32_t capacitance) {
+    if (windowCount == windowSize) windowSum -= window[windowNext];
+    else windowCount++;
+    window[windowNext] = capacitance;
+    windowSum += capacitance;
+    windowNext = (windowNext + 1) % windowSize;
+}
+
 void AD7746::writeCapSetupRegister(uint8_t data) {
     I2Cdev::writeByte(devAddr, AD7746_RA_CAP_SETUP, data);
 }
@@ -6,6 +6,7 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - add continuous conversion, ready-gated burst reads and moving average
 //     2012-04-01 - initial release
 
 /* ============================================
@@ -157,6 +158,11 @@ THE SOFTWARE.
 
 #define AD7746_DAC_COEFFICIENT           0.13385826771654F // 17pF/127
 
+// longest moving average window kept by the driver (samples, RAM is 4 bytes each)
+#ifndef AD7746_AVERAGE_MAX
+    #define AD7746_AVERAGE_MAX           16
+#endif
+
 
 
 class AD7746 {
@@ -169,6 +175,16 @@ class AD7746 {
         void reset(); 
 
         uint32_t getCapacitance();
+
+        uint8_t getStatus();
+        void setMode(uint8_t mode);
+        void setCapFilter(uint8_t capf);
+        void setReadyPin(int8_t pin);
+        bool getCapacitanceIfReady(uint32_t *capacitance);
+        bool getCapacitanceAndVtIfReady(uint32_t *capacitance, uint32_t *vt);
+
+        void setAveraging(uint8_t samples);
+        uint32_t getAverageCapacitance();
     
         void writeCapSetupRegister(uint8_t data);
         void writeVtSetupRegister(uint8_t data);
@@ -181,6 +197,15 @@ class AD7746 {
     private:
         uint8_t devAddr;
         uint8_t buffer[19];
+        int8_t readyPin;
+        uint32_t window[AD7746_AVERAGE_MAX];
+        uint32_t windowSum;
+        uint8_t windowSize;
+        uint8_t windowCount;
+        uint8_t windowNext;
+
+        bool readIfReady(uint8_t length, uint8_t readyMask);
+        void addSample(uint32_t capacitance);
 };
 
 #endif /* _AD7746_H_ */
@@ -5,6 +5,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - waitBusy() idles through the minimum conversion time before polling OS
+//     2026-10-14 - add ALERT/RDY conversion-ready mode and interrupt-friendly data ready API
+//     2026-10-14 - add multi-channel scan engine with precomputed CONFIG words
 //     2013-05-05 - Add debug information.  Rename methods to match datasheet.
 //     2011-11-06 - added getVoltage, F. Farzanegan
 //     2011-10-29 - added getDifferentialx() methods, F. Farzanegan
@@ -40,6 +43,14 @@ THE SOFTWARE.
  */
 ADS1115::ADS1115() {
     devAddr = ADS1115_DEFAULT_ADDRESS;
+    scanCount = 0;
+    rdyPin = -1;
+    rdyInterrupt = false;
+    rdyFlag = false;
+    rdyActiveHigh = false;
+    devRate = ADS1115_RATE_128;
+    convStartedAt = 0;
+    convPending = false;
 }
 
 /** Specific address constructor.
@@ -52,6 +63,14 @@ ADS1115::ADS1115() {
  */
 ADS1115::ADS1115(uint8_t address) {
     devAddr = address;
+    scanCount = 0;
+    rdyPin = -1;
+    rdyInterrupt = false;
+    rdyFlag = false;
+    rdyActiveHigh = false;
+    devRate = ADS1115_RATE_128;
+    convStartedAt = 0;
+    convPending = false;
 }
 
 /** Power on and prepare for general usage.
@@ -82,11 +101,29 @@ bool ADS1115::testConnection() {
 /** Wait until the single-shot conversion is finished
  * Retry at most 'max_retries' times
  * conversion is finished, then return;
+ * Without ALERT/RDY the bus is left alone until the earliest the oscillator
+ * (nominal -10%) can finish, timed from the last start, and OS is then
+ * polled every 1/32 of a conversion rather than back to back.
  * @see ADS1115_OS_INACTIVE
  */
 void ADS1115::waitBusy(uint16_t max_retries) {  
+  if (rdyPin >= 0) {
+    // ALERT/RDY tells us without touching the bus; allow twice the conversion time
+    uint32_t t0 = micros(), limit = getConversionMicros(devRate) * 2;
+    while (!isConversionReady() && micros() - t0 < limit);
+    return;
+  }
+  uint32_t conversion = getConversionMicros(devRate);
+  uint32_t earliest = conversion * 9 / 11, elapsed = micros() - convStartedAt;
+  if (elapsed < earliest) {
+    uint32_t wait = earliest - elapsed;
+    delay(wait / 1000);
+    delayMicroseconds(wait % 1000);
+  }
+  uint16_t gap = conversion / 32;
   for(uint16_t i = 0; i < max_retries; i++) {
     if (getOpStatus()==ADS1115_OS_INACTIVE) break;    
+    delayMicroseconds(gap);
   }
 }
 
@@ -129,11 +166,13 @@ void ADS1115::waitBusy(uint16_t max_retries) {
 int16_t ADS1115::getConversion() {
     if (devMode == ADS1115_MODE_SINGLESHOT) 
     {  
+      rdyFlag = false;
       setOpStatus(ADS1115_OS_ACTIVE);
       ADS1115::waitBusy(I2CDEV_DEFAULT_READ_TIMEOUT);
       
     }
     I2Cdev::readWord(devAddr, ADS1115_RA_CONVERSION, buffer);
+    convPending = false;
     return buffer[0];
 }
 /** Get AIN0/N1 differential.
@@ -316,6 +355,10 @@ uint8_t ADS1115::getOpStatus() {
  * @see ADS1115_CFG_OS_BIT
  */
 void ADS1115::setOpStatus(uint8_t status) { 
+    if (status == ADS1115_OS_ACTIVE) {
+        convStartedAt = micros();
+        convPending = true;
+    }
     I2Cdev::writeBitW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_OS_BIT, status);
 }
 /** Get multiplexer connection.
@@ -443,7 +486,9 @@ uint8_t ADS1115::getRate() {
  * @see ADS1115_CFG_DR_LENGTH
  */
 void ADS1115::setRate(uint8_t rate) {
-    I2Cdev::writeBitsW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_DR_BIT, ADS1115_CFG_DR_LENGTH, rate);
+    if (I2Cdev::writeBitsW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_DR_BIT, ADS1115_CFG_DR_LENGTH, rate)) {
+        devRate = rate;
+    }
 }
 /** Get comparator mode.
  * @return Current comparator mode
@@ -569,6 +614,227 @@ void ADS1115::setHighThreshold(int16_t threshold) {
     I2Cdev::writeWord(devAddr, ADS1115_RA_HI_THRESH, threshold);
 }
 
+// Multi-channel scan engine
+
+// position of the MUX field in the CONFIG word
+#define ADS1115_SCAN_MUX_SHIFT  (ADS1115_CFG_MUX_BIT - ADS1115_CFG_MUX_LENGTH + 1)
+
+/** Start scanning a list of inputs round-robin without blocking.
+ * A full CONFIG word (OS, MUX, single-shot mode, plus the current gain, rate
+ * and comparator settings) is built once per entry, so each channel switch
+ * is a single register write that also triggers the conversion, rather than
+ * a read-modify-write of MUX followed by a second one of OS. Completion is
+ * detected from the ALERT/RDY pin if one is given here or with setRdyPin()
+ * (conversion-ready mode is then set up automatically) or else from the
+ * conversion time of the data rate, so the bus stays idle
+ * while a conversion runs. Call serviceScan() from loop().
+ *
+ * Gain, rate and comparator settings must not be changed while scanning;
+ * stop and restart the scan instead.
+ * @param muxModes List of ADS1115_MUX_* inputs to convert in turn
+ * @param count Number of entries (1 to ADS1115_SCAN_CHANNELS)
+ * @param rdyPin Digital pin wired to ALERT/RDY, or -1 to keep the setRdyPin() setting
+ * @return True if the first conversion was started
+ * @see serviceScan()
+ */
+bool ADS1115::startScan(const uint8_t *muxModes, uint8_t count, int8_t rdyPin) {
+    scanCount = 0;
+    if (count == 0 || count > ADS1115_SCAN_CHANNELS) return false;
+    if (rdyPin >= 0) setRdyPin(rdyPin);
+    if (this -> rdyPin >= 0 && !setConversionReadyPinMode()) return false;
+    if (I2Cdev::readWord(devAddr, ADS1115_RA_CONFIG, buffer) != 1) return false;
+
+    // keep PGA, rate and comparator settings, scan in single-shot mode
+    uint16_t base = buffer[0] & ~((1 << ADS1115_CFG_OS_BIT) | (0x07 << ADS1115_SCAN_MUX_SHIFT) | (1 << ADS1115_CFG_MODE_BIT));
+    base |= (1 << ADS1115_CFG_OS_BIT) | (ADS1115_MODE_SINGLESHOT << ADS1115_CFG_MODE_BIT);
+    for (uint8_t i = 0; i < count; i++) {
+        scanConfig[i] = base | ((uint16_t)muxModes[i] << ADS1115_SCAN_MUX_SHIFT);
+    }
+    scanMicros = getConversionMicros((base >> (ADS1115_CFG_DR_BIT - ADS1115_CFG_DR_LENGTH + 1)) & 0x07);
+    scanIndex = 0;
+    scanBlockReady = false;
+    scanCount = count;
+    devMode = ADS1115_MODE_SINGLESHOT;
+    return startScanChannel();
+}
+
+/** Stop scanning. The conversion in progress, if any, is left to finish.
+ */
+void ADS1115::stopScan() {
+    scanCount = 0;
+}
+
+/** Check whether a scan is running.
+ * @return True between startScan() and stopScan()
+ */
+bool ADS1115::isScanning() {
+    return scanCount > 0;
+}
+
+/** Advance the scan if the current conversion has finished: read its
+ * result and immediately start the next entry. Costs no bus traffic while
+ * the conversion is still running.
+ * @return True if a complete round of samples has just been stored
+ * @see getScanBlock()
+ */
+bool ADS1115::serviceScan() {
+    if (scanCount == 0) return false;
+    if (rdyPin >= 0) {
+        if (!isConversionReady()) return false;
+    } else if (micros() - scanStarted < scanMicros) {
+        return false;
+    }
+    if (I2Cdev::readWord(devAddr, ADS1115_RA_CONVERSION, buffer) != 1) {
+        startScanChannel(); // retry this entry
+        return false;
+    }
+    scanResults[scanIndex] = (int16_t)buffer[0];
+    bool roundDone = (++scanIndex == scanCount);
+    if (roundDone) {
+        scanIndex = 0;
+        scanBlockReady = true;
+    }
+    startScanChannel();
+    return roundDone;
+}
+
+/** Copy out the latest complete round of scan samples.
+ * @param samples Buffer for one sample per scan entry, in scan-list order
+ * @return True if a round completed since the last call
+ */
+bool ADS1115::getScanBlock(int16_t *samples) {
+    if (!scanBlockReady) return false;
+    for (uint8_t i = 0; i < scanCount; i++) samples[i] = scanResults[i];
+    scanBlockReady = false;
+    return true;
+}
+
+/** Get the most recent sample for one scan entry.
+ * @param index Position in the scan list
+ * @return Last conversion result for that entry
+ */
+int16_t ADS1115::getScanResult(uint8_t index) {
+    return scanResults[index];
+}
+
+/** Get the worst-case single conversion time for a data rate, including
+ * the datasheet's 10% oscillator tolerance.
+ * @param rate ADS1115_RATE_* value
+ * @return Conversion time in microseconds
+ */
+uint32_t ADS1115::getConversionMicros(uint8_t rate) {
+    static const uint16_t sps[8] = { 8, 16, 32, 64, 128, 250, 475, 860 };
+    return 1100000UL / sps[rate & 0x07];
+}
+
+/** Write the precomputed CONFIG word for the current scan entry,
+ * selecting its input and starting its conversion in one transaction.
+ */
+bool ADS1115::startScanChannel() {
+    muxMode = (scanConfig[scanIndex] >> ADS1115_SCAN_MUX_SHIFT) & 0x07;
+    scanStarted = micros();
+    rdyFlag = false;
+    convPending = true;
+    return I2Cdev::writeWord(devAddr, ADS1115_RA_CONFIG, scanConfig[scanIndex]);
+}
+
+// ALERT/RDY conversion-ready signalling
+
+/** Put the comparator into conversion-ready mode, turning ALERT/RDY into a
+ * data-ready output: Hi_thresh MSB set, Lo_thresh MSB clear, comparator
+ * queue asserting after one conversion, non-latching. The pin polarity
+ * follows the comparator polarity setting. In single-shot mode the pin
+ * asserts when the conversion finishes and stays asserted until the next one
+ * is triggered; in continuous mode it pulses for about 8us per conversion,
+ * so that case needs an interrupt (see setRdyPin()).
+ * @return Status of operation (true = success)
+ * @see ADS1115_RA_LO_THRESH
+ * @see ADS1115_RA_HI_THRESH
+ * @see ADS1115_CFG_COMP_QUE_BIT
+ */
+bool ADS1115::setConversionReadyPinMode() {
+    if (!I2Cdev::writeWord(devAddr, ADS1115_RA_HI_THRESH, 0x8000)) return false;
+    if (!I2Cdev::writeWord(devAddr, ADS1115_RA_LO_THRESH, 0x0000)) return false;
+    if (I2Cdev::readWord(devAddr, ADS1115_RA_CONFIG, buffer) != 1) return false;
+    uint16_t config = buffer[0] & ~(0x03 | (1 << ADS1115_CFG_COMP_LAT_BIT) | (1 << ADS1115_CFG_OS_BIT));
+    config |= ADS1115_COMP_QUE_ASSERT1;
+    rdyActiveHigh = (config >> ADS1115_CFG_COMP_POL_BIT) & 0x01;
+    return I2Cdev::writeWord(devAddr, ADS1115_RA_CONFIG, config);
+}
+
+/** Tell the driver where ALERT/RDY is wired, so waitBusy(), getConversion()
+ * and the scan engine wait on the pin instead of polling the OS bit over
+ * I2C. With interrupt set, the sketch attaches its own ISR to the pin edge
+ * (FALLING for the default active-low polarity) and calls
+ * notifyConversionReady() from it; otherwise the pin level is read.
+ * Call setConversionReadyPinMode() as well unless startScan() does it.
+ * @param pin Digital pin wired to ALERT/RDY, or -1 to go back to OS-bit polling
+ * @param interrupt True if an ISR calls notifyConversionReady()
+ */
+void ADS1115::setRdyPin(int8_t pin, bool interrupt) {
+    rdyPin = pin;
+    rdyInterrupt = interrupt;
+    rdyFlag = false;
+    if (pin >= 0) pinMode(pin, INPUT);
+}
+
+/** Start a single-shot conversion on the current input and return
+ * immediately. Pair with isConversionReady()/getConversionIfReady().
+ * @return Status of operation (true = success)
+ */
+bool ADS1115::triggerConversion() {
+    rdyFlag = false;
+    convStartedAt = micros();
+    convPending = true;
+    return I2Cdev::writeBitW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_OS_BIT, ADS1115_OS_ACTIVE);
+}
+
+/** Record that ALERT/RDY fired. Safe to call from an interrupt handler; it
+ * only sets a flag, all bus access happens later in getConversionIfReady().
+ */
+void ADS1115::notifyConversionReady() {
+    rdyFlag = true;
+}
+
+/** Check for a finished conversion without any bus traffic.
+ * A polled pin stays asserted after a single-shot conversion until the next
+ * one starts, so it only counts while the result of a conversion started by
+ * this driver is still unread; that also means continuous mode needs the
+ * interrupt.
+ * @return True if the ALERT/RDY flag (interrupt) or pin level (polled) says data is ready
+ */
+bool ADS1115::isConversionReady() {
+    if (rdyPin < 0) return false;
+    if (rdyInterrupt) return rdyFlag;
+    return convPending && digitalRead(rdyPin) == (rdyActiveHigh ? HIGH : LOW);
+}
+
+/** Read the CONVERSION register only if ALERT/RDY has signalled a new
+ * result, so the bus stays free for other devices during conversions.
+ * @param value Container for the conversion result
+ * @return True if a new result was read into value
+ */
+bool ADS1115::getConversionIfReady(int16_t *value) {
+    if (!isConversionReady()) return false;
+    rdyFlag = false;
+    if (I2Cdev::readWord(devAddr, ADS1115_RA_CONVERSION, buffer) != 1) return false;
+    convPending = false;
+    *value = (int16_t)buffer[0];
+    return true;
+}
+
+/** Queue the CONVERSION register into a sample ring if ALERT/RDY has
+ * signalled a new result. A result that finds the ring full is counted in
+ * ring->dropped.
+ * @param ring Destination ring
+ * @return True if a new result was queued
+ */
+bool ADS1115::getConversionIfReady(I2Cdev_Ring<int16_t> *ring) {
+    int16_t value;
+    if (!getConversionIfReady(&value)) return false;
+    return ring -> push(value);
+}
+
 // Create a mask between two bits
 unsigned createMask(unsigned a, unsigned b)
 {
@@ -5,6 +5,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - waitBusy() idles through the minimum conversion time before polling OS
+//     2026-10-14 - add ALERT/RDY conversion-ready mode and interrupt-friendly data ready API
+//     2026-10-14 - add multi-channel scan engine with precomputed CONFIG words
 //     2013-05-05 - Add debug information.  Clean up Single Shot implementation
 //     2011-10-29 - added getDifferentialx() methods, F. Farzanegan
 //     2011-08-02 - initial release
@@ -125,6 +128,9 @@ THE SOFTWARE.
 #define ADS1115_COMP_QUE_ASSERT4    0x02
 #define ADS1115_COMP_QUE_DISABLE    0x03 // default
 
+// maximum number of entries in a scan list
+#define ADS1115_SCAN_CHANNELS       8
+
 // -----------------------------------------------------------------------------
 // Arduino-style "Serial.print" debug constant (uncomment to enable)
 // -----------------------------------------------------------------------------
@@ -187,6 +193,24 @@ class ADS1115 {
         int16_t getHighThreshold();
         void setHighThreshold(int16_t threshold);
         
+        // Multi-channel scan engine
+        bool startScan(const uint8_t *muxModes, uint8_t count, int8_t rdyPin=-1);
+        void stopScan();
+        bool isScanning();
+        bool serviceScan();
+        bool getScanBlock(int16_t *samples);
+        int16_t getScanResult(uint8_t index);
+        uint32_t getConversionMicros(uint8_t rate);
+
+        // ALERT/RDY conversion-ready signalling
+        bool setConversionReadyPinMode();
+        void setRdyPin(int8_t pin, bool interrupt=false);
+        bool triggerConversion();
+        void notifyConversionReady();
+        bool isConversionReady();
+        bool getConversionIfReady(int16_t *value);
+        bool getConversionIfReady(I2Cdev_Ring<int16_t> *ring);
+
         // DEBUG
         void showConfigRegister();
 
@@ -196,6 +220,24 @@ class ADS1115 {
         uint8_t devMode;
         uint8_t muxMode;
         uint8_t pgaMode;
+        uint8_t devRate;
+
+        int8_t rdyPin;
+        bool rdyInterrupt;
+        bool rdyActiveHigh;
+        volatile bool rdyFlag;
+        uint32_t convStartedAt;     // micros() of the last single-shot start
+        bool convPending;           // a started conversion's result is still unread
+
+        bool startScanChannel();
+
+        uint16_t scanConfig[ADS1115_SCAN_CHANNELS];     // full CONFIG word per entry, OS set
+        int16_t scanResults[ADS1115_SCAN_CHANNELS];
+        uint8_t scanCount;                              // 0 = not scanning
+        uint8_t scanIndex;                              // entry currently converting
+        bool scanBlockReady;
+        uint32_t scanMicros;                            // conversion time when timing instead of RDY
+        uint32_t scanStarted;
 };
 
 #endif /* _ADS1115_H_ */
@@ -4,6 +4,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - initialize() POWER_CTL setup from a flash register script
+//     2026-10-14 - stamp streamed samples with their reconstructed sample time
+//     2026-10-14 - FIFO streaming into a caller sample ring
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -37,6 +40,10 @@ THE SOFTWARE.
  */
 ADXL345::ADXL345() {
     devAddr = ADXL345_DEFAULT_ADDRESS;
+    streamPin = -1;
+    streamInterrupt = false;
+    streamFlag = false;
+    streamPeriod = 10000;
 }
 
 /** Specific address constructor.
@@ -47,17 +54,37 @@ ADXL345::ADXL345() {
  */
 ADXL345::ADXL345(uint8_t address) {
     devAddr = address;
+    streamPin = -1;
+    streamInterrupt = false;
+    streamFlag = false;
+    streamPeriod = 10000;
 }
 
+// initialize() settings: POWER_CTL cleared, then auto-sleep and measurement
+// set in a second write (taken from the register cache, not read back)
+static const uint8_t initScript[] I2CDEV_SCRIPT_PROGMEM = {
+    I2CDEV_SCRIPT_WRITE(ADXL345_RA_POWER_CTL, 0), // reset all power settings
+    I2CDEV_SCRIPT_FLUSH,
+    I2CDEV_SCRIPT_BIT(ADXL345_RA_POWER_CTL, ADXL345_PCTL_AUTOSLEEP_BIT, 1),
+    I2CDEV_SCRIPT_BIT(ADXL345_RA_POWER_CTL, ADXL345_PCTL_MEASURE_BIT, 1),
+    I2CDEV_SCRIPT_END
+};
+
 /** Power on and prepare for general usage.
  * This will activate the accelerometer, so be sure to adjust the power settings
  * after you call this method if you want it to enter standby mode, or another
  * less demanding mode of operation.
  */
 void ADXL345::initialize() {
-    I2Cdev::writeByte(devAddr, ADXL345_RA_POWER_CTL, 0); // reset all power settings
-    setAutoSleepEnabled(true);
-    setMeasureEnabled(true);
+    #ifdef I2CDEV_REGISTER_CACHE
+        // THRESH_TAP .. FIFO_CTL minus ACT_TAP_STATUS, INT_SOURCE and DATAx
+        I2Cdev::addCacheRange(&cacheConfig, devAddr, ADXL345_RA_THRESH_TAP, 28, cacheConfigValues,
+            (1UL << (ADXL345_RA_ACT_TAP_STATUS - ADXL345_RA_THRESH_TAP)) |
+            (1UL << (ADXL345_RA_INT_SOURCE - ADXL345_RA_THRESH_TAP)) |
+            (0x3FUL << (ADXL345_RA_DATAX0 - ADXL345_RA_THRESH_TAP)));
+        I2Cdev::loadCacheRange(&cacheConfig);
+    #endif
+    I2Cdev::runScript(devAddr, initScript);
 }
 
 /** Verify the I2C connection.
@@ -368,7 +395,7 @@ void ADXL345::setInactivityTime(uint8_t time) {
  * @see ADXL345_AIC_ACT_AC_BIT
  */
 bool ADXL345::getActivityAC() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_AC_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_AC_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set activity AC/DC coupling.
@@ -378,7 +405,7 @@ bool ADXL345::getActivityAC() {
  * @see ADXL345_AIC_ACT_AC_BIT
  */
 void ADXL345::setActivityAC(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_AC_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_AC_BIT> >(devAddr, enabled);
 }
 /** Get X axis activity monitoring inclusion.
  * For all "get[In]Activity*Enabled()" methods: a setting of 1 enables x-, y-,
@@ -396,7 +423,7 @@ void ADXL345::setActivityAC(bool enabled) {
  * @see ADXL345_AIC_ACT_X_BIT
  */
 bool ADXL345::getActivityXEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_X_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_X_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set X axis activity monitoring inclusion.
@@ -407,7 +434,7 @@ bool ADXL345::getActivityXEnabled() {
  * @see ADXL345_AIC_ACT_X_BIT
  */
 void ADXL345::setActivityXEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_X_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_X_BIT> >(devAddr, enabled);
 }
 /** Get Y axis activity monitoring.
  * @return Y axis activity monitoring enabled value
@@ -417,7 +444,7 @@ void ADXL345::setActivityXEnabled(bool enabled) {
  * @see ADXL345_AIC_ACT_Y_BIT
  */
 bool ADXL345::getActivityYEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Y_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Y_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Y axis activity monitoring inclusion.
@@ -428,7 +455,7 @@ bool ADXL345::getActivityYEnabled() {
  * @see ADXL345_AIC_ACT_Y_BIT
  */
 void ADXL345::setActivityYEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Y_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Y_BIT> >(devAddr, enabled);
 }
 /** Get Z axis activity monitoring.
  * @return Z axis activity monitoring enabled value
@@ -438,7 +465,7 @@ void ADXL345::setActivityYEnabled(bool enabled) {
  * @see ADXL345_AIC_ACT_Z_BIT
  */
 bool ADXL345::getActivityZEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Z_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Z_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Z axis activity monitoring inclusion.
@@ -449,7 +476,7 @@ bool ADXL345::getActivityZEnabled() {
  * @see ADXL345_AIC_ACT_Z_BIT
  */
 void ADXL345::setActivityZEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Z_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_ACT_Z_BIT> >(devAddr, enabled);
 }
 /** Get inactivity AC/DC coupling.
  * @return Inctivity coupling (0 = DC, 1 = AC)
@@ -458,7 +485,7 @@ void ADXL345::setActivityZEnabled(bool enabled) {
  * @see ADXL345_AIC_INACT_AC_BIT
  */
 bool ADXL345::getInactivityAC() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_AC_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_AC_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set inctivity AC/DC coupling.
@@ -468,7 +495,7 @@ bool ADXL345::getInactivityAC() {
  * @see ADXL345_AIC_INACT_AC_BIT
  */
 void ADXL345::setInactivityAC(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_AC_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_AC_BIT> >(devAddr, enabled);
 }
 /** Get X axis inactivity monitoring.
  * @return Y axis inactivity monitoring enabled value
@@ -478,7 +505,7 @@ void ADXL345::setInactivityAC(bool enabled) {
  * @see ADXL345_AIC_INACT_X_BIT
  */
 bool ADXL345::getInactivityXEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_X_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_X_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set X axis activity monitoring inclusion.
@@ -489,7 +516,7 @@ bool ADXL345::getInactivityXEnabled() {
  * @see ADXL345_AIC_INACT_X_BIT
  */
 void ADXL345::setInactivityXEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_X_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_X_BIT> >(devAddr, enabled);
 }
 /** Get Y axis inactivity monitoring.
  * @return Y axis inactivity monitoring enabled value
@@ -499,7 +526,7 @@ void ADXL345::setInactivityXEnabled(bool enabled) {
  * @see ADXL345_AIC_INACT_Y_BIT
  */
 bool ADXL345::getInactivityYEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Y_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Y_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Y axis inactivity monitoring inclusion.
@@ -510,7 +537,7 @@ bool ADXL345::getInactivityYEnabled() {
  * @see ADXL345_AIC_INACT_Y_BIT
  */
 void ADXL345::setInactivityYEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Y_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Y_BIT> >(devAddr, enabled);
 }
 /** Get Z axis inactivity monitoring.
  * @return Z axis inactivity monitoring enabled value
@@ -520,7 +547,7 @@ void ADXL345::setInactivityYEnabled(bool enabled) {
  * @see ADXL345_AIC_INACT_Z_BIT
  */
 bool ADXL345::getInactivityZEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Z_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Z_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Z axis inactivity monitoring inclusion.
@@ -531,7 +558,7 @@ bool ADXL345::getInactivityZEnabled() {
  * @see ADXL345_AIC_INACT_Z_BIT
  */
 void ADXL345::setInactivityZEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Z_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_ACT_INACT_CTL, ADXL345_AIC_INACT_Z_BIT> >(devAddr, enabled);
 }
 
 // THRESH_FF register
@@ -596,7 +623,7 @@ void ADXL345::setFreefallTime(uint8_t time) {
  * @see ADXL345_TAPAXIS_SUP_BIT
  */
 bool ADXL345::getTapAxisSuppress() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_SUP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_SUP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set double-tap fast-movement suppression.
@@ -606,7 +633,7 @@ bool ADXL345::getTapAxisSuppress() {
  * @see ADXL345_TAPAXIS_SUP_BIT
  */
 void ADXL345::setTapAxisSuppress(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_SUP_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_SUP_BIT> >(devAddr, enabled);
 }
 /** Get double-tap fast-movement suppression.
  * A setting of 1 in the TAP_X enable bit enables x-axis participation in tap
@@ -618,7 +645,7 @@ void ADXL345::setTapAxisSuppress(bool enabled) {
  * @see ADXL345_TAPAXIS_X_BIT
  */
 bool ADXL345::getTapAxisXEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_X_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_X_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set tap detection X axis inclusion.
@@ -628,7 +655,7 @@ bool ADXL345::getTapAxisXEnabled() {
  * @see ADXL345_TAPAXIS_X_BIT
  */
 void ADXL345::setTapAxisXEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_X_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_X_BIT> >(devAddr, enabled);
 }
 /** Get tap detection Y axis inclusion.
  * A setting of 1 in the TAP_Y enable bit enables y-axis participation in tap
@@ -640,7 +667,7 @@ void ADXL345::setTapAxisXEnabled(bool enabled) {
  * @see ADXL345_TAPAXIS_Y_BIT
  */
 bool ADXL345::getTapAxisYEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Y_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Y_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set tap detection Y axis inclusion.
@@ -650,7 +677,7 @@ bool ADXL345::getTapAxisYEnabled() {
  * @see ADXL345_TAPAXIS_Y_BIT
  */
 void ADXL345::setTapAxisYEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Y_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Y_BIT> >(devAddr, enabled);
 }
 /** Get tap detection Z axis inclusion.
  * A setting of 1 in the TAP_Z enable bit enables z-axis participation in tap
@@ -662,7 +689,7 @@ void ADXL345::setTapAxisYEnabled(bool enabled) {
  * @see ADXL345_TAPAXIS_Z_BIT
  */
 bool ADXL345::getTapAxisZEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Z_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Z_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set tap detection Z axis inclusion.
@@ -672,7 +699,7 @@ bool ADXL345::getTapAxisZEnabled() {
  * @see ADXL345_TAPAXIS_Z_BIT
  */
 void ADXL345::setTapAxisZEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Z_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_TAP_AXES, ADXL345_TAPAXIS_Z_BIT> >(devAddr, enabled);
 }
 
 // ACT_TAP_STATUS register
@@ -690,7 +717,7 @@ void ADXL345::setTapAxisZEnabled(bool enabled) {
  * @see ADXL345_TAPSTAT_ACTX_BIT
  */
 bool ADXL345::getActivitySourceX() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ACTX_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ACTX_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Y axis activity source flag.
@@ -700,7 +727,7 @@ bool ADXL345::getActivitySourceX() {
  * @see ADXL345_TAPSTAT_ACTY_BIT
  */
 bool ADXL345::getActivitySourceY() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ACTY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ACTY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Z axis activity source flag.
@@ -710,7 +737,7 @@ bool ADXL345::getActivitySourceY() {
  * @see ADXL345_TAPSTAT_ACTZ_BIT
  */
 bool ADXL345::getActivitySourceZ() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ACTZ_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ACTZ_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get sleep mode flag.
@@ -723,7 +750,7 @@ bool ADXL345::getActivitySourceZ() {
  * @see ADXL345_TAPSTAT_ASLEEP_BIT
  */
 bool ADXL345::getAsleep() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ASLEEP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_ASLEEP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get X axis tap source flag.
@@ -733,7 +760,7 @@ bool ADXL345::getAsleep() {
  * @see ADXL345_TAPSTAT_TAPX_BIT
  */
 bool ADXL345::getTapSourceX() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_TAPX_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_TAPX_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Y axis tap source flag.
@@ -743,7 +770,7 @@ bool ADXL345::getTapSourceX() {
  * @see ADXL345_TAPSTAT_TAPY_BIT
  */
 bool ADXL345::getTapSourceY() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_TAPY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_TAPY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Z axis tap source flag.
@@ -753,7 +780,7 @@ bool ADXL345::getTapSourceY() {
  * @see ADXL345_TAPSTAT_TAPZ_BIT
  */
 bool ADXL345::getTapSourceZ() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_TAPZ_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_ACT_TAP_STATUS, ADXL345_TAPSTAT_TAPZ_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -768,7 +795,7 @@ bool ADXL345::getTapSourceZ() {
  * @see ADXL345_BW_LOWPOWER_BIT
  */
 bool ADXL345::getLowPowerEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_BW_RATE, ADXL345_BW_LOWPOWER_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_BW_RATE, ADXL345_BW_LOWPOWER_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set low power enabled status.
@@ -778,7 +805,7 @@ bool ADXL345::getLowPowerEnabled() {
  * @see ADXL345_BW_LOWPOWER_BIT
  */
 void ADXL345::setLowPowerEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_BW_RATE, ADXL345_BW_LOWPOWER_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_BW_RATE, ADXL345_BW_LOWPOWER_BIT> >(devAddr, enabled);
 }
 /** Get measurement data rate.
  * These bits select the device bandwidth and output data rate (see Table 7 and
@@ -793,7 +820,7 @@ void ADXL345::setLowPowerEnabled(bool enabled) {
  * @see ADXL345_BW_RATE_LENGTH
  */
 uint8_t ADXL345::getRate() {
-    I2Cdev::readBits(devAddr, ADXL345_RA_BW_RATE, ADXL345_BW_RATE_BIT, ADXL345_BW_RATE_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<ADXL345_RA_BW_RATE, ADXL345_BW_RATE_BIT, ADXL345_BW_RATE_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set measurement data rate.
@@ -808,7 +835,7 @@ uint8_t ADXL345::getRate() {
  * @see ADXL345_BW_RATE_LENGTH
  */
 void ADXL345::setRate(uint8_t rate) {
-    I2Cdev::writeBits(devAddr, ADXL345_RA_BW_RATE, ADXL345_BW_RATE_BIT, ADXL345_BW_RATE_LENGTH, rate);
+    I2Cdev::writeField<I2Cdev_Field<ADXL345_RA_BW_RATE, ADXL345_BW_RATE_BIT, ADXL345_BW_RATE_LENGTH> >(devAddr, rate);
 }
 
 // POWER_CTL register
@@ -834,7 +861,7 @@ void ADXL345::setRate(uint8_t rate) {
  * @see ADXL345_PCTL_LINK_BIT
  */
 bool ADXL345::getLinkEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_LINK_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_LINK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set activity/inactivity serial linkage status.
@@ -843,7 +870,7 @@ bool ADXL345::getLinkEnabled() {
  * @see ADXL345_PCTL_LINK_BIT
  */
 void ADXL345::setLinkEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_LINK_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_LINK_BIT> >(devAddr, enabled);
 }
 /** Get auto-sleep enabled status.
  * If the link bit is set, a setting of 1 in the AUTO_SLEEP bit enables the
@@ -877,7 +904,7 @@ void ADXL345::setLinkEnabled(bool enabled) {
  * @see ADXL345_PCTL_AUTOSLEEP_BIT
  */
 bool ADXL345::getAutoSleepEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_AUTOSLEEP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_AUTOSLEEP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set auto-sleep enabled status.
@@ -887,7 +914,7 @@ bool ADXL345::getAutoSleepEnabled() {
  * @see ADXL345_PCTL_AUTOSLEEP_BIT
  */
 void ADXL345::setAutoSleepEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_AUTOSLEEP_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_AUTOSLEEP_BIT> >(devAddr, enabled);
 }
 /** Get measurement enabled status.
  * A setting of 0 in the measure bit places the part into standby mode, and a
@@ -898,7 +925,7 @@ void ADXL345::setAutoSleepEnabled(bool enabled) {
  * @see ADXL345_PCTL_MEASURE_BIT
  */
 bool ADXL345::getMeasureEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_MEASURE_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_MEASURE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set measurement enabled status.
@@ -908,7 +935,7 @@ bool ADXL345::getMeasureEnabled() {
  * @see ADXL345_PCTL_MEASURE_BIT
  */
 void ADXL345::setMeasureEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_MEASURE_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_MEASURE_BIT> >(devAddr, enabled);
 }
 /** Get sleep mode enabled status.
  * A setting of 0 in the sleep bit puts the part into the normal mode of
@@ -931,7 +958,7 @@ void ADXL345::setMeasureEnabled(bool enabled) {
  * @see ADXL345_PCTL_SLEEP_BIT
  */
 bool ADXL345::getSleepEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_SLEEP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_SLEEP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set sleep mode enabled status.
@@ -941,7 +968,7 @@ bool ADXL345::getSleepEnabled() {
  * @see ADXL345_PCTL_SLEEP_BIT
  */
 void ADXL345::setSleepEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_SLEEP_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_POWER_CTL, ADXL345_PCTL_SLEEP_BIT> >(devAddr, enabled);
 }
 /** Get wakeup frequency.
  * These bits control the frequency of readings in sleep mode as described in
@@ -951,7 +978,7 @@ void ADXL345::setSleepEnabled(bool enabled) {
  * @see ADXL345_PCTL_SLEEP_BIT
  */
 uint8_t ADXL345::getWakeupFrequency() {
-    I2Cdev::readBits(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_WAKEUP_BIT, ADXL345_PCTL_WAKEUP_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<ADXL345_RA_POWER_CTL, ADXL345_PCTL_WAKEUP_BIT, ADXL345_PCTL_WAKEUP_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set wakeup frequency.
@@ -961,7 +988,7 @@ uint8_t ADXL345::getWakeupFrequency() {
  * @see ADXL345_PCTL_SLEEP_BIT
  */
 void ADXL345::setWakeupFrequency(uint8_t frequency) {
-    I2Cdev::writeBits(devAddr, ADXL345_RA_POWER_CTL, ADXL345_PCTL_WAKEUP_BIT, ADXL345_PCTL_WAKEUP_LENGTH, frequency);
+    I2Cdev::writeField<I2Cdev_Field<ADXL345_RA_POWER_CTL, ADXL345_PCTL_WAKEUP_BIT, ADXL345_PCTL_WAKEUP_LENGTH> >(devAddr, frequency);
 }
 
 // INT_ENABLE register
@@ -977,7 +1004,7 @@ void ADXL345::setWakeupFrequency(uint8_t frequency) {
  * @see ADXL345_INT_DATA_READY_BIT
  */
 bool ADXL345::getIntDataReadyEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_DATA_READY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_DATA_READY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set DATA_READY interrupt enabled status.
@@ -987,7 +1014,7 @@ bool ADXL345::getIntDataReadyEnabled() {
  * @see ADXL345_INT_DATA_READY_BIT
  */
 void ADXL345::setIntDataReadyEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_DATA_READY_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_DATA_READY_BIT> >(devAddr, enabled);
 }
 /** Set SINGLE_TAP interrupt enabled status.
  * @param enabled New interrupt enabled status
@@ -996,7 +1023,7 @@ void ADXL345::setIntDataReadyEnabled(bool enabled) {
  * @see ADXL345_INT_SINGLE_TAP_BIT
  */
 bool ADXL345::getIntSingleTapEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_SINGLE_TAP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_SINGLE_TAP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set SINGLE_TAP interrupt enabled status.
@@ -1006,7 +1033,7 @@ bool ADXL345::getIntSingleTapEnabled() {
  * @see ADXL345_INT_SINGLE_TAP_BIT
  */
 void ADXL345::setIntSingleTapEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_SINGLE_TAP_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_SINGLE_TAP_BIT> >(devAddr, enabled);
 }
 /** Get DOUBLE_TAP interrupt enabled status.
  * @return Interrupt enabled status
@@ -1015,7 +1042,7 @@ void ADXL345::setIntSingleTapEnabled(bool enabled) {
  * @see ADXL345_INT_DOUBLE_TAP_BIT
  */
 bool ADXL345::getIntDoubleTapEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_DOUBLE_TAP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_DOUBLE_TAP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set DOUBLE_TAP interrupt enabled status.
@@ -1025,7 +1052,7 @@ bool ADXL345::getIntDoubleTapEnabled() {
  * @see ADXL345_INT_DOUBLE_TAP_BIT
  */
 void ADXL345::setIntDoubleTapEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_DOUBLE_TAP_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_DOUBLE_TAP_BIT> >(devAddr, enabled);
 }
 /** Set ACTIVITY interrupt enabled status.
  * @return Interrupt enabled status
@@ -1034,7 +1061,7 @@ void ADXL345::setIntDoubleTapEnabled(bool enabled) {
  * @see ADXL345_INT_ACTIVITY_BIT
  */
 bool ADXL345::getIntActivityEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_ACTIVITY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_ACTIVITY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set ACTIVITY interrupt enabled status.
@@ -1044,7 +1071,7 @@ bool ADXL345::getIntActivityEnabled() {
  * @see ADXL345_INT_ACTIVITY_BIT
  */
 void ADXL345::setIntActivityEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_ACTIVITY_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_ACTIVITY_BIT> >(devAddr, enabled);
 }
 /** Get INACTIVITY interrupt enabled status.
  * @return Interrupt enabled status
@@ -1053,7 +1080,7 @@ void ADXL345::setIntActivityEnabled(bool enabled) {
  * @see ADXL345_INT_INACTIVITY_BIT
  */
 bool ADXL345::getIntInactivityEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_INACTIVITY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_INACTIVITY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set INACTIVITY interrupt enabled status.
@@ -1063,7 +1090,7 @@ bool ADXL345::getIntInactivityEnabled() {
  * @see ADXL345_INT_INACTIVITY_BIT
  */
 void ADXL345::setIntInactivityEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_INACTIVITY_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_INACTIVITY_BIT> >(devAddr, enabled);
 }
 /** Get FREE_FALL interrupt enabled status.
  * @return Interrupt enabled status
@@ -1072,7 +1099,7 @@ void ADXL345::setIntInactivityEnabled(bool enabled) {
  * @see ADXL345_INT_FREE_FALL_BIT
  */
 bool ADXL345::getIntFreefallEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_FREE_FALL_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_FREE_FALL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FREE_FALL interrupt enabled status.
@@ -1082,7 +1109,7 @@ bool ADXL345::getIntFreefallEnabled() {
  * @see ADXL345_INT_FREE_FALL_BIT
  */
 void ADXL345::setIntFreefallEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_FREE_FALL_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_FREE_FALL_BIT> >(devAddr, enabled);
 }
 /** Get WATERMARK interrupt enabled status.
  * @return Interrupt enabled status
@@ -1091,7 +1118,7 @@ void ADXL345::setIntFreefallEnabled(bool enabled) {
  * @see ADXL345_INT_WATERMARK_BIT
  */
 bool ADXL345::getIntWatermarkEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_WATERMARK_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_WATERMARK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set WATERMARK interrupt enabled status.
@@ -1101,7 +1128,7 @@ bool ADXL345::getIntWatermarkEnabled() {
  * @see ADXL345_INT_WATERMARK_BIT
  */
 void ADXL345::setIntWatermarkEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_WATERMARK_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_WATERMARK_BIT> >(devAddr, enabled);
 }
 /** Get OVERRUN interrupt enabled status.
  * @return Interrupt enabled status
@@ -1110,7 +1137,7 @@ void ADXL345::setIntWatermarkEnabled(bool enabled) {
  * @see ADXL345_INT_OVERRUN_BIT
  */
 bool ADXL345::getIntOverrunEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_OVERRUN_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_OVERRUN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set OVERRUN interrupt enabled status.
@@ -1120,7 +1147,7 @@ bool ADXL345::getIntOverrunEnabled() {
  * @see ADXL345_INT_OVERRUN_BIT
  */
 void ADXL345::setIntOverrunEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_ENABLE, ADXL345_INT_OVERRUN_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_ENABLE, ADXL345_INT_OVERRUN_BIT> >(devAddr, enabled);
 }
 
 // INT_MAP register
@@ -1134,7 +1161,7 @@ void ADXL345::setIntOverrunEnabled(bool enabled) {
  * @see ADXL345_INT_DATA_READY_BIT
  */
 uint8_t ADXL345::getIntDataReadyPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_DATA_READY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_DATA_READY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set DATA_READY interrupt pin.
@@ -1144,7 +1171,7 @@ uint8_t ADXL345::getIntDataReadyPin() {
  * @see ADXL345_INT_DATA_READY_BIT
  */
 void ADXL345::setIntDataReadyPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_DATA_READY_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_DATA_READY_BIT> >(devAddr, pin);
 }
 /** Get SINGLE_TAP interrupt pin.
  * @return Interrupt pin setting
@@ -1153,7 +1180,7 @@ void ADXL345::setIntDataReadyPin(uint8_t pin) {
  * @see ADXL345_INT_SINGLE_TAP_BIT
  */
 uint8_t ADXL345::getIntSingleTapPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_SINGLE_TAP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_SINGLE_TAP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set SINGLE_TAP interrupt pin.
@@ -1163,7 +1190,7 @@ uint8_t ADXL345::getIntSingleTapPin() {
  * @see ADXL345_INT_SINGLE_TAP_BIT
  */
 void ADXL345::setIntSingleTapPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_SINGLE_TAP_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_SINGLE_TAP_BIT> >(devAddr, pin);
 }
 /** Get DOUBLE_TAP interrupt pin.
  * @return Interrupt pin setting
@@ -1172,7 +1199,7 @@ void ADXL345::setIntSingleTapPin(uint8_t pin) {
  * @see ADXL345_INT_DOUBLE_TAP_BIT
  */
 uint8_t ADXL345::getIntDoubleTapPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_DOUBLE_TAP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_DOUBLE_TAP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set DOUBLE_TAP interrupt pin.
@@ -1182,7 +1209,7 @@ uint8_t ADXL345::getIntDoubleTapPin() {
  * @see ADXL345_INT_DOUBLE_TAP_BIT
  */
 void ADXL345::setIntDoubleTapPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_DOUBLE_TAP_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_DOUBLE_TAP_BIT> >(devAddr, pin);
 }
 /** Get ACTIVITY interrupt pin.
  * @return Interrupt pin setting
@@ -1191,7 +1218,7 @@ void ADXL345::setIntDoubleTapPin(uint8_t pin) {
  * @see ADXL345_INT_ACTIVITY_BIT
  */
 uint8_t ADXL345::getIntActivityPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_ACTIVITY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_ACTIVITY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set ACTIVITY interrupt pin.
@@ -1201,7 +1228,7 @@ uint8_t ADXL345::getIntActivityPin() {
  * @see ADXL345_INT_ACTIVITY_BIT
  */
 void ADXL345::setIntActivityPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_ACTIVITY_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_ACTIVITY_BIT> >(devAddr, pin);
 }
 /** Get INACTIVITY interrupt pin.
  * @return Interrupt pin setting
@@ -1210,7 +1237,7 @@ void ADXL345::setIntActivityPin(uint8_t pin) {
  * @see ADXL345_INT_INACTIVITY_BIT
  */
 uint8_t ADXL345::getIntInactivityPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_INACTIVITY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_INACTIVITY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set INACTIVITY interrupt pin.
@@ -1220,7 +1247,7 @@ uint8_t ADXL345::getIntInactivityPin() {
  * @see ADXL345_INT_INACTIVITY_BIT
  */
 void ADXL345::setIntInactivityPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_INACTIVITY_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_INACTIVITY_BIT> >(devAddr, pin);
 }
 /** Get FREE_FALL interrupt pin.
  * @return Interrupt pin setting
@@ -1229,7 +1256,7 @@ void ADXL345::setIntInactivityPin(uint8_t pin) {
  * @see ADXL345_INT_FREE_FALL_BIT
  */
 uint8_t ADXL345::getIntFreefallPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_FREE_FALL_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_FREE_FALL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FREE_FALL interrupt pin.
@@ -1239,7 +1266,7 @@ uint8_t ADXL345::getIntFreefallPin() {
  * @see ADXL345_INT_FREE_FALL_BIT
  */
 void ADXL345::setIntFreefallPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_FREE_FALL_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_FREE_FALL_BIT> >(devAddr, pin);
 }
 /** Get WATERMARK interrupt pin.
  * @return Interrupt pin setting
@@ -1248,7 +1275,7 @@ void ADXL345::setIntFreefallPin(uint8_t pin) {
  * @see ADXL345_INT_WATERMARK_BIT
  */
 uint8_t ADXL345::getIntWatermarkPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_WATERMARK_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_WATERMARK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set WATERMARK interrupt pin.
@@ -1258,7 +1285,7 @@ uint8_t ADXL345::getIntWatermarkPin() {
  * @see ADXL345_INT_WATERMARK_BIT
  */
 void ADXL345::setIntWatermarkPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_WATERMARK_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_WATERMARK_BIT> >(devAddr, pin);
 }
 /** Get OVERRUN interrupt pin.
  * @return Interrupt pin setting
@@ -1267,7 +1294,7 @@ void ADXL345::setIntWatermarkPin(uint8_t pin) {
  * @see ADXL345_INT_OVERRUN_BIT
  */
 uint8_t ADXL345::getIntOverrunPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_OVERRUN_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_OVERRUN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set OVERRUN interrupt pin.
@@ -1277,7 +1304,7 @@ uint8_t ADXL345::getIntOverrunPin() {
  * @see ADXL345_INT_OVERRUN_BIT
  */
 void ADXL345::setIntOverrunPin(uint8_t pin) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_INT_MAP, ADXL345_INT_OVERRUN_BIT, pin);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_INT_MAP, ADXL345_INT_OVERRUN_BIT> >(devAddr, pin);
 }
 
 // INT_SOURCE register
@@ -1297,7 +1324,7 @@ void ADXL345::setIntOverrunPin(uint8_t pin) {
  * @see ADXL345_INT_DATA_READY_BIT
  */
 uint8_t ADXL345::getIntDataReadySource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_DATA_READY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_DATA_READY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get SINGLE_TAP interrupt source flag.
@@ -1306,7 +1333,7 @@ uint8_t ADXL345::getIntDataReadySource() {
  * @see ADXL345_INT_SINGLE_TAP_BIT
  */
 uint8_t ADXL345::getIntSingleTapSource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_SINGLE_TAP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_SINGLE_TAP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get DOUBLE_TAP interrupt source flag.
@@ -1315,7 +1342,7 @@ uint8_t ADXL345::getIntSingleTapSource() {
  * @see ADXL345_INT_DOUBLE_TAP_BIT
  */
 uint8_t ADXL345::getIntDoubleTapSource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_DOUBLE_TAP_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_DOUBLE_TAP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get ACTIVITY interrupt source flag.
@@ -1324,7 +1351,7 @@ uint8_t ADXL345::getIntDoubleTapSource() {
  * @see ADXL345_INT_ACTIVITY_BIT
  */
 uint8_t ADXL345::getIntActivitySource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_ACTIVITY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_ACTIVITY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get INACTIVITY interrupt source flag.
@@ -1333,7 +1360,7 @@ uint8_t ADXL345::getIntActivitySource() {
  * @see ADXL345_INT_INACTIVITY_BIT
  */
 uint8_t ADXL345::getIntInactivitySource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_INACTIVITY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_INACTIVITY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get FREE_FALL interrupt source flag.
@@ -1342,7 +1369,7 @@ uint8_t ADXL345::getIntInactivitySource() {
  * @see ADXL345_INT_FREE_FALL_BIT
  */
 uint8_t ADXL345::getIntFreefallSource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_FREE_FALL_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_FREE_FALL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get WATERMARK interrupt source flag.
@@ -1351,7 +1378,7 @@ uint8_t ADXL345::getIntFreefallSource() {
  * @see ADXL345_INT_WATERMARK_BIT
  */
 uint8_t ADXL345::getIntWatermarkSource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_WATERMARK_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_WATERMARK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get OVERRUN interrupt source flag.
@@ -1360,7 +1387,7 @@ uint8_t ADXL345::getIntWatermarkSource() {
  * @see ADXL345_INT_OVERRUN_BIT
  */
 uint8_t ADXL345::getIntOverrunSource() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_INT_SOURCE, ADXL345_INT_OVERRUN_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_INT_SOURCE, ADXL345_INT_OVERRUN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1375,7 +1402,7 @@ uint8_t ADXL345::getIntOverrunSource() {
  * @see ADXL345_FORMAT_SELFTEST_BIT
  */
 uint8_t ADXL345::getSelfTestEnabled() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SELFTEST_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SELFTEST_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set self-test force enabled.
@@ -1385,7 +1412,7 @@ uint8_t ADXL345::getSelfTestEnabled() {
  * @see ADXL345_FORMAT_SELFTEST_BIT
  */
 void ADXL345::setSelfTestEnabled(uint8_t enabled) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SELFTEST_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SELFTEST_BIT> >(devAddr, enabled);
 }
 /** Get SPI mode setting.
  * A value of 1 in the SPI bit sets the device to 3-wire SPI mode, and a value
@@ -1395,7 +1422,7 @@ void ADXL345::setSelfTestEnabled(uint8_t enabled) {
  * @see ADXL345_FORMAT_SELFTEST_BIT
  */
 uint8_t ADXL345::getSPIMode() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SPIMODE_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SPIMODE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set SPI mode setting.
@@ -1405,7 +1432,7 @@ uint8_t ADXL345::getSPIMode() {
  * @see ADXL345_FORMAT_SELFTEST_BIT
  */
 void ADXL345::setSPIMode(uint8_t mode) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SPIMODE_BIT, mode);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_SPIMODE_BIT> >(devAddr, mode);
 }
 /** Get interrupt mode setting.
  * A value of 0 in the INT_INVERT bit sets the interrupts to active high, and a
@@ -1415,7 +1442,7 @@ void ADXL345::setSPIMode(uint8_t mode) {
  * @see ADXL345_FORMAT_INTMODE_BIT
  */
 uint8_t ADXL345::getInterruptMode() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_INTMODE_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_INTMODE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt mode setting.
@@ -1425,7 +1452,7 @@ uint8_t ADXL345::getInterruptMode() {
  * @see ADXL345_FORMAT_INTMODE_BIT
  */
 void ADXL345::setInterruptMode(uint8_t mode) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_INTMODE_BIT, mode);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_INTMODE_BIT> >(devAddr, mode);
 }
 /** Get full resolution mode setting.
  * When this bit is set to a value of 1, the device is in full resolution mode,
@@ -1438,7 +1465,7 @@ void ADXL345::setInterruptMode(uint8_t mode) {
  * @see ADXL345_FORMAT_FULL_RES_BIT
  */
 uint8_t ADXL345::getFullResolution() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_FULL_RES_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_FULL_RES_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set full resolution mode setting.
@@ -1448,7 +1475,7 @@ uint8_t ADXL345::getFullResolution() {
  * @see ADXL345_FORMAT_FULL_RES_BIT
  */
 void ADXL345::setFullResolution(uint8_t resolution) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_FULL_RES_BIT, resolution);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_FULL_RES_BIT> >(devAddr, resolution);
 }
 /** Get data justification mode setting.
  * A setting of 1 in the justify bit selects left-justified (MSB) mode, and a
@@ -1458,7 +1485,7 @@ void ADXL345::setFullResolution(uint8_t resolution) {
  * @see ADXL345_FORMAT_JUSTIFY_BIT
  */
 uint8_t ADXL345::getDataJustification() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_JUSTIFY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_JUSTIFY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set data justification mode setting.
@@ -1468,7 +1495,7 @@ uint8_t ADXL345::getDataJustification() {
  * @see ADXL345_FORMAT_JUSTIFY_BIT
  */
 void ADXL345::setDataJustification(uint8_t justification) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_JUSTIFY_BIT, justification);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_JUSTIFY_BIT> >(devAddr, justification);
 }
 /** Get data range setting.
  * These bits set the g range as described in Table 21. (That is, 0x0 - 0x3 to
@@ -1479,7 +1506,7 @@ void ADXL345::setDataJustification(uint8_t justification) {
  * @see ADXL345_FORMAT_RANGE_LENGTH
  */
 uint8_t ADXL345::getRange() {
-    I2Cdev::readBits(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_RANGE_BIT, ADXL345_FORMAT_RANGE_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_RANGE_BIT, ADXL345_FORMAT_RANGE_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set data range setting.
@@ -1490,7 +1517,7 @@ uint8_t ADXL345::getRange() {
  * @see ADXL345_FORMAT_RANGE_LENGTH
  */
 void ADXL345::setRange(uint8_t range) {
-    I2Cdev::writeBits(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_RANGE_BIT, ADXL345_FORMAT_RANGE_LENGTH, range);
+    I2Cdev::writeField<I2Cdev_Field<ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_RANGE_BIT, ADXL345_FORMAT_RANGE_LENGTH> >(devAddr, range);
 }
 
 // DATA* registers
@@ -1517,9 +1544,9 @@ void ADXL345::setRange(uint8_t range) {
  */
 void ADXL345::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
     I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, buffer);
-    *x = (((int16_t)buffer[1]) << 8) | buffer[0];
-    *y = (((int16_t)buffer[3]) << 8) | buffer[2];
-    *z = (((int16_t)buffer[5]) << 8) | buffer[4];
+    *x = I2CDEV_LE16(buffer);
+    *y = I2CDEV_LE16(buffer + 2);
+    *z = I2CDEV_LE16(buffer + 4);
 }
 /** Get X-axis accleration measurement.
  * @return 16-bit signed X-axis acceleration value
@@ -1527,7 +1554,7 @@ void ADXL345::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
  */
 int16_t ADXL345::getAccelerationX() {
     I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    return I2CDEV_LE16(buffer);
 }
 /** Get Y-axis accleration measurement.
  * @return 16-bit signed Y-axis acceleration value
@@ -1535,7 +1562,7 @@ int16_t ADXL345::getAccelerationX() {
  */
 int16_t ADXL345::getAccelerationY() {
     I2Cdev::readBytes(devAddr, ADXL345_RA_DATAY0, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    return I2CDEV_LE16(buffer);
 }
 /** Get Z-axis accleration measurement.
  * @return 16-bit signed Z-axis acceleration value
@@ -1543,7 +1570,7 @@ int16_t ADXL345::getAccelerationY() {
  */
 int16_t ADXL345::getAccelerationZ() {
     I2Cdev::readBytes(devAddr, ADXL345_RA_DATAZ0, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    return I2CDEV_LE16(buffer);
 }
 
 // FIFO_CTL register
@@ -1569,7 +1596,7 @@ int16_t ADXL345::getAccelerationZ() {
  * @see ADXL345_FIFO_MODE_LENGTH
  */
 uint8_t ADXL345::getFIFOMode() {
-    I2Cdev::readBits(devAddr, ADXL345_RA_FIFO_CTL, ADXL345_FIFO_MODE_BIT, ADXL345_FIFO_MODE_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<ADXL345_RA_FIFO_CTL, ADXL345_FIFO_MODE_BIT, ADXL345_FIFO_MODE_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FIFO mode.
@@ -1580,7 +1607,7 @@ uint8_t ADXL345::getFIFOMode() {
  * @see ADXL345_FIFO_MODE_LENGTH
  */
 void ADXL345::setFIFOMode(uint8_t mode) {
-    I2Cdev::writeBits(devAddr, ADXL345_RA_FIFO_CTL, ADXL345_FIFO_MODE_BIT, ADXL345_FIFO_MODE_LENGTH, mode);
+    I2Cdev::writeField<I2Cdev_Field<ADXL345_RA_FIFO_CTL, ADXL345_FIFO_MODE_BIT, ADXL345_FIFO_MODE_LENGTH> >(devAddr, mode);
 }
 /** Get FIFO trigger interrupt setting.
  * A value of 0 in the trigger bit links the trigger event of trigger mode to
@@ -1590,7 +1617,7 @@ void ADXL345::setFIFOMode(uint8_t mode) {
  * @see ADXL345_FIFO_TRIGGER_BIT
  */
 uint8_t ADXL345::getFIFOTriggerInterruptPin() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_FIFO_CTL, ADXL345_FIFO_TRIGGER_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_FIFO_CTL, ADXL345_FIFO_TRIGGER_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FIFO trigger interrupt pin setting.
@@ -1599,7 +1626,7 @@ uint8_t ADXL345::getFIFOTriggerInterruptPin() {
  * @see ADXL345_FIFO_TRIGGER_BIT
  */
 void ADXL345::setFIFOTriggerInterruptPin(uint8_t interrupt) {
-    I2Cdev::writeBit(devAddr, ADXL345_RA_FIFO_CTL, ADXL345_FIFO_TRIGGER_BIT, interrupt);
+    I2Cdev::writeField<I2Cdev_Bit<ADXL345_RA_FIFO_CTL, ADXL345_FIFO_TRIGGER_BIT> >(devAddr, interrupt);
 }
 /** Get FIFO samples setting.
  * The function of these bits depends on the FIFO mode selected (see Table 23).
@@ -1621,7 +1648,7 @@ void ADXL345::setFIFOTriggerInterruptPin(uint8_t interrupt) {
  * @see ADXL345_FIFO_SAMPLES_LENGTH
  */
 uint8_t ADXL345::getFIFOSamples() {
-    I2Cdev::readBits(devAddr, ADXL345_RA_FIFO_CTL, ADXL345_FIFO_SAMPLES_BIT, ADXL345_FIFO_SAMPLES_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<ADXL345_RA_FIFO_CTL, ADXL345_FIFO_SAMPLES_BIT, ADXL345_FIFO_SAMPLES_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FIFO samples setting.
@@ -1633,7 +1660,7 @@ uint8_t ADXL345::getFIFOSamples() {
  * @see ADXL345_FIFO_SAMPLES_LENGTH
  */
 void ADXL345::setFIFOSamples(uint8_t size) {
-    I2Cdev::writeBits(devAddr, ADXL345_RA_FIFO_CTL, ADXL345_FIFO_SAMPLES_BIT, ADXL345_FIFO_SAMPLES_LENGTH, size);
+    I2Cdev::writeField<I2Cdev_Field<ADXL345_RA_FIFO_CTL, ADXL345_FIFO_SAMPLES_BIT, ADXL345_FIFO_SAMPLES_LENGTH> >(devAddr, size);
 }
 
 // FIFO_STATUS register
@@ -1646,7 +1673,7 @@ void ADXL345::setFIFOSamples(uint8_t size) {
  * @see ADXL345_FIFOSTAT_TRIGGER_BIT
  */
 bool ADXL345::getFIFOTriggerOccurred() {
-    I2Cdev::readBit(devAddr, ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_TRIGGER_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_TRIGGER_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get FIFO length.
@@ -1663,6 +1690,99 @@ bool ADXL345::getFIFOTriggerOccurred() {
  * @see ADXL345_FIFOSTAT_LENGTH_LENGTH
  */
 uint8_t ADXL345::getFIFOLength() {
-    I2Cdev::readBits(devAddr, ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_LENGTH_BIT, ADXL345_FIFOSTAT_LENGTH_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_LENGTH_BIT, ADXL345_FIFOSTAT_LENGTH_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
+
+// FIFO streaming
+
+/** Configure the FIFO for continuous streaming.
+ * Sets the output data rate, puts the FIFO in stream mode with the given
+ * watermark in a single FIFO_CTL write, routes the WATERMARK interrupt to
+ * the chosen INT pin and enables measurement. Auto-sleep is disabled since
+ * it would drop the output rate. Samples are then collected with
+ * serviceStream(). At 3200Hz a 400kHz bus is needed to keep up.
+ * @param rate Output data rate (ADXL345_RATE_*)
+ * @param watermark FIFO entries that raise WATERMARK (1-31)
+ * @param intPin ADXL345_INT1_PIN or ADXL345_INT2_PIN
+ * @return True if the parameters were valid
+ * @see serviceStream()
+ */
+bool ADXL345::startStream(uint8_t rate, uint8_t watermark, uint8_t intPin) {
+    if (watermark == 0 || watermark >= ADXL345_FIFO_DEPTH) return false;
+    setMeasureEnabled(false);
+    setAutoSleepEnabled(false);
+    setRate(rate);
+    streamPeriod = (625UL << (15 - (rate & 0x0F))) >> 1; // 3200Hz halved per step below ADXL345_RATE_3200
+    I2Cdev::writeByte(devAddr, ADXL345_RA_FIFO_CTL, (ADXL345_FIFO_MODE_STREAM << 6) | watermark);
+    setIntWatermarkPin(intPin);
+    setIntWatermarkEnabled(true);
+    streamFlag = true; // drain once right away
+    setMeasureEnabled(true);
+    return true;
+}
+/** Stop streaming and return the FIFO to bypass mode. */
+void ADXL345::stopStream() {
+    setIntWatermarkEnabled(false);
+    setFIFOMode(ADXL345_FIFO_MODE_BYPASS);
+}
+/** Gate serviceStream() on the INT pin carrying WATERMARK.
+ * With interrupt set, an ISR on the pin's active edge must call
+ * notifyWatermark(); otherwise the pin level is polled. The active level
+ * follows the INT_INVERT setting at the time of this call.
+ * @param pin Digital pin wired to the INT output, or -1 to drain on every call
+ * @param interrupt True if an ISR calls notifyWatermark()
+ */
+void ADXL345::setStreamPin(int8_t pin, bool interrupt) {
+    streamPin = pin;
+    streamInterrupt = interrupt;
+    streamActiveHigh = getInterruptMode() == 0;
+    streamFlag = true;
+}
+/** Flag the watermark as reached; call from the INT pin interrupt handler. */
+void ADXL345::notifyWatermark() {
+    streamFlag = true;
+}
+/** Check whether the FIFO has reached the watermark.
+ * @return True if a drain is due (always true without a stream pin)
+ */
+bool ADXL345::isWatermarkPending() {
+    if (streamPin < 0) return true;
+    if (streamInterrupt) return streamFlag;
+    return digitalRead(streamPin) == (streamActiveHigh ? HIGH : LOW);
+}
+/** Drain the FIFO into a sample ring.
+ * FIFO_STATUS is read once and exactly that many entries are popped, one
+ * 6-byte DATAX0..DATAZ1 burst each (the FIFO advances one entry per data
+ * read, so entries cannot be merged into a longer transfer). Entries that
+ * arrive during the drain are left for the next call. If the ring is full
+ * the entry is still popped to keep the FIFO moving and ring->dropped is
+ * incremented; a full FIFO on entry bumps ring->overruns. The newest entry
+ * is stamped with the completion time of the FIFO_STATUS read and older
+ * ones are spaced back from it by the output data rate period (to within
+ * one period; exact timing needs a data-ready interrupt instead).
+ * @param ring Destination ring
+ * @return Number of entries popped from the FIFO
+ */
+uint8_t ADXL345::serviceStream(ADXL345_SampleRing *ring) {
+    if (!isWatermarkPending()) return 0;
+    streamFlag = false; // cleared before the drain so a new edge is not lost
+
+    uint8_t entries = getFIFOLength();
+    uint32_t newest = I2Cdev::getReadTimestamp();
+    if (entries >= ADXL345_FIFO_DEPTH) ring -> overruns++;
+    for (uint8_t i = 0; i < entries; i++) {
+        if (I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, buffer) != 6) return i;
+        ADXL345_Sample *sample = ring -> reserve();
+        if (!sample) continue;
+        sample -> x = I2CDEV_LE16(buffer);
+        sample -> y = I2CDEV_LE16(buffer + 2);
+        sample -> z = I2CDEV_LE16(buffer + 4);
+        sample -> timestamp = newest - (uint32_t)(entries - 1 - i) * streamPeriod;
+        ring -> commit();
+    }
+    // the level stays asserted if the FIFO refilled past the watermark during
+    // the drain, in which case no new edge will come
+    if (streamInterrupt && digitalRead(streamPin) == (streamActiveHigh ? HIGH : LOW)) streamFlag = true;
+    return entries;
+}
@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp streamed samples with their reconstructed sample time
+//     2026-10-14 - FIFO streaming into a caller sample ring
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -163,6 +165,23 @@ THE SOFTWARE.
 #define ADXL345_FIFOSTAT_LENGTH_BIT         5
 #define ADXL345_FIFOSTAT_LENGTH_LENGTH      6
 
+#define ADXL345_INT1_PIN            0
+#define ADXL345_INT2_PIN            1
+
+#define ADXL345_FIFO_DEPTH          32
+
+/** One X/Y/Z acceleration sample. */
+typedef struct ADXL345_Sample {
+    int16_t x, y, z;
+    uint32_t timestamp;         // micros() the sample was taken (reconstructed from the output rate)
+} ADXL345_Sample;
+
+/** Caller-owned ring of samples filled by ADXL345::serviceStream().
+ * overruns counts drains that found the FIFO full (data may be lost).
+ * @see I2Cdev_Ring
+ */
+typedef I2Cdev_Ring<ADXL345_Sample> ADXL345_SampleRing;
+
 class ADXL345 {
     public:
         ADXL345();
@@ -353,9 +372,26 @@ class ADXL345 {
         bool getFIFOTriggerOccurred();
         uint8_t getFIFOLength();
 
+        // FIFO streaming
+        bool startStream(uint8_t rate, uint8_t watermark=16, uint8_t intPin=ADXL345_INT1_PIN);
+        void stopStream();
+        void setStreamPin(int8_t pin, bool interrupt=false);
+        void notifyWatermark();
+        bool isWatermarkPending();
+        uint8_t serviceStream(ADXL345_SampleRing *ring);
+
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        int8_t streamPin;
+        bool streamInterrupt;
+        bool streamActiveHigh;
+        volatile bool streamFlag;
+        uint32_t streamPeriod;      // microseconds between FIFO entries
+        #ifdef I2CDEV_REGISTER_CACHE
+            I2Cdev_CacheRange cacheConfig;      // THRESH_TAP .. FIFO_CTL
+            uint8_t cacheConfigValues[28];
+        #endif
 };
 
 #endif /* _ADXL345_H_ */
@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - pipelined single-measurement mode with DRDY support
 //     2011-08-27 - initial release
 
 /* ============================================
@@ -37,6 +38,10 @@ THE SOFTWARE.
  */
 AK8975::AK8975() {
     devAddr = AK8975_DEFAULT_ADDRESS;
+    pipeDrdyPin = -1;
+    pipeInterrupt = false;
+    pipeActive = false;
+    pipeFlag = false;
 }
 
 /** Specific address constructor.
@@ -46,6 +51,10 @@ AK8975::AK8975() {
  */
 AK8975::AK8975(uint8_t address) {
     devAddr = address;
+    pipeDrdyPin = -1;
+    pipeInterrupt = false;
+    pipeActive = false;
+    pipeFlag = false;
 }
 
 /** Power on and prepare for general usage.
@@ -91,27 +100,27 @@ void AK8975::getHeading(int16_t *x, int16_t *y, int16_t *z) {
     I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
     delay(10);
     I2Cdev::readBytes(devAddr, AK8975_RA_HXL, 6, buffer);
-    *x = (((int16_t)buffer[1]) << 8) | buffer[0];
-    *y = (((int16_t)buffer[3]) << 8) | buffer[2];
-    *z = (((int16_t)buffer[5]) << 8) | buffer[4];
+    *x = I2CDEV_LE16(buffer);
+    *y = I2CDEV_LE16(buffer + 2);
+    *z = I2CDEV_LE16(buffer + 4);
 }
 int16_t AK8975::getHeadingX() {
     I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
     delay(10);
     I2Cdev::readBytes(devAddr, AK8975_RA_HXL, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    return I2CDEV_LE16(buffer);
 }
 int16_t AK8975::getHeadingY() {
     I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
     delay(10);
     I2Cdev::readBytes(devAddr, AK8975_RA_HYL, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    return I2CDEV_LE16(buffer);
 }
 int16_t AK8975::getHeadingZ() {
     I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
     delay(10);
     I2Cdev::readBytes(devAddr, AK8975_RA_HZL, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    return I2CDEV_LE16(buffer);
 }
 
 // ST2 register
@@ -124,6 +133,84 @@ bool AK8975::getDataError() {
     return buffer[0];
 }
 
+// Pipelined single measurements
+
+/** Start pipelined single-measurement sampling.
+ * The first measurement is triggered here. getHeadingPipelined() then reads
+ * each result and triggers the next measurement in one combined transaction
+ * (I2Cdev::executeBatch(), joined by a repeated START where the bus allows),
+ * so the sensor converts while the host does other work and the output rate
+ * is limited only by the single-shot conversion time.
+ * DRDY (active high) stays asserted until the data is read, so it can be
+ * polled or used as a RISING edge interrupt; without it the 9ms worst-case
+ * conversion time is assumed.
+ * @param drdyPin Digital pin wired to DRDY, or -1 to use the conversion time
+ * @param interrupt True if an ISR on DRDY calls notifyDataReady()
+ * @return True if the first measurement was triggered
+ * @see getHeadingPipelined()
+ */
+bool AK8975::startPipeline(int8_t drdyPin, bool interrupt) {
+    pipeDrdyPin = drdyPin;
+    pipeInterrupt = interrupt;
+    pipeFlag = false;
+    if (drdyPin >= 0 && !interrupt) pinMode(drdyPin, INPUT);
+    pipeActive = I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
+    pipeTriggered = micros();
+    return pipeActive;
+}
+/** Stop pipelined sampling; the measurement in flight is left unread. */
+void AK8975::stopPipeline() {
+    pipeActive = false;
+}
+/** Flag a completed measurement; call from the DRDY interrupt handler. */
+void AK8975::notifyDataReady() {
+    pipeFlag = true;
+}
+/** Check whether the measurement in flight has completed.
+ * @return True if getHeadingPipelined() will return a new sample
+ */
+bool AK8975::isPipelineReady() {
+    if (!pipeActive) return false;
+    if (pipeDrdyPin < 0) return micros() - pipeTriggered >= AK8975_SINGLE_MEASURE_US;
+    if (pipeInterrupt) return pipeFlag;
+    return digitalRead(pipeDrdyPin) == HIGH;
+}
+/** Read the finished measurement and trigger the next one.
+ * One batch reads HXL..ST2 (reading ST2 releases the data protection and
+ * reports overflow) and writes CNTL = single measurement.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return True if a new valid sample was returned; false if none was ready
+ *         yet, the read failed or the sensor reported overflow/data error
+ */
+bool AK8975::getHeadingPipelined(int16_t *x, int16_t *y, int16_t *z) {
+    if (!isPipelineReady()) return false;
+    pipeFlag = false;
+    uint8_t data[7];
+    uint8_t trigger = AK8975_MODE_SINGLE;
+    I2Cdev_Transaction segments[2];
+    segments[0].devAddr = devAddr;
+    segments[0].regAddr = AK8975_RA_HXL;
+    segments[0].flags = I2CDEV_TXN_READ;
+    segments[0].length = 7;
+    segments[0].data = data;
+    segments[0].callback = 0;
+    segments[1].devAddr = devAddr;
+    segments[1].regAddr = AK8975_RA_CNTL;
+    segments[1].flags = I2CDEV_TXN_WRITE;
+    segments[1].length = 1;
+    segments[1].data = &trigger;
+    segments[1].callback = 0;
+    uint8_t ok = I2Cdev::executeBatch(segments, 2);
+    pipeTriggered = micros();
+    if (ok != 2) return false;
+    *x = (((int16_t)data[1]) << 8) | data[0];
+    *y = (((int16_t)data[3]) << 8) | data[2];
+    *z = (((int16_t)data[5]) << 8) | data[4];
+    return (data[6] & ((1 << AK8975_ST2_HOFL_BIT) | (1 << AK8975_ST2_DERR_BIT))) == 0;
+}
+
 // CNTL register
 uint8_t AK8975::getMode() {
     I2Cdev::readBits(devAddr, AK8975_RA_CNTL, AK8975_CNTL_MODE_BIT, AK8975_CNTL_MODE_LENGTH, buffer);
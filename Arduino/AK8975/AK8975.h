@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - pipelined single-measurement mode with DRDY support
 //     2011-08-27 - initial release
 
 /* ============================================
@@ -78,6 +79,8 @@ THE SOFTWARE.
 
 #define AK8975_I2CDIS_BIT         0
 
+#define AK8975_SINGLE_MEASURE_US    9000 // worst-case single-measurement time
+
 class AK8975 {
     public:
         AK8975();
@@ -105,6 +108,13 @@ class AK8975 {
         bool getOverflowStatus();
         bool getDataError();
 
+        // pipelined single measurements
+        bool startPipeline(int8_t drdyPin=-1, bool interrupt=false);
+        void stopPipeline();
+        void notifyDataReady();
+        bool isPipelineReady();
+        bool getHeadingPipelined(int16_t *x, int16_t *y, int16_t *z);
+
         // CNTL register
         uint8_t getMode();
         void setMode(uint8_t mode);
@@ -130,6 +140,11 @@ class AK8975 {
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        int8_t pipeDrdyPin;
+        bool pipeInterrupt;
+        bool pipeActive;
+        volatile bool pipeFlag;
+        uint32_t pipeTriggered;
 };
 
 #endif /* _AK8975_H_ */
\ No newline at end of file
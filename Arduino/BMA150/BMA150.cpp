@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp data-ready samples with their read completion time
+//     2026-10-14 - add combined axes/new-data/temperature burst and data-ready interrupt reads
 //     2012-01-18 - initial release
 
 /* ============================================
@@ -37,6 +39,7 @@ THE SOFTWARE.
  */
 BMA150::BMA150() {
     devAddr = BMA150_DEFAULT_ADDRESS;
+    dataReadyPin = -1;
 }
 
 /** Specific address constructor.
@@ -46,6 +49,7 @@ BMA150::BMA150() {
  */
 BMA150::BMA150(uint8_t address) {
     devAddr = address;
+    dataReadyPin = -1;
 }
 
 /** Power on and prepare for general usage. This sets the full scale range of 
@@ -96,9 +100,9 @@ uint8_t BMA150::getDeviceID() {
 
 void BMA150::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
     I2Cdev::readBytes(devAddr, BMA150_RA_X_AXIS_LSB, 6, buffer);
-    *x = ((((int16_t)buffer[1]) << 8) | buffer[0]) >> 6;
-    *y = ((((int16_t)buffer[3]) << 8) | buffer[2]) >> 6;
-    *z = ((((int16_t)buffer[5]) << 8) | buffer[4]) >> 6;
+    *x = I2CDEV_LE16(buffer) >> 6;
+    *y = I2CDEV_LE16(buffer + 2) >> 6;
+    *z = I2CDEV_LE16(buffer + 4) >> 6;
 }
 
 /** Get X-axis accelerometer reading.
@@ -107,7 +111,7 @@ void BMA150::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
  */
 int16_t BMA150::getAccelerationX() {
     I2Cdev::readBytes(devAddr, BMA150_RA_X_AXIS_LSB, 2, buffer);
-    return ((((int16_t)buffer[1]) << 8) | buffer[0]) >> 6;
+    return I2CDEV_LE16(buffer) >> 6;
 }
 
 /** Get Y-axis accelerometer reading.
@@ -116,7 +120,7 @@ int16_t BMA150::getAccelerationX() {
  */
 int16_t BMA150::getAccelerationY() {
     I2Cdev::readBytes(devAddr, BMA150_RA_Y_AXIS_LSB, 2, buffer);
-    return ((((int16_t)buffer[1]) << 8) | buffer[0]) >> 6;
+    return I2CDEV_LE16(buffer) >> 6;
 }
 
 /** Get Z-axis accelerometer reading.
@@ -125,7 +129,7 @@ int16_t BMA150::getAccelerationY() {
  */
 int16_t BMA150::getAccelerationZ() {
     I2Cdev::readBytes(devAddr, BMA150_RA_Z_AXIS_LSB, 2, buffer);
-    return ((((int16_t)buffer[1]) << 8) | buffer[0]) >> 6;
+    return I2CDEV_LE16(buffer) >> 6;
 }
 
 /** Check for new X axis acceleration data.
@@ -155,6 +159,62 @@ bool BMA150::newDataZ() {
 	return buffer[0];
 }
 				
+/** Get all three axes, their new data flags and the temperature in one
+ * burst read (X LSB through TEMP, 7 bytes), instead of one transaction for
+ * the axes and more for each flag. A flag is set when its axis was updated
+ * since the previous read of it.
+ * @param x 16-bit signed integer container for X-axis acceleration
+ * @param y 16-bit signed integer container for Y-axis acceleration
+ * @param z 16-bit signed integer container for Z-axis acceleration
+ * @param temperature Container for the temperature (same scale as getTemperature())
+ * @return BMA150_NEW_DATA_* flags of the axes that were fresh (0 on read failure)
+ * @see BMA150_RA_X_AXIS_LSB
+ */
+uint8_t BMA150::getMotionTemperature(int16_t* x, int16_t* y, int16_t* z, int8_t* temperature) {
+    if (I2Cdev::readBytes(devAddr, BMA150_RA_X_AXIS_LSB, 7, buffer) != 7) return 0;
+    *x = I2CDEV_LE16(buffer) >> 6;
+    *y = I2CDEV_LE16(buffer + 2) >> 6;
+    *z = I2CDEV_LE16(buffer + 4) >> 6;
+    *temperature = buffer[6];
+    return ((buffer[0] >> BMA150_X_NEW_DATA_BIT) & 1)
+        | (((buffer[2] >> BMA150_Y_NEW_DATA_BIT) & 1) << 1)
+        | (((buffer[4] >> BMA150_Z_NEW_DATA_BIT) & 1) << 2);
+}
+
+/** Use the INT output as a data-ready line.
+ * Enables the new data interrupt (and disables latching, so INT follows
+ * each sample); getMotionTemperatureIfReady() then only reads the device
+ * while INT is high. Pass -1 to go back to checking the new data flags.
+ * @param pin Arduino pin wired to INT, -1 for none
+ * @see setNewDataInt()
+ */
+void BMA150::setDataReadyPin(int8_t pin) {
+    dataReadyPin = pin;
+    if (pin >= 0) {
+        pinMode(pin, INPUT);
+        setLatchInt(false);
+    }
+    setNewDataInt(pin >= 0);
+}
+
+/** Read a fresh sample only.
+ * With a data-ready pin set this costs no bus traffic until INT is high;
+ * otherwise the combined burst is read and rejected unless all three axes
+ * carry their new data flag. In both cases a fresh sample is one
+ * transaction, so samples can be taken at the full configured bandwidth.
+ * @param timestamp Optional container for the micros() time the sample read completed
+ * @return True if the containers were filled with a new sample
+ * @see getMotionTemperature()
+ * @see I2Cdev::getReadTimestamp()
+ */
+bool BMA150::getMotionTemperatureIfReady(int16_t* x, int16_t* y, int16_t* z, int8_t* temperature, uint32_t* timestamp) {
+    if (dataReadyPin >= 0 && digitalRead(dataReadyPin) != HIGH) return false;
+    uint8_t fresh = getMotionTemperature(x, y, z, temperature);
+    if (dataReadyPin >= 0 ? fresh == 0 : fresh != BMA150_NEW_DATA_ALL) return false;
+    if (timestamp) *timestamp = I2Cdev::getReadTimestamp();
+    return true;
+}
+
 // TEMP register
 /** Check for current temperature
  * @return Current Temperature in 0.5C increments from -30C at 00h
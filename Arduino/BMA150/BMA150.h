@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp data-ready samples with their read completion time
+//     2026-10-14 - add combined axes/new-data/temperature burst and data-ready interrupt reads
 //     2012-01-18 - initial release
 
 /* ============================================
@@ -143,6 +145,12 @@ THE SOFTWARE.
 #define BMA150_BW_750HZ                5
 #define BMA150_BW_1500HZ               6
 
+/* new data flags returned by getMotionTemperature() */
+#define BMA150_NEW_DATA_X              0x01
+#define BMA150_NEW_DATA_Y              0x02
+#define BMA150_NEW_DATA_Z              0x04
+#define BMA150_NEW_DATA_ALL            0x07
+
 /* mode settings */
 #define BMA150_MODE_NORMAL             0
 #define BMA150_MODE_SLEEP              1
@@ -169,6 +177,9 @@ class BMA150 {
         bool newDataX();
         bool newDataY();
         bool newDataZ();
+        uint8_t getMotionTemperature(int16_t* x, int16_t* y, int16_t* z, int8_t* temperature);
+        void setDataReadyPin(int8_t pin);
+        bool getMotionTemperatureIfReady(int16_t* x, int16_t* y, int16_t* z, int8_t* temperature, uint32_t* timestamp=0);
                 
         // TEMP register
         int8_t getTemperature();
@@ -273,8 +284,9 @@ class BMA150 {
         
         private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[7];
         uint8_t mode;
+        int8_t dataReadyPin;
 };
 
 #endif /* _BMA150_H_ */
\ No newline at end of file
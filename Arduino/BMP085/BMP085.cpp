@@ -4,6 +4,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp fetched conversions with their completion time
+//     2026-10-14 - add integer compensation with precomputed terms and table-based altitude
+//     2026-10-14 - add non-blocking start/isReady/fetch API and T/P pipeline
 //     2012-06-28 - initial release, dynamically built
 
 /* ============================================
@@ -32,12 +35,43 @@ THE SOFTWARE.
 
 #include "BMP085.h"
 
+#if !defined(__arm__) && I2CDEV_IMPLEMENTATION != I2CDEV_HOST_SIMULATION
+    #include <avr/pgmspace.h>
+#else
+    #define PROGMEM
+    #ifndef pgm_read_dword
+        #define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+    #endif
+#endif
+
+// altitude in cm for pressure ratios p/p0 = 0.25 .. 1.125 in steps of 1/64,
+// from the datasheet formula 44330 * (1 - (p/p0)^(1/5.255))
+#define BMP085_ALTITUDE_TABLE_START 8192    // 0.25 in Q15
+#define BMP085_ALTITUDE_TABLE_SHIFT 9       // 1/64 in Q15 = 1 << 9
+#define BMP085_ALTITUDE_TABLE_SIZE  57
+static const int32_t BMP085_altitudeTable[BMP085_ALTITUDE_TABLE_SIZE] PROGMEM = {
+    1027933, 988421, 950749, 914735, 880225, 847085, 815199, 784465,
+    754795, 726110, 698340, 671421, 645298, 619919, 595240, 571217,
+    547815, 524997, 502732, 480992, 459749, 438978, 418657, 398764,
+    379280, 360187, 341467, 323105, 305085, 287394, 270018, 252946,
+    236165, 219665, 203435, 187466, 171749, 156274, 141035, 126022,
+    111228, 96647, 82271, 68095, 54112, 40316, 26702, 13265,
+    0, -13099, -26035, -38814, -51439, -63915, -76245, -88433,
+    -100484
+};
+
 /**
  * Default constructor, uses default I2C device address.
  * @see BMP085_DEFAULT_ADDRESS
  */
 BMP085::BMP085() {
     devAddr = BMP085_DEFAULT_ADDRESS;
+    eocPin = -1;
+    conversionPending = false;
+    lastTemperature = 0;
+    lastPressure = 0;
+    lastTemperatureMicros = lastPressureMicros = 0;
+    setPipeline(BMP085_MODE_PRESSURE_3, 1);
 }
 
 /**
@@ -47,6 +81,12 @@ BMP085::BMP085() {
  */
 BMP085::BMP085(uint8_t address) {
     devAddr = address;
+    eocPin = -1;
+    conversionPending = false;
+    lastTemperature = 0;
+    lastPressure = 0;
+    lastTemperatureMicros = lastPressureMicros = 0;
+    setPipeline(BMP085_MODE_PRESSURE_3, 1);
 }
 
 /**
@@ -82,6 +122,10 @@ void BMP085::loadCalibration() {
     mc = ((int16_t)buf2[18] << 8) + buf2[19];
     md = ((int16_t)buf2[20] << 8) + buf2[21];
     calibrationLoaded = true;
+
+    // derived constants that never change
+    ac1x4 = (int32_t)ac1 * 4;
+    mcx2048 = (int32_t)mc << 11;
 }
 
 #ifdef BMP085_INCLUDE_INDIVIDUAL_CALIBRATION_ACCESS
@@ -175,20 +219,20 @@ uint32_t BMP085::getMeasurement3() {
 }
 uint8_t BMP085::getMeasureDelayMilliseconds(uint8_t mode) {
     if (mode == 0) mode = measureMode;
-    if (measureMode == 0x2E) return 5;
-    else if (measureMode == 0x34) return 5;
-    else if (measureMode == 0x74) return 8;
-    else if (measureMode == 0xB4) return 14;
-    else if (measureMode == 0xF4) return 26;
+    if (mode == 0x2E) return 5;
+    else if (mode == 0x34) return 5;
+    else if (mode == 0x74) return 8;
+    else if (mode == 0xB4) return 14;
+    else if (mode == 0xF4) return 26;
     return 0; // invalid mode
 }
 uint16_t BMP085::getMeasureDelayMicroseconds(uint8_t mode) {
     if (mode == 0) mode = measureMode;
-    if (measureMode == 0x2E) return 4500;
-    else if (measureMode == 0x34) return 4500;
-    else if (measureMode == 0x74) return 7500;
-    else if (measureMode == 0xB4) return 13500;
-    else if (measureMode == 0xF4) return 25500;
+    if (mode == 0x2E) return 4500;
+    else if (mode == 0x34) return 4500;
+    else if (mode == 0x74) return 7500;
+    else if (mode == 0xB4) return 13500;
+    else if (mode == 0xF4) return 25500;
     return 0; // invalid mode
 }
 
@@ -206,11 +250,33 @@ float BMP085::getTemperatureC() {
         B5 = X1 + X2
         T = (B5 + 8) / 2^4
     */
-    int32_t ut = getRawTemperature();
+    return (float)compensateTemperature(getRawTemperature()) / 10.0f;
+}
+
+/**
+ * Apply the datasheet temperature compensation and cache B5, which the
+ * pressure compensation needs.
+ * @param ut Raw temperature reading
+ * @return Temperature in units of 0.1 degrees Celsius
+ */
+int16_t BMP085::compensateTemperature(int32_t ut) {
     int32_t x1 = ((ut - (int32_t)ac6) * (int32_t)ac5) >> 15;
-    int32_t x2 = ((int32_t)mc << 11) / (x1 + md);
+    int32_t x2 = mcx2048 / (x1 + md);
     b5 = x1 + x2;
-    return (float)((b5 + 8) >> 4) / 10.0f;
+
+    // everything in the pressure formula that depends only on B5, so each
+    // pressure sample until the next temperature costs one division
+    int32_t b6 = b5 - 4000;
+    int32_t b6sq = (b6 * b6) >> 12;
+    x1 = ((int32_t)b2 * b6sq) >> 11;
+    x2 = ((int32_t)ac2 * b6) >> 11;
+    pressureB3 = ac1x4 + x1 + x2;
+    x1 = ((int32_t)ac3 * b6) >> 13;
+    x2 = ((int32_t)b1 * b6sq) >> 16;
+    int32_t x3 = ((x1 + x2) + 2) >> 2;
+    pressureB4 = ((uint32_t)ac4 * (uint32_t)(x3 + 32768)) >> 15;
+
+    return (b5 + 8) >> 4;
 }
 
 float BMP085::getTemperatureF() {
@@ -243,30 +309,226 @@ float BMP085::getPressure() {
         X2 = (-7357 * p) / 2^16
         p = p + (X1 + X2 + 3791) / 2^4
     */
-    uint32_t up = getRawPressure();
-    uint8_t oss = (measureMode & 0xC0) >> 6;
+    return compensatePressure(getRawPressure(), (measureMode & 0xC0) >> 6);
+}
+
+/**
+ * Apply the datasheet pressure compensation using the cached B5 from the
+ * most recent temperature reading.
+ * @param up Raw pressure reading, already shifted down by 8 - oss
+ * @param oss Oversampling setting the reading was taken with (0-3)
+ * @return Pressure in Pascals (Pa)
+ */
+int32_t BMP085::compensatePressure(uint32_t up, uint8_t oss) {
     int32_t p;
-    int32_t b6 = b5 - 4000;
-    int32_t x1 = ((int32_t)b2 * ((b6 * b6) >> 12)) >> 11;
-    int32_t x2 = ((int32_t)ac2 * b6) >> 11;
-    int32_t x3 = x1 + x2;
-    int32_t b3 = ((((int32_t)ac1 * 4 + x3) << oss) + 2) >> 2;
-    x1 = ((int32_t)ac3 * b6) >> 13;
-    x2 = ((int32_t)b1 * ((b6 * b6) >> 12)) >> 16;
-    x3 = ((x1 + x2) + 2) >> 2;
-    uint32_t b4 = ((uint32_t)ac4 * (uint32_t)(x3 + 32768)) >> 15;
+    int32_t b3 = ((pressureB3 << oss) + 2) >> 2;
     uint32_t b7 = ((uint32_t)up - b3) * (uint32_t)(50000UL >> oss);
     if (b7 < 0x80000000) {
-        p = (b7 << 1) / b4;
+        p = (b7 << 1) / pressureB4;
     } else {
-        p = (b7 / b4) << 1;
+        p = (b7 / pressureB4) << 1;
     }
-    x1 = (p >> 8) * (p >> 8);
+    int32_t x1 = (p >> 8) * (p >> 8);
     x1 = (x1 * 3038) >> 16;
-    x2 = (-7357 * p) >> 16;
+    int32_t x2 = (-7357 * p) >> 16;
     return p + ((x1 + x2 + (int32_t)3791) >> 4);
 }
-
 float BMP085::getAltitude(float pressure, float seaLevelPressure) {
     return 44330 * (1.0 - pow(pressure / seaLevelPressure, 0.1903));
-}
\ No newline at end of file
+}
+
+/* integer compensation methods */
+
+/**
+ * Read and compensate the current temperature conversion without floating
+ * point. Also refreshes the B5-dependent pressure terms.
+ * @return Temperature in units of 0.1 degrees Celsius
+ */
+int16_t BMP085::getTemperatureDeciC() {
+    return compensateTemperature(getRawTemperature());
+}
+
+/**
+ * Read and compensate the current pressure conversion without floating
+ * point, using the terms from the last temperature reading.
+ * @return Pressure in Pascals (Pa)
+ */
+int32_t BMP085::getPressurePa() {
+    return compensatePressure(getRawPressure(), (measureMode & 0xC0) >> 6);
+}
+
+/**
+ * Approximate altitude without floating point or pow(), by linear
+ * interpolation in a 57-entry table of the barometric formula. Error is
+ * within 0.6 m up to 2 km and about 3 m at 10 km, comparable to the sensor's
+ * own noise; pressure ratios outside 0.25 .. 1.125 are clamped.
+ * @param pressure Pressure in Pa
+ * @param seaLevelPressure Reference pressure in Pa
+ * @return Altitude in centimeters
+ */
+int32_t BMP085::getAltitudeCm(int32_t pressure, int32_t seaLevelPressure) {
+    int32_t ratio = (int32_t)(((uint32_t)pressure << 15) / (uint32_t)seaLevelPressure) - BMP085_ALTITUDE_TABLE_START;
+    if (ratio < 0) ratio = 0;
+    uint8_t index = ratio >> BMP085_ALTITUDE_TABLE_SHIFT;
+    if (index >= BMP085_ALTITUDE_TABLE_SIZE - 1) return (int32_t)pgm_read_dword(&BMP085_altitudeTable[BMP085_ALTITUDE_TABLE_SIZE - 1]);
+    int32_t a0 = (int32_t)pgm_read_dword(&BMP085_altitudeTable[index]);
+    int32_t a1 = (int32_t)pgm_read_dword(&BMP085_altitudeTable[index + 1]);
+    int32_t frac = ratio & ((1 << BMP085_ALTITUDE_TABLE_SHIFT) - 1);
+    return a0 + (((a1 - a0) * frac) >> BMP085_ALTITUDE_TABLE_SHIFT);
+}
+
+/* non-blocking conversion methods */
+
+/**
+ * Start a temperature conversion and return immediately.
+ * @see isReady()
+ * @see fetch()
+ */
+void BMP085::startTemperature() {
+    setControl(BMP085_MODE_TEMPERATURE);
+    conversionStart = micros();
+    conversionPending = true;
+}
+
+/**
+ * Start a pressure conversion and return immediately. The result is
+ * compensated with the B5 value from the last temperature fetched.
+ * @param mode Pressure mode (BMP085_MODE_PRESSURE_0 .. BMP085_MODE_PRESSURE_3)
+ * @see isReady()
+ * @see fetch()
+ */
+void BMP085::startPressure(uint8_t mode) {
+    setControl(mode);
+    conversionStart = micros();
+    conversionPending = true;
+}
+
+/**
+ * Use the EOC (end of conversion) pin for isReady() instead of the
+ * worst-case conversion time. EOC goes high when the result is ready.
+ * @param pin Digital pin wired to EOC, or -1 to go back to timing
+ */
+void BMP085::setEocPin(int8_t pin) {
+    eocPin = pin;
+    if (pin >= 0) pinMode(pin, INPUT);
+}
+
+/**
+ * Check whether the conversion started last has finished, without any
+ * bus traffic.
+ * @return True if a conversion is pending and its result can be fetched
+ */
+bool BMP085::isReady() {
+    if (!conversionPending) return false;
+    if (eocPin >= 0) return digitalRead(eocPin) == HIGH;
+    return micros() - conversionStart >= getMeasureDelayMicroseconds();
+}
+
+/**
+ * Read and compensate the result of the pending conversion if it is ready.
+ * Temperature results refresh the cached B5 used by later pressure results.
+ * The result is stamped with the end of its conversion time, or with the
+ * completion of the result read if that came first (EOC pin in use).
+ * @return True if a new result was stored
+ * @see getLastTemperatureC()
+ * @see getLastPressure()
+ */
+bool BMP085::fetch() {
+    if (!isReady()) return false;
+    conversionPending = false;
+    uint32_t converted = conversionStart + getMeasureDelayMicroseconds();
+    if (measureMode == BMP085_MODE_TEMPERATURE) {
+        lastTemperature = compensateTemperature(getMeasurement2());
+    } else {
+        uint8_t oss = (measureMode & 0xC0) >> 6;
+        lastPressure = compensatePressure(getMeasurement3() >> (8 - oss), oss);
+    }
+    uint32_t read = I2Cdev::getReadTimestamp();
+    if ((int32_t)(read - converted) < 0) converted = read;
+    if (measureMode == BMP085_MODE_TEMPERATURE) lastTemperatureMicros = converted;
+    else lastPressureMicros = converted;
+    return true;
+}
+
+/**
+ * Configure the automatic conversion pipeline run by update().
+ * @param pressureMode Pressure mode (BMP085_MODE_PRESSURE_0 .. BMP085_MODE_PRESSURE_3)
+ * @param temperatureInterval Pressure samples per temperature refresh (1 = alternate)
+ */
+void BMP085::setPipeline(uint8_t pressureMode, uint8_t temperatureInterval) {
+    pipelineMode = pressureMode;
+    pipelineInterval = temperatureInterval ? temperatureInterval : 1;
+    pipelineCount = 0; // start with a temperature so B5 is valid
+}
+
+/**
+ * Advance the temperature/pressure pipeline without blocking: fetch the
+ * pending result if ready and start the next conversion right away, so the
+ * device converts back-to-back at its maximum rate. Call from loop() as
+ * often as convenient.
+ * @return True if a new pressure sample is available
+ */
+bool BMP085::update() {
+    bool pressureDone = false;
+    if (conversionPending) {
+        if (!fetch()) return false;
+        pressureDone = (measureMode != BMP085_MODE_TEMPERATURE);
+    }
+    if (pipelineCount == 0) {
+        startTemperature();
+        pipelineCount = pipelineInterval;
+    } else {
+        startPressure(pipelineMode);
+        pipelineCount--;
+    }
+    return pressureDone;
+}
+
+/**
+ * Get the temperature from the last fetched temperature conversion.
+ * @return Temperature in degrees Celsius
+ */
+float BMP085::getLastTemperatureC() {
+    return (float)lastTemperature / 10.0f;
+}
+
+/**
+ * Get the pressure from the last fetched pressure conversion.
+ * @return Pressure in Pascals (Pa)
+ */
+float BMP085::getLastPressure() {
+    return (float)lastPressure;
+}
+
+/**
+ * Get the temperature from the last fetched temperature conversion.
+ * @return Temperature in units of 0.1 degrees Celsius
+ */
+int16_t BMP085::getLastTemperatureDeciC() {
+    return lastTemperature;
+}
+
+/**
+ * Get the pressure from the last fetched pressure conversion.
+ * @return Pressure in Pascals (Pa)
+ */
+int32_t BMP085::getLastPressurePa() {
+    return lastPressure;
+}
+
+/**
+ * Get the time the last fetched temperature conversion completed.
+ * @return micros() timestamp
+ */
+uint32_t BMP085::getLastTemperatureTimestamp() {
+    return lastTemperatureMicros;
+}
+
+/**
+ * Get the time the last fetched pressure conversion completed, for aligning
+ * pressure with samples from other sensors.
+ * @return micros() timestamp
+ */
+uint32_t BMP085::getLastPressureTimestamp() {
+    return lastPressureMicros;
+}
@@ -4,6 +4,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp fetched conversions with their completion time
+//     2026-10-14 - add integer compensation with precomputed terms and table-based altitude
+//     2026-10-14 - add non-blocking start/isReady/fetch API and T/P pipeline
 //     2012-06-28 - initial release, dynamically built
 
 /* ============================================
@@ -111,15 +114,52 @@ class BMP085 {
         float       getPressure();
         float       getAltitude(float pressure, float seaLevelPressure=101325);
 
+        // integer compensation methods
+        int16_t     getTemperatureDeciC();
+        int32_t     getPressurePa();
+        int32_t     getAltitudeCm(int32_t pressure, int32_t seaLevelPressure=101325);
+
+        // non-blocking conversion methods
+        void        startTemperature();
+        void        startPressure(uint8_t mode=BMP085_MODE_PRESSURE_3);
+        void        setEocPin(int8_t pin);
+        bool        isReady();
+        bool        fetch();
+        void        setPipeline(uint8_t pressureMode, uint8_t temperatureInterval);
+        bool        update();
+        float       getLastTemperatureC();
+        float       getLastPressure();
+        int16_t     getLastTemperatureDeciC();
+        int32_t     getLastPressurePa();
+        uint32_t    getLastTemperatureTimestamp();
+        uint32_t    getLastPressureTimestamp();
+
    private:
         uint8_t devAddr;
-        uint8_t buffer[2];
+        uint8_t buffer[3];
 
         bool calibrationLoaded;
         int16_t ac1, ac2, ac3, b1, b2, mb, mc, md;
         uint16_t ac4, ac5, ac6;
         int32_t b5;
+        int32_t ac1x4, mcx2048;     // derived from calibration
+        int32_t pressureB3;         // AC1 * 4 + X3, before the oversampling shift
+        uint32_t pressureB4;        // both depend only on B5
         uint8_t measureMode;
+
+        int16_t compensateTemperature(int32_t ut);
+        int32_t compensatePressure(uint32_t up, uint8_t oss);
+
+        int8_t eocPin;
+        bool conversionPending;
+        uint32_t conversionStart;
+        int16_t lastTemperature;    // 0.1 degrees Celsius
+        int32_t lastPressure;       // Pa
+        uint32_t lastTemperatureMicros; // micros() the last temperature conversion completed
+        uint32_t lastPressureMicros;    // micros() the last pressure conversion completed
+        uint8_t pipelineMode;
+        uint8_t pipelineInterval;
+        uint8_t pipelineCount;
 };
 
 #endif /* _BMP085_H_ */
@@ -8,6 +8,9 @@
 //     2011-11-13 - initial release
 //     2012-03-29 - alain.spineux@gmail.com: bug in getHours24() 
 //                  am/pm is bit 0x20 instead of 0x80
+//     2026-10-14 - read/write date and time in single burst transactions
+//     2026-10-14 - SQW-driven tick mode with cached time
+//     2026-10-14 - bulk NVRAM transfers with optional CRC
 //
 
 /* ============================================
@@ -35,12 +38,84 @@ THE SOFTWARE.
 */
 
 #include "DS1307.h"
+#include <string.h>
+
+#ifndef __arm__
+    #include <avr/pgmspace.h>
+#else
+    #define PROGMEM
+    #ifndef pgm_read_byte
+        #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+    #endif
+    #ifndef pgm_read_word
+        #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+    #endif
+#endif
+
+// binary 0-99 to packed BCD, so encoding needs no division
+static const uint8_t DS1307_binToBcd[100] PROGMEM = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99
+};
+
+// tens digit weights for decoding the upper BCD nibble
+static const uint8_t DS1307_bcdTens[10] PROGMEM = { 0, 10, 20, 30, 40, 50, 60, 70, 80, 90 };
+
+// value bits of each time-keeping register 0x00 - 0x06 (drops CH and the 12/24 flag)
+static const uint8_t DS1307_clockMask[7] PROGMEM = { 0x7F, 0x7F, 0x3F, 0x07, 0x3F, 0x1F, 0xFF };
+
+static inline uint8_t DS1307_fromBcd(uint8_t bcd) {
+    return pgm_read_byte(&DS1307_bcdTens[bcd >> 4]) + (bcd & 0x0F);
+}
+
+static inline uint8_t DS1307_toBcd(uint8_t value) {
+    return pgm_read_byte(&DS1307_binToBcd[value]);
+}
+
+// largest piece the Wire buffers take in one transaction, minus the register
+// address byte on writes
+#ifdef BUFFER_LENGTH
+    #define DS1307_RAM_CHUNK (BUFFER_LENGTH - 1)
+#else
+    #define DS1307_RAM_CHUNK 31
+#endif
+
+// Dallas/Maxim CRC-8 (x^8 + x^5 + x^4 + 1), as used by 1-Wire parts
+static uint8_t DS1307_crc8(const uint8_t *data, uint8_t length) {
+    uint8_t crc = 0;
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x01) ? (crc >> 1) ^ 0x8C : crc >> 1;
+    }
+    return crc;
+}
+
+// days before the first of each month in a non-leap year
+static const uint16_t DS1307_daysBeforeMonth[12] PROGMEM = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+// decoded SECONDS..YEAR registers (24-hour) to seconds since 1970-01-01
+static uint32_t DS1307_toUnixTime(const uint8_t *regs) {
+    uint8_t y = regs[6];
+    uint16_t days = 365 * y + (y + 3) / 4 + pgm_read_word(&DS1307_daysBeforeMonth[regs[5] - 1]) + regs[4] - 1;
+    if (regs[5] > 2 && (y & 3) == 0) days++;
+    return 946684800UL + ((days * 24UL + regs[2]) * 60 + regs[1]) * 60 + regs[0];
+}
 
 /** Default constructor, uses default I2C address.
  * @see DS1307_DEFAULT_ADDRESS
  */
 DS1307::DS1307() {
     devAddr = DS1307_DEFAULT_ADDRESS;
+    ticking = false;
+    tickStale = false;
 }
 
 /** Specific address constructor.
@@ -50,6 +125,8 @@ DS1307::DS1307() {
  */
 DS1307::DS1307(uint8_t address) {
     devAddr = address;
+    ticking = false;
+    tickStale = false;
 }
 
 /** Power on and prepare for general usage.
@@ -269,85 +346,335 @@ void DS1307::setSquareWaveRate(uint8_t rate) {
 
 // RAM registers
 uint8_t DS1307::getMemoryByte(uint8_t offset) {
-    if (offset > 55) return 0;
+    if (offset >= DS1307_RAM_LENGTH) return 0;
     I2Cdev::readByte(devAddr, DS1307_RA_RAM + offset, buffer);
     return buffer[0];
 }
 void DS1307::setMemoryByte(uint8_t offset, uint8_t value) {
-    if (offset > 55) return;
+    if (offset >= DS1307_RAM_LENGTH) return;
     I2Cdev::writeByte(devAddr, DS1307_RA_RAM + offset, value);
 }
+/** Read a block of battery-backed RAM.
+ * The RAM address auto-increments, so the whole block is one transaction
+ * wherever the Wire buffer holds it; otherwise (e.g. 32-byte AVR Wire
+ * buffers) it is split into as few pieces as the buffer allows.
+ * @param offset First RAM byte (0 - 55)
+ * @param length Number of bytes, offset + length must not exceed 56
+ * @param data Buffer to store read data in
+ * @return True if all bytes were read
+ */
+bool DS1307::readMemory(uint8_t offset, uint8_t length, uint8_t *data) {
+    if (offset + length > DS1307_RAM_LENGTH) return false;
+    for (uint8_t k = 0; k < length; ) {
+        uint8_t n = length - k > DS1307_RAM_CHUNK ? DS1307_RAM_CHUNK : length - k;
+        if (I2Cdev::readBytes(devAddr, DS1307_RA_RAM + offset + k, n, data + k) != (int8_t)n) return false;
+        k += n;
+    }
+    return true;
+}
+/** Write a block of battery-backed RAM.
+ * Same transaction splitting as readMemory().
+ * @param offset First RAM byte (0 - 55)
+ * @param length Number of bytes, offset + length must not exceed 56
+ * @param data Buffer to copy new data from
+ * @return True if all bytes were written
+ * @see readMemory()
+ */
+bool DS1307::writeMemory(uint8_t offset, uint8_t length, uint8_t *data) {
+    if (offset + length > DS1307_RAM_LENGTH) return false;
+    for (uint8_t k = 0; k < length; ) {
+        uint8_t n = length - k > DS1307_RAM_CHUNK ? DS1307_RAM_CHUNK : length - k;
+        if (!I2Cdev::writeBytes(devAddr, DS1307_RA_RAM + offset + k, n, data + k)) return false;
+        k += n;
+    }
+    return true;
+}
+/** Read a CRC-protected block written by writeMemoryCRC().
+ * Reads length data bytes plus the trailing CRC-8 byte in one transfer and
+ * only copies the data out if the CRC matches, so a checkpoint torn by power
+ * loss mid-write is rejected instead of restored.
+ * @param offset First RAM byte (0 - 54)
+ * @param length Number of data bytes, offset + length + 1 must not exceed 56
+ * @param data Buffer to store read data in (untouched on failure)
+ * @return True if the block was read and its CRC is valid
+ */
+bool DS1307::readMemoryCRC(uint8_t offset, uint8_t length, uint8_t *data) {
+    uint8_t stage[DS1307_RAM_LENGTH];
+    if (offset + length + 1 > DS1307_RAM_LENGTH) return false;
+    if (!readMemory(offset, length + 1, stage)) return false;
+    if (DS1307_crc8(stage, length) != stage[length]) return false;
+    memcpy(data, stage, length);
+    return true;
+}
+/** Write a block followed by its CRC-8 byte.
+ * @param offset First RAM byte (0 - 54)
+ * @param length Number of data bytes, offset + length + 1 must not exceed 56
+ * @param data Buffer to copy new data from
+ * @return True if the block and CRC were written
+ * @see readMemoryCRC()
+ */
+bool DS1307::writeMemoryCRC(uint8_t offset, uint8_t length, uint8_t *data) {
+    uint8_t stage[DS1307_RAM_LENGTH];
+    if (offset + length + 1 > DS1307_RAM_LENGTH) return false;
+    memcpy(stage, data, length);
+    stage[length] = DS1307_crc8(data, length);
+    return writeMemory(offset, length + 1, stage);
+}
 
 // convenience methods
 
 void DS1307::getDate(uint16_t *year, uint8_t *month, uint8_t *day) {
-    *year = getYear();
-    *month = getMonth();
-    *day = getDay();
+    uint8_t regs[3];
+    I2Cdev::readBytes(devAddr, DS1307_RA_DATE, 3, regs);
+    *day = DS1307_fromBcd(regs[0] & 0x3F);
+    *month = DS1307_fromBcd(regs[1] & 0x1F);
+    *year = 2000 + DS1307_fromBcd(regs[2]);
 }
 void DS1307::setDate(uint16_t year, uint8_t month, uint8_t day) {
-    setYear(year);
-    setMonth(month);
-    setDay(day);
+    if (year < 2000 || year > 2099 || month < 1 || month > 12 || day < 1 || day > 31) return;
+    uint8_t regs[3] = { DS1307_toBcd(day), DS1307_toBcd(month), DS1307_toBcd(year - 2000) };
+    I2Cdev::writeBytes(devAddr, DS1307_RA_DATE, 3, regs);
+    tickStale = true; // resync on next serviceTick()
 }
 
 void DS1307::getTime12(uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm) {
-    *hours = getHours12();
-    *minutes = getMinutes();
-    *seconds = getSeconds();
-    *ampm = getAMPM();
+    uint8_t regs[DS1307_CLOCK_REGISTERS];
+    readClock(regs, 3);
+    to12(regs[2], hours, ampm);
+    *minutes = regs[1];
+    *seconds = regs[0];
 }
 void DS1307::setTime12(uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t ampm) {
-    // write seconds first to reset divider chain and give
-    // us 1 second to write remaining time info
-    setSeconds(seconds);
-    setMinutes(minutes);
-    setHours12(hours, ampm);
+    if (hours > 12 || hours < 1 || minutes > 59 || seconds > 59) return;
+    // seconds go first, resetting the divider chain, and the whole
+    // time lands in one transaction
+    uint8_t regs[3] = { (uint8_t)((clockHalt ? 0x80 : 0x00) | DS1307_toBcd(seconds)), DS1307_toBcd(minutes), encodeHours12(hours, ampm) };
+    I2Cdev::writeBytes(devAddr, DS1307_RA_SECONDS, 3, regs);
+    tickStale = true; // resync on next serviceTick()
 }
 
 void DS1307::getTime24(uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
-    *hours = getHours24();
-    *minutes = getMinutes();
-    *seconds = getSeconds();
+    uint8_t regs[DS1307_CLOCK_REGISTERS];
+    readClock(regs, 3);
+    *hours = regs[2];
+    *minutes = regs[1];
+    *seconds = regs[0];
 }
 void DS1307::setTime24(uint8_t hours, uint8_t minutes, uint8_t seconds) {
-    // write seconds first to reset divider chain and give
-    // us 1 second to write remaining time info
-    setSeconds(seconds);
-    setMinutes(minutes);
-    setHours24(hours);
+    if (hours > 23 || minutes > 59 || seconds > 59) return;
+    uint8_t regs[3] = { (uint8_t)((clockHalt ? 0x80 : 0x00) | DS1307_toBcd(seconds)), DS1307_toBcd(minutes), encodeHours24(hours) };
+    I2Cdev::writeBytes(devAddr, DS1307_RA_SECONDS, 3, regs);
+    tickStale = true; // resync on next serviceTick()
 }
 
 void DS1307::getDateTime12(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm) {
-    getTime12(hours, minutes, seconds, ampm);
-    getDate(year, month, day);
+    uint8_t regs[DS1307_CLOCK_REGISTERS];
+    readClock(regs, DS1307_CLOCK_REGISTERS);
+    to12(regs[2], hours, ampm);
+    *minutes = regs[1];
+    *seconds = regs[0];
+    *day = regs[4];
+    *month = regs[5];
+    *year = 2000 + regs[6];
 }
 void DS1307::setDateTime12(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t ampm) {
-    setTime12(hours, minutes, seconds, ampm);
-    setDate(year, month, day);
+    if (hours > 12 || hours < 1) return;
+    if (ampm) hours = (hours == 12) ? 12 : hours + 12;
+    else if (hours == 12) hours = 0;
+    setDateTime24(year, month, day, hours, minutes, seconds);
 }
 
 void DS1307::getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
-    getTime24(hours, minutes, seconds);
-    getDate(year, month, day);
+    uint8_t regs[DS1307_CLOCK_REGISTERS];
+    readClock(regs, DS1307_CLOCK_REGISTERS);
+    *hours = regs[2];
+    *minutes = regs[1];
+    *seconds = regs[0];
+    *day = regs[4];
+    *month = regs[5];
+    *year = 2000 + regs[6];
 }
+
+/** Set date and time (24-hour) in one burst write of registers 0x00 - 0x06.
+ * The day-of-week register is written too, computed from the date with
+ * 1 = Sunday (DateTime::dayOfWeek() + 1). The clock halt flag and the
+ * 12/24-hour mode are preserved.
+ */
 void DS1307::setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds) {
-    setTime24(hours, minutes, seconds);
-    setDate(year, month, day);
+    if (year < 2000 || year > 2099 || month < 1 || month > 12 || day < 1 || day > 31) return;
+    if (hours > 23 || minutes > 59 || seconds > 59) return;
+
+    // Sakamoto's day-of-week, 0 = Sunday
+    static const uint8_t monthOffset[12] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+    uint16_t y = year - (month < 3);
+    uint8_t dow = (y + y / 4 - y / 100 + y / 400 + monthOffset[month - 1] + day) % 7;
+
+    uint8_t regs[DS1307_CLOCK_REGISTERS] = {
+        (uint8_t)((clockHalt ? 0x80 : 0x00) | DS1307_toBcd(seconds)),
+        DS1307_toBcd(minutes),
+        encodeHours24(hours),
+        (uint8_t)(dow + 1),
+        DS1307_toBcd(day),
+        DS1307_toBcd(month),
+        DS1307_toBcd(year - 2000)
+    };
+    I2Cdev::writeBytes(devAddr, DS1307_RA_SECONDS, DS1307_CLOCK_REGISTERS, regs);
+    tickStale = true; // resync on next serviceTick()
+}
+
+/** Burst-read the first count time-keeping registers and decode them to
+ * binary. Hours are always returned in 24-hour form; the device's 12/24
+ * mode and clock halt flag are refreshed from the same read.
+ * @param regs Output, one decoded value per register starting at SECONDS
+ * @param count Number of registers (1 - DS1307_CLOCK_REGISTERS)
+ * @return True if all registers were read
+ */
+bool DS1307::readClock(uint8_t *regs, uint8_t count) {
+    if (I2Cdev::readBytes(devAddr, DS1307_RA_SECONDS, count, regs) != (int8_t)count) return false;
+    clockHalt = regs[0] & 0x80;
+    uint8_t hours = count > 2 ? regs[2] : 0;
+    for (uint8_t i = 0; i < count; i++) {
+        regs[i] = DS1307_fromBcd(regs[i] & pgm_read_byte(&DS1307_clockMask[i]));
+    }
+    if (count > 2) {
+        mode12 = hours & 0x40;
+        if (mode12) {
+            // Byte: [5 = AM/PM] [4 = 10HR] [3:0 = 1HR]
+            regs[2] = DS1307_fromBcd(hours & 0x1F);
+            if (regs[2] == 12) regs[2] = 0;
+            if (hours & 0x20) regs[2] += 12;
+        }
+    }
+    return true;
+}
+
+// convert a decoded 24-hour value to 12-hour form
+void DS1307::to12(uint8_t hours24, uint8_t *hours, uint8_t *ampm) {
+    *ampm = hours24 >= 12;
+    *hours = hours24 % 12;
+    if (*hours == 0) *hours = 12;
+}
+
+// HOURS register value for a 24-hour input in the current 12/24 mode
+uint8_t DS1307::encodeHours24(uint8_t hours) {
+    if (!mode12) return DS1307_toBcd(hours);
+    uint8_t ampm = hours > 11 ? 0x20 : 0x00;
+    if (hours > 12) hours -= 12;
+    else if (hours == 0) hours = 12;
+    return 0x40 | ampm | DS1307_toBcd(hours);
+}
+
+// HOURS register value for a 12-hour input in the current 12/24 mode
+uint8_t DS1307::encodeHours12(uint8_t hours, uint8_t ampm) {
+    if (mode12) return 0x40 | (ampm ? 0x20 : 0x00) | DS1307_toBcd(hours);
+    if (ampm) hours = (hours == 12) ? 12 : hours + 12;
+    else if (hours == 12) hours = 0;
+    return DS1307_toBcd(hours);
 }
 
 #ifdef DS1307_INCLUDE_DATETIME_METHODS
     DateTime DS1307::getDateTime() {
-        DateTime dt = DateTime(getYear(), getMonth(), getDay(), getHours24(), getMinutes(), getSeconds());
-        return dt;
+        uint8_t regs[DS1307_CLOCK_REGISTERS];
+        if (!readClock(regs, DS1307_CLOCK_REGISTERS)) return DateTime();
+        return DateTime(2000 + regs[6], regs[5], regs[4], regs[2], regs[1], regs[0]);
     }
     void DS1307::setDateTime(DateTime dt) {
-        setSeconds(dt.second());
-        setMinutes(dt.minute());
-        setHours24(dt.hour());
-        setDay(dt.day());
-        setMonth(dt.month());
-        setYear(dt.year());
+        setDateTime24(dt.year(), dt.month(), dt.day(), dt.hour(), dt.minute(), dt.second());
+    }
+#endif
+
+// SQW tick mode
+
+/** Start SQW tick mode.
+ * Sets the square-wave output to 1Hz, enables it and loads the cached time
+ * from the chip. Attach the SQW/OUT pin (open drain, needs a pull-up) to an
+ * external interrupt on the FALLING edge, which is when the seconds register
+ * advances, and call tick() from the handler. After that getTickTime() is a
+ * memory read; call serviceTick() from the main loop so the cache is
+ * periodically re-read from the chip to catch missed edges.
+ * @param resyncSeconds Ticks between resynchronizations (0 = never)
+ * @return True if the initial sync succeeded
+ * @see tick()
+ * @see serviceTick()
+ */
+bool DS1307::startTick(uint16_t resyncSeconds) {
+    setSquareWaveRate(DS1307_SQW_RATE_1);
+    setSquareWaveEnabled(true);
+    tickInterval = resyncSeconds;
+    ticking = true;
+    return syncTick();
+}
+/** Leave SQW tick mode and disable the square-wave output.
+ * The cached time stops advancing; getDateTime*() keep reading the chip.
+ */
+void DS1307::stopTick() {
+    ticking = false;
+    setSquareWaveEnabled(false);
+}
+/** Get whether SQW tick mode is active.
+ * @return True between startTick() and stopTick()
+ */
+bool DS1307::isTicking() {
+    return ticking;
+}
+/** Advance the cached time by one second.
+ * Call from the SQW falling-edge interrupt handler; does no I2C traffic.
+ */
+void DS1307::tick() {
+    tickTime++;
+    tickElapsed++;
+    tickSeq++;
+}
+/** Resynchronize the cached time if the resync interval has elapsed, or
+ * if the time was set since the last sync (even with resyncs disabled).
+ * Call from the main loop, never from an interrupt handler.
+ * @return True if the chip was read during this call
+ */
+bool DS1307::serviceTick() {
+    if (!ticking) return false;
+    if (tickStale) return syncTick();
+    if (tickInterval == 0) return false; // never
+    noInterrupts();
+    uint16_t elapsed = tickElapsed;
+    interrupts();
+    if (elapsed < tickInterval) return false;
+    return syncTick();
+}
+/** Reload the cached time from the chip now.
+ * The read is retried if a tick lands in the middle of it, so the cache
+ * never ends up one second behind.
+ * @return True if the chip was read successfully
+ */
+bool DS1307::syncTick() {
+    uint8_t regs[DS1307_CLOCK_REGISTERS];
+    uint8_t tries = 3;
+    uint8_t seq;
+    do {
+        seq = tickSeq;
+        if (!readClock(regs, DS1307_CLOCK_REGISTERS)) return false;
+    } while (seq != tickSeq && --tries);
+    uint32_t t = DS1307_toUnixTime(regs);
+    noInterrupts();
+    tickTime = t;
+    tickElapsed = 0;
+    interrupts();
+    tickStale = false;
+    return true;
+}
+/** Get the cached time without bus traffic.
+ * Safe to call from interrupt handlers.
+ * @return Seconds since 1970-01-01 00:00:00
+ */
+uint32_t DS1307::getTickTime() {
+    uint32_t t;
+    do {
+        t = tickTime;
+    } while (t != tickTime);
+    return t;
+}
+#ifdef DS1307_INCLUDE_DATETIME_CLASS
+    DateTime DS1307::getTickDateTime() {
+        return DateTime(getTickTime());
     }
 #endif
 
@@ -6,6 +6,9 @@
 //
 // Changelog:
 //     2011-11-13 - initial release
+//     2026-10-14 - bulk NVRAM transfers with optional CRC
+//     2026-10-14 - SQW-driven tick mode with cached time
+//     2026-10-14 - burst date/time access, table-driven BCD
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -55,6 +58,9 @@ THE SOFTWARE.
 #define DS1307_RA_YEAR              0x06
 #define DS1307_RA_CONTROL           0x07
 #define DS1307_RA_RAM               0x08
+#define DS1307_RAM_LENGTH           56 // battery-backed bytes at 0x08 - 0x3F
+
+#define DS1307_CLOCK_REGISTERS      7 // SECONDS through YEAR, read/written as one burst
 
 #define DS1307_SECONDS_CH_BIT       7
 #define DS1307_SECONDS_10_BIT       6
@@ -100,6 +106,8 @@ THE SOFTWARE.
 #define DS1307_SQW_RATE_8192        0x2
 #define DS1307_SQW_RATE_32768       0x3
 
+#define DS1307_TICK_RESYNC_DEFAULT  3600 // seconds between chip reads in tick mode
+
 #ifdef DS1307_INCLUDE_DATETIME_CLASS
     // DateTime class courtesy of public domain JeeLabs code
     // simple general-purpose date/time class (no TZ / DST / leap second handling!)
@@ -181,6 +189,10 @@ class DS1307 {
         // RAM registers
         uint8_t getMemoryByte(uint8_t offset);
         void setMemoryByte(uint8_t offset, uint8_t value);
+        bool readMemory(uint8_t offset, uint8_t length, uint8_t *data);
+        bool writeMemory(uint8_t offset, uint8_t length, uint8_t *data);
+        bool readMemoryCRC(uint8_t offset, uint8_t length, uint8_t *data);
+        bool writeMemoryCRC(uint8_t offset, uint8_t length, uint8_t *data);
 
         // convenience methods
 
@@ -204,11 +216,35 @@ class DS1307 {
             void setDateTime(DateTime dt);
         #endif
 
+        // SQW tick mode (cached time advanced by the 1Hz output)
+        bool startTick(uint16_t resyncSeconds=DS1307_TICK_RESYNC_DEFAULT);
+        void stopTick();
+        bool isTicking();
+        void tick();
+        bool serviceTick();
+        bool syncTick();
+        uint32_t getTickTime();
+        #ifdef DS1307_INCLUDE_DATETIME_CLASS
+            DateTime getTickDateTime();
+        #endif
+
     private:
         uint8_t devAddr;
         uint8_t buffer[1];
         bool mode12;
         bool clockHalt;
+
+        bool readClock(uint8_t *regs, uint8_t count);
+        void to12(uint8_t hours24, uint8_t *hours, uint8_t *ampm);
+        uint8_t encodeHours24(uint8_t hours);
+        uint8_t encodeHours12(uint8_t hours, uint8_t ampm);
+
+        volatile uint32_t tickTime;
+        volatile uint16_t tickElapsed;
+        volatile uint8_t tickSeq;
+        uint16_t tickInterval;          // 0 = never resync on a schedule
+        bool ticking;
+        bool tickStale;                 // time set since the last sync
 };
 
 #endif /* _DS1307_H_ */
@@ -0,0 +1,100 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for DS1307 SQW tick mode
+// Keeps a cached time advanced by the 1Hz SQW interrupt instead of polling the chip
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+// I2C Device Library hosted at http://www.i2cdevlib.com
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev and DS1307 must be installed as libraries, or else the .cpp/.h files
+// for both classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "DS1307.h"
+
+// class default I2C address is 0x68
+DS1307 rtc;
+
+// SQW/OUT is open drain; wire it to an external interrupt pin with a pull-up
+#define SQW_PIN 2
+
+#define LED_PIN 13
+bool blinkState = false;
+uint32_t lastTime = 0;
+
+void sqwTick() {
+    rtc.tick();
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Serial.begin(38400);
+
+    // initialize device
+    Serial.println("Initializing I2C devices...");
+    rtc.initialize();
+    Serial.println(rtc.testConnection() ? "DS1307 connection successful" : "DS1307 connection failed");
+
+    pinMode(LED_PIN, OUTPUT);
+    pinMode(SQW_PIN, INPUT_PULLUP);
+
+    // 1Hz square wave drives the cached time; re-read the chip every 10 minutes
+    attachInterrupt(digitalPinToInterrupt(SQW_PIN), sqwTick, FALLING);
+    rtc.startTick(600);
+}
+
+void loop() {
+    // occasional resync from the chip, otherwise no I2C traffic at all
+    if (rtc.serviceTick()) Serial.println("resync");
+
+    // timestamping is now a memory read
+    uint32_t now = rtc.getTickTime();
+    if (now != lastTime) {
+        lastTime = now;
+        DateTime dt = rtc.getTickDateTime();
+        Serial.print("tick:\t");
+        Serial.print(now); Serial.print("\t");
+        Serial.print(dt.year()); Serial.print("-");
+        if (dt.month() < 10) Serial.print("0");
+        Serial.print(dt.month()); Serial.print("-");
+        if (dt.day() < 10) Serial.print("0");
+        Serial.print(dt.day()); Serial.print(" ");
+        if (dt.hour() < 10) Serial.print("0");
+        Serial.print(dt.hour()); Serial.print(":");
+        if (dt.minute() < 10) Serial.print("0");
+        Serial.print(dt.minute()); Serial.print(":");
+        if (dt.second() < 10) Serial.print("0");
+        Serial.println(dt.second());
+
+        blinkState = !blinkState;
+        digitalWrite(LED_PIN, blinkState);
+    }
+}
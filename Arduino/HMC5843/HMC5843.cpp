@@ -247,9 +247,9 @@ void HMC5843::setMode(uint8_t newMode) {
 void HMC5843::getHeading(int16_t *x, int16_t *y, int16_t *z) {
     I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 6, buffer);
     if (mode == HMC5843_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, HMC5843_MODE_SINGLE << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 2);
+    *z = I2CDEV_BE16(buffer + 4);
 }
 /** Get X-axis heading measurement.
  * @return 16-bit signed integer with X-axis heading
@@ -260,7 +260,7 @@ int16_t HMC5843::getHeadingX() {
     // one is used; this was not done ineffiently in the code by accident
     I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 6, buffer);
     if (mode == HMC5843_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, HMC5843_MODE_SINGLE << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Y-axis heading measurement.
  * @return 16-bit signed integer with Y-axis heading
@@ -271,7 +271,7 @@ int16_t HMC5843::getHeadingY() {
     // one is used; this was not done ineffiently in the code by accident
     I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 6, buffer);
     if (mode == HMC5843_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, HMC5843_MODE_SINGLE << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
-    return (((int16_t)buffer[2]) << 8) | buffer[3];
+    return I2CDEV_BE16(buffer + 2);
 }
 /** Get Z-axis heading measurement.
  * @return 16-bit signed integer with Z-axis heading
@@ -282,7 +282,7 @@ int16_t HMC5843::getHeadingZ() {
     // one is used; this was not done ineffiently in the code by accident
     I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 6, buffer);
     if (mode == HMC5843_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, HMC5843_MODE_SINGLE << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
-    return (((int16_t)buffer[4]) << 8) | buffer[5];
+    return I2CDEV_BE16(buffer + 4);
 }
 
 // STATUS register
@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp pipelined samples with their measurement completion time
+//     2026-10-14 - pipelined single-measurement mode with DRDY support
 //     2012-06-12 - fixed swapped Y/Z axes
 //     2011-08-22 - small Doxygen comment fixes
 //     2011-07-31 - initial release
@@ -39,6 +41,11 @@ THE SOFTWARE.
  */
 HMC5883L::HMC5883L() {
     devAddr = HMC5883L_DEFAULT_ADDRESS;
+    pipeDrdyPin = -1;
+    pipeInterrupt = false;
+    pipeActive = false;
+    pipeFlag = false;
+    pipeReadyAt = 0;
 }
 
 /** Specific address constructor.
@@ -48,6 +55,11 @@ HMC5883L::HMC5883L() {
  */
 HMC5883L::HMC5883L(uint8_t address) {
     devAddr = address;
+    pipeDrdyPin = -1;
+    pipeInterrupt = false;
+    pipeActive = false;
+    pipeFlag = false;
+    pipeReadyAt = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -93,7 +105,7 @@ bool HMC5883L::testConnection() {
  * @see HMC5883L_CRA_AVERAGE_LENGTH
  */
 uint8_t HMC5883L::getSampleAveraging() {
-    I2Cdev::readBits(devAddr, HMC5883L_RA_CONFIG_A, HMC5883L_CRA_AVERAGE_BIT, HMC5883L_CRA_AVERAGE_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<HMC5883L_RA_CONFIG_A, HMC5883L_CRA_AVERAGE_BIT, HMC5883L_CRA_AVERAGE_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set number of samples averaged per measurement.
@@ -103,7 +115,7 @@ uint8_t HMC5883L::getSampleAveraging() {
  * @see HMC5883L_CRA_AVERAGE_LENGTH
  */
 void HMC5883L::setSampleAveraging(uint8_t averaging) {
-    I2Cdev::writeBits(devAddr, HMC5883L_RA_CONFIG_A, HMC5883L_CRA_AVERAGE_BIT, HMC5883L_CRA_AVERAGE_LENGTH, averaging);
+    I2Cdev::writeField<I2Cdev_Field<HMC5883L_RA_CONFIG_A, HMC5883L_CRA_AVERAGE_BIT, HMC5883L_CRA_AVERAGE_LENGTH> >(devAddr, averaging);
 }
 /** Get data output rate value.
  * The Table below shows all selectable output rates in continuous measurement
@@ -129,7 +141,7 @@ void HMC5883L::setSampleAveraging(uint8_t averaging) {
  * @see HMC5883L_CRA_RATE_LENGTH
  */
 uint8_t HMC5883L::getDataRate() {
-    I2Cdev::readBits(devAddr, HMC5883L_RA_CONFIG_A, HMC5883L_CRA_RATE_BIT, HMC5883L_CRA_RATE_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<HMC5883L_RA_CONFIG_A, HMC5883L_CRA_RATE_BIT, HMC5883L_CRA_RATE_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set data output rate value.
@@ -141,7 +153,7 @@ uint8_t HMC5883L::getDataRate() {
  * @see HMC5883L_CRA_RATE_LENGTH
  */
 void HMC5883L::setDataRate(uint8_t rate) {
-    I2Cdev::writeBits(devAddr, HMC5883L_RA_CONFIG_A, HMC5883L_CRA_RATE_BIT, HMC5883L_CRA_RATE_LENGTH, rate);
+    I2Cdev::writeField<I2Cdev_Field<HMC5883L_RA_CONFIG_A, HMC5883L_CRA_RATE_BIT, HMC5883L_CRA_RATE_LENGTH> >(devAddr, rate);
 }
 /** Get measurement bias value.
  * @return Current bias value (0-2 for normal/positive/negative respectively)
@@ -151,7 +163,7 @@ void HMC5883L::setDataRate(uint8_t rate) {
  * @see HMC5883L_CRA_BIAS_LENGTH
  */
 uint8_t HMC5883L::getMeasurementBias() {
-    I2Cdev::readBits(devAddr, HMC5883L_RA_CONFIG_A, HMC5883L_CRA_BIAS_BIT, HMC5883L_CRA_BIAS_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<HMC5883L_RA_CONFIG_A, HMC5883L_CRA_BIAS_BIT, HMC5883L_CRA_BIAS_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set measurement bias value.
@@ -162,7 +174,7 @@ uint8_t HMC5883L::getMeasurementBias() {
  * @see HMC5883L_CRA_BIAS_LENGTH
  */
 void HMC5883L::setMeasurementBias(uint8_t bias) {
-    I2Cdev::writeBits(devAddr, HMC5883L_RA_CONFIG_A, HMC5883L_CRA_BIAS_BIT, HMC5883L_CRA_BIAS_LENGTH, bias);
+    I2Cdev::writeField<I2Cdev_Field<HMC5883L_RA_CONFIG_A, HMC5883L_CRA_BIAS_BIT, HMC5883L_CRA_BIAS_LENGTH> >(devAddr, bias);
 }
 
 // CONFIG_B register
@@ -191,7 +203,7 @@ void HMC5883L::setMeasurementBias(uint8_t bias) {
  * @see HMC5883L_CRB_GAIN_LENGTH
  */
 uint8_t HMC5883L::getGain() {
-    I2Cdev::readBits(devAddr, HMC5883L_RA_CONFIG_B, HMC5883L_CRB_GAIN_BIT, HMC5883L_CRB_GAIN_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<HMC5883L_RA_CONFIG_B, HMC5883L_CRB_GAIN_BIT, HMC5883L_CRB_GAIN_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set magnetic field gain value.
@@ -233,7 +245,7 @@ void HMC5883L::setGain(uint8_t gain) {
  * @see HMC5883L_MODEREG_LENGTH
  */
 uint8_t HMC5883L::getMode() {
-    I2Cdev::readBits(devAddr, HMC5883L_RA_MODE, HMC5883L_MODEREG_BIT, HMC5883L_MODEREG_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<HMC5883L_RA_MODE, HMC5883L_MODEREG_BIT, HMC5883L_MODEREG_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set measurement mode.
@@ -270,9 +282,9 @@ void HMC5883L::setMode(uint8_t newMode) {
 void HMC5883L::getHeading(int16_t *x, int16_t *y, int16_t *z) {
     I2Cdev::readBytes(devAddr, HMC5883L_RA_DATAX_H, 6, buffer);
     if (mode == HMC5883L_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[4]) << 8) | buffer[5];
-    *z = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 4);
+    *z = I2CDEV_BE16(buffer + 2);
 }
 /** Get X-axis heading measurement.
  * @return 16-bit signed integer with X-axis heading
@@ -283,7 +295,7 @@ int16_t HMC5883L::getHeadingX() {
     // one is used; this was not done ineffiently in the code by accident
     I2Cdev::readBytes(devAddr, HMC5883L_RA_DATAX_H, 6, buffer);
     if (mode == HMC5883L_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Y-axis heading measurement.
  * @return 16-bit signed integer with Y-axis heading
@@ -294,7 +306,7 @@ int16_t HMC5883L::getHeadingY() {
     // one is used; this was not done ineffiently in the code by accident
     I2Cdev::readBytes(devAddr, HMC5883L_RA_DATAX_H, 6, buffer);
     if (mode == HMC5883L_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
-    return (((int16_t)buffer[4]) << 8) | buffer[5];
+    return I2CDEV_BE16(buffer + 4);
 }
 /** Get Z-axis heading measurement.
  * @return 16-bit signed integer with Z-axis heading
@@ -305,7 +317,7 @@ int16_t HMC5883L::getHeadingZ() {
     // one is used; this was not done ineffiently in the code by accident
     I2Cdev::readBytes(devAddr, HMC5883L_RA_DATAX_H, 6, buffer);
     if (mode == HMC5883L_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
-    return (((int16_t)buffer[2]) << 8) | buffer[3];
+    return I2CDEV_BE16(buffer + 2);
 }
 
 // STATUS register
@@ -322,7 +334,7 @@ int16_t HMC5883L::getHeadingZ() {
  * @see HMC5883L_STATUS_LOCK_BIT
  */
 bool HMC5883L::getLockStatus() {
-    I2Cdev::readBit(devAddr, HMC5883L_RA_STATUS, HMC5883L_STATUS_LOCK_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<HMC5883L_RA_STATUS, HMC5883L_STATUS_LOCK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get data ready status.
@@ -336,10 +348,91 @@ bool HMC5883L::getLockStatus() {
  * @see HMC5883L_STATUS_READY_BIT
  */
 bool HMC5883L::getReadyStatus() {
-    I2Cdev::readBit(devAddr, HMC5883L_RA_STATUS, HMC5883L_STATUS_READY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<HMC5883L_RA_STATUS, HMC5883L_STATUS_READY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
+// Pipelined single measurements
+
+/** Start pipelined single-measurement sampling.
+ * The first measurement is triggered here. getHeadingPipelined() then reads
+ * each result and triggers the next measurement in one combined transaction
+ * (I2Cdev::executeBatch(), joined by a repeated START where the bus allows),
+ * so the sensor converts while the host does other work and the output rate
+ * is limited only by the single-shot conversion time.
+ * DRDY only pulses low for about 250us, so it is only used with an
+ * interrupt on its FALLING edge; otherwise the 6ms conversion time of
+ * 1-sample averaging is assumed (set averaging to 1 for the fastest rate).
+ * @param drdyPin Digital pin wired to DRDY, or -1 to use the conversion time
+ * @param interrupt True if an ISR on DRDY calls notifyDataReady()
+ * @return True if the first measurement was triggered
+ * @see getHeadingPipelined()
+ */
+bool HMC5883L::startPipeline(int8_t drdyPin, bool interrupt) {
+    pipeDrdyPin = drdyPin;
+    pipeInterrupt = interrupt;
+    pipeFlag = false;
+    pipeActive = I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
+    mode = HMC5883L_MODE_SINGLE;
+    pipeTriggered = micros();
+    return pipeActive;
+}
+/** Stop pipelined sampling; the measurement in flight is left unread. */
+void HMC5883L::stopPipeline() {
+    pipeActive = false;
+}
+/** Flag a completed measurement; call from the DRDY interrupt handler. */
+void HMC5883L::notifyDataReady() {
+    pipeReadyAt = micros();
+    pipeFlag = true;
+}
+/** Check whether the measurement in flight has completed.
+ * @return True if getHeadingPipelined() will return a new sample
+ */
+bool HMC5883L::isPipelineReady() {
+    if (!pipeActive) return false;
+    if (pipeDrdyPin >= 0 && pipeInterrupt) return pipeFlag;
+    // the DRDY pulse is too short to poll reliably, so fall back to timing
+    return micros() - pipeTriggered >= HMC5883L_SINGLE_MEASURE_US;
+}
+/** Read the finished measurement and trigger the next one.
+ * One batch reads DATAX_H..DATAY_L and writes MODE = single measurement.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @param timestamp Optional container for the micros() time the measurement
+ *        completed: the DRDY edge with an interrupt, otherwise the trigger
+ *        time plus the conversion time
+ * @return True if a new sample was returned (false if none was ready yet)
+ */
+bool HMC5883L::getHeadingPipelined(int16_t *x, int16_t *y, int16_t *z, uint32_t *timestamp) {
+    if (!isPipelineReady()) return false;
+    pipeFlag = false;
+    uint32_t completed = (pipeDrdyPin >= 0 && pipeInterrupt) ? pipeReadyAt : pipeTriggered + HMC5883L_SINGLE_MEASURE_US;
+    uint8_t trigger = HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1);
+    I2Cdev_Transaction segments[2];
+    segments[0].devAddr = devAddr;
+    segments[0].regAddr = HMC5883L_RA_DATAX_H;
+    segments[0].flags = I2CDEV_TXN_READ;
+    segments[0].length = 6;
+    segments[0].data = buffer;
+    segments[0].callback = 0;
+    segments[1].devAddr = devAddr;
+    segments[1].regAddr = HMC5883L_RA_MODE;
+    segments[1].flags = I2CDEV_TXN_WRITE;
+    segments[1].length = 1;
+    segments[1].data = &trigger;
+    segments[1].callback = 0;
+    uint8_t ok = I2Cdev::executeBatch(segments, 2);
+    pipeTriggered = micros();
+    if (ok != 2) return false;
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 4);
+    *z = I2CDEV_BE16(buffer + 2);
+    if (timestamp) *timestamp = completed;
+    return true;
+}
+
 // ID_* registers
 
 /** Get identification byte A
@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp pipelined samples with their measurement completion time
+//     2026-10-14 - pipelined single-measurement mode with DRDY support
 //     2012-06-12 - fixed swapped Y/Z axes
 //     2011-08-22 - small Doxygen comment fixes
 //     2011-07-31 - initial release
@@ -100,6 +102,8 @@ THE SOFTWARE.
 #define HMC5883L_STATUS_LOCK_BIT    1
 #define HMC5883L_STATUS_READY_BIT   0
 
+#define HMC5883L_SINGLE_MEASURE_US  6000 // single-measurement conversion time, 1-sample averaging
+
 class HMC5883L {
     public:
         HMC5883L();
@@ -134,6 +138,13 @@ class HMC5883L {
         bool getLockStatus();
         bool getReadyStatus();
 
+        // pipelined single measurements
+        bool startPipeline(int8_t drdyPin=-1, bool interrupt=false);
+        void stopPipeline();
+        void notifyDataReady();
+        bool isPipelineReady();
+        bool getHeadingPipelined(int16_t *x, int16_t *y, int16_t *z, uint32_t *timestamp=0);
+
         // ID_* registers
         uint8_t getIDA();
         uint8_t getIDB();
@@ -143,6 +154,12 @@ class HMC5883L {
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        int8_t pipeDrdyPin;
+        bool pipeInterrupt;
+        bool pipeActive;
+        volatile bool pipeFlag;
+        uint32_t pipeTriggered;
+        volatile uint32_t pipeReadyAt;  // micros() at the last DRDY edge
 };
 
 #endif /* _HMC5883L_H_ */
@@ -0,0 +1,281 @@
+// I2Cdev library collection - Host-side driver bus-efficiency benchmark
+// Runs common driver calls against the simulated bus and reports their bus cost
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Build and run on a PC (from Arduino/), as one command line:
+//
+//   g++ -O2 -DI2CDEV_IMPLEMENTATION=I2CDEV_HOST_SIMULATION
+//       -II2Cdev -IMPU6050 -IADXL345 -IBMP085 -IADS1115
+//       I2Cdev/Benchmark/I2Cdev_benchmark.cpp I2Cdev/I2Cdev.cpp I2Cdev/I2Cdev_core.c I2Cdev/I2Cdev_sim.c
+//       MPU6050/MPU6050.cpp ADXL345/ADXL345.cpp BMP085/BMP085.cpp ADS1115/ADS1115.cpp
+//       -o i2cdev_benchmark
+//   ./i2cdev_benchmark [clockHz [setupNanos]]
+//
+// Every call is run against freshly initialised device models and its
+// transactions, data bytes and modelled bus time are printed. Each entry
+// carries the transaction and byte counts it cost when it was last tuned;
+// the program exits with status 1 if any call now needs more, so a change
+// that makes a driver chattier shows up before it reaches hardware. Lower
+// a budget when a call gets cheaper. Budgets are only checked at the default
+// clock and setup cost, since calls that poll the FIFO take a different
+// number of reads at other speeds. MahonyAHRSFixed is also checked against
+// the float MahonyAHRS, as it has no bus cost to budget.
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include "I2Cdev.h"
+#define HELPER_3DMATH_FIXED
+#include "MPU6050_6Axis_MotionApps20.h"
+#include "helper_ahrs.h"
+#include "ADXL345.h"
+#include "BMP085.h"
+#include "ADS1115.h"
+
+#if I2CDEV_IMPLEMENTATION != I2CDEV_HOST_SIMULATION
+    #error Build with -DI2CDEV_IMPLEMENTATION=I2CDEV_HOST_SIMULATION
+#endif
+
+static I2Cdev_SimDevice mpuDevice, adxlDevice, bmpDevice, adsDevice;
+static I2Cdev_SimMPU6050 mpuState;
+static I2Cdev_SimBMP085 bmpState;
+static I2Cdev_SimADS1115 adsState;
+
+static MPU6050 mpu;
+static ADXL345 accel;
+static BMP085 barometer;
+static ADS1115 adc(ADS1115_DEFAULT_ADDRESS);
+
+static int16_t ax, ay, az, gx, gy, gz;
+static int16_t blockData[6][MPU6050_MOTION_BLOCK_CHUNK];
+static bool wrong = false; // a call misbehaved, not just overspent
+
+// -----------------------------------------------------------------------------
+// Benchmarked calls; each prepare() runs uncounted before its call
+// -----------------------------------------------------------------------------
+
+static void nothing() {}
+
+static void mpuInitialize() { mpu.initialize(); }
+static void mpuTestConnection() { mpu.testConnection(); }
+static void mpuGetMotion6() { mpu.getMotion6(&ax, &ay, &az, &gx, &gy, &gz); }
+static void mpuGetAcceleration() { mpu.getAcceleration(&ax, &ay, &az); }
+static void mpuGetTemperature() { mpu.getTemperature(); }
+static void mpuSetAccelRange() { mpu.setFullScaleAccelRange(MPU6050_ACCEL_FS_4); }
+static void mpuGetIntStatus() { mpu.getIntStatus(); }
+
+static void mpuPrepareBlock() {
+    mpu.initialize();
+    mpu.startMotionFIFO();
+    delay(8); // 8 samples at the 1kHz default rate with the DLPF on
+}
+static void mpuGetMotion6Block() {
+    MPU6050_MotionBlock block = { blockData[0], blockData[1], blockData[2], blockData[3], blockData[4], blockData[5] };
+    mpu.getMotion6Block(&block, MPU6050_MOTION_BLOCK_CHUNK);
+}
+
+static void mpuDmpInitialize() { mpu.dmpInitialize(); }
+static void mpuPrepareDmpRestart() {
+    // the usual sketch runs initialize() before dmpInitialize(), which
+    // leaves the resident image with the wrong clock and gyro range
+    mpu.dmpInitialize();
+    mpu.initialize();
+}
+static void mpuDmpInitializeNew() {
+    // a fresh object (MCU reset with the MPU still powered) must still
+    // come out of a warm start with the default packet layout
+    MPU6050 restarted;
+    restarted.dmpInitialize();
+    if (restarted.dmpGetFIFOPacketSize() != MPU6050_DMP_PACKET_SIZE) {
+        printf("warm start on a new object left packet size %u\n", restarted.dmpGetFIFOPacketSize());
+        wrong = true;
+    }
+    if ((mpuDevice.regs[MPU6050_RA_GYRO_CONFIG] & 0x18) != (MPU6050_GYRO_FS_2000 << 3)
+            || (mpuDevice.regs[MPU6050_RA_PWR_MGMT_1] & 0x07) != MPU6050_CLOCK_PLL_ZGYRO) {
+        printf("warm start left GYRO_CONFIG 0x%02X, PWR_MGMT_1 0x%02X\n",
+            mpuDevice.regs[MPU6050_RA_GYRO_CONFIG], mpuDevice.regs[MPU6050_RA_PWR_MGMT_1]);
+        wrong = true;
+    }
+}
+static void mpuPrepareDmpPacket() {
+    mpu.dmpInitialize();
+    mpu.setDMPEnabled(true);
+    delay(10);
+}
+static void mpuDmpPacket() {
+    uint8_t packet[64];
+    Quaternion q;
+    uint16_t packetSize = mpu.dmpGetFIFOPacketSize();
+    if (mpu.getIntStatus() & 0x02 && mpu.getFIFOCount() >= packetSize) {
+        mpu.getFIFOBytes(packet, packetSize);
+        mpu.dmpGetQuaternion(&q, packet);
+    }
+}
+
+static void adxlInitialize() { accel.initialize(); }
+static void adxlTestConnection() { accel.testConnection(); }
+static void adxlGetAcceleration() { accel.getAcceleration(&ax, &ay, &az); }
+
+static void bmpInitialize() { barometer.initialize(); }
+static void bmpTestConnection() { barometer.testConnection(); }
+static void bmpPrepare() { barometer.initialize(); }
+static void bmpTemperature() {
+    barometer.setControl(BMP085_MODE_TEMPERATURE);
+    delay(barometer.getMeasureDelayMilliseconds());
+    barometer.getTemperatureC();
+}
+static void bmpPressure() {
+    barometer.setControl(BMP085_MODE_PRESSURE_3);
+    delay(barometer.getMeasureDelayMilliseconds());
+    barometer.getPressure();
+}
+
+static void adsInitialize() { adc.initialize(); }
+static void adsTestConnection() { adc.testConnection(); }
+static void adsPrepare() { adc.initialize(); }
+static void adsSingleShot() { adc.getConversionP0GND(); }
+static void adsPrepareContinuous() {
+    adc.initialize();
+    adc.setMultiplexer(ADS1115_MUX_P0_NG);
+    adc.setMode(ADS1115_MODE_CONTINUOUS);
+}
+static void adsContinuous() { adc.getConversion(); }
+
+typedef struct Benchmark {
+    const char *name;
+    void (*prepare)();
+    void (*run)();
+    uint16_t maxTransactions;   // budget: transactions per call
+    uint16_t maxBytes;          // budget: data bytes per call
+} Benchmark;
+
+static const Benchmark benchmarks[] = {
+    { "MPU6050::initialize",                nothing,                mpuInitialize,           4,   41 },
+    { "MPU6050::testConnection",            nothing,                mpuTestConnection,       1,    1 },
+    { "MPU6050::getMotion6",                mpuInitialize,          mpuGetMotion6,           1,   14 },
+    { "MPU6050::getAcceleration",           mpuInitialize,          mpuGetAcceleration,      1,    6 },
+    { "MPU6050::getTemperature",            mpuInitialize,          mpuGetTemperature,       1,    2 },
+    { "MPU6050::setFullScaleAccelRange",    mpuInitialize,          mpuSetAccelRange,        1,    1 },
+    { "MPU6050::getIntStatus",              mpuInitialize,          mpuGetIntStatus,         1,    1 },
+    { "MPU6050::getMotion6Block (8)",       mpuPrepareBlock,        mpuGetMotion6Block,      2,   98 },
+    { "MPU6050::dmpInitialize (cold)",      nothing,                mpuDmpInitialize,      556, 4522 },
+    { "MPU6050::dmpInitialize (warm)",      mpuDmpInitialize,       mpuDmpInitialize,       21,   23 },
+    { "MPU6050::dmpInitialize (warm, new)", mpuPrepareDmpRestart,   mpuDmpInitializeNew,    21,   23 },
+    { "MPU6050 DMP packet",                 mpuPrepareDmpPacket,    mpuDmpPacket,            3,   45 },
+    { "ADXL345::initialize",                nothing,                adxlInitialize,          3,   30 },
+    { "ADXL345::testConnection",            nothing,                adxlTestConnection,      1,    1 },
+    { "ADXL345::getAcceleration",           adxlInitialize,         adxlGetAcceleration,     1,    6 },
+    { "BMP085::initialize",                 nothing,                bmpInitialize,           1,   22 },
+    { "BMP085::testConnection",             nothing,                bmpTestConnection,       1,    1 },
+    { "BMP085 temperature",                 bmpPrepare,             bmpTemperature,          2,    3 },
+    { "BMP085 pressure",                    bmpPrepare,             bmpPressure,             2,    4 },
+    { "ADS1115::initialize",                nothing,                adsInitialize,          32,   64 },
+    { "ADS1115::testConnection",            nothing,                adsTestConnection,       1,    2 },
+    { "ADS1115 single-shot P0GND",          adsPrepare,             adsSingleShot,           6,   12 },
+    { "ADS1115 continuous read",            adsPrepareContinuous,   adsContinuous,           1,    2 }
+};
+
+// MahonyAHRSFixed has to track the float filter it mirrors; the integral
+// path in particular only shows up with twoKi > 0 and a steady gyro bias
+static void checkMahonyFixed() {
+    const float scale = HELPER_AHRS_DEG_TO_RAD / 131.0f; // MPU6050 at +/- 250 deg/sec
+    MahonyAHRS reference(0.005f, scale, 1.0f, 0.5f);
+    MahonyAHRSFixed filter(5000, HELPER_AHRS_Q24(scale), HELPER_AHRS_Q16(1.0f), HELPER_AHRS_Q16(0.5f));
+    float worst = 0.0f;
+    for (uint16_t i = 0; i < 4000; i++) {
+        reference.updateRaw(40, -25, 30, 2000, -3000, 15000);
+        filter.updateRaw(40, -25, 30, 2000, -3000, 15000);
+        Quaternion a = reference.getQuaternion();
+        QuaternionFixed b = filter.getQuaternion();
+        float error = fabsf(a.w - b.w / 1073741824.0f) + fabsf(a.x - b.x / 1073741824.0f)
+            + fabsf(a.y - b.y / 1073741824.0f) + fabsf(a.z - b.z / 1073741824.0f);
+        if (error > worst) worst = error;
+    }
+    if (worst > 0.01f) {
+        printf("MahonyAHRSFixed strays %.4f from MahonyAHRS\n", worst);
+        wrong = true;
+    }
+}
+
+// fresh models for every entry, so no call benefits from an earlier one
+static void resetDevices() {
+    I2Cdev_simInit(&I2Cdev_simBus, I2Cdev_simBus.clockHz, I2Cdev_simBus.setupNanos);
+    I2Cdev_simInitMPU6050(&mpuDevice, &mpuState, MPU6050_DEFAULT_ADDRESS);
+    I2Cdev_simInitADXL345(&adxlDevice, ADXL345_DEFAULT_ADDRESS);
+    I2Cdev_simInitBMP085(&bmpDevice, &bmpState, BMP085_DEFAULT_ADDRESS);
+    I2Cdev_simInitADS1115(&adsDevice, &adsState, ADS1115_DEFAULT_ADDRESS);
+    I2Cdev_simAttach(&I2Cdev_simBus, &mpuDevice);
+    I2Cdev_simAttach(&I2Cdev_simBus, &adxlDevice);
+    I2Cdev_simAttach(&I2Cdev_simBus, &bmpDevice);
+    I2Cdev_simAttach(&I2Cdev_simBus, &adsDevice);
+    adsState.inputs[0] = 12345;
+    #ifdef I2CDEV_REGISTER_CACHE
+        // forget what the previous models held; the driver objects (and the
+        // cache ranges they registered) live on
+        I2Cdev::invalidateCache(MPU6050_DEFAULT_ADDRESS, 0, 256);
+        I2Cdev::invalidateCache(ADXL345_DEFAULT_ADDRESS, 0, 256);
+    #endif
+}
+
+int main(int argc, char **argv) {
+    uint32_t clockHz = argc > 1 ? (uint32_t)strtoul(argv[1], 0, 10) : I2CDEV_SIM_DEFAULT_CLOCK_HZ;
+    uint32_t setupNanos = argc > 2 ? (uint32_t)strtoul(argv[2], 0, 10) : I2CDEV_SIM_DEFAULT_SETUP_NANOS;
+    bool checkBudgets = argc <= 1;
+    uint8_t failed = 0;
+    uint8_t i;
+
+    I2Cdev_simInit(&I2Cdev_simBus, clockHz, setupNanos);
+    printf("I2Cdev bus benchmark: %lu Hz SCL, %lu ns per-transaction setup\n\n", (unsigned long)clockHz, (unsigned long)setupNanos);
+    printf("%-36s %6s %6s %6s %10s %10s\n", "call", "txns", "reads", "bytes", "bus us", "total us");
+
+    for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        const Benchmark *b = &benchmarks[i];
+        uint64_t started;
+
+        resetDevices();
+        b -> prepare();
+        I2Cdev_simResetCounters(&I2Cdev_simBus);
+        started = I2Cdev_simBus.nowNanos;
+        b -> run();
+
+        const I2Cdev_SimCounters *c = &I2Cdev_simBus.counters;
+        bool over = checkBudgets && (c -> transactions > b -> maxTransactions || c -> bytes > b -> maxBytes);
+        printf("%-36s %6lu %6lu %6lu %10.1f %10.1f%s\n", b -> name,
+            (unsigned long)c -> transactions, (unsigned long)c -> reads, (unsigned long)c -> bytes,
+            c -> busNanos / 1000.0, (I2Cdev_simBus.nowNanos - started) / 1000.0,
+            over ? "  OVER BUDGET" : "");
+        if (c -> nacks) printf("%-36s %6lu NACKed\n", "", (unsigned long)c -> nacks);
+        if (over) {
+            printf("%-36s budget %u txns, %u bytes\n", "", b -> maxTransactions, b -> maxBytes);
+            failed = 1;
+        }
+    }
+    checkMahonyFixed();
+    return failed || wrong;
+}
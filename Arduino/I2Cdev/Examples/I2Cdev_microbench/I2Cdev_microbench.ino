@@ -0,0 +1,248 @@
+// I2C device class (I2Cdev) on-target micro-benchmark sketch
+// Times the I2Cdev read/write primitives against a real slave and prints a
+// report that can be compared between I2CDEV_IMPLEMENTATION settings
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Build this sketch once per implementation you want to compare (change
+// I2CDEV_IMPLEMENTATION in I2Cdev.h, or pass it with -D where the build
+// system allows), run each on the same board and bus, and diff the reports.
+// All writes put back the values they read first, so the target device's
+// configuration is left as it was. For the simulated host-side bus
+// benchmark see ../../Benchmark/I2Cdev_benchmark.cpp.
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// I2Cdev must be installed as a library, or else the .cpp/.h files must be
+// in the include path of your project
+#include "I2Cdev.h"
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+    #include "Wire.h"
+#endif
+
+// target device and registers; the defaults suit an MPU6050/MPU9150 with
+// AD0 low: reads walk the sensor output block from ACCEL_XOUT_H, writes
+// rewrite SMPLRT_DIV..ACCEL_CONFIG with their current contents
+#define BENCH_ADDRESS       0x68
+#define BENCH_READ_REG      0x3B    // start of a readable block of at least BENCH_BLOCK_LENGTH
+#define BENCH_WRITE_REG     0x19    // start of a read/write block of at least BENCH_WRITE_LENGTH
+#define BENCH_WRITE_LENGTH  4
+
+// SCL rate requested from the backend, in kHz
+#define BENCH_CLOCK_KHZ     400
+
+// calls timed per report row
+#define BENCH_ITERATIONS    200
+
+// length of the readBlock() row; longer than one Wire/NBWire buffer so the
+// chunking cost shows up
+#define BENCH_BLOCK_LENGTH  64
+
+uint8_t buffer[BENCH_BLOCK_LENGTH];
+uint8_t original[BENCH_WRITE_LENGTH];
+
+// -----------------------------------------------------------------------------
+// Cycle counter: single-call latency in CPU cycles where the core has a free
+// running counter, micros() scaled to cycles everywhere else
+// -----------------------------------------------------------------------------
+
+#if defined(__AVR__)
+    // Timer1 free running at F_CPU; 16 bits cover 4ms at 16MHz, and calls
+    // that take longer are measured with micros() instead (see cyclesSince())
+    #define CYCLE_SOURCE "Timer1"
+    static void cycleCounterBegin() {
+        TCCR1A = 0;
+        TCCR1B = _BV(CS10);
+        TIMSK1 = 0;
+    }
+    static inline uint16_t cycleCounterRead() { return TCNT1; }
+    typedef uint16_t cycle_t;
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    // Cortex-M3/M4/M7 DWT cycle counter
+    #define CYCLE_SOURCE "DWT"
+    #define BENCH_DEMCR     (*(volatile uint32_t *)0xE000EDFC)
+    #define BENCH_DWT_CTRL  (*(volatile uint32_t *)0xE0001000)
+    #define BENCH_DWT_CYCNT (*(volatile uint32_t *)0xE0001004)
+    static void cycleCounterBegin() {
+        BENCH_DEMCR |= (1UL << 24);     // TRCENA
+        BENCH_DWT_CYCNT = 0;
+        BENCH_DWT_CTRL |= 1;            // CYCCNTENA
+    }
+    static inline uint32_t cycleCounterRead() { return BENCH_DWT_CYCNT; }
+    typedef uint32_t cycle_t;
+#else
+    #define CYCLE_SOURCE "micros"
+    static void cycleCounterBegin() {}
+    static inline uint32_t cycleCounterRead() { return micros() * (F_CPU / 1000000L); }
+    typedef uint32_t cycle_t;
+#endif
+
+static uint32_t cyclesSince(cycle_t startCycles, uint32_t startMicros) {
+    cycle_t cycles = (cycle_t)(cycleCounterRead() - startCycles);
+    uint32_t elapsed = micros() - startMicros;
+    // a narrow counter may have wrapped; fall back to the coarser clock
+    if ((uint64_t)elapsed * (F_CPU / 1000000L) > (cycle_t)~(cycle_t)0 / 2) {
+        return elapsed * (F_CPU / 1000000L);
+    }
+    return cycles;
+}
+
+// -----------------------------------------------------------------------------
+// Operations under test; each returns true on success
+// -----------------------------------------------------------------------------
+
+typedef bool (*BenchOp)(uint8_t length);
+
+static bool opReadByte(uint8_t length) {
+    return I2Cdev::readByte(BENCH_ADDRESS, BENCH_READ_REG, buffer) == 1;
+}
+
+static bool opReadBytes(uint8_t length) {
+    return I2Cdev::readBytes(BENCH_ADDRESS, BENCH_READ_REG, length, buffer) == (int8_t)length;
+}
+
+static bool opReadBlock(uint8_t length) {
+    return I2Cdev::readBlock(BENCH_ADDRESS, BENCH_READ_REG, length, buffer) == length;
+}
+
+static bool opWriteBits(uint8_t length) {
+    // rewrite the low field of the first write register with its own value
+    uint8_t mask = (1 << length) - 1;
+    return I2Cdev::writeBits(BENCH_ADDRESS, BENCH_WRITE_REG, length - 1, length, original[0] & mask);
+}
+
+static bool opWriteBytes(uint8_t length) {
+    return I2Cdev::writeBytes(BENCH_ADDRESS, BENCH_WRITE_REG, length, original);
+}
+
+struct BenchRow {
+    const char *name;
+    BenchOp op;
+    uint8_t length;     // bytes moved (bits for writeBits)
+    uint8_t bytes;      // data bytes on the bus per call, for throughput
+};
+
+static const BenchRow rows[] = {
+    { "readByte",   opReadByte,   1,  1 },
+    { "readBytes",  opReadBytes,  2,  2 },
+    { "readBytes",  opReadBytes,  6,  6 },
+    { "readBytes",  opReadBytes,  14, 14 },
+    { "readBytes",  opReadBytes,  32, 32 },
+    { "readBlock",  opReadBlock,  BENCH_BLOCK_LENGTH, BENCH_BLOCK_LENGTH },
+    { "writeBits",  opWriteBits,  1,  2 },  // read-modify-write: one byte each way
+    { "writeBits",  opWriteBits,  4,  2 },
+    { "writeBytes", opWriteBytes, 1,  1 },
+    { "writeBytes", opWriteBytes, BENCH_WRITE_LENGTH, BENCH_WRITE_LENGTH },
+};
+
+static const char *implementationName() {
+    #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+        return "I2CDEV_ARDUINO_WIRE";
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
+        return "I2CDEV_BUILTIN_NBWIRE";
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+        return "I2CDEV_BUILTIN_FASTWIRE";
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_I2CMASTER_LIBRARY
+        return "I2CDEV_I2CMASTER_LIBRARY";
+    #else
+        return "unknown";
+    #endif
+}
+
+static void runRow(const BenchRow *row) {
+    uint32_t minCycles = 0xFFFFFFFF, maxCycles = 0;
+    uint16_t errors = 0;
+
+    // one untimed call so a first-access cost (bus speed switch, cache load)
+    // is not charged to the row
+    row -> op(row -> length);
+
+    uint32_t started = micros();
+    for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+        uint32_t callMicros = micros();
+        cycle_t callCycles = cycleCounterRead();
+        bool ok = row -> op(row -> length);
+        uint32_t cycles = cyclesSince(callCycles, callMicros);
+        if (!ok) errors++;
+        if (cycles < minCycles) minCycles = cycles;
+        if (cycles > maxCycles) maxCycles = cycles;
+    }
+    uint32_t total = micros() - started;
+
+    // op,length,iterations,errors,us_per_call,min_cycles,max_cycles,bytes_per_s
+    Serial.print(row -> name); Serial.print(',');
+    Serial.print(row -> length); Serial.print(',');
+    Serial.print(BENCH_ITERATIONS); Serial.print(',');
+    Serial.print(errors); Serial.print(',');
+    Serial.print((float)total / BENCH_ITERATIONS, 1); Serial.print(',');
+    Serial.print(minCycles); Serial.print(',');
+    Serial.print(maxCycles); Serial.print(',');
+    Serial.println(total ? (uint32_t)((uint64_t)row -> bytes * BENCH_ITERATIONS * 1000000UL / total) : 0);
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+        Wire.begin();
+        #ifdef TWBR
+            TWBR = ((F_CPU / (BENCH_CLOCK_KHZ * 1000L)) - 16) / 2;
+        #endif
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
+        Wire.begin();
+        TWBR = ((F_CPU / (BENCH_CLOCK_KHZ * 1000L)) - 16) / 2;
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+        Fastwire::setup(BENCH_CLOCK_KHZ, true);
+    #endif
+
+    Serial.begin(38400);
+    cycleCounterBegin();
+
+    // header: everything needed to tell two reports apart
+    Serial.println(F("# I2Cdev micro-benchmark"));
+    Serial.print(F("# implementation=")); Serial.println(implementationName());
+    Serial.print(F("# f_cpu=")); Serial.println(F_CPU);
+    Serial.print(F("# clock_khz=")); Serial.println(BENCH_CLOCK_KHZ);
+    Serial.print(F("# cycles=")); Serial.println(CYCLE_SOURCE);
+    Serial.print(F("# device=0x")); Serial.println(BENCH_ADDRESS, HEX);
+
+    if (I2Cdev::readBytes(BENCH_ADDRESS, BENCH_WRITE_REG, BENCH_WRITE_LENGTH, original) != BENCH_WRITE_LENGTH) {
+        Serial.println(F("# device not responding, check BENCH_ADDRESS and wiring"));
+        return;
+    }
+
+    Serial.println(F("op,length,iterations,errors,us_per_call,min_cycles,max_cycles,bytes_per_s"));
+    for (uint8_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        runRow(&rows[i]);
+    }
+    Serial.println(F("# done"));
+}
+
+void loop() {
+}
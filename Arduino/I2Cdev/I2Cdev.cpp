@@ -3,6 +3,28 @@
 // 6/9/2012 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-14 - quarantine devices that keep failing and re-probe them with exponential backoff
+//      2026-10-14 - add probe()/scan() bus scan; transfers to addresses found empty fail without bus traffic
+//      2026-10-14 - add runScript() register scripts from flash
+//      2026-10-14 - hold the bus in blocking calls and defer submits from interrupts until it is released
+//      2026-10-14 - add I2CDEV_TIMESTAMPS read completion stamps and I2Cdev::getReadTimestamp()
+//      2026-10-14 - add readRaw() register-less reads and I2CDEV_TXN_NOREG queued transactions
+//      2026-10-14 - add I2CDEV_SOFTWARE_WIRE transfers on the bit-banged master
+//      2026-10-14 - join Fastwire register reads with repeated START and retry NACKed addresses with backoff
+//      2026-10-14 - run NBWire transfers through the interrupt-driven transaction queue
+//      2026-10-14 - add I2CDEV_HOST_SIMULATION transfers on the simulated host bus
+//      2026-10-14 - unpack readWords() results with the shared big-endian word kernel
+//      2026-10-14 - add I2Cdev_Bus handles for multiple buses and mux channels
+//      2026-10-14 - add per-device bus speed profiles with optional probing
+//      2026-10-14 - add binary ring-buffer trace of bus transactions (I2CDEV_TRACE)
+//      2026-10-14 - add optional per-device transaction statistics (I2CDEV_STATISTICS)
+//      2026-10-14 - add stuck bus detection and SCL clock-out recovery
+//      2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//      2026-10-14 - add compile-time register field descriptors (readField()/writeField())
+//      2026-10-14 - add readBlock()/writeBlock() for transfers larger than BUFFER_LENGTH
+//      2026-10-14 - add optional register shadow cache for read-modify-write operations
+//      2026-10-14 - add batched (scatter/gather) transactions with repeated START
+//      2026-10-14 - add asynchronous transaction queue (interrupt-driven with Fastwire)
 //      2013-05-06 - add Francesco Ferrara's Fastwire v0.24 implementation with small modifications
 //      2013-05-05 - fix issue with writing bit values to words (Sasquatch/Farzanegan)
 //      2012-06-09 - fix major issue with reading > 32 bytes at a time with Arduino Wire
@@ -45,6 +67,10 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 
+#if defined(I2CDEV_TRACE) && I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION
+    #include <stdio.h> // dumpTrace() prints to stdout
+#endif
+
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
 
     #ifdef I2CDEV_IMPLEMENTATION_WARNINGS
@@ -87,11 +113,194 @@ THE SOFTWARE.
 
 #endif
 
+// Fastwire and NBWire record every transaction as their queue finishes it;
+// the other implementations record from the blocking calls that drive the bus
+#if defined(I2CDEV_INSTRUMENT) && !defined(I2CDEV_TWI_QUEUE)
+    #define I2CDEV_INSTRUMENT_BLOCKING
+#endif
+
+#ifndef BUFFER_LENGTH
+    // piece size for readBlock()/writeBlock() when Wire.h doesn't provide one
+    #define BUFFER_LENGTH 32
+#endif
+
+#ifdef I2CDEV_TWI_QUEUE
+    // backend running submitted transactions from the TWI interrupt
+    #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+        typedef Fastwire I2Cdev_TwiQueue;
+    #else
+        typedef TwoWire I2Cdev_TwiQueue;
+    #endif
+#endif
+
+// Short critical sections around state shared with interrupt handlers, and
+// a test for running in one
+#if defined(__AVR__)
+    #define I2CDEV_CRITICAL_BEGIN   uint8_t sreg = SREG; cli()
+    #define I2CDEV_CRITICAL_END     SREG = sreg
+    // a cleared I flag also means cli() in the main context, so only
+    // I2Cdev::submitFromISR() marks interrupt context
+    #define I2CDEV_IN_INTERRUPT()   (dq_isr != 0)
+#elif defined(__arm__)
+    // Cortex-M: PRIMASK masks interrupts, IPSR is non-zero in a handler
+    #define I2CDEV_CRITICAL_BEGIN   uint32_t primask; __asm__ volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory")
+    #define I2CDEV_CRITICAL_END     __asm__ volatile ("msr primask, %0" :: "r" (primask) : "memory")
+    #define I2CDEV_IN_INTERRUPT()   (dq_isr != 0 || dq_ipsr() != 0)
+    static inline uint32_t dq_ipsr() {
+        uint32_t ipsr;
+        __asm__ volatile ("mrs %0, ipsr" : "=r" (ipsr));
+        return ipsr;
+    }
+#else
+    // no interrupts to mask (host simulation)
+    #define I2CDEV_CRITICAL_BEGIN
+    #define I2CDEV_CRITICAL_END
+    #define I2CDEV_IN_INTERRUPT()   (dq_isr != 0)
+#endif
+
+#ifndef I2CDEV_TWI_QUEUE
+    // Bus ownership for the implementations that run transfers from the
+    // calling code. Every blocking entry point holds the bus for its
+    // duration; transactions submitted while it is held, or from interrupt
+    // context, wait in a ring and run in the main context as soon as the
+    // outermost holder lets go (or at the next I2Cdev::runDeferred()).
+    static I2Cdev_Transaction *dq_queue[I2CDEV_QUEUE_LENGTH];
+    static volatile uint8_t dq_head = 0;    // next free slot (written by submit())
+    static volatile uint8_t dq_tail = 0;    // oldest deferred transaction (written by dq_drain())
+    static volatile uint8_t dq_depth = 0;   // nesting depth of blocking calls holding the bus
+    static volatile uint8_t dq_isr = 0;     // nesting depth of submitFromISR() calls
+
+    // run one transaction to completion on the calling context
+    static void dq_execute(I2Cdev_Transaction *txn) {
+        bool ok;
+        txn -> state = I2CDEV_TXN_ACTIVE;
+        if ((txn -> flags & (I2CDEV_TXN_READ | I2CDEV_TXN_NOREG)) == I2CDEV_TXN_NOREG) {
+            ok = I2Cdev::probe(txn -> devAddr);
+        } else if (txn -> flags & I2CDEV_TXN_NOREG) {
+            ok = I2Cdev::readRaw(txn -> devAddr, txn -> length, txn -> data) == (int16_t)txn -> length;
+        } else if (txn -> flags & I2CDEV_TXN_READ) {
+            ok = I2Cdev::readBlock(txn -> devAddr, txn -> regAddr, txn -> length, txn -> data) == (int16_t)txn -> length;
+        } else {
+            ok = I2Cdev::writeBlock(txn -> devAddr, txn -> regAddr, txn -> length, txn -> data);
+        }
+        I2Cdev_Callback callback = txn -> callback;
+        txn -> error = ok ? 0 : 1;
+        txn -> state = ok ? I2CDEV_TXN_DONE : I2CDEV_TXN_ERROR;
+        if (callback) callback(txn);
+    }
+
+    static bool dq_enqueue(I2Cdev_Transaction *txn) {
+        I2CDEV_CRITICAL_BEGIN;
+        uint8_t next = (dq_head + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+        if (next == dq_tail) {
+            I2CDEV_CRITICAL_END;
+            return false; // full
+        }
+        txn -> state = I2CDEV_TXN_QUEUED;
+        txn -> error = 0;
+        dq_queue[dq_head] = txn;
+        dq_head = next;
+        I2CDEV_CRITICAL_END;
+        return true;
+    }
+
+    // run deferred transactions in order until the ring is empty; the caller
+    // holds the bus, so work deferred by their callbacks joins the same pass
+    static void dq_drain() {
+        while (true) {
+            I2Cdev_Transaction *txn;
+            {
+                I2CDEV_CRITICAL_BEGIN;
+                if (dq_head == dq_tail) {
+                    I2CDEV_CRITICAL_END;
+                    return;
+                }
+                txn = dq_queue[dq_tail];
+                dq_tail = (dq_tail + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+                I2CDEV_CRITICAL_END;
+            }
+            dq_execute(txn);
+        }
+    }
+
+    class I2Cdev_BusGuard {
+        public:
+            I2Cdev_BusGuard() {
+                I2CDEV_CRITICAL_BEGIN;
+                // an interrupt landing in the middle of a transfer can't
+                // use the bus; anything else nests
+                held = !(dq_depth && I2CDEV_IN_INTERRUPT());
+                if (held) dq_depth++;
+                I2CDEV_CRITICAL_END;
+            }
+            ~I2Cdev_BusGuard() {
+                if (!held) return;
+                if (dq_depth == 1 && !I2CDEV_IN_INTERRUPT()) dq_drain();
+                I2CDEV_CRITICAL_BEGIN;
+                dq_depth--;
+                I2CDEV_CRITICAL_END;
+            }
+            bool held;
+    };
+
+    // take the bus for the rest of the calling function, or fail it if an
+    // interrupt tries to start a transfer while another is in progress
+    #define I2CDEV_HOLD_BUS(fail) I2Cdev_BusGuard busGuard; if (!busGuard.held) return fail
+#else
+    // the TWI queue already orders transfers from any context
+    #define I2CDEV_HOLD_BUS(fail)
+#endif
+
+#if defined(I2CDEV_PRESENCE_MAP) || defined(I2CDEV_DEVICE_BREAKER)
+    // an address a scan or probe found empty, or one in quarantine, fails
+    // without touching the bus
+    #define I2CDEV_CHECK_DEVICE(devAddr, fail) if (!I2Cdev::admit(devAddr)) return fail
+#else
+    #define I2CDEV_CHECK_DEVICE(devAddr, fail)
+#endif
+
 /** Default constructor.
  */
 I2Cdev::I2Cdev() {
 }
 
+// -----------------------------------------------------------------------------
+// Transport backend for the shared register core (I2Cdev_core.c)
+// -----------------------------------------------------------------------------
+
+static int16_t I2Cdev_transportRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    if (timeout == I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) timeout = I2Cdev::readTimeout;
+    // readBytes() keeps the register cache current, so prefer it when it can
+    if (length <= 0xFF) return I2Cdev::readBytes(devAddr, regAddr, length, data, timeout);
+    return I2Cdev::readBlock(devAddr, regAddr, length, data, timeout);
+}
+
+static uint8_t I2Cdev_transportWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    if (length <= 0xFF) return I2Cdev::writeBytes(devAddr, regAddr, length, data);
+    return I2Cdev::writeBlock(devAddr, regAddr, length, data);
+}
+
+#ifdef I2CDEV_REGISTER_CACHE
+    static uint8_t I2Cdev_transportLookup(void *context, uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
+        return I2Cdev::getCachedByte(devAddr, regAddr, data);
+    }
+#endif
+
+/** Register-level transport used by the bit and word accessors. Drivers and
+ * other core code can call the I2Cdev_core*() functions with it directly.
+ */
+const I2Cdev_Transport I2Cdev::transport = {
+    I2Cdev_transportRead,
+    I2Cdev_transportWrite,
+    #ifdef I2CDEV_REGISTER_CACHE
+        I2Cdev_transportLookup,
+    #else
+        0,
+    #endif
+    0,  // readAsync
+    0   // context
+};
+
 /** Read a single bit from an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
@@ -101,10 +310,7 @@ I2Cdev::I2Cdev() {
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
-    uint8_t b;
-    uint8_t count = readByte(devAddr, regAddr, &b, timeout);
-    *data = b & (1 << bitNum);
-    return count;
+    return I2Cdev_coreReadBit(&transport, devAddr, regAddr, bitNum, data, timeout);
 }
 
 /** Read a single bit from a 16-bit device register.
@@ -116,10 +322,7 @@ int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
-    uint16_t b;
-    uint8_t count = readWord(devAddr, regAddr, &b, timeout);
-    *data = b & (1 << bitNum);
-    return count;
+    return I2Cdev_coreReadBitW(&transport, devAddr, regAddr, bitNum, data, timeout);
 }
 
 /** Read multiple bits from an 8-bit device register.
@@ -132,19 +335,7 @@ int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
-    // 01101001 read byte
-    // 76543210 bit numbers
-    //    xxx   args: bitStart=4, length=3
-    //    010   masked
-    //   -> 010 shifted
-    uint8_t count, b;
-    if ((count = readByte(devAddr, regAddr, &b, timeout)) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        b &= mask;
-        b >>= (bitStart - length + 1);
-        *data = b;
-    }
-    return count;
+    return I2Cdev_coreReadBits(&transport, devAddr, regAddr, bitStart, length, data, timeout);
 }
 
 /** Read multiple bits from a 16-bit device register.
@@ -157,20 +348,7 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
 int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
-    // 1101011001101001 read byte
-    // fedcba9876543210 bit numbers
-    //    xxx           args: bitStart=12, length=3
-    //    010           masked
-    //           -> 010 shifted
-    uint8_t count;
-    uint16_t w;
-    if ((count = readWord(devAddr, regAddr, &w, timeout)) != 0) {
-        uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        w &= mask;
-        w >>= (bitStart - length + 1);
-        *data = w;
-    }
-    return count;
+    return I2Cdev_coreReadBitsW(&transport, devAddr, regAddr, bitStart, length, data, timeout);
 }
 
 /** Read single byte from an 8-bit device register.
@@ -204,6 +382,8 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16
  * @return Number of bytes read (-1 indicates failure)
  */
 int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+    I2CDEV_HOLD_BUS(-1);
+    I2CDEV_CHECK_DEVICE(devAddr, -1);
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.print("I2C (0x");
         Serial.print(devAddr, HEX);
@@ -213,9 +393,13 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
         Serial.print(regAddr, HEX);
         Serial.print("...");
     #endif
+    selectSpeed(devAddr);
 
     int8_t count = 0;
     uint32_t t1 = millis();
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        uint32_t started = micros();
+    #endif
 
     #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE)
 
@@ -290,21 +474,44 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
             }
         #endif
 
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
+    #elif defined(I2CDEV_TWI_QUEUE)
 
-        // Fastwire library
-        // no loop required for fastwire
-        uint8_t status = Fastwire::readBuf(devAddr << 1, regAddr, data, length);
-        if (status == 0) {
-            count = length; // success
-        } else {
-            count = -1; // error
-        }
+        // Fastwire or NBWire library
+        // no loop required, transaction goes through the TWI queue
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = regAddr;
+        txn.flags = I2CDEV_TXN_READ;
+        txn.length = length;
+        txn.data = data;
+        txn.callback = 0;
+        count = submit(&txn) ? wait(&txn, timeout) : -1;
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+
+        count = I2Cdev_simRead(&I2Cdev_simBus, devAddr, regAddr, length, data);
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+
+        // bit-banged, no buffer to split around
+        count = I2Cdev_SoftBus::readRegisters(devAddr, regAddr, length, data);
 
     #endif
 
     // check for timeout
     if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
+    #if defined(I2CDEV_TIMESTAMPS) && !defined(I2CDEV_TWI_QUEUE)
+        if (count > 0) lastReadMicros = micros(); // queued reads are stamped on completion
+    #endif
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        recordTransaction(devAddr, regAddr, I2CDEV_TXN_READ, length, data, count == (int8_t)length ? I2CDEV_RESULT_OK :
+            (timeout > 0 && millis() - t1 >= timeout) ? I2CDEV_RESULT_TIMEOUT : I2CDEV_RESULT_NACK, started);
+    #endif
+    if (count < (int8_t)length) checkBus(); // free a held line before the next call
+
+    #ifdef I2CDEV_REGISTER_CACHE
+        if (count == (int8_t)length) updateCache(devAddr, regAddr, length, data);
+    #endif
 
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.print(". Done (");
@@ -324,6 +531,8 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
  * @return Number of words read (-1 indicates failure)
  */
 int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
+    I2CDEV_HOLD_BUS(-1);
+    I2CDEV_CHECK_DEVICE(devAddr, -1);
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.print("I2C (0x");
         Serial.print(devAddr, HEX);
@@ -333,12 +542,21 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
         Serial.print(regAddr, HEX);
         Serial.print("...");
     #endif
+    selectSpeed(devAddr);
 
     int8_t count = 0;
     uint32_t t1 = millis();
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        uint32_t started = micros();
+    #endif
 
     #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE)
 
+        // word i only overlaps bytes 2i and 2i+1, so the caller's buffer
+        // holds the raw bytes and is converted in place afterwards
+        uint8_t *raw = (uint8_t *)data;
+        uint16_t received = 0;
+
         #if (ARDUINO < 100)
             // Arduino v00xx (before v1.0), Wire library
 
@@ -352,21 +570,9 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                 Wire.beginTransmission(devAddr);
                 Wire.requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
     
-                bool msb = true; // starts with MSB, then LSB
-                for (; Wire.available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
-                    if (msb) {
-                        // first byte is bits 15-8 (MSb=15)
-                        data[count] = Wire.receive() << 8;
-                    } else {
-                        // second byte is bits 7-0 (LSb=0)
-                        data[count] |= Wire.receive();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
-                        count++;
-                    }
-                    msb = !msb;
+                // collect raw big-endian bytes; they are unpacked in one pass below
+                for (; Wire.available() && received < length * 2 && (timeout == 0 || millis() - t1 < timeout); received++) {
+                    raw[received] = Wire.receive();
                 }
 
                 Wire.endTransmission();
@@ -385,21 +591,9 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                 Wire.beginTransmission(devAddr);
                 Wire.requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
     
-                bool msb = true; // starts with MSB, then LSB
-                for (; Wire.available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
-                    if (msb) {
-                        // first byte is bits 15-8 (MSb=15)
-                        data[count] = Wire.read() << 8;
-                    } else {
-                        // second byte is bits 7-0 (LSb=0)
-                        data[count] |= Wire.read();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
-                        count++;
-                    }
-                    msb = !msb;
+                // collect raw big-endian bytes; they are unpacked in one pass below
+                for (; Wire.available() && received < length * 2 && (timeout == 0 || millis() - t1 < timeout); received++) {
+                    raw[received] = Wire.read();
                 }
         
                 Wire.endTransmission();
@@ -418,38 +612,57 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                 Wire.beginTransmission(devAddr);
                 Wire.requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
         
-                bool msb = true; // starts with MSB, then LSB
-                for (; Wire.available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
-                    if (msb) {
-                        // first byte is bits 15-8 (MSb=15)
-                        data[count] = Wire.read() << 8;
-                    } else {
-                        // second byte is bits 7-0 (LSb=0)
-                        data[count] |= Wire.read();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
-                        count++;
-                    }
-                    msb = !msb;
+                // collect raw big-endian bytes; they are unpacked in one pass below
+                for (; Wire.available() && received < length * 2 && (timeout == 0 || millis() - t1 < timeout); received++) {
+                    raw[received] = Wire.read();
                 }
         
                 Wire.endTransmission();
             }
         #endif
 
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
+        count = received / 2;
+        I2Cdev_coreUnpackBE16(data, raw, count);
+        #ifdef I2CDEV_SERIAL_DEBUG
+            for (uint8_t i = 0; i < count; i++) {
+                Serial.print(data[i], HEX);
+                if (i + 1 < count) Serial.print(" ");
+            }
+        #endif
 
-        // Fastwire library
-        // no loop required for fastwire
-        uint16_t intermediate[(uint8_t)length];
-        uint8_t status = Fastwire::readBuf(devAddr << 1, regAddr, (uint8_t *)intermediate, (uint8_t)(length * 2));
-        if (status == 0) {
+    #elif defined(I2CDEV_TWI_QUEUE)
+
+        // Fastwire or NBWire library
+        // no loop required, raw bytes land in the caller's buffer
+        // and are then converted in place (word i occupies bytes 2i and 2i+1)
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = regAddr;
+        txn.flags = I2CDEV_TXN_READ;
+        txn.length = length * 2;
+        txn.data = (uint8_t *)data;
+        txn.callback = 0;
+        if (submit(&txn) && wait(&txn, timeout) >= 0) {
             count = length; // success
-            for (uint8_t i = 0; i < length; i++) {
-                data[i] = (intermediate[2*i] << 8) | intermediate[2*i + 1];
-            }
+            I2Cdev_coreUnpackBE16(data, txn.data, length);
+        } else {
+            count = -1; // error
+        }
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+
+        if (I2Cdev_simRead(&I2Cdev_simBus, devAddr, regAddr, length * 2, (uint8_t *)data) == length * 2) {
+            count = length;
+            I2Cdev_coreUnpackBE16(data, (uint8_t *)data, length);
+        } else {
+            count = -1; // no device at this address
+        }
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+
+        if (I2Cdev_SoftBus::readRegisters(devAddr, regAddr, length * 2, (uint8_t *)data) == length * 2) {
+            count = length;
+            I2Cdev_coreUnpackBE16(data, (uint8_t *)data, length);
         } else {
             count = -1; // error
         }
@@ -457,6 +670,15 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
     #endif
 
     if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
+    #if defined(I2CDEV_TIMESTAMPS) && !defined(I2CDEV_TWI_QUEUE)
+        if (count > 0) lastReadMicros = micros(); // queued reads are stamped on completion
+    #endif
+
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        recordTransaction(devAddr, regAddr, I2CDEV_TXN_READ, length * 2, (uint8_t *)data, count == (int8_t)length ? I2CDEV_RESULT_OK :
+            (timeout > 0 && millis() - t1 >= timeout) ? I2CDEV_RESULT_TIMEOUT : I2CDEV_RESULT_NACK, started);
+    #endif
+    if (count < (int8_t)length) checkBus(); // free a held line before the next call
 
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.print(". Done (");
@@ -475,10 +697,18 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-    uint8_t b;
-    readByte(devAddr, regAddr, &b);
-    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-    return writeByte(devAddr, regAddr, b);
+    return I2Cdev_coreWriteBit(&transport, devAddr, regAddr, bitNum, data);
+}
+
+/** Fetch the current value of a register ahead of a read-modify-write.
+ * Uses the register cache when available, otherwise reads the device.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read
+ * @param data Container for current register value
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::readForUpdate(uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
+    return I2Cdev_coreFetch(&transport, devAddr, regAddr, data);
 }
 
 /** write a single bit in a 16-bit device register.
@@ -489,10 +719,7 @@ bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
-    uint16_t w;
-    readWord(devAddr, regAddr, &w);
-    w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
-    return writeWord(devAddr, regAddr, w);
+    return I2Cdev_coreWriteBitW(&transport, devAddr, regAddr, bitNum, data);
 }
 
 /** Write multiple bits in an 8-bit device register.
@@ -504,24 +731,7 @@ bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
-    //      010 value to write
-    // 76543210 bit numbers
-    //    xxx   args: bitStart=4, length=3
-    // 00011100 mask byte
-    // 10101111 original value (sample)
-    // 10100011 original & ~mask
-    // 10101011 masked | value
-    uint8_t b;
-    if (readByte(devAddr, regAddr, &b) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        b &= ~(mask); // zero all important bits in existing byte
-        b |= data; // combine data with existing byte
-        return writeByte(devAddr, regAddr, b);
-    } else {
-        return false;
-    }
+    return I2Cdev_coreWriteBits(&transport, devAddr, regAddr, bitStart, length, data);
 }
 
 /** Write multiple bits in a 16-bit device register.
@@ -533,24 +743,7 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
-    //              010 value to write
-    // fedcba9876543210 bit numbers
-    //    xxx           args: bitStart=12, length=3
-    // 0001110000000000 mask word
-    // 1010111110010110 original value (sample)
-    // 1010001110010110 original & ~mask
-    // 1010101110010110 masked | value
-    uint16_t w;
-    if (readWord(devAddr, regAddr, &w) != 0) {
-        uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        w &= ~(mask); // zero all important bits in existing word
-        w |= data; // combine data with existing word
-        return writeWord(devAddr, regAddr, w);
-    } else {
-        return false;
-    }
+    return I2Cdev_coreWriteBitsW(&transport, devAddr, regAddr, bitStart, length, data);
 }
 
 /** Write single byte to an 8-bit device register.
@@ -580,117 +773,1704 @@ bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
  * @param data Buffer to copy new data from
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print("I2C (0x");
-        Serial.print(devAddr, HEX);
-        Serial.print(") writing ");
-        Serial.print(length, DEC);
-        Serial.print(" bytes to 0x");
-        Serial.print(regAddr, HEX);
-        Serial.print("...");
-    #endif
-    uint8_t status = 0;
-    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-        Wire.beginTransmission(devAddr);
-        Wire.send((uint8_t) regAddr); // send address
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-        Wire.beginTransmission(devAddr);
-        Wire.write((uint8_t) regAddr); // send address
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::beginTransmission(devAddr);
-        Fastwire::write(regAddr);
-    #endif
+bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
+    I2CDEV_HOLD_BUS(false);
+    I2CDEV_CHECK_DEVICE(devAddr, false);
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") writing ");
+        Serial.print(length, DEC);
+        Serial.print(" bytes to 0x");
+        Serial.print(regAddr, HEX);
+        Serial.print("...");
+    #endif
+    selectSpeed(devAddr);
+    uint8_t status = 0;
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        uint32_t started = micros();
+    #endif
+    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100))
+        Wire.beginTransmission(devAddr);
+        Wire.send((uint8_t) regAddr); // send address
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
+        Wire.beginTransmission(devAddr);
+        Wire.write((uint8_t) regAddr); // send address
+    #endif
+    for (uint8_t i = 0; i < length; i++) {
+        #ifdef I2CDEV_SERIAL_DEBUG
+            Serial.print(data[i], HEX);
+            if (i + 1 < length) Serial.print(" ");
+        #endif
+        #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100))
+            Wire.send((uint8_t) data[i]);
+        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
+            Wire.write((uint8_t) data[i]);
+        #endif
+    }
+    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100))
+        Wire.endTransmission();
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
+        status = Wire.endTransmission();
+    #elif defined(I2CDEV_TWI_QUEUE)
+        // whole write goes through the TWI queue as one transaction
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = regAddr;
+        txn.flags = I2CDEV_TXN_WRITE;
+        txn.length = length;
+        txn.data = data;
+        txn.callback = 0;
+        if (!submit(&txn) || wait(&txn) < 0) status = 1;
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+        if (!I2Cdev_simWrite(&I2Cdev_simBus, devAddr, regAddr, length, data)) status = 2; // address NACK
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+        if (!I2Cdev_SoftBus::writeRegisters(devAddr, regAddr, length, data)) status = 1;
+    #endif
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        recordTransaction(devAddr, regAddr, I2CDEV_TXN_WRITE, length, data, status == 0 ? I2CDEV_RESULT_OK :
+            (status == 2 || status == 3) ? I2CDEV_RESULT_NACK : I2CDEV_RESULT_ERROR, started);
+    #endif
+    if (status != 0) checkBus(); // free a held line before the next call
+    #ifdef I2CDEV_REGISTER_CACHE
+        // write-through on success; on failure the device state is unknown
+        if (status == 0) updateCache(devAddr, regAddr, length, data);
+        else invalidateCache(devAddr, regAddr, length);
+    #endif
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.println(". Done.");
+    #endif
+    return status == 0;
+}
+
+/** Write multiple words to a 16-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of words to write (at most I2CDEV_WRITE_WORDS_MAX, except with Arduino Wire)
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
+    I2CDEV_HOLD_BUS(false);
+    I2CDEV_CHECK_DEVICE(devAddr, false);
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") writing ");
+        Serial.print(length, DEC);
+        Serial.print(" words to 0x");
+        Serial.print(regAddr, HEX);
+        Serial.print("...");
+    #endif
+    selectSpeed(devAddr);
+    uint8_t status = 0;
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        uint32_t started = micros();
+    #endif
+    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100))
+        Wire.beginTransmission(devAddr);
+        Wire.send(regAddr); // send address
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
+        Wire.beginTransmission(devAddr);
+        Wire.write(regAddr); // send address
+    #elif (defined(I2CDEV_TWI_QUEUE) || I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION || I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+        uint8_t bytes[I2CDEV_WRITE_WORDS_MAX * 2]; // big-endian copy for the TWI queue
+        if (length > I2CDEV_WRITE_WORDS_MAX) return false;
+    #endif
+    for (uint8_t i = 0; i < length * 2; i++) {
+        #ifdef I2CDEV_SERIAL_DEBUG
+            Serial.print(data[i], HEX);
+            if (i + 1 < length) Serial.print(" ");
+        #endif
+        #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100))
+            Wire.send((uint8_t)(data[i] >> 8));     // send MSB
+            Wire.send((uint8_t)data[i++]);          // send LSB
+        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
+            Wire.write((uint8_t)(data[i] >> 8));    // send MSB
+            Wire.write((uint8_t)data[i++]);         // send LSB
+        #elif (defined(I2CDEV_TWI_QUEUE) || I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION || I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+            bytes[i] = (uint8_t)(data[i >> 1] >> 8);        // MSB
+            bytes[i + 1] = (uint8_t)data[i >> 1]; i++;      // LSB
+        #endif
+    }
+    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100))
+        Wire.endTransmission();
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
+        status = Wire.endTransmission();
+    #elif defined(I2CDEV_TWI_QUEUE)
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = regAddr;
+        txn.flags = I2CDEV_TXN_WRITE;
+        txn.length = length * 2;
+        txn.data = bytes;
+        txn.callback = 0;
+        if (!submit(&txn) || wait(&txn) < 0) status = 1;
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+        if (!I2Cdev_simWrite(&I2Cdev_simBus, devAddr, regAddr, length * 2, bytes)) status = 2; // address NACK
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+        if (!I2Cdev_SoftBus::writeRegisters(devAddr, regAddr, length * 2, bytes)) status = 1;
+    #endif
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        // trace the bytes as they went on the bus where a copy exists
+        #if (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION || I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+            const uint8_t *traced = bytes;
+        #else
+            const uint8_t *traced = (uint8_t *)data;
+        #endif
+        recordTransaction(devAddr, regAddr, I2CDEV_TXN_WRITE, length * 2, traced, status == 0 ? I2CDEV_RESULT_OK :
+            (status == 2 || status == 3) ? I2CDEV_RESULT_NACK : I2CDEV_RESULT_ERROR, started);
+    #endif
+    if (status != 0) checkBus(); // free a held line before the next call
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.println(". Done.");
+    #endif
+    return status == 0;
+}
+
+/** Apply a register script from flash.
+ * Runs of consecutive registers are coalesced into single burst writes and
+ * partial-mask entries read (or take from the register cache) the current
+ * value first; see I2Cdev_coreRunScript() and I2CDEV_SCRIPT_WRITE() for the
+ * script format. Typical driver bring-up shrinks from one setter call and
+ * transaction per field to a table of 3 bytes per field and a few bursts.
+ * @param devAddr I2C slave device address
+ * @param script Entries ending with I2CDEV_SCRIPT_END, declared I2CDEV_SCRIPT_PROGMEM
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::runScript(uint8_t devAddr, const uint8_t *script) {
+    return I2Cdev_coreRunScript(&transport, devAddr, script);
+}
+
+/** Read a block of bytes of any length in one logical transfer.
+ * The register address is sent once and the data is streamed into the
+ * caller's buffer. With Fastwire or the software master this is a single
+ * addressed read of the full length; with Arduino v1.0.1+ Wire it is split
+ * into BUFFER_LENGTH pieces joined by repeated START without re-sending the
+ * register address, so the device keeps incrementing its own register
+ * pointer (or keeps draining a FIFO port). Older Wire versions and NBWire fall back to re-addressed
+ * reads of the same register (BUFFER_LENGTH or NBWIRE_BUFFER_LENGTH bytes
+ * each), which suits FIFO/memory ports.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int16_t I2Cdev::readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    I2CDEV_HOLD_BUS(-1);
+    I2CDEV_CHECK_DEVICE(devAddr, -1);
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") reading block of ");
+        Serial.print(length, DEC);
+        Serial.print(" bytes from 0x");
+        Serial.print(regAddr, HEX);
+        Serial.print("...");
+    #endif
+    selectSpeed(devAddr);
+
+    int16_t count = 0;
+    uint32_t t1 = millis();
+    #if defined(I2CDEV_INSTRUMENT_BLOCKING) && I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO > 100
+        uint32_t started = micros();
+    #endif
+
+    #ifdef I2CDEV_TWI_QUEUE
+
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = regAddr;
+        txn.flags = I2CDEV_TXN_READ;
+        txn.length = length;
+        txn.data = data;
+        txn.callback = 0;
+        count = submit(&txn) ? wait(&txn, timeout) : -1;
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+
+        // one addressed read of the full length, as with Fastwire
+        count = I2Cdev_simRead(&I2Cdev_simBus, devAddr, regAddr, length, data);
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+
+        count = I2Cdev_SoftBus::readRegisters(devAddr, regAddr, length, data);
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO > 100)
+
+        Wire.beginTransmission(devAddr);
+        Wire.write(regAddr);
+        if (Wire.endTransmission(false) != 0) count = -1;
+        for (uint16_t k = 0; count >= 0 && k < length; ) {
+            uint8_t n = (length - k > BUFFER_LENGTH) ? BUFFER_LENGTH : (uint8_t)(length - k);
+            k += n;
+            Wire.requestFrom(devAddr, n, (uint8_t)(k >= length)); // STOP only after the last piece
+            for (; Wire.available() && count < (int16_t)k && (timeout == 0 || millis() - t1 < timeout); count++) {
+                data[count] = Wire.read();
+            }
+            if (count < (int16_t)k) break; // short read or timeout
+        }
+
+    #else
+
+        for (uint16_t k = 0; count >= 0 && k < length; ) {
+            uint8_t n = (length - k > BUFFER_LENGTH) ? BUFFER_LENGTH : (uint8_t)(length - k);
+            int8_t got = readBytes(devAddr, regAddr, n, data + k, timeout);
+            if (got != (int8_t)n) {
+                count = -1;
+                break;
+            }
+            k += n;
+            count = k;
+        }
+
+    #endif
+
+    if (timeout > 0 && millis() - t1 >= timeout && count < (int16_t)length) count = -1; // timeout
+    #if defined(I2CDEV_TIMESTAMPS) && !defined(I2CDEV_TWI_QUEUE)
+        if (count > 0) lastReadMicros = micros(); // queued reads are stamped on completion
+    #endif
+
+    #if defined(I2CDEV_INSTRUMENT_BLOCKING) && I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO > 100
+        recordTransaction(devAddr, regAddr, I2CDEV_TXN_READ, length, data, count == (int16_t)length ? I2CDEV_RESULT_OK :
+            (timeout > 0 && millis() - t1 >= timeout) ? I2CDEV_RESULT_TIMEOUT : I2CDEV_RESULT_NACK, started);
+    #endif
+    if (count < (int16_t)length) checkBus(); // free a held line before the next call
+
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print(". Done (");
+        Serial.print(count, DEC);
+        Serial.println(" read).");
+    #endif
+
+    return count;
+}
+
+/** Write a block of bytes of any length in one logical transfer.
+ * With Fastwire or the software master this is a single addressed write of
+ * the full length. Other implementations are limited by the Wire transmit
+ * buffer and send pieces of up to BUFFER_LENGTH - 1 (NBWIRE_BUFFER_LENGTH - 1
+ * with NBWire) bytes, each prefixed with the same register address, which
+ * suits FIFO/memory/display data ports.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    I2CDEV_HOLD_BUS(false);
+    I2CDEV_CHECK_DEVICE(devAddr, false);
+    #ifdef I2CDEV_TWI_QUEUE
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = regAddr;
+        txn.flags = I2CDEV_TXN_WRITE;
+        txn.length = length;
+        txn.data = data;
+        txn.callback = 0;
+        return submit(&txn) && wait(&txn) >= 0;
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+        return I2Cdev_simWrite(&I2Cdev_simBus, devAddr, regAddr, length, data);
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+        return I2Cdev_SoftBus::writeRegisters(devAddr, regAddr, length, data);
+    #else
+        // one byte of the Wire buffer goes to the register address
+        for (uint16_t k = 0; k < length; ) {
+            uint8_t n = (length - k > BUFFER_LENGTH - 1) ? BUFFER_LENGTH - 1 : (uint8_t)(length - k);
+            if (!writeBytes(devAddr, regAddr, n, data + k)) return false;
+            k += n;
+        }
+        return true;
+    #endif
+}
+
+/** Read bytes from a device without sending a register address first.
+ * A single addressed read (SLA+R) of the current device output, for parts
+ * with no register map (e.g. the iAQ-2000) or to continue from wherever a
+ * device's own register pointer was left. With Fastwire and NBWire the read
+ * goes through the TWI queue, so a slave stretching the clock holds only the
+ * bus, not the CPU; submit a transaction with I2CDEV_TXN_READ |
+ * I2CDEV_TXN_NOREG instead to avoid waiting for it at all.
+ * @param devAddr I2C slave device address
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int16_t I2Cdev::readRaw(uint8_t devAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    I2CDEV_HOLD_BUS(-1);
+    I2CDEV_CHECK_DEVICE(devAddr, -1);
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") reading ");
+        Serial.print(length, DEC);
+        Serial.print(" bytes without register address...");
+    #endif
+    selectSpeed(devAddr);
+
+    int16_t count = 0;
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE) || defined(I2CDEV_INSTRUMENT_BLOCKING)
+        uint32_t t1 = millis(); // the other backends time out in their own transfer
+    #endif
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        uint32_t started = micros();
+    #endif
+
+    #ifdef I2CDEV_TWI_QUEUE
+
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = 0;
+        txn.flags = I2CDEV_TXN_READ | I2CDEV_TXN_NOREG;
+        txn.length = length;
+        txn.data = data;
+        txn.callback = 0;
+        count = submit(&txn) ? wait(&txn, timeout) : -1;
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+
+        count = I2Cdev_simReadCurrent(&I2Cdev_simBus, devAddr, length, data);
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+
+        count = I2Cdev_SoftBus::readCurrent(devAddr, length, data);
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE)
+
+        // consecutive requests continue where the device left off
+        for (uint16_t k = 0; k < length; ) {
+            uint8_t n = (length - k > BUFFER_LENGTH) ? BUFFER_LENGTH : (uint8_t)(length - k);
+            k += n;
+            Wire.requestFrom(devAddr, n);
+            for (; Wire.available() && count < (int16_t)k && (timeout == 0 || millis() - t1 < timeout); count++) {
+                #if (ARDUINO < 100)
+                    data[count] = Wire.receive();
+                #else
+                    data[count] = Wire.read();
+                #endif
+            }
+            if (count < (int16_t)k) break; // short read or timeout
+        }
+
+    #endif
+
+    if (count < (int16_t)length) count = -1; // short read or timeout
+    #if defined(I2CDEV_TIMESTAMPS) && !defined(I2CDEV_TWI_QUEUE)
+        if (count > 0) lastReadMicros = micros(); // queued reads are stamped on completion
+    #endif
+    #ifdef I2CDEV_INSTRUMENT_BLOCKING
+        recordTransaction(devAddr, 0, I2CDEV_TXN_READ | I2CDEV_TXN_NOREG, length, data, count >= 0 ? I2CDEV_RESULT_OK :
+            (timeout > 0 && millis() - t1 >= timeout) ? I2CDEV_RESULT_TIMEOUT : I2CDEV_RESULT_NACK, started);
+    #endif
+    if (count < 0) checkBus(); // free a held line before the next call
+
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print(". Done (");
+        Serial.print(count, DEC);
+        Serial.println(" read).");
+    #endif
+
+    return count;
+}
+
+/** Default timeout value for read operations.
+ * Set this to 0 to disable timeout detection.
+ */
+uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
+
+#ifdef I2CDEV_TIMESTAMPS
+    /** micros() when the last successful read completed.
+     * @see getReadTimestamp()
+     */
+    volatile uint32_t I2Cdev::lastReadMicros = 0;
+#endif
+
+// -----------------------------------------------------------------------------
+// Per-device bus speed profiles
+// -----------------------------------------------------------------------------
+
+#ifdef I2CDEV_SPEED_PROFILES
+    uint8_t I2Cdev::speedAddr[I2CDEV_SPEED_PROFILES];
+    uint8_t I2Cdev::speedTwbr[I2CDEV_SPEED_PROFILES];
+    uint8_t I2Cdev::speedTwps[I2CDEV_SPEED_PROFILES];
+    uint8_t I2Cdev::speedUsed = 0;
+    uint8_t I2Cdev::defaultTwbr;
+    uint8_t I2Cdev::defaultTwps;
+#endif
+
+/** Give one device its own SCL rate.
+ * The TWI bit rate and prescaler are switched to this rate before every
+ * transaction with devAddr and back to the bus default (the rate in effect
+ * when the first profile is registered, so call this after Wire.begin() or
+ * Fastwire::setup()) for other devices.
+ * @param devAddr I2C slave device address
+ * @param khz SCL rate in kHz
+ * @return True if registered (false = table full, rate out of range, or no TWI)
+ */
+bool I2Cdev::setDeviceSpeed(uint8_t devAddr, uint16_t khz) {
+    #ifdef I2CDEV_SPEED_PROFILES
+        // SCL = F_CPU / (16 + 2 * TWBR * 4^TWPS); use the smallest prescaler that fits
+        if (khz == 0) return false;
+        int32_t div = ((int32_t)(F_CPU / 1000UL) / khz - 16) / 2;
+        uint8_t twps = 0;
+        if (div < 0) return false;
+        while (div > 255 && twps < 3) {
+            div >>= 2;
+            twps++;
+        }
+        if (div > 255) return false;
+
+        if (speedUsed == 0) {
+            defaultTwbr = TWBR;
+            defaultTwps = TWSR & 0x03;
+        }
+        uint8_t i;
+        for (i = 0; i < speedUsed && speedAddr[i] != devAddr; i++);
+        if (i == speedUsed) {
+            if (speedUsed == I2CDEV_SPEED_PROFILES) return false;
+            speedUsed++;
+        }
+        speedAddr[i] = devAddr;
+        speedTwbr[i] = (uint8_t)div;
+        speedTwps[i] = twps;
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/** Return a device to the bus default SCL rate.
+ * @param devAddr I2C slave device address
+ */
+void I2Cdev::clearDeviceSpeed(uint8_t devAddr) {
+    #ifdef I2CDEV_SPEED_PROFILES
+        for (uint8_t i = 0; i < speedUsed; i++) {
+            if (speedAddr[i] != devAddr) continue;
+            speedUsed--;
+            speedAddr[i] = speedAddr[speedUsed];
+            speedTwbr[i] = speedTwbr[speedUsed];
+            speedTwps[i] = speedTwps[speedUsed];
+            return;
+        }
+    #endif
+}
+
+/** Find the fastest SCL rate at which a device reads back reliably.
+ * Tries maxKhz, then 400, 300, 200 and 100 kHz (those not above maxKhz),
+ * reading regAddr repeatedly at each; the first rate that gives no errors
+ * and the same value every time is kept as the device's profile. Use a
+ * register that does not change, such as a WHO_AM_I/ID register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register with a constant value to read back
+ * @param maxKhz Fastest rate to try
+ * @return Rate kept in kHz (0 = none worked, device left at the bus default)
+ */
+uint16_t I2Cdev::probeDeviceSpeed(uint8_t devAddr, uint8_t regAddr, uint16_t maxKhz) {
+    #ifdef I2CDEV_SPEED_PROFILES
+        static const uint16_t rates[] = { 0, 400, 300, 200, 100 };
+        for (uint8_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+            uint16_t khz = r == 0 ? maxKhz : rates[r];
+            if (khz > maxKhz || (r > 0 && khz == maxKhz)) continue;
+            if (!setDeviceSpeed(devAddr, khz)) continue;
+
+            uint8_t first = 0, value;
+            bool reliable = true;
+            for (uint8_t n = 0; n < 8 && reliable; n++) {
+                if (readByte(devAddr, regAddr, &value) != 1) reliable = false;
+                else if (n == 0) first = value;
+                else if (value != first) reliable = false;
+            }
+            if (reliable) return khz;
+        }
+        clearDeviceSpeed(devAddr);
+    #endif
+    return 0;
+}
+
+/** Switch the TWI to the SCL rate registered for a device.
+ * Called before each transaction; only touches the hardware when the rate
+ * actually changes. The bus must be idle (or between a STOP and START).
+ * @param devAddr I2C slave device address about to be addressed
+ */
+void I2Cdev::selectSpeed(uint8_t devAddr) {
+    #ifdef I2CDEV_SPEED_PROFILES
+        if (speedUsed == 0) return;
+        uint8_t twbr = defaultTwbr, twps = defaultTwps;
+        for (uint8_t i = 0; i < speedUsed; i++) {
+            if (speedAddr[i] == devAddr) {
+                twbr = speedTwbr[i];
+                twps = speedTwps[i];
+                break;
+            }
+        }
+        if (TWBR != twbr) TWBR = twbr;
+        if ((TWSR & 0x03) != twps) TWSR = twps;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+// Bus scan and presence map
+// -----------------------------------------------------------------------------
+
+#ifdef I2CDEV_PRESENCE_MAP
+    uint8_t I2Cdev::presenceKnown[16];
+    uint8_t I2Cdev::presenceFound[16];
+#endif
+
+/** Check whether a device acknowledges its address. Sends START, the
+ * address with the write bit and STOP, and no data, so no register pointer
+ * or FIFO is touched. It is the cheapest transfer there is, about 0.1ms at
+ * 100kHz. A device busy with an internal write cycle (EEPROMs) may not
+ * acknowledge.
+ * With I2CDEV_PRESENCE_MAP the result is remembered (see isPresent()).
+ * @param devAddr I2C slave device address
+ * @return True if the address was acknowledged
+ */
+bool I2Cdev::probe(uint8_t devAddr) {
+    bool found = false;
+    #ifdef I2CDEV_TWI_QUEUE
+        I2Cdev_Transaction txn;
+        txn.devAddr = devAddr;
+        txn.regAddr = 0;
+        txn.flags = I2CDEV_TXN_WRITE | I2CDEV_TXN_NOREG;
+        txn.length = 0;
+        txn.data = 0;
+        txn.callback = 0;
+        found = submit(&txn) && wait(&txn) >= 0;
+    #else
+        I2CDEV_HOLD_BUS(false);
+        selectSpeed(devAddr);
+        #ifdef I2CDEV_INSTRUMENT_BLOCKING
+            uint32_t started = micros();
+        #endif
+
+        #if (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+            found = I2Cdev_simProbe(&I2Cdev_simBus, devAddr);
+        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+            found = I2Cdev_SoftBus::probe(devAddr);
+        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE)
+            Wire.beginTransmission(devAddr);
+            found = Wire.endTransmission() == 0;
+        #endif
+
+        #ifdef I2CDEV_INSTRUMENT_BLOCKING
+            recordTransaction(devAddr, 0, I2CDEV_TXN_WRITE | I2CDEV_TXN_NOREG, 0, 0, found ? I2CDEV_RESULT_OK : I2CDEV_RESULT_NACK, started);
+        #endif
+        if (!found) checkBus(); // a held line NACKs every address
+    #endif
+
+    #ifdef I2CDEV_PRESENCE_MAP
+        uint8_t i = (devAddr >> 3) & 0x0F, bit = 1 << (devAddr & 0x07);
+        presenceKnown[i] |= bit;
+        if (found) presenceFound[i] |= bit;
+        else presenceFound[i] &= ~bit;
+    #endif
+    return found;
+}
+
+/** Probe a range of addresses, e.g. once in setup() before the drivers'
+ * initialize() and testConnection() calls. A full scan of the default
+ * range is 112 probes, roughly 11ms at 100kHz and 3ms at 400kHz.
+ * Afterwards every transfer to an address that did not answer fails at once
+ * (with I2CDEV_PRESENCE_MAP). A device that is powered up later, or was busy
+ * during the scan, stays that way until probe() finds it or clearPresence()
+ * forgets the result.
+ * @param first Lowest address to probe (default skips the reserved 0x00-0x07)
+ * @param last Highest address to probe (default skips the reserved 0x78-0x7F)
+ * @return Number of addresses that acknowledged
+ */
+uint8_t I2Cdev::scan(uint8_t first, uint8_t last) {
+    uint8_t found = 0;
+    for (uint8_t devAddr = first; devAddr <= last && devAddr < 0x80; devAddr++) {
+        if (probe(devAddr)) found++;
+    }
+    return found;
+}
+
+/** Look an address up in the presence map.
+ * @param devAddr I2C slave device address
+ * @return 1 if it answered its last probe, 0 if it did not, -1 if it was
+ *         never probed (always -1 without I2CDEV_PRESENCE_MAP)
+ */
+int8_t I2Cdev::isPresent(uint8_t devAddr) {
+    #ifdef I2CDEV_PRESENCE_MAP
+        uint8_t i = (devAddr >> 3) & 0x0F, bit = 1 << (devAddr & 0x07);
+        if (!(presenceKnown[i] & bit)) return -1;
+        return (presenceFound[i] & bit) ? 1 : 0;
+    #else
+        return -1;
+    #endif
+}
+
+/** Forget probe results, so transfers to the address(es) are tried again.
+ * @param devAddr I2C slave device address, or 0xFF for the whole map
+ */
+void I2Cdev::clearPresence(uint8_t devAddr) {
+    #ifdef I2CDEV_PRESENCE_MAP
+        if (devAddr == 0xFF) {
+            memset(presenceKnown, 0, sizeof(presenceKnown));
+            return;
+        }
+        presenceKnown[(devAddr >> 3) & 0x0F] &= ~(1 << (devAddr & 0x07));
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+// Per-device circuit breaker
+// -----------------------------------------------------------------------------
+
+#ifdef I2CDEV_DEVICE_BREAKER
+    I2Cdev_Breaker I2Cdev::breakers[I2CDEV_BREAKER_DEVICES];
+    uint8_t I2Cdev::breakersUsed = 0;
+
+    // move an open breaker whose backoff has run out to half-open; true if it did
+    static bool I2Cdev_expireBreaker(I2Cdev_Breaker *b) {
+        #ifdef I2CDEV_TWI_QUEUE
+            // the TWI interrupt reopens breakers
+            uint8_t sreg = SREG;
+            cli();
+        #endif
+        bool expired = b -> state == I2CDEV_BREAKER_OPEN
+            && millis() - b -> openedAt >= ((uint32_t)I2CDEV_BREAKER_BACKOFF_MS << b -> backoffShift);
+        if (expired) b -> state = I2CDEV_BREAKER_HALF_OPEN;
+        #ifdef I2CDEV_TWI_QUEUE
+            SREG = sreg;
+        #endif
+        return expired;
+    }
+#endif
+
+/** Decide whether a transfer to a device should go to the bus at all.
+ * A device its breaker tracks as open fails at once; when the backoff has
+ * run out it is probed first (from the main context on the blocking
+ * backends), and only an answer lets the transfer through as the trial.
+ * Untracked and closed devices fall back to the presence map.
+ * @param devAddr I2C slave device address
+ * @return True if the transfer may proceed
+ */
+bool I2Cdev::admit(uint8_t devAddr) {
+    #ifdef I2CDEV_DEVICE_BREAKER
+        I2Cdev_Breaker *b = findBreaker(devAddr);
+        if (b && b -> state != I2CDEV_BREAKER_CLOSED) {
+            if (I2Cdev_expireBreaker(b)) {
+                #ifndef I2CDEV_TWI_QUEUE
+                    // a NACKed probe costs ~0.1ms, a trial transfer up to a
+                    // full timeout; a NACK reopens the breaker for longer
+                    if (!I2CDEV_IN_INTERRUPT()) probe(devAddr);
+                #endif
+            }
+            if (b -> state == I2CDEV_BREAKER_OPEN) {
+                b -> rejected++;
+                return false;
+            }
+            // the breaker, not the presence map, decides for a device it tracks
+            return true;
+        }
+    #endif
+    return isPresent(devAddr) != 0;
+}
+
+/** Re-probe quarantined devices whose backoff has run out, so a recovered
+ * device is found from loop() rather than by the next driver call. Devices
+ * that answer get one trial transfer; the others back off for longer.
+ * Call from loop(), not from an interrupt.
+ * @return Number of devices that answered and await their trial transfer
+ */
+uint8_t I2Cdev::serviceBreakers() {
+    uint8_t answered = 0;
+    #ifdef I2CDEV_DEVICE_BREAKER
+        for (uint8_t i = 0; i < breakersUsed; i++) {
+            I2Cdev_Breaker *b = &breakers[i];
+            if (!I2Cdev_expireBreaker(b)) continue;
+            probe(b -> devAddr);
+            if (b -> state == I2CDEV_BREAKER_HALF_OPEN) answered++;
+        }
+    #endif
+    return answered;
+}
+
+/** Close breakers and forget their failure history, e.g. after power
+ * cycling a sensor.
+ * @param devAddr I2C slave device address, or 0xFF for all devices
+ */
+void I2Cdev::resetBreaker(uint8_t devAddr) {
+    #ifdef I2CDEV_DEVICE_BREAKER
+        if (devAddr == 0xFF) {
+            breakersUsed = 0;
+            return;
+        }
+        I2Cdev_Breaker *b = findBreaker(devAddr);
+        if (b) *b = breakers[--breakersUsed];
+    #endif
+}
+
+#ifdef I2CDEV_DEVICE_BREAKER
+/** Get the breaker entry for a device.
+ * @param devAddr I2C slave device address
+ * @return Entry, or 0 if the device has not failed since its entry was last reused
+ */
+const I2Cdev_Breaker *I2Cdev::getBreaker(uint8_t devAddr) {
+    return findBreaker(devAddr);
+}
+
+/** Find the breaker entry tracking devAddr, or 0. */
+I2Cdev_Breaker *I2Cdev::findBreaker(uint8_t devAddr) {
+    for (uint8_t i = 0; i < breakersUsed; i++) {
+        if (breakers[i].devAddr == devAddr) return &breakers[i];
+    }
+    return 0;
+}
+
+/** Count one transaction outcome against its device, taking an entry on
+ * its first failure (from a recovered device if the table is full). */
+void I2Cdev::recordBreaker(uint8_t devAddr, uint8_t flags, uint16_t length, uint8_t result) {
+    // losing arbitration says nothing about the device
+    if (result == I2CDEV_RESULT_ARB_LOST) return;
+    I2Cdev_Breaker *b = findBreaker(devAddr);
+
+    // probes only count as the re-probe of a quarantined device, and an
+    // answer earns it a trial transfer rather than closing the breaker;
+    // empty addresses found by a scan are the presence map's business
+    bool probing = (flags & (I2CDEV_TXN_READ | I2CDEV_TXN_NOREG)) == I2CDEV_TXN_NOREG && length == 0;
+    if (probing && (!b || b -> state != I2CDEV_BREAKER_HALF_OPEN || result == I2CDEV_RESULT_OK)) return;
+
+    if (result == I2CDEV_RESULT_OK) {
+        if (!b) return;
+        #ifdef I2CDEV_PRESENCE_MAP
+            // a trial let through from an interrupt skipped the re-probe,
+            // so the map may still hold an earlier NACK
+            if (b -> state != I2CDEV_BREAKER_CLOSED && isPresent(devAddr) == 0) clearPresence(devAddr);
+        #endif
+        b -> state = I2CDEV_BREAKER_CLOSED;
+        b -> failures = 0;
+        b -> backoffShift = 0;
+        return;
+    }
+
+    if (!b) {
+        if (breakersUsed < I2CDEV_BREAKER_DEVICES) {
+            b = &breakers[breakersUsed++];
+        } else {
+            for (uint8_t i = 0; i < I2CDEV_BREAKER_DEVICES; i++) {
+                if (breakers[i].state == I2CDEV_BREAKER_CLOSED && breakers[i].failures == 0) {
+                    b = &breakers[i];
+                    break;
+                }
+            }
+            if (!b) return;
+        }
+        memset(b, 0, sizeof(I2Cdev_Breaker));
+        b -> devAddr = devAddr;
+    }
+    if (b -> failures < 255) b -> failures++;
+
+    if (b -> state == I2CDEV_BREAKER_HALF_OPEN) {
+        // the re-probe or trial failed: quarantine again, for longer
+        if (b -> backoffShift < I2CDEV_BREAKER_MAX_SHIFT) b -> backoffShift++;
+    } else if (b -> state == I2CDEV_BREAKER_CLOSED && b -> failures >= I2CDEV_BREAKER_THRESHOLD) {
+        b -> backoffShift = 0;
+        b -> trips++;
+    } else {
+        return;
+    }
+    b -> state = I2CDEV_BREAKER_OPEN;
+    b -> openedAt = millis();
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Transaction statistics
+// -----------------------------------------------------------------------------
+
+#ifdef I2CDEV_STATISTICS
+    I2Cdev_Stats I2Cdev::stats[I2CDEV_STATISTICS_DEVICES];
+    uint8_t I2Cdev::statsUsed = 0;
+#endif
+
+/** Account for one finished transaction in the statistics, trace and
+ * device breaker. Called by the bus implementations; drivers that move data
+ * by other means may call it too. Does nothing unless I2CDEV_STATISTICS,
+ * I2CDEV_TRACE or I2CDEV_DEVICE_BREAKER is defined.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address
+ * @param flags I2CDEV_TXN_READ or I2CDEV_TXN_WRITE
+ * @param length Number of data bytes requested
+ * @param data Transfer buffer (first bytes are traced, may be 0)
+ * @param result I2CDEV_RESULT_* outcome
+ * @param started micros() timestamp taken when the transaction began
+ */
+void I2Cdev::recordTransaction(uint8_t devAddr, uint8_t regAddr, uint8_t flags, uint16_t length, const uint8_t *data, uint8_t result, uint32_t started) {
+    #ifdef I2CDEV_STATISTICS
+        recordStats(devAddr, length, result, started);
+    #endif
+    #ifdef I2CDEV_TRACE
+        appendTrace(devAddr, regAddr, flags, length, data, result, started);
+    #endif
+    #ifdef I2CDEV_DEVICE_BREAKER
+        recordBreaker(devAddr, flags, length, result);
+    #endif
+}
+
+#ifdef I2CDEV_STATISTICS
+/** Update the statistics entry for devAddr, allocating it on first use. */
+void I2Cdev::recordStats(uint8_t devAddr, uint16_t bytes, uint8_t result, uint32_t started) {
+    uint32_t elapsed = micros() - started;
+    uint16_t us = elapsed > 0xFFFF ? 0xFFFF : (uint16_t)elapsed;
+    I2Cdev_Stats *entry = 0;
+    uint8_t i;
+
+    for (i = 0; i < statsUsed; i++) {
+        if (stats[i].devAddr == devAddr) {
+            entry = &stats[i];
+            break;
+        }
+    }
+    if (!entry) {
+        if (statsUsed < I2CDEV_STATISTICS_DEVICES) {
+            entry = &stats[statsUsed++];
+            memset(entry, 0, sizeof(I2Cdev_Stats));
+            entry -> devAddr = devAddr;
+            entry -> minMicros = 0xFFFF;
+        } else {
+            entry = &stats[I2CDEV_STATISTICS_DEVICES - 1];
+            entry -> devAddr = I2CDEV_STATS_OTHER;
+        }
+    }
+
+    entry -> transactions++;
+    switch (result) {
+        case I2CDEV_RESULT_OK:       entry -> bytes += bytes; break;
+        case I2CDEV_RESULT_NACK:     entry -> nacks++; break;
+        case I2CDEV_RESULT_TIMEOUT:  entry -> timeouts++; break;
+        case I2CDEV_RESULT_ARB_LOST: entry -> arbitrationLost++; break;
+        default:                     entry -> errors++; break;
+    }
+    if (us < entry -> minMicros) entry -> minMicros = us;
+    if (us > entry -> maxMicros) entry -> maxMicros = us;
+    entry -> totalMicros += us;
+}
+
+/** Get the statistics collected for one slave address.
+ * @param devAddr I2C slave device address (or I2CDEV_STATS_OTHER)
+ * @return Statistics entry, or 0 if nothing has been recorded for devAddr
+ */
+const I2Cdev_Stats *I2Cdev::getStats(uint8_t devAddr) {
+    for (uint8_t i = 0; i < statsUsed; i++) {
+        if (stats[i].devAddr == devAddr) return &stats[i];
+    }
+    return 0;
+}
+
+/** Forget all collected statistics. */
+void I2Cdev::resetStats() {
+    I2CDEV_CRITICAL_BEGIN;
+    statsUsed = 0;
+    I2CDEV_CRITICAL_END;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Binary transaction trace
+// -----------------------------------------------------------------------------
+
+#ifdef I2CDEV_TRACE
+    I2Cdev_TraceRecord I2Cdev::traceBuffer[I2CDEV_TRACE_LENGTH];
+    uint8_t I2Cdev::traceHead = 0;
+    uint8_t I2Cdev::traceCount = 0;
+    uint16_t I2Cdev::traceLost = 0;
+
+/** Append one record to the trace ring, overwriting the oldest when full.
+ * Only copies a few bytes, so it is cheap enough to run from the TWI
+ * interrupt without disturbing bus timing.
+ */
+void I2Cdev::appendTrace(uint8_t devAddr, uint8_t regAddr, uint8_t flags, uint16_t length, const uint8_t *data, uint8_t result, uint32_t started) {
+    I2Cdev_TraceRecord *record = &traceBuffer[traceHead];
+    uint8_t n = length < I2CDEV_TRACE_DATA_BYTES ? (uint8_t)length : I2CDEV_TRACE_DATA_BYTES;
+
+    record -> timestamp = started;
+    record -> devAddr = (devAddr << 1) | (flags & I2CDEV_TXN_READ);
+    record -> regAddr = regAddr;
+    record -> length = length;
+    record -> status = result;
+    for (uint8_t i = 0; i < I2CDEV_TRACE_DATA_BYTES; i++) {
+        record -> data[i] = (data && i < n) ? data[i] : 0;
+    }
+    traceHead = (traceHead + 1) & (I2CDEV_TRACE_LENGTH - 1);
+    if (traceCount < I2CDEV_TRACE_LENGTH) traceCount++;
+    else traceLost++;
+}
+
+/** Remove the oldest record from the trace ring.
+ * @param record Container for the copied record
+ * @return True if a record was copied, false if the trace is empty
+ */
+bool I2Cdev::readTrace(I2Cdev_TraceRecord *record) {
+    I2CDEV_CRITICAL_BEGIN;
+    if (traceCount == 0) {
+        I2CDEV_CRITICAL_END;
+        return false;
+    }
+    *record = traceBuffer[(traceHead - traceCount) & (I2CDEV_TRACE_LENGTH - 1)];
+    traceCount--;
+    I2CDEV_CRITICAL_END;
+    return true;
+}
+
+/** Get the number of records overwritten before they were read.
+ * @return Lost record count since the last clearTrace()
+ */
+uint16_t I2Cdev::getTraceLost() {
+    return traceLost;
+}
+
+/** Discard all buffered records and reset the lost counter. */
+void I2Cdev::clearTrace() {
+    I2CDEV_CRITICAL_BEGIN;
+    traceCount = 0;
+    traceLost = 0;
+    I2CDEV_CRITICAL_END;
+}
+
+/** Print and drain the trace, one record per line, to Serial (stdout in
+ * the host simulation).
+ * Format: timestamp (us), R/W, device, register, length, status, first data
+ * bytes, all hex. Call from a point where Serial time does not matter.
+ */
+void I2Cdev::dumpTrace() {
+    I2Cdev_TraceRecord record;
+    #if I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION
+        if (traceLost) printf("lost %u\n", traceLost);
+        while (readTrace(&record)) {
+            printf("%lX %c %X %X %u %u", (unsigned long)record.timestamp, (record.devAddr & 1) ? 'R' : 'W',
+                record.devAddr >> 1, record.regAddr, record.length, record.status);
+            for (uint8_t i = 0; i < I2CDEV_TRACE_DATA_BYTES && i < record.length; i++) printf(" %X", record.data[i]);
+            printf("\n");
+        }
+    #else
+        if (traceLost) {
+            Serial.print("lost ");
+            Serial.println(traceLost, DEC);
+        }
+        while (readTrace(&record)) {
+            Serial.print(record.timestamp, HEX);
+            Serial.print((record.devAddr & 1) ? " R " : " W ");
+            Serial.print(record.devAddr >> 1, HEX);
+            Serial.print(" ");
+            Serial.print(record.regAddr, HEX);
+            Serial.print(" ");
+            Serial.print(record.length, DEC);
+            Serial.print(" ");
+            Serial.print(record.status, DEC);
+            for (uint8_t i = 0; i < I2CDEV_TRACE_DATA_BYTES && i < record.length; i++) {
+                Serial.print(" ");
+                Serial.print(record.data[i], HEX);
+            }
+            Serial.println();
+        }
+    #endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Stuck bus recovery
+// -----------------------------------------------------------------------------
+
+#ifdef I2CDEV_BUS_RECOVERY
+    /** Recovery counters (stuck lines seen, recoveries that worked/failed). */
+    I2Cdev_RecoveryStats I2Cdev::recoveryStats = { 0, 0, 0 };
+
+    // open-drain emulation: drive low, or float with the pull-up
+    static void I2Cdev_pullLine(uint8_t pin) {
+        digitalWrite(pin, LOW);
+        pinMode(pin, OUTPUT);
+    }
+
+    static void I2Cdev_releaseLine(uint8_t pin) {
+        #ifdef INPUT_PULLUP
+            pinMode(pin, INPUT_PULLUP);
+        #else
+            // cores before 1.0.1: writing HIGH to an input enables the pull-up
+            pinMode(pin, INPUT);
+            digitalWrite(pin, HIGH);
+        #endif
+    }
+#endif
+
+/** Check whether a slave is holding SDA or SCL low.
+ * Only meaningful while no transfer is in progress.
+ * @return True if either line is low (always false without I2CDEV_BUS_RECOVERY)
+ */
+bool I2Cdev::isBusStuck() {
+    #ifdef I2CDEV_BUS_RECOVERY
+        return digitalRead(I2CDEV_RECOVERY_SDA_PIN) == LOW || digitalRead(I2CDEV_RECOVERY_SCL_PIN) == LOW;
+    #else
+        return false;
+    #endif
+}
+
+/** Free a bus held by a slave and re-initialise the TWI.
+ * The TWI is switched off, SCL is toggled (up to nine times, until the slave
+ * lets go of SDA) to finish whatever byte it believes it is sending, a STOP
+ * is generated, and the TWI is brought back up at its previous bit rate.
+ * A Fastwire transaction that was on the bus is restarted from the beginning.
+ * Takes about 0.1ms and updates I2Cdev::recoveryStats.
+ * @return True if both lines are released afterwards
+ */
+bool I2Cdev::recoverBus() {
+    #ifdef I2CDEV_BUS_RECOVERY
+        #ifdef TWBR
+            uint8_t twbr = TWBR;
+            TWCR = 0; // hand the pins back to the port registers
+        #endif
+
+        I2Cdev_releaseLine(I2CDEV_RECOVERY_SDA_PIN);
+        I2Cdev_releaseLine(I2CDEV_RECOVERY_SCL_PIN);
+        delayMicroseconds(I2CDEV_RECOVERY_HALF_PERIOD);
+
+        for (uint8_t i = 0; i < 9 && digitalRead(I2CDEV_RECOVERY_SDA_PIN) == LOW; i++) {
+            I2Cdev_pullLine(I2CDEV_RECOVERY_SCL_PIN);
+            delayMicroseconds(I2CDEV_RECOVERY_HALF_PERIOD);
+            I2Cdev_releaseLine(I2CDEV_RECOVERY_SCL_PIN);
+            delayMicroseconds(I2CDEV_RECOVERY_HALF_PERIOD);
+            // allow a slave to stretch the clock for a little while
+            for (uint8_t w = 0; w < 20 && digitalRead(I2CDEV_RECOVERY_SCL_PIN) == LOW; w++) {
+                delayMicroseconds(I2CDEV_RECOVERY_HALF_PERIOD);
+            }
+        }
+
+        // STOP: SDA rises while SCL is high
+        I2Cdev_pullLine(I2CDEV_RECOVERY_SDA_PIN);
+        delayMicroseconds(I2CDEV_RECOVERY_HALF_PERIOD);
+        I2Cdev_releaseLine(I2CDEV_RECOVERY_SDA_PIN);
+        delayMicroseconds(I2CDEV_RECOVERY_HALF_PERIOD);
+
+        bool released = !isBusStuck();
+        if (released) recoveryStats.recovered++;
+        else recoveryStats.failed++;
+
+        #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
+            Wire.begin(); // resets the driver state as well as the hardware
+            #ifdef TWBR
+                TWBR = twbr;
+            #endif
+            #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
+                TwoWire::resume();
+            #endif
+        #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+            TWBR = twbr;
+            TWCR = 1 << TWEN;
+            Fastwire::resume();
+        #endif
+        return released;
+    #else
+        return false;
+    #endif
+}
+
+/** Recover the bus if a line is stuck low while the bus should be idle. */
+void I2Cdev::checkBus() {
+    #ifdef I2CDEV_BUS_RECOVERY
+        #ifdef I2CDEV_TWI_QUEUE
+            if (I2Cdev_TwiQueue::queued()) return; // lines are legitimately busy
+        #endif
+        if (!isBusStuck()) return;
+        recoveryStats.stuck++;
+        recoverBus();
+    #endif
+}
+
+#ifdef I2CDEV_REGISTER_CACHE
+/** Head of the list of cache ranges declared by drivers. */
+I2Cdev_CacheRange *I2Cdev::cacheRanges = 0;
+
+/** Declare a span of registers as cacheable.
+ * Calling this again with a range that is already registered reconfigures it
+ * and drops any cached values.
+ * @param range Driver-owned descriptor (must stay valid while registered)
+ * @param devAddr I2C slave device address
+ * @param regAddr First register in the span
+ * @param length Number of registers in the span (not more than 32)
+ * @param values Driver-owned storage for length bytes
+ * @param volatileMask Bit n set marks register regAddr + n as never cacheable
+ */
+void I2Cdev::addCacheRange(I2Cdev_CacheRange *range, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *values, uint32_t volatileMask) {
+    range -> devAddr = devAddr;
+    range -> regAddr = regAddr;
+    range -> length = length > 32 ? 32 : length;
+    range -> volatileMask = volatileMask;
+    range -> validMask = 0;
+    range -> values = values;
+    for (I2Cdev_CacheRange *r = cacheRanges; r; r = r -> next) {
+        if (r == range) return; // already listed
+    }
+    range -> next = cacheRanges;
+    cacheRanges = range;
+}
+
+/** Stop caching a previously declared span of registers.
+ * @param range Descriptor passed to addCacheRange()
+ */
+void I2Cdev::removeCacheRange(I2Cdev_CacheRange *range) {
+    for (I2Cdev_CacheRange **r = &cacheRanges; *r; r = &(*r) -> next) {
+        if (*r == range) {
+            *r = range -> next;
+            return;
+        }
+    }
+}
+
+/** Fill a cache range from the device with a single burst read.
+ * @param range Descriptor passed to addCacheRange()
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Status of read operation (true = success)
+ */
+bool I2Cdev::loadCacheRange(I2Cdev_CacheRange *range, uint16_t timeout) {
+    // readBytes() marks the span valid on success via updateCache()
+    return readBytes(range -> devAddr, range -> regAddr, range -> length, range -> values, timeout) == (int8_t)range -> length;
+}
+
+/** Forget cached values so the next read-modify-write reads the device again.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register to forget (leave off for all registers)
+ * @param length Number of registers to forget (leave off for all registers)
+ */
+void I2Cdev::invalidateCache(uint8_t devAddr, uint8_t regAddr, uint16_t length) {
+    for (I2Cdev_CacheRange *r = cacheRanges; r; r = r -> next) {
+        if (r -> devAddr != devAddr) continue;
+        for (uint8_t n = 0; n < r -> length; n++) {
+            uint8_t reg = r -> regAddr + n;
+            if (reg >= regAddr && reg - regAddr < length) r -> validMask &= ~((uint32_t)1 << n);
+        }
+    }
+}
+
+/** Look up the last known value of a register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register to look up
+ * @param data Container for cached byte value
+ * @return True if a current value was cached
+ */
+bool I2Cdev::getCachedByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
+    for (I2Cdev_CacheRange *r = cacheRanges; r; r = r -> next) {
+        uint8_t n = regAddr - r -> regAddr;
+        if (r -> devAddr == devAddr && regAddr >= r -> regAddr && n < r -> length) {
+            if (!(r -> validMask & ((uint32_t)1 << n))) return false;
+            *data = r -> values[n];
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Record bytes just read from or written to a device in any matching range.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register transferred
+ * @param length Number of bytes transferred
+ * @param data Transferred bytes
+ */
+void I2Cdev::updateCache(uint8_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data) {
+    for (I2Cdev_CacheRange *r = cacheRanges; r; r = r -> next) {
+        if (r -> devAddr != devAddr) continue;
+        for (uint8_t i = 0; i < length; i++) {
+            uint8_t n = (uint8_t)(regAddr + i) - r -> regAddr;
+            if ((uint8_t)(regAddr + i) < r -> regAddr || n >= r -> length) continue;
+            uint32_t bit = (uint32_t)1 << n;
+            if (r -> volatileMask & bit) continue;
+            r -> values[n] = data[i];
+            r -> validMask |= bit;
+        }
+    }
+}
+#endif
+
+/** Queue a transaction for execution.
+ * With the Fastwire and NBWire implementations the transaction is appended
+ * to the TWI queue and this returns immediately; progress is made from the
+ * TWI interrupt and the descriptor's callback (if any) is called from
+ * interrupt context on completion. Other implementations execute the
+ * transaction right away and call the callback before returning, unless the
+ * bus is busy with another transfer: then the transaction is deferred, runs
+ * in the main context as soon as the transfer in progress finishes (or at
+ * the next I2Cdev::runDeferred()), and its callback is called from there.
+ * Interrupt handlers must use submitFromISR() instead.
+ * @param txn Caller-owned transaction descriptor (must stay valid until done)
+ * @return True if the transaction was accepted (false = queue full or invalid)
+ * @see I2Cdev::wait()
+ */
+bool I2Cdev::submit(I2Cdev_Transaction *txn) {
+    if (txn == 0 || ((txn -> flags & I2CDEV_TXN_READ) && txn -> length == 0)) return false;
+    bool probing = (txn -> flags & (I2CDEV_TXN_READ | I2CDEV_TXN_NOREG)) == I2CDEV_TXN_NOREG;
+    if (probing && txn -> length != 0) return false; // register-less writes are address probes only
+    #if defined(I2CDEV_PRESENCE_MAP) || defined(I2CDEV_DEVICE_BREAKER)
+        // a probe is how an address gets back into the map or out of quarantine
+        if (!probing && !admit(txn -> devAddr)) return false;
+    #endif
+    #ifdef I2CDEV_TWI_QUEUE
+        #ifdef I2CDEV_REGISTER_CACHE
+            // completes later, so don't trust cached values for the span until
+            // something reads or writes them synchronously again
+            if (!(txn -> flags & I2CDEV_TXN_READ)) invalidateCache(txn -> devAddr, txn -> regAddr, txn -> length);
+        #endif
+        return I2Cdev_TwiQueue::enqueue(txn);
+    #else
+        if (dq_depth || I2CDEV_IN_INTERRUPT()) return dq_enqueue(txn);
+        dq_execute(txn);
+        return true;
+    #endif
+}
+
+/** Queue a transaction from an interrupt handler.
+ * As submit(), except that the blocking implementations always defer the
+ * transaction to the main context instead of running it on the spot.
+ * @param txn Caller-owned transaction descriptor (must stay valid until done)
+ * @return True if the transaction was accepted (false = queue full or invalid)
+ */
+bool I2Cdev::submitFromISR(I2Cdev_Transaction *txn) {
+    #ifdef I2CDEV_TWI_QUEUE
+        return submit(txn);
+    #else
+        dq_isr++;
+        bool accepted = submit(txn);
+        dq_isr--;
+        return accepted;
+    #endif
+}
+
+/** Run transactions deferred by submitFromISR() from interrupt context.
+ * Deferred work also runs whenever a blocking call releases the bus, so this
+ * is only needed to pick up transactions an interrupt submitted while the bus
+ * was idle; call it from loop(). Does nothing from interrupt context or with
+ * the Fastwire and NBWire implementations.
+ */
+void I2Cdev::runDeferred() {
+    #ifndef I2CDEV_TWI_QUEUE
+        if (I2CDEV_IN_INTERRUPT()) return;
+        I2Cdev_BusGuard busGuard; // drains on release if outermost
+        if (dq_depth > 1) dq_drain(); // e.g. wait() from a callback
+    #endif
+}
+
+/** Check whether a submitted transaction has finished (successfully or not).
+ * @param txn Transaction descriptor previously passed to submit()
+ * @return True if the transaction is no longer queued or on the bus
+ */
+bool I2Cdev::isComplete(const I2Cdev_Transaction *txn) {
+    return txn -> state != I2CDEV_TXN_QUEUED && txn -> state != I2CDEV_TXN_ACTIVE;
+}
+
+/** Block until a submitted transaction finishes.
+ * If the timeout expires the transaction is aborted.
+ * @param txn Transaction descriptor previously passed to submit()
+ * @param timeout Optional timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes transferred (-1 indicates failure, abort or timeout)
+ */
+int16_t I2Cdev::wait(I2Cdev_Transaction *txn, uint16_t timeout) {
+    uint32_t t1 = millis();
+    while (!isComplete(txn)) {
+        #ifdef I2CDEV_TWI_QUEUE
+            // called with interrupts disabled (e.g. from an ISR), so drive the
+            // state machine by polling instead of waiting for TWI_vect
+            if (!(SREG & 0x80) && (TWCR & (1 << TWINT))) I2Cdev_TwiQueue::service();
+        #else
+            // deferred behind nothing in the main context: run it now
+            if (txn -> state == I2CDEV_TXN_QUEUED) runDeferred();
+        #endif
+        if (timeout > 0 && millis() - t1 >= timeout && !isComplete(txn)) {
+            abort(txn);
+            checkBus();
+            return -1;
+        }
+    }
+    return txn -> state == I2CDEV_TXN_DONE ? txn -> length : -1;
+}
+
+/** Cancel a queued or in-progress transaction.
+ * An in-progress transaction is cut short by resetting the TWI hardware.
+ * @param txn Transaction descriptor previously passed to submit()
+ * @return True if the transaction was removed from the queue
+ */
+bool I2Cdev::abort(I2Cdev_Transaction *txn) {
+    #ifdef I2CDEV_TWI_QUEUE
+        return I2Cdev_TwiQueue::cancel(txn);
+    #else
+        // only deferred transactions can still be cancelled
+        bool found = false;
+        I2CDEV_CRITICAL_BEGIN;
+        for (uint8_t i = dq_tail; i != dq_head; i = (i + 1) & (I2CDEV_QUEUE_LENGTH - 1)) {
+            if (!found && dq_queue[i] != txn) continue;
+            found = true;
+            uint8_t next = (i + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+            if (next != dq_head) dq_queue[i] = dq_queue[next];
+        }
+        if (found) {
+            dq_head = (dq_head - 1) & (I2CDEV_QUEUE_LENGTH - 1);
+            txn -> state = I2CDEV_TXN_ABORTED;
+        }
+        I2CDEV_CRITICAL_END;
+        return found;
+    #endif
+}
+
+/** Get number of transactions waiting for or currently using the bus.
+ * @return Pending transaction count (only deferred ones without Fastwire or NBWire)
+ */
+uint8_t I2Cdev::getQueueCount() {
+    #ifdef I2CDEV_TWI_QUEUE
+        return I2Cdev_TwiQueue::queued();
+    #else
+        return (dq_head - dq_tail) & (I2CDEV_QUEUE_LENGTH - 1);
+    #endif
+}
+
+/** Execute a list of register reads/writes back-to-back.
+ * Segments may address any mix of devices and registers. Where the bus
+ * implementation allows it, segments are chained with a repeated START
+ * instead of STOP + START, so the whole list costs one bus arbitration.
+ * The I2CDEV_TXN_NOSTOP flag is managed by this function and need not be set
+ * by the caller. Status of each segment is left in its state/error members.
+ * @param segments Array of transaction descriptors (callbacks are honoured)
+ * @param count Number of descriptors in the array
+ * @param timeout Optional timeout in milliseconds for the whole batch (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of segments that completed successfully
+ */
+uint8_t I2Cdev::executeBatch(I2Cdev_Transaction *segments, uint8_t count, uint16_t timeout) {
+    I2CDEV_HOLD_BUS(0);
+    uint8_t ok = 0;
+    uint8_t i;
+    uint32_t t1 = millis();
+    #ifdef I2CDEV_TWI_QUEUE
+        // queue as many segments as fit; each time the ring is full, wait for
+        // the oldest outstanding segment before queueing more
+        uint8_t head = 0;
+        for (i = 0; i < count; i++) {
+            if (i + 1 < count) segments[i].flags |= I2CDEV_TXN_NOSTOP;
+            else segments[i].flags &= ~I2CDEV_TXN_NOSTOP;
+            while (!submit(&segments[i])) {
+                if (timeout > 0 && millis() - t1 >= timeout) {
+                    segments[i].state = I2CDEV_TXN_ERROR;
+                    break;
+                }
+                if (head < i && isComplete(&segments[head])) {
+                    if (segments[head].state == I2CDEV_TXN_DONE) ok++;
+                    head++;
+                }
+            }
+        }
+        for (; head < count; head++) {
+            if (!isComplete(&segments[head])) {
+                uint16_t left = 0;
+                if (timeout > 0) {
+                    uint32_t spent = millis() - t1;
+                    left = spent >= timeout ? 1 : timeout - spent;
+                }
+                wait(&segments[head], left);
+            }
+            if (segments[head].state == I2CDEV_TXN_DONE) ok++;
+        }
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO > 100)
+        // Arduino v1.0.1+, Wire library supports holding the bus between transfers
+        for (i = 0; i < count; i++) {
+            I2Cdev_Transaction *txn = &segments[i];
+            uint8_t sendStop = (i + 1 == count);
+            bool success;
+            txn -> state = I2CDEV_TXN_ACTIVE;
+            if (timeout > 0 && millis() - t1 >= timeout) {
+                success = false;
+            } else if ((txn -> flags & (I2CDEV_TXN_READ | I2CDEV_TXN_NOREG)) == I2CDEV_TXN_NOREG) {
+                success = probe(txn -> devAddr);
+            } else if (txn -> flags & I2CDEV_TXN_NOREG) {
+                // no register phase to chain, runs as its own transfer
+                success = readRaw(txn -> devAddr, txn -> length, txn -> data, timeout) == (int16_t)txn -> length;
+            } else if ((txn -> flags & I2CDEV_TXN_READ) && txn -> length > BUFFER_LENGTH) {
+                // too big for one Wire request, fall back to the chunked path
+                success = readBlock(txn -> devAddr, txn -> regAddr, txn -> length, txn -> data, timeout) == (int16_t)txn -> length;
+            } else if (txn -> flags & I2CDEV_TXN_READ) {
+                Wire.beginTransmission(txn -> devAddr);
+                Wire.write(txn -> regAddr);
+                success = Wire.endTransmission(false) == 0;
+                if (success) {
+                    uint8_t n = 0;
+                    Wire.requestFrom(txn -> devAddr, (uint8_t)txn -> length, sendStop);
+                    for (; Wire.available() && n < txn -> length && (timeout == 0 || millis() - t1 < timeout); n++) {
+                        txn -> data[n] = Wire.read();
+                    }
+                    success = (n == txn -> length);
+                }
+            } else if (txn -> length >= BUFFER_LENGTH) {
+                success = writeBlock(txn -> devAddr, txn -> regAddr, txn -> length, txn -> data);
+            } else {
+                Wire.beginTransmission(txn -> devAddr);
+                Wire.write(txn -> regAddr);
+                for (uint8_t n = 0; n < txn -> length; n++) Wire.write(txn -> data[n]);
+                success = Wire.endTransmission(sendStop) == 0;
+                #ifdef I2CDEV_REGISTER_CACHE
+                    if (success) updateCache(txn -> devAddr, txn -> regAddr, txn -> length, txn -> data);
+                    else invalidateCache(txn -> devAddr, txn -> regAddr, txn -> length);
+                #endif
+            }
+            I2Cdev_Callback callback = txn -> callback;
+            txn -> error = success ? 0 : 1;
+            txn -> state = success ? I2CDEV_TXN_DONE : I2CDEV_TXN_ERROR;
+            if (callback) callback(txn);
+            if (success) ok++;
+        }
+    #else
+        // no repeated START support, run segments one at a time; the bus is
+        // already held, so run them in place (submit() would defer them)
+        for (i = 0; i < count; i++) {
+            I2Cdev_Transaction *txn = &segments[i];
+            txn -> flags &= ~I2CDEV_TXN_NOSTOP;
+            if (timeout > 0 && millis() - t1 >= timeout) {
+                I2Cdev_Callback callback = txn -> callback;
+                txn -> error = 1;
+                txn -> state = I2CDEV_TXN_ERROR;
+                if (callback) callback(txn);
+                continue;
+            }
+            dq_execute(txn);
+            if (txn -> state == I2CDEV_TXN_DONE) ok++;
+        }
+    #endif
+    return ok;
+}
+
+
+// -----------------------------------------------------------------------------
+// Bus handles
+// -----------------------------------------------------------------------------
+
+/** Handle for the static I2Cdev bus. */
+I2Cdev_Bus I2Cdev_defaultBus;
+
+#ifdef I2CDEV_WIRE_BUS
+    // burst read on a specific TwoWire port, chunked to its buffer size the
+    // way I2Cdev::readBlock() does: pieces joined by repeated START keep the
+    // device's own register pointer (or FIFO port) going; without repeated
+    // START every piece re-addresses the same register
+    static int16_t I2Cdev_wireRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+        TwoWire *wire = (TwoWire *)context;
+        if (timeout == I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) timeout = I2Cdev::readTimeout;
+        uint32_t t1 = millis();
+        uint16_t count = 0;
+        #if ARDUINO > 100
+            wire -> beginTransmission(devAddr);
+            wire -> write(regAddr);
+            if (wire -> endTransmission(false) != 0) return -1;
+        #endif
+        while (count < length) {
+            uint8_t piece = (uint8_t)min(length - count, (uint16_t)BUFFER_LENGTH);
+            uint16_t end = count + piece;
+            #if ARDUINO > 100
+                wire -> requestFrom(devAddr, piece, (uint8_t)(end >= length)); // STOP only after the last piece
+            #else
+                wire -> beginTransmission(devAddr);
+                wire -> write(regAddr);
+                if (wire -> endTransmission() != 0) return -1;
+                wire -> requestFrom(devAddr, piece);
+            #endif
+            for (; wire -> available() && count < end && (timeout == 0 || millis() - t1 < timeout); count++) {
+                data[count] = wire -> read();
+            }
+            if (count < end) return -1; // short read or timeout
+        }
+        return count;
+    }
+
+    // burst write on a specific TwoWire port, each piece prefixed with the
+    // same register address as in I2Cdev::writeBlock()
+    static uint8_t I2Cdev_wireWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+        TwoWire *wire = (TwoWire *)context;
+        uint16_t offset = 0;
+        do {
+            uint8_t piece = (uint8_t)min(length - offset, (uint16_t)(BUFFER_LENGTH - 1));
+            wire -> beginTransmission(devAddr);
+            wire -> write(regAddr);
+            for (uint8_t i = 0; i < piece; i++) wire -> write(data[offset + i]);
+            if (wire -> endTransmission() != 0) return false;
+            offset += piece;
+        } while (offset < length);
+        return true;
+    }
+#endif
+
+/** Bind a handle to a transport.
+ * @param transport Transport to use (leave off for the static I2Cdev bus)
+ */
+I2Cdev_Bus::I2Cdev_Bus(const I2Cdev_Transport *transport) {
+    this -> transport = transport;
+}
+
+#ifdef I2CDEV_WIRE_BUS
+    /** Bind a handle to a TwoWire port other than Wire (e.g. &Wire1).
+     * The port must already be started with begin().
+     * @param wire TwoWire instance to use
+     */
+    I2Cdev_Bus::I2Cdev_Bus(TwoWire *wire) {
+        wireTransport.read = I2Cdev_wireRead;
+        wireTransport.write = I2Cdev_wireWrite;
+        wireTransport.lookup = 0;
+        wireTransport.readAsync = 0;
+        wireTransport.context = wire;
+        transport = &wireTransport;
+    }
+#endif
+
+/** Read a single bit from an 8-bit device register.
+ * @see I2Cdev::readBit()
+ */
+int8_t I2Cdev_Bus::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
+    return I2Cdev_coreReadBit(transport, devAddr, regAddr, bitNum, data, timeout);
+}
+
+/** Read a single bit from a 16-bit device register.
+ * @see I2Cdev::readBitW()
+ */
+int8_t I2Cdev_Bus::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
+    return I2Cdev_coreReadBitW(transport, devAddr, regAddr, bitNum, data, timeout);
+}
+
+/** Read multiple bits from an 8-bit device register.
+ * @see I2Cdev::readBits()
+ */
+int8_t I2Cdev_Bus::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
+    return I2Cdev_coreReadBits(transport, devAddr, regAddr, bitStart, length, data, timeout);
+}
+
+/** Read multiple bits from a 16-bit device register.
+ * @see I2Cdev::readBitsW()
+ */
+int8_t I2Cdev_Bus::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
+    return I2Cdev_coreReadBitsW(transport, devAddr, regAddr, bitStart, length, data, timeout);
+}
+
+/** Read single byte from an 8-bit device register.
+ * @see I2Cdev::readByte()
+ */
+int8_t I2Cdev_Bus::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
+    return readBytes(devAddr, regAddr, 1, data, timeout);
+}
+
+/** Read single word from a 16-bit device register.
+ * @see I2Cdev::readWord()
+ */
+int8_t I2Cdev_Bus::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
+    return I2Cdev_coreReadWord(transport, devAddr, regAddr, data, timeout);
+}
+
+/** Read multiple bytes from an 8-bit device register.
+ * @see I2Cdev::readBytes()
+ */
+int8_t I2Cdev_Bus::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+    return (int8_t)readBlock(devAddr, regAddr, length, data, timeout);
+}
+
+/** Read multiple words from a 16-bit device register.
+ * Words arrive big-endian and are swapped into place in the caller's buffer.
+ * @see I2Cdev::readWords()
+ */
+int8_t I2Cdev_Bus::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
+    uint8_t *bytes = (uint8_t *)data;
+    int16_t count = readBlock(devAddr, regAddr, length * 2, bytes, timeout);
+    if (count < 0) return -1;
+    count /= 2;
+    I2Cdev_coreUnpackBE16(data, bytes, count);
+    return (int8_t)count;
+}
+
+/** Write a single bit in an 8-bit device register.
+ * @see I2Cdev::writeBit()
+ */
+bool I2Cdev_Bus::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
+    return I2Cdev_coreWriteBit(transport, devAddr, regAddr, bitNum, data);
+}
+
+/** Write a single bit in a 16-bit device register.
+ * @see I2Cdev::writeBitW()
+ */
+bool I2Cdev_Bus::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
+    return I2Cdev_coreWriteBitW(transport, devAddr, regAddr, bitNum, data);
+}
+
+/** Write multiple bits in an 8-bit device register.
+ * @see I2Cdev::writeBits()
+ */
+bool I2Cdev_Bus::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+    return I2Cdev_coreWriteBits(transport, devAddr, regAddr, bitStart, length, data);
+}
+
+/** Write multiple bits in a 16-bit device register.
+ * @see I2Cdev::writeBitsW()
+ */
+bool I2Cdev_Bus::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
+    return I2Cdev_coreWriteBitsW(transport, devAddr, regAddr, bitStart, length, data);
+}
+
+/** Write single byte to an 8-bit device register.
+ * @see I2Cdev::writeByte()
+ */
+bool I2Cdev_Bus::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
+    return transport -> write(transport -> context, devAddr, regAddr, 1, &data);
+}
+
+/** Write single word to a 16-bit device register.
+ * @see I2Cdev::writeWord()
+ */
+bool I2Cdev_Bus::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
+    return I2Cdev_coreWriteWord(transport, devAddr, regAddr, data);
+}
+
+/** Write multiple bytes to an 8-bit device register.
+ * @see I2Cdev::writeBytes()
+ */
+bool I2Cdev_Bus::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    return transport -> write(transport -> context, devAddr, regAddr, length, data);
+}
+
+/** Write multiple words to a 16-bit device register.
+ * The words are staged big-endian on the stack, so the caller's buffer is
+ * never modified (an interrupt may be reading it) and at most
+ * I2CDEV_WRITE_WORDS_MAX words go out per call.
+ * @see I2Cdev::writeWords()
+ */
+bool I2Cdev_Bus::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
+    uint8_t bytes[I2CDEV_WRITE_WORDS_MAX * 2];
+    if (length > I2CDEV_WRITE_WORDS_MAX) return false;
     for (uint8_t i = 0; i < length; i++) {
-        #ifdef I2CDEV_SERIAL_DEBUG
-            Serial.print(data[i], HEX);
-            if (i + 1 < length) Serial.print(" ");
-        #endif
-        #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-            Wire.send((uint8_t) data[i]);
-        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-            Wire.write((uint8_t) data[i]);
-        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-            Fastwire::write((uint8_t) data[i]);
-        #endif
+        bytes[i * 2] = (uint8_t)(data[i] >> 8);     // MSB
+        bytes[i * 2 + 1] = (uint8_t)data[i];        // LSB
     }
-    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-        Wire.endTransmission();
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-        status = Wire.endTransmission();
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::stop();
-        //status = Fastwire::endTransmission();
-    #endif
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.println(". Done.");
-    #endif
-    return status == 0;
+    return transport -> write(transport -> context, devAddr, regAddr, length * 2, bytes);
 }
 
-/** Write multiple words to a 16-bit device register.
- * @param devAddr I2C slave device address
- * @param regAddr First register address to write to
- * @param length Number of words to write
- * @param data Buffer to copy new data from
- * @return Status of operation (true = success)
+/** Apply a register script from flash.
+ * @see I2Cdev::runScript()
  */
-bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print("I2C (0x");
-        Serial.print(devAddr, HEX);
-        Serial.print(") writing ");
-        Serial.print(length, DEC);
-        Serial.print(" words to 0x");
-        Serial.print(regAddr, HEX);
-        Serial.print("...");
-    #endif
-    uint8_t status = 0;
-    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-        Wire.beginTransmission(devAddr);
-        Wire.send(regAddr); // send address
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-        Wire.beginTransmission(devAddr);
-        Wire.write(regAddr); // send address
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::beginTransmission(devAddr);
-        Fastwire::write(regAddr);
-    #endif
-    for (uint8_t i = 0; i < length * 2; i++) {
-        #ifdef I2CDEV_SERIAL_DEBUG
-            Serial.print(data[i], HEX);
-            if (i + 1 < length) Serial.print(" ");
-        #endif
-        #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-            Wire.send((uint8_t)(data[i] >> 8));     // send MSB
-            Wire.send((uint8_t)data[i++]);          // send LSB
-        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-            Wire.write((uint8_t)(data[i] >> 8));    // send MSB
-            Wire.write((uint8_t)data[i++]);         // send LSB
-        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-            Fastwire::write((uint8_t)(data[i] >> 8));       // send MSB
-            status = Fastwire::write((uint8_t)data[i++]);   // send LSB
-            if (status != 0) break;
-        #endif
-    }
-    #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-        Wire.endTransmission();
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-        status = Wire.endTransmission();
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::stop();
-        //status = Fastwire::endTransmission();
-    #endif
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.println(". Done.");
+bool I2Cdev_Bus::runScript(uint8_t devAddr, const uint8_t *script) {
+    return I2Cdev_coreRunScript(transport, devAddr, script);
+}
+
+/** Read a register span of any length.
+ * @see I2Cdev::readBlock()
+ */
+int16_t I2Cdev_Bus::readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    int16_t count = transport -> read(transport -> context, devAddr, regAddr, length, data, timeout);
+    #ifdef I2CDEV_TIMESTAMPS
+        // the static bus stamps its own reads
+        if (count > 0 && !isDefault()) I2Cdev::lastReadMicros = micros();
     #endif
-    return status == 0;
+    return count;
 }
 
-/** Default timeout value for read operations.
- * Set this to 0 to disable timeout detection.
+/** Write a register span of any length.
+ * @see I2Cdev::writeBlock()
  */
-uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
+bool I2Cdev_Bus::writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    return transport -> write(transport -> context, devAddr, regAddr, length, data);
+}
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
     // I2C library
@@ -740,66 +2520,92 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         TWCR = 1 << TWEN; // enable twi module, no interrupt
     }
 
-    // added by Jeff Rowberg 2013-05-07:
-    // Arduino Wire-style "beginTransmission" function
-    // (takes 7-bit device address like the Wire method, NOT 8-bit: 0x68, not 0xD0/0xD1)
-    byte Fastwire::beginTransmission(byte device) {
-        byte twst, retry;
-        retry = 2;
-        do {
-            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO) | (1 << TWSTA);
+    // START, or a repeated START while the bus is still held from a
+    // previous step, followed by the slave address byte sla (8-bit, R/W bit
+    // included). A NACKed address is retried FASTWIRE_RETRIES times with a
+    // repeated START each, pausing FASTWIRE_RETRY_DELAY_US before the first
+    // retry and twice as long before each further one; the bus is not let
+    // go in between, so a register address sent earlier stays valid.
+    // Returns 0 on success, 1/3 on TWI timeout, 2 on an unexpected START
+    // status and 4 if the address was never acknowledged.
+    byte Fastwire::start(byte sla) {
+        byte twst;
+        byte retry = FASTWIRE_RETRIES;
+        uint16_t backoff = FASTWIRE_RETRY_DELAY_US;
+        for (;;) {
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTA);
             if (!waitInt()) return 1;
             twst = TWSR & 0xF8;
             if (twst != TW_START && twst != TW_REP_START) return 2;
 
-            //Serial.print(device, HEX);
-            //Serial.print(" ");
-            TWDR = device << 1; // send device address without read bit (1)
+            TWDR = sla;
             TWCR = (1 << TWINT) | (1 << TWEN);
             if (!waitInt()) return 3;
             twst = TWSR & 0xF8;
-        } while (twst == TW_MT_SLA_NACK && retry-- > 0);
-        if (twst != TW_MT_SLA_ACK) return 4;
+            if (twst == TW_MT_SLA_ACK || twst == TW_MR_SLA_ACK) return 0;
+            if ((twst != TW_MT_SLA_NACK && twst != TW_MR_SLA_NACK) || retry-- == 0) return 4;
+            delayMicroseconds(backoff);
+            backoff <<= 1;
+        }
+    }
+
+    // receive num bytes after a successful SLA+R, NACKing the last one;
+    // returns 0, 26 on TWI timeout or the unexpected TWI status
+    byte Fastwire::readData(byte *data, byte num) {
+        byte twst;
+        for (uint8_t i = 0; i < num; i++) {
+            if (i == num - 1)
+                TWCR = (1 << TWINT) | (1 << TWEN);
+            else
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWEA);
+            if (!waitInt()) return 26;
+            twst = TWSR & 0xF8;
+            if (twst != TW_MR_DATA_ACK && twst != TW_MR_DATA_NACK) return twst;
+            data[i] = TWDR;
+        }
         return 0;
     }
 
-    byte Fastwire::writeBuf(byte device, byte address, byte *data, byte num) {
-        byte twst, retry;
+    // added by Jeff Rowberg 2013-05-07:
+    // Arduino Wire-style "beginTransmission" function
+    // (takes 7-bit device address like the Wire method, NOT 8-bit: 0x68, not 0xD0/0xD1)
+    // the bus stays held until stop(), so a following call continues with a
+    // repeated START
+    byte Fastwire::beginTransmission(byte device) {
+        byte r = start(device << 1); // send device address without read bit (1)
+        if (r != 0) stop();
+        return r;
+    }
 
-        retry = 2;
-        do {
-            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO) | (1 << TWSTA);
-            if (!waitInt()) return 1;
-            twst = TWSR & 0xF8;
-            if (twst != TW_START && twst != TW_REP_START) return 2;
+    byte Fastwire::writeBuf(byte device, byte address, byte *data, byte num) {
+        byte r, twst;
 
-            //Serial.print(device, HEX);
-            //Serial.print(" ");
-            TWDR = device & 0xFE; // send device address without read bit (1)
-            TWCR = (1 << TWINT) | (1 << TWEN);
-            if (!waitInt()) return 3;
-            twst = TWSR & 0xF8;
-        } while (twst == TW_MT_SLA_NACK && retry-- > 0);
-        if (twst != TW_MT_SLA_ACK) return 4;
+        r = start(device & 0xFE); // send device address without read bit (1)
+        if (r != 0) {
+            stop();
+            return r;
+        }
 
-        //Serial.print(address, HEX);
-        //Serial.print(" ");
         TWDR = address; // send data to the previously addressed device
         TWCR = (1 << TWINT) | (1 << TWEN);
         if (!waitInt()) return 5;
         twst = TWSR & 0xF8;
-        if (twst != TW_MT_DATA_ACK) return 6;
+        if (twst != TW_MT_DATA_ACK) {
+            stop();
+            return 6;
+        }
 
         for (byte i = 0; i < num; i++) {
-            //Serial.print(data[i], HEX);
-            //Serial.print(" ");
             TWDR = data[i]; // send data to the previously addressed device
             TWCR = (1 << TWINT) | (1 << TWEN);
             if (!waitInt()) return 7;
             twst = TWSR & 0xF8;
-            if (twst != TW_MT_DATA_ACK) return 8;
+            if (twst != TW_MT_DATA_ACK) {
+                stop();
+                return 8;
+            }
         }
-        //Serial.print("\n");
+        stop(); // release the bus (and let EEPROM-style devices commit)
 
         return 0;
     }
@@ -815,66 +2621,67 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         return 0;
     }
 
+    // register read as one combined transaction: the read is joined to the
+    // register address write by a repeated START, never a STOP, so devices
+    // that forget their register pointer on STOP read correctly
     byte Fastwire::readBuf(byte device, byte address, byte *data, byte num) {
-        byte twst, retry;
-
-        retry = 2;
-        do {
-            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO) | (1 << TWSTA);
-            if (!waitInt()) return 16;
-            twst = TWSR & 0xF8;
-            if (twst != TW_START && twst != TW_REP_START) return 17;
+        byte r, twst;
 
-            //Serial.print(device, HEX);
-            //Serial.print(" ");
-            TWDR = device & 0xfe; // send device address to write
-            TWCR = (1 << TWINT) | (1 << TWEN);
-            if (!waitInt()) return 18;
-            twst = TWSR & 0xF8;
-        } while (twst == TW_MT_SLA_NACK && retry-- > 0);
-        if (twst != TW_MT_SLA_ACK) return 19;
+        r = start(device & 0xFE); // send device address to write
+        if (r != 0) {
+            stop();
+            return 15 + r;
+        }
 
-        //Serial.print(address, HEX);
-        //Serial.print(" ");
         TWDR = address; // send data to the previously addressed device
         TWCR = (1 << TWINT) | (1 << TWEN);
         if (!waitInt()) return 20;
         twst = TWSR & 0xF8;
-        if (twst != TW_MT_DATA_ACK) return 21;
-
-        /***/
-
-        retry = 2;
-        do {
-            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO) | (1 << TWSTA);
-            if (!waitInt()) return 22;
-            twst = TWSR & 0xF8;
-            if (twst != TW_START && twst != TW_REP_START) return 23;
-
-            //Serial.print(device, HEX);
-            //Serial.print(" ");
-            TWDR = device | 0x01; // send device address with the read bit (1)
-            TWCR = (1 << TWINT) | (1 << TWEN);
-            if (!waitInt()) return 24;
-            twst = TWSR & 0xF8;
-        } while (twst == TW_MR_SLA_NACK && retry-- > 0);
-        if (twst != TW_MR_SLA_ACK) return 25;
+        if (twst != TW_MT_DATA_ACK) {
+            stop();
+            return 21;
+        }
 
-        for (uint8_t i = 0; i < num; i++) {
-            if (i == num - 1)
-                TWCR = (1 << TWINT) | (1 << TWEN);
-            else
-                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWEA);
-            if (!waitInt()) return 26;
-            twst = TWSR & 0xF8;
-            if (twst != TW_MR_DATA_ACK && twst != TW_MR_DATA_NACK) return twst;
-            data[i] = TWDR;
-            //Serial.print(data[i], HEX);
-            //Serial.print(" ");
+        r = start(device | 0x01); // repeated START, device address with the read bit (1)
+        if (r != 0) {
+            stop();
+            return 21 + r;
         }
-        //Serial.print("\n");
+
+        r = readData(data, num);
         stop();
+        return r;
+    }
 
+    // combined write-then-read transfer (7-bit device address): writes wnum
+    // bytes, then reads rnum bytes after a repeated START. With sendStop
+    // false the bus is kept and the next transfer()/readBuf()/writeBuf()
+    // starts with a repeated START, so segments can be chained into one bus
+    // transaction. Returns 0; 1-4 addressing for the write, 5/6 data timeout
+    // or NACK, 7-10 addressing for the read, else the readData() codes.
+    byte Fastwire::transfer(byte device, const byte *wdata, byte wnum, byte *rdata, byte rnum, boolean sendStop) {
+        byte r;
+        if (wnum > 0 || rnum == 0) {
+            r = start(device << 1);
+            for (byte i = 0; r == 0 && i < wnum; i++) {
+                r = write(wdata[i]);
+                if (r != 0) r += 4;
+            }
+            if (r != 0) {
+                stop();
+                return r;
+            }
+        }
+        if (rnum > 0) {
+            r = start((device << 1) | 0x01);
+            if (r != 0) r += 6;
+            else r = readData(rdata, rnum);
+            if (r != 0) {
+                stop();
+                return r;
+            }
+        }
+        if (sendStop) stop();
         return 0;
     }
 
@@ -884,8 +2691,210 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
 
     byte Fastwire::stop() {
         TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
-        if (!waitInt()) return 1;
-        return 0;
+        // TWINT is not set after a STOP; TWSTO clears once it is on the bus
+        int l = 250;
+        while ((TWCR & (1 << TWSTO)) && l-- > 0);
+        return l > 0 ? 0 : 1;
+    }
+
+    // -------------------------------------------------------------------------
+    // Interrupt-driven transaction queue
+    // -------------------------------------------------------------------------
+    // Ring of pending transactions; the entry at fw_queueTail is the one on
+    // the bus. The polled functions above must not be used while transactions
+    // are queued, since both drive the same TWI hardware.
+
+    static I2Cdev_Transaction * volatile fw_queue[I2CDEV_QUEUE_LENGTH];
+    static volatile uint8_t fw_queueHead = 0;
+    static volatile uint8_t fw_queueTail = 0;
+    static uint16_t fw_index;               // next data byte of the active transaction
+    static bool fw_reading;                 // active read has sent its register address (or has none)
+    static uint8_t fw_retries;              // address NACKs retried for the active transaction
+    #ifdef I2CDEV_INSTRUMENT
+        static uint32_t fw_started;         // micros() when the active transaction started
+    #endif
+
+    bool Fastwire::enqueue(I2Cdev_Transaction *txn) {
+        uint8_t sreg = SREG;
+        cli();
+        uint8_t next = (fw_queueHead + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+        if (next == fw_queueTail) {
+            SREG = sreg;
+            return false; // full
+        }
+        bool idle = (fw_queueHead == fw_queueTail);
+        txn -> error = 0;
+        txn -> state = I2CDEV_TXN_QUEUED;
+        fw_queue[fw_queueHead] = txn;
+        fw_queueHead = next;
+        if (idle) startNext();
+        SREG = sreg;
+        return true;
+    }
+
+    bool Fastwire::cancel(I2Cdev_Transaction *txn) {
+        uint8_t sreg = SREG;
+        cli();
+        bool found = false;
+        if (fw_queueTail != fw_queueHead && fw_queue[fw_queueTail] == txn) {
+            // on the bus right now, drop the TWI and move on
+            TWCR = 0;
+            TWCR = (1 << TWEN);
+            fw_queueTail = (fw_queueTail + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+            #ifdef I2CDEV_INSTRUMENT
+                I2Cdev::recordTransaction(txn -> devAddr, txn -> regAddr, txn -> flags, txn -> length, txn -> data, I2CDEV_RESULT_TIMEOUT, fw_started);
+            #endif
+            txn -> state = I2CDEV_TXN_ABORTED;
+            found = true;
+            startNext();
+        } else {
+            // still waiting, compact the ring over it
+            uint8_t w = fw_queueTail;
+            for (uint8_t r = fw_queueTail; r != fw_queueHead; r = (r + 1) & (I2CDEV_QUEUE_LENGTH - 1)) {
+                if (fw_queue[r] == txn) {
+                    found = true;
+                    continue;
+                }
+                fw_queue[w] = fw_queue[r];
+                w = (w + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+            }
+            fw_queueHead = w;
+            if (found) txn -> state = I2CDEV_TXN_ABORTED;
+        }
+        SREG = sreg;
+        return found;
+    }
+
+    void Fastwire::resume() {
+        // after a bus recovery, restart whatever was on the bus from scratch
+        uint8_t sreg = SREG;
+        cli();
+        startNext();
+        SREG = sreg;
+    }
+
+    uint8_t Fastwire::queued() {
+        return (fw_queueHead - fw_queueTail) & (I2CDEV_QUEUE_LENGTH - 1);
+    }
+
+    void Fastwire::startNext() {
+        if (fw_queueTail == fw_queueHead) {
+            TWCR = (1 << TWEN); // idle, interrupt off
+            return;
+        }
+        fw_queue[fw_queueTail] -> state = I2CDEV_TXN_ACTIVE;
+        I2Cdev::selectSpeed(fw_queue[fw_queueTail] -> devAddr);
+        #ifdef I2CDEV_INSTRUMENT
+            fw_started = micros();
+        #endif
+        fw_index = 0;
+        // no register address: go straight to SLA+R (or, for a probe, SLA+W alone)
+        fw_reading = (fw_queue[fw_queueTail] -> flags & (I2CDEV_TXN_READ | I2CDEV_TXN_NOREG)) == (I2CDEV_TXN_READ | I2CDEV_TXN_NOREG);
+        fw_retries = 0;
+        TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWSTA);
+    }
+
+    void Fastwire::finish(uint8_t state, uint8_t error) {
+        I2Cdev_Transaction *txn = fw_queue[fw_queueTail];
+        fw_queueTail = (fw_queueTail + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+        if (state != I2CDEV_TXN_DONE || !(txn -> flags & I2CDEV_TXN_NOSTOP) || fw_queueTail == fw_queueHead) {
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+            while (TWCR & (1 << TWSTO));
+        }
+        // otherwise startNext() below issues a repeated START on the held bus
+        // read the callback first; a waiting caller may reuse the descriptor
+        // as soon as the state changes
+        #ifdef I2CDEV_INSTRUMENT
+            uint8_t result = I2CDEV_RESULT_OK;
+            if (state != I2CDEV_TXN_DONE) {
+                if (error == TW_MT_SLA_NACK || error == TW_MR_SLA_NACK || error == TW_MT_DATA_NACK) result = I2CDEV_RESULT_NACK;
+                else if (error == TW_MT_ARB_LOST) result = I2CDEV_RESULT_ARB_LOST;
+                else result = I2CDEV_RESULT_ERROR;
+            }
+            I2Cdev::recordTransaction(txn -> devAddr, txn -> regAddr, txn -> flags, txn -> length, txn -> data, result, fw_started);
+        #endif
+        #ifdef I2CDEV_TIMESTAMPS
+            txn -> timestamp = micros();
+            if (state == I2CDEV_TXN_DONE && (txn -> flags & I2CDEV_TXN_READ)) I2Cdev::lastReadMicros = txn -> timestamp;
+        #endif
+        I2Cdev_Callback callback = txn -> callback;
+        txn -> error = error;
+        txn -> state = state;
+        if (callback) callback(txn);
+        startNext();
+    }
+
+    void Fastwire::service() {
+        if (fw_queueTail == fw_queueHead) {
+            TWCR = (1 << TWEN); // spurious, nothing to do
+            return;
+        }
+        I2Cdev_Transaction *txn = fw_queue[fw_queueTail];
+        byte twst = TWSR & 0xF8;
+        switch (twst) {
+            case TW_START:
+            case TW_REP_START:
+                TWDR = (txn -> devAddr << 1) | (fw_reading ? 0x01 : 0x00); // device address with read bit (1) once restarted
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                break;
+
+            case TW_MT_SLA_ACK:
+                if (txn -> flags & I2CDEV_TXN_NOREG) {
+                    finish(I2CDEV_TXN_DONE, 0); // probe acknowledged
+                    break;
+                }
+                TWDR = txn -> regAddr;
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                break;
+
+            case TW_MT_DATA_ACK:
+                if (txn -> flags & I2CDEV_TXN_READ) {
+                    fw_reading = true; // register address sent, restart for the read
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWSTA);
+                } else if (fw_index < txn -> length) {
+                    TWDR = txn -> data[fw_index++];
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                } else {
+                    finish(I2CDEV_TXN_DONE, 0);
+                }
+                break;
+
+            case TW_MR_DATA_ACK:
+                txn -> data[fw_index++] = TWDR;
+                // fall through
+            case TW_MR_SLA_ACK:
+                if (fw_index + 1 >= txn -> length)
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);                // NACK last byte
+                else
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWEA);
+                break;
+
+            case TW_MR_DATA_NACK:
+                txn -> data[fw_index++] = TWDR;
+                finish(I2CDEV_TXN_DONE, 0);
+                break;
+
+            case TW_MT_SLA_NACK:
+            case TW_MR_SLA_NACK:
+                if (fw_retries < FASTWIRE_RETRIES) {
+                    // address again with a repeated START; the bus is kept,
+                    // so for a read the register address already sent stands
+                    fw_retries++;
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWSTA);
+                    break;
+                }
+                finish(I2CDEV_TXN_ERROR, twst);
+                break;
+
+            default:
+                // data NACK, arbitration lost or bus error
+                finish(I2CDEV_TXN_ERROR, twst);
+                break;
+        }
+    }
+
+    ISR(TWI_vect) {
+        Fastwire::service();
     }
 #endif
 
@@ -994,14 +3003,15 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         uint8_t i;
     } twi_Write_Vars;
 
+    // only one transfer is ever in flight, and the queue below starts the next
+    // one from interrupt context, so the transfer variables live in static
+    // storage rather than on the heap
+    static twi_Write_Vars twv;
     twi_Write_Vars *ptwv = 0;
     static void (*fNextInterruptFunction)(void) = 0;
 
     void twi_Finish(byte bRetVal) {
-        if (ptwv) {
-            free(ptwv);
-            ptwv = 0;
-        }
+        ptwv = 0;
         twi_Done = 0xFF;
         twi_Return_Value = bRetVal;
         fNextInterruptFunction = 0;
@@ -1068,6 +3078,7 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         if (TWI_READY != twi_state) return; // blocking test
         if (TWI_BUFFER_LENGTH < ptwv -> length) {
             twi_Finish(1); // end write with error 1
+            if (twi_cbendTransmissionDone) twi_cbendTransmissionDone(1);
             return;
         }
         twi_Done = 0x00; // show as working
@@ -1082,8 +3093,7 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
     }
     
     void twi_writeTo(uint8_t address, uint8_t* data, uint8_t length, uint8_t wait) {
-        uint8_t i;
-        ptwv = (twi_Write_Vars *)malloc(sizeof(twi_Write_Vars));
+        ptwv = &twv;
         ptwv -> address = address;
         ptwv -> data = data;
         ptwv -> length = length;
@@ -1103,7 +3113,11 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
     
     void twi_read00() {
         if (TWI_READY != twi_state) return; // blocking test
-        if (TWI_BUFFER_LENGTH < ptwv -> length) twi_Finish(0); // error return
+        if (TWI_BUFFER_LENGTH < ptwv -> length) {
+            twi_Finish(0); // error return
+            if (twi_cbreadFromDone) twi_cbreadFromDone(0);
+            return;
+        }
         twi_Done = 0x00; // show as working
         twii_SetState(TWI_MRX); // reading
         twii_SetError(0xFF); // reset error
@@ -1115,9 +3129,7 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
     }
 
     void twi_readFrom(uint8_t address, uint8_t* data, uint8_t length) {
-        uint8_t i;
-
-        ptwv = (twi_Write_Vars *)malloc(sizeof(twi_Write_Vars));
+        ptwv = &twv;
         ptwv -> address = address;
         ptwv -> data = data;
         ptwv -> length = length;
@@ -1156,7 +3168,7 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         twi_state = TWI_READY;
     }
     
-    SIGNAL(TWI_vect) {
+    void TwoWire::service() {
         switch (TW_STATUS) {
             // All Master
             case TW_START:     // sent start condition
@@ -1328,6 +3340,10 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         if (fNextInterruptFunction) return fNextInterruptFunction();
     }
 
+    SIGNAL(TWI_vect) {
+        TwoWire::service();
+    }
+
     TwoWire::TwoWire() { }
     
     void TwoWire::begin(void) {
@@ -1454,4 +3470,189 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         return rxBufferLength - rxBufferIndex;
     }
 
+    // -------------------------------------------------------------------------
+    // Interrupt-driven transaction queue
+    // -------------------------------------------------------------------------
+    // Ring of pending transactions; the entry at nb_queueTail is the one on
+    // the bus. Each transaction runs as a chain of the non-blocking transfers
+    // above, every step started from the completion callback of the one
+    // before: reads write the register address and then read a piece of up to
+    // NBWIRE_BUFFER_LENGTH bytes, writes send the register address and up to
+    // NBWIRE_BUFFER_LENGTH - 1 data bytes, repeated until the transaction is
+    // done. There is no repeated START, so I2CDEV_TXN_NOSTOP is ignored. The
+    // blocking Wire-style functions must not be used while transactions are
+    // queued, since both drive the same TWI hardware.
+
+    static I2Cdev_Transaction * volatile nb_queue[I2CDEV_QUEUE_LENGTH];
+    static volatile uint8_t nb_queueHead = 0;
+    static volatile uint8_t nb_queueTail = 0;
+    static uint16_t nb_index;               // data bytes of the active transaction already moved
+    static uint8_t nb_piece;                // data bytes in the transfer on the bus
+    static uint8_t nb_txBuffer[NBWIRE_BUFFER_LENGTH]; // register address + write data
+    #ifdef I2CDEV_INSTRUMENT
+        static uint32_t nb_started;         // micros() when the active transaction started
+    #endif
+
+    bool TwoWire::enqueue(I2Cdev_Transaction *txn) {
+        uint8_t sreg = SREG;
+        cli();
+        uint8_t next = (nb_queueHead + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+        if (next == nb_queueTail) {
+            SREG = sreg;
+            return false; // full
+        }
+        bool idle = (nb_queueHead == nb_queueTail);
+        txn -> error = 0;
+        txn -> state = I2CDEV_TXN_QUEUED;
+        nb_queue[nb_queueHead] = txn;
+        nb_queueHead = next;
+        if (idle) startNext();
+        SREG = sreg;
+        return true;
+    }
+
+    bool TwoWire::cancel(I2Cdev_Transaction *txn) {
+        uint8_t sreg = SREG;
+        cli();
+        bool found = false;
+        if (nb_queueTail != nb_queueHead && nb_queue[nb_queueTail] == txn) {
+            // on the bus right now, drop the TWI and the transfer chain
+            TWCR = 0;
+            TWCR = _BV(TWEN) | _BV(TWIE) | _BV(TWEA);
+            twi_state = TWI_READY;
+            twi_Finish(0);
+            nb_queueTail = (nb_queueTail + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+            #ifdef I2CDEV_INSTRUMENT
+                I2Cdev::recordTransaction(txn -> devAddr, txn -> regAddr, txn -> flags, txn -> length, txn -> data, I2CDEV_RESULT_TIMEOUT, nb_started);
+            #endif
+            txn -> state = I2CDEV_TXN_ABORTED;
+            found = true;
+            startNext();
+        } else {
+            // still waiting, compact the ring over it
+            uint8_t w = nb_queueTail;
+            for (uint8_t r = nb_queueTail; r != nb_queueHead; r = (r + 1) & (I2CDEV_QUEUE_LENGTH - 1)) {
+                if (nb_queue[r] == txn) {
+                    found = true;
+                    continue;
+                }
+                nb_queue[w] = nb_queue[r];
+                w = (w + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+            }
+            nb_queueHead = w;
+            if (found) txn -> state = I2CDEV_TXN_ABORTED;
+        }
+        SREG = sreg;
+        return found;
+    }
+
+    void TwoWire::resume() {
+        // after a bus recovery (Wire.begin() has reset the TWI state), restart
+        // whatever was on the bus from scratch
+        uint8_t sreg = SREG;
+        cli();
+        twi_Finish(0);
+        startNext();
+        SREG = sreg;
+    }
+
+    uint8_t TwoWire::queued() {
+        return (nb_queueHead - nb_queueTail) & (I2CDEV_QUEUE_LENGTH - 1);
+    }
+
+    void TwoWire::startNext() {
+        if (nb_queueTail == nb_queueHead) return; // idle
+        nb_queue[nb_queueTail] -> state = I2CDEV_TXN_ACTIVE;
+        I2Cdev::selectSpeed(nb_queue[nb_queueTail] -> devAddr);
+        #ifdef I2CDEV_INSTRUMENT
+            nb_started = micros();
+        #endif
+        nb_index = 0;
+        startPiece();
+    }
+
+    void TwoWire::startPiece() {
+        I2Cdev_Transaction *txn = nb_queue[nb_queueTail];
+        uint16_t left = txn -> length - nb_index;
+        nb_txBuffer[0] = txn -> regAddr;
+        if ((txn -> flags & (I2CDEV_TXN_READ | I2CDEV_TXN_NOREG)) == I2CDEV_TXN_NOREG) {
+            // probe: address only
+            nb_piece = 0;
+            twi_cbendTransmissionDone = writeDone;
+            twi_writeTo(txn -> devAddr, nb_txBuffer, 0, 1);
+        } else if (txn -> flags & I2CDEV_TXN_NOREG) {
+            // every piece continues from the device's own pointer
+            nb_piece = (left > NBWIRE_BUFFER_LENGTH) ? NBWIRE_BUFFER_LENGTH : (uint8_t)left;
+            twi_cbreadFromDone = readDone;
+            twi_readFrom(txn -> devAddr, txn -> data + nb_index, nb_piece);
+        } else if (txn -> flags & I2CDEV_TXN_READ) {
+            nb_piece = (left > NBWIRE_BUFFER_LENGTH) ? NBWIRE_BUFFER_LENGTH : (uint8_t)left;
+            twi_cbendTransmissionDone = addressDone;
+            twi_writeTo(txn -> devAddr, nb_txBuffer, 1, 1);
+        } else {
+            nb_piece = (left > NBWIRE_BUFFER_LENGTH - 1) ? NBWIRE_BUFFER_LENGTH - 1 : (uint8_t)left;
+            for (uint8_t i = 0; i < nb_piece; i++) nb_txBuffer[i + 1] = txn -> data[nb_index + i];
+            twi_cbendTransmissionDone = writeDone;
+            twi_writeTo(txn -> devAddr, nb_txBuffer, nb_piece + 1, 1);
+        }
+    }
+
+    void TwoWire::addressDone(int result) {
+        if (result != 0) {
+            finish(I2CDEV_TXN_ERROR, twi_error);
+            return;
+        }
+        I2Cdev_Transaction *txn = nb_queue[nb_queueTail];
+        twi_cbreadFromDone = readDone;
+        twi_readFrom(txn -> devAddr, txn -> data + nb_index, nb_piece);
+    }
+
+    void TwoWire::readDone(int count) {
+        if (count != nb_piece) {
+            // the ISR doesn't flag an address NACK on reads
+            finish(I2CDEV_TXN_ERROR, twi_error == 0xFF ? TW_MR_SLA_NACK : twi_error);
+            return;
+        }
+        nb_index += nb_piece;
+        if (nb_index < nb_queue[nb_queueTail] -> length) startPiece();
+        else finish(I2CDEV_TXN_DONE, 0);
+    }
+
+    void TwoWire::writeDone(int result) {
+        if (result != 0) {
+            finish(I2CDEV_TXN_ERROR, twi_error);
+            return;
+        }
+        nb_index += nb_piece;
+        if (nb_index < nb_queue[nb_queueTail] -> length) startPiece();
+        else finish(I2CDEV_TXN_DONE, 0);
+    }
+
+    void TwoWire::finish(uint8_t state, uint8_t error) {
+        I2Cdev_Transaction *txn = nb_queue[nb_queueTail];
+        nb_queueTail = (nb_queueTail + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+        twi_cbendTransmissionDone = NULL;
+        twi_cbreadFromDone = NULL;
+        #ifdef I2CDEV_INSTRUMENT
+            uint8_t result = I2CDEV_RESULT_OK;
+            if (state != I2CDEV_TXN_DONE) {
+                if (error == TW_MT_SLA_NACK || error == TW_MR_SLA_NACK || error == TW_MT_DATA_NACK) result = I2CDEV_RESULT_NACK;
+                else if (error == TW_MT_ARB_LOST) result = I2CDEV_RESULT_ARB_LOST;
+                else result = I2CDEV_RESULT_ERROR;
+            }
+            I2Cdev::recordTransaction(txn -> devAddr, txn -> regAddr, txn -> flags, txn -> length, txn -> data, result, nb_started);
+        #endif
+        // read the callback first; a waiting caller may reuse the descriptor
+        // as soon as the state changes
+        #ifdef I2CDEV_TIMESTAMPS
+            txn -> timestamp = micros();
+            if (state == I2CDEV_TXN_DONE && (txn -> flags & I2CDEV_TXN_READ)) I2Cdev::lastReadMicros = txn -> timestamp;
+        #endif
+        I2Cdev_Callback callback = txn -> callback;
+        txn -> error = error;
+        txn -> state = state;
+        if (callback) callback(txn);
+        startNext();
+    }
+
 #endif
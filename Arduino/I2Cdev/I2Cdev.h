@@ -3,6 +3,29 @@
 // 6/9/2012 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-14 - add I2CDEV_DEVICE_BREAKER per-device quarantine with exponential re-probe backoff
+//      2026-10-14 - add probe()/scan() address-only bus scan and I2CDEV_PRESENCE_MAP fast-fail for absent devices
+//      2026-10-14 - add runScript() PROGMEM register scripts with coalesced burst writes
+//      2026-10-14 - add bus ownership with deferred ISR submits and I2Cdev::runDeferred()
+//      2026-10-14 - add I2CDEV_TIMESTAMPS read completion stamps and I2Cdev::getReadTimestamp()
+//      2026-10-14 - replace the writeWords() variable-length stack copy with a fixed I2CDEV_WRITE_WORDS_MAX buffer
+//      2026-10-14 - add readRaw() register-less reads, also queueable with I2CDEV_TXN_NOREG
+//      2026-10-14 - add I2CDEV_SOFTWARE_WIRE bit-banged master and I2Cdev_SoftWire extra buses
+//      2026-10-14 - add Fastwire repeated START write-then-read transfers and address NACK retry policy
+//      2026-10-14 - run NBWire transfers through the interrupt-driven transaction queue
+//      2026-10-14 - add I2CDEV_HOST_SIMULATION implementation for host builds and benchmarks
+//      2026-10-14 - add header-only I2Cdev_Ring single-producer/single-consumer sample ring
+//      2026-10-14 - add I2Cdev_Bus handles for multiple buses and mux channels
+//      2026-10-14 - add per-device bus speed profiles with optional probing
+//      2026-10-14 - add binary ring-buffer trace of bus transactions (I2CDEV_TRACE)
+//      2026-10-14 - add optional per-device transaction statistics (I2CDEV_STATISTICS)
+//      2026-10-14 - add stuck bus detection and SCL clock-out recovery
+//      2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//      2026-10-14 - add compile-time register field descriptors (readField()/writeField())
+//      2026-10-14 - add readBlock()/writeBlock() for transfers larger than BUFFER_LENGTH
+//      2026-10-14 - add optional register shadow cache for read-modify-write operations
+//      2026-10-14 - add batched (scatter/gather) transactions with repeated START
+//      2026-10-14 - add asynchronous transaction queue (interrupt-driven with Fastwire)
 //      2013-05-06 - add Francesco Ferrara's Fastwire v0.24 implementation with small modifications
 //      2013-05-05 - fix issue with writing bit values to words (Sasquatch/Farzanegan)
 //      2012-06-09 - fix major issue with reading > 32 bytes at a time with Arduino Wire
@@ -49,8 +72,11 @@ THE SOFTWARE.
 // -----------------------------------------------------------------------------
 // I2C interface implementation setting
 // -----------------------------------------------------------------------------
+// (host builds pass -DI2CDEV_IMPLEMENTATION=I2CDEV_HOST_SIMULATION instead)
+#ifndef I2CDEV_IMPLEMENTATION
 #define I2CDEV_IMPLEMENTATION       I2CDEV_ARDUINO_WIRE
 //#define I2CDEV_IMPLEMENTATION       I2CDEV_BUILTIN_FASTWIRE
+#endif
 
 // comment this out if you are using a non-optimal IDE/implementation setting
 // but want the compiler to shut up about it
@@ -64,12 +90,138 @@ THE SOFTWARE.
                                       // ^^^ NBWire implementation is still buggy w/some interrupts!
 #define I2CDEV_BUILTIN_FASTWIRE     3 // FastWire object from Francesco Ferrara's project
 #define I2CDEV_I2CMASTER_LIBRARY    4 // I2C object from DSSCircuits I2C-Master Library at https://github.com/DSSCircuits/I2C-Master-Library
+#define I2CDEV_HOST_SIMULATION      5 // simulated register-file devices on a PC, see I2Cdev_sim.h
+#define I2CDEV_SOFTWARE_WIRE        6 // bit-banged master on any two pins, see I2Cdev_softwire.h
 
 // -----------------------------------------------------------------------------
 // Arduino-style "Serial.print" debug constant (uncomment to enable)
 // -----------------------------------------------------------------------------
+// Printing from inside every transfer changes its timing by milliseconds;
+// prefer I2CDEV_STATISTICS or I2CDEV_TRACE below when measuring bus behaviour.
 //#define I2CDEV_SERIAL_DEBUG
 
+// -----------------------------------------------------------------------------
+// Per-device transaction statistics (uncomment to enable)
+// -----------------------------------------------------------------------------
+// Counts transactions, bytes and failures per slave address and keeps
+// min/max/total latency in microseconds; read with I2Cdev::getStats().
+// Compiles to nothing when disabled.
+//#define I2CDEV_STATISTICS
+
+// number of distinct slave addresses tracked; once full, further devices
+// are pooled in the last entry under devAddr I2CDEV_STATS_OTHER
+#define I2CDEV_STATISTICS_DEVICES   4
+
+// -----------------------------------------------------------------------------
+// Binary transaction trace (uncomment to enable)
+// -----------------------------------------------------------------------------
+// Appends a fixed-size record per transaction to a static ring buffer under
+// production timing; drain it later with I2Cdev::readTrace()/dumpTrace().
+//#define I2CDEV_TRACE
+
+// ring size in records (must be a power of 2) and data bytes kept per record
+#define I2CDEV_TRACE_LENGTH         16
+#define I2CDEV_TRACE_DATA_BYTES     4
+
+#if defined(I2CDEV_STATISTICS) || defined(I2CDEV_TRACE)
+    #define I2CDEV_INSTRUMENT
+#endif
+
+// -----------------------------------------------------------------------------
+// Register shadow cache (comment out to save RAM in drivers that declare ranges)
+// -----------------------------------------------------------------------------
+#define I2CDEV_REGISTER_CACHE
+
+// -----------------------------------------------------------------------------
+// Stuck bus recovery (uncomment to enable)
+// -----------------------------------------------------------------------------
+// After a blocking transfer fails or times out, SDA and SCL are checked; if
+// a slave is holding a line low (typically after a brownout in the middle of
+// a read), SCL is clocked as GPIO until SDA is released, a STOP is generated
+// and the TWI is re-initialised at its previous bit rate. Successful
+// transfers pay nothing, so the first transfer on a bus already stuck at
+// power-up fails; call I2Cdev::isBusStuck() and I2Cdev::recoverBus() from
+// setup() to clear it before the drivers start.
+//#define I2CDEV_BUS_RECOVERY
+
+// -----------------------------------------------------------------------------
+// Per-device bus speed profiles (comment out to save RAM)
+// -----------------------------------------------------------------------------
+// Number of devices that can be given their own SCL rate with
+// I2Cdev::setDeviceSpeed(); all others use the rate the bus was set up with.
+// The TWI bit rate is switched before each transaction, so only available on
+// AVR targets with a TWI peripheral.
+#define I2CDEV_SPEED_PROFILES       4
+
+// -----------------------------------------------------------------------------
+// Read completion timestamps (uncomment to enable)
+// -----------------------------------------------------------------------------
+// Every successful read stores micros() at the moment it completed (from the
+// TWI interrupt with the queued backends), so drivers can stamp the samples
+// they return on one common microsecond timebase; see
+// I2Cdev::getReadTimestamp(). Queued transactions carry their own stamp too.
+// Costs a micros() call per read and 4 bytes per I2Cdev_Transaction. Without
+// it getReadTimestamp() returns micros() at the time of the call, which is
+// close enough when it is called right after the read. The option changes
+// I2Cdev_Transaction, so set it here (or for the whole build), not in a sketch.
+//#define I2CDEV_TIMESTAMPS
+
+// -----------------------------------------------------------------------------
+// Device presence map (uncomment to enable)
+// -----------------------------------------------------------------------------
+// I2Cdev::scan() and I2Cdev::probe() remember which addresses acknowledged
+// an address-only write. Any transfer to an address found empty then fails
+// at once without touching the bus, so e.g. the testConnection() of a
+// missing device returns false at once and does not wait for a timeout.
+// Addresses never probed are tried as usual. Costs 32 bytes of RAM and a
+// bitmap lookup per transfer. A device that was absent during the scan
+// (powered up later, hot-plugged) stays refused until it is probed again.
+//#define I2CDEV_PRESENCE_MAP
+
+// -----------------------------------------------------------------------------
+// Per-device circuit breaker (uncomment to enable)
+// -----------------------------------------------------------------------------
+// After I2CDEV_BREAKER_THRESHOLD consecutive failed transfers a device is
+// quarantined: its transfers fail at once without touching the bus, so one
+// dead or wedged sensor can't keep the others waiting out read timeouts.
+// Once the backoff expires the next transfer (or I2Cdev::serviceBreakers()
+// from loop()) first probes the address; if it answers, one real transfer
+// is let through, and its success closes the breaker. Each failed attempt
+// doubles the backoff, up to I2CDEV_BREAKER_BACKOFF_MS << I2CDEV_BREAKER_MAX_SHIFT.
+// Costs a micros() per transfer, like I2CDEV_STATISTICS. Sketches that
+// poll a device with repeated NACKed transfers (EEPROM write cycles,
+// waiting for a part to come out of reset) must poll with I2Cdev::probe(),
+// which the breaker ignores, or call resetBreaker() once the wait is over.
+//#define I2CDEV_DEVICE_BREAKER
+
+// number of devices tracked at once; entries are taken on first failure
+#define I2CDEV_BREAKER_DEVICES      4
+
+#define I2CDEV_BREAKER_THRESHOLD    3   // consecutive failures before quarantine
+#define I2CDEV_BREAKER_BACKOFF_MS   100 // first quarantine period
+#define I2CDEV_BREAKER_MAX_SHIFT    7   // backoff doubles up to 12.8s
+
+#ifdef I2CDEV_DEVICE_BREAKER
+    // fed from the same per-transaction hook as statistics and trace
+    #define I2CDEV_INSTRUMENT
+#endif
+
+// -----------------------------------------------------------------------------
+// Memory model
+// -----------------------------------------------------------------------------
+// Nothing in I2Cdev or the drivers is allocated from the heap. Static state
+// is sized by the options above; the largest stack scratch any I2Cdev call
+// takes is I2CDEV_STACK_BYTES, the big-endian copy writeWords() makes on
+// the queued, simulated and software backends (and I2Cdev_Bus::writeWords()
+// on all of them). Drivers document their own worst case the same way (e.g.
+// MPU6050_STACK_BYTES).
+
+// maximum words per writeWords() call on those backends and per
+// I2Cdev_Bus::writeWords() call (longer calls fail; Wire can't take more
+// than (BUFFER_LENGTH - 1) / 2 words either)
+#define I2CDEV_WRITE_WORDS_MAX      16
+#define I2CDEV_STACK_BYTES          (I2CDEV_WRITE_WORDS_MAX * 2)
+
 #ifdef ARDUINO
     #if ARDUINO < 100
         #include "WProgram.h"
@@ -84,9 +236,238 @@ THE SOFTWARE.
     #endif
 #endif
 
+#if I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION
+    #include "I2Cdev_sim.h"
+#endif
+
+#if defined(I2CDEV_SPEED_PROFILES) && (!defined(TWBR) || I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE)
+    #undef I2CDEV_SPEED_PROFILES // no AVR TWI bit rate register to switch
+#endif
+
+#if defined(I2CDEV_BUS_RECOVERY) && I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE && !defined(I2CDEV_RECOVERY_SDA_PIN)
+    #undef I2CDEV_BUS_RECOVERY // the TWI pins aren't the bus; the software master unsticks its own lines
+#endif
+
+#ifdef I2CDEV_BUS_RECOVERY
+    // pins to bit-bang during recovery; cores without PIN_WIRE_* need these
+    // defined before including I2Cdev.h, or recovery is compiled out
+    #ifndef I2CDEV_RECOVERY_SDA_PIN
+        #if defined(PIN_WIRE_SDA) && defined(PIN_WIRE_SCL)
+            #define I2CDEV_RECOVERY_SDA_PIN     PIN_WIRE_SDA
+            #define I2CDEV_RECOVERY_SCL_PIN     PIN_WIRE_SCL
+        #else
+            #undef I2CDEV_BUS_RECOVERY
+        #endif
+    #endif
+
+    // half period of the recovery clock in microseconds (5 = 100kHz)
+    #define I2CDEV_RECOVERY_HALF_PERIOD     5
+
+    /** Bus recovery counters, cleared only by the application. */
+    typedef struct I2Cdev_RecoveryStats {
+        uint16_t stuck;                     // times a line was found held low while idle
+        uint16_t recovered;                 // recoveries that released both lines
+        uint16_t failed;                    // recoveries after which a line was still low
+    } I2Cdev_RecoveryStats;
+#endif
+
+// transaction outcome, as passed to I2Cdev::recordTransaction()
+#define I2CDEV_RESULT_OK            0
+#define I2CDEV_RESULT_NACK          1 // address or data byte not acknowledged
+#define I2CDEV_RESULT_TIMEOUT       2 // timed out or aborted
+#define I2CDEV_RESULT_ARB_LOST      3 // arbitration lost to another master
+#define I2CDEV_RESULT_ERROR         4 // anything else (bus error, queue full)
+
+#ifdef I2CDEV_STATISTICS
+    #define I2CDEV_STATS_OTHER      0xFF
+
+    /** Transaction statistics for one slave address.
+     * Average latency is totalMicros / transactions. Entries updated from
+     * the Fastwire interrupt should be copied with interrupts disabled.
+     */
+    typedef struct I2Cdev_Stats {
+        uint8_t devAddr;                    // 7-bit slave address (I2CDEV_STATS_OTHER = pooled)
+        uint16_t transactions;              // completed or failed transactions
+        uint32_t bytes;                     // data bytes moved by successful transactions
+        uint16_t nacks;                     // I2CDEV_RESULT_NACK count
+        uint16_t timeouts;                  // I2CDEV_RESULT_TIMEOUT count
+        uint16_t arbitrationLost;           // I2CDEV_RESULT_ARB_LOST count
+        uint16_t errors;                    // I2CDEV_RESULT_ERROR count
+        uint16_t minMicros;                 // fastest transaction
+        uint16_t maxMicros;                 // slowest transaction (saturates at 65535)
+        uint32_t totalMicros;               // sum of all transaction latencies
+    } I2Cdev_Stats;
+#endif
+
+#ifdef I2CDEV_DEVICE_BREAKER
+    #define I2CDEV_BREAKER_CLOSED       0 // healthy, transfers go to the bus
+    #define I2CDEV_BREAKER_OPEN         1 // quarantined, transfers fail at once
+    #define I2CDEV_BREAKER_HALF_OPEN    2 // backoff expired, next outcome decides
+
+    /** Failure accounting for one slave address. Entries updated from the
+     * Fastwire interrupt should be copied with interrupts disabled.
+     */
+    typedef struct I2Cdev_Breaker {
+        uint8_t devAddr;                    // 7-bit slave address
+        uint8_t state;                      // I2CDEV_BREAKER_* state
+        uint8_t failures;                   // consecutive failed transactions (saturates at 255)
+        uint8_t backoffShift;               // backoff is I2CDEV_BREAKER_BACKOFF_MS << backoffShift
+        uint32_t openedAt;                  // millis() when last quarantined
+        uint16_t trips;                     // times quarantined from the closed state
+        uint16_t rejected;                  // transfers failed without touching the bus
+    } I2Cdev_Breaker;
+#endif
+
+#ifdef I2CDEV_TRACE
+    /** One traced transaction (13 bytes with the default data length). */
+    typedef struct I2Cdev_TraceRecord {
+        uint32_t timestamp;                 // micros() at the start of the transaction
+        uint8_t devAddr;                    // 7-bit address << 1 | 1 for reads
+        uint8_t regAddr;                    // first register
+        uint16_t length;                    // data bytes requested
+        uint8_t status;                     // I2CDEV_RESULT_* outcome
+        uint8_t data[I2CDEV_TRACE_DATA_BYTES]; // first data bytes, in bus order (blocking word reads and Wire word writes: native order)
+    } I2Cdev_TraceRecord;
+#endif
+
+// shared register logic, identical in every port
+#include "I2Cdev_core.h"
+
+// lock-free sample ring shared by the streaming drivers
+#include "I2Cdev_ring.h"
+
+#if I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE
+    #include "I2Cdev_softwire.h"
+
+    // pins of the bus behind the static I2Cdev class: the TWI pins on
+    // ATmega168/328 (PC4/PC5 at port speed), the core's SDA/SCL elsewhere.
+    // To move it, define I2CDEV_SOFTWIRE_SDA and I2CDEV_SOFTWIRE_SCL as pin
+    // types (I2Cdev_SoftPin<n> or I2CDEV_SOFTWIRE_AVR_PIN) before including
+    // I2Cdev.h. Call I2Cdev_SoftBus::begin() in setup() instead of Wire.begin().
+    #ifndef I2CDEV_SOFTWIRE_SDA
+        #if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__)
+            I2CDEV_SOFTWIRE_AVR_PIN(I2Cdev_SoftSDA, C, 4);
+            I2CDEV_SOFTWIRE_AVR_PIN(I2Cdev_SoftSCL, C, 5);
+            #define I2CDEV_SOFTWIRE_SDA     I2Cdev_SoftSDA
+            #define I2CDEV_SOFTWIRE_SCL     I2Cdev_SoftSCL
+        #else
+            #define I2CDEV_SOFTWIRE_SDA     I2Cdev_SoftPin<SDA>
+            #define I2CDEV_SOFTWIRE_SCL     I2Cdev_SoftPin<SCL>
+        #endif
+    #endif
+    #ifndef I2CDEV_SOFTWIRE_KHZ
+        #define I2CDEV_SOFTWIRE_KHZ         400
+    #endif
+    typedef I2Cdev_SoftWire<I2CDEV_SOFTWIRE_SDA, I2CDEV_SOFTWIRE_SCL, I2CDEV_SOFTWIRE_KHZ> I2Cdev_SoftBus;
+#endif
+
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     1000
 
+// -----------------------------------------------------------------------------
+// Asynchronous transaction queue
+// -----------------------------------------------------------------------------
+// Number of slots in the pending transaction ring (must be a power of 2; one
+// slot is always kept free, so up to I2CDEV_QUEUE_LENGTH - 1 can be pending).
+// With I2CDEV_BUILTIN_FASTWIRE and I2CDEV_BUILTIN_NBWIRE the queue is
+// serviced from the TWI interrupt; other implementations execute submitted
+// transactions immediately, except that one submitted from an interrupt
+// (with I2Cdev::submitFromISR()) or while a blocking call is using the bus
+// waits in the same size of ring and runs in the main context right after
+// the transfer in progress (see I2Cdev::runDeferred()). On Cortex-M, a
+// blocking call made from an interrupt in the middle of another transfer
+// fails instead of corrupting it; AVR can't tell a handler from code running
+// under cli(), so there blocking calls must stay out of interrupt handlers.
+#define I2CDEV_QUEUE_LENGTH         8
+
+#if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
+    #define I2CDEV_TWI_QUEUE
+#endif
+
+// I2Cdev::submitFromISR() may be called from an interrupt handler: queued by
+// the TWI backends, deferred to the main context where there are critical
+// sections to protect the ring (AVR and Cortex-M)
+#if defined(I2CDEV_TWI_QUEUE) || ((defined(__AVR__) || defined(__arm__)) && I2CDEV_IMPLEMENTATION != I2CDEV_HOST_SIMULATION)
+    #define I2CDEV_ISR_SUBMIT
+#endif
+
+#define I2CDEV_TXN_WRITE            0x00 // write data[] starting at regAddr
+#define I2CDEV_TXN_READ             0x01 // read data[] starting at regAddr
+#define I2CDEV_TXN_NOSTOP           0x02 // keep the bus, next transaction starts with repeated START
+#define I2CDEV_TXN_NOREG            0x04 // with I2CDEV_TXN_READ: no register address, read from the device's current position;
+                                         // as a zero-length write: address only, i.e. a presence probe
+
+#define I2CDEV_TXN_IDLE             0 // never submitted
+#define I2CDEV_TXN_QUEUED           1 // waiting for the bus
+#define I2CDEV_TXN_ACTIVE           2 // currently on the bus
+#define I2CDEV_TXN_DONE             3 // completed successfully
+#define I2CDEV_TXN_ERROR            4 // failed, see error member for TWI status
+#define I2CDEV_TXN_ABORTED          5 // cancelled by I2Cdev::abort() or timeout
+
+struct I2Cdev_Transaction;
+typedef void (*I2Cdev_Callback)(struct I2Cdev_Transaction *txn);
+
+/** Descriptor for a single queued register read or write.
+ * The descriptor and its data buffer are owned by the caller and must stay
+ * valid until the transaction completes (or is aborted). The callback, if
+ * any, is called from interrupt context when the transaction finishes with
+ * Fastwire and NBWire, and from the submitting or deferring context otherwise.
+ */
+typedef struct I2Cdev_Transaction {
+    uint8_t devAddr;            // 7-bit slave address
+    uint8_t regAddr;            // first register to read or write (unused with I2CDEV_TXN_NOREG)
+    uint8_t flags;              // I2CDEV_TXN_READ or I2CDEV_TXN_WRITE, optionally | I2CDEV_TXN_NOSTOP / I2CDEV_TXN_NOREG
+    uint16_t length;            // number of data bytes
+    uint8_t *data;              // transfer buffer
+    I2Cdev_Callback callback;   // optional completion callback (may be 0)
+    void *context;              // optional user pointer for the callback
+    volatile uint8_t state;     // I2CDEV_TXN_* progress
+    volatile uint8_t error;     // TWI status on failure, 0 on success
+    #ifdef I2CDEV_TIMESTAMPS
+        uint32_t timestamp;     // micros() when the transaction finished
+    #endif
+} I2Cdev_Transaction;
+
+#ifdef I2CDEV_REGISTER_CACHE
+    /** Span of up to 32 consecutive registers whose last known values are kept
+     * in RAM so writeBit()/writeBits() can skip the read half of their
+     * read-modify-write cycle. Drivers own the descriptor and value storage,
+     * register them with I2Cdev::addCacheRange() and call
+     * I2Cdev::invalidateCache() after anything that changes registers behind
+     * the library's back (resets, self-clearing bits). Registers flagged in
+     * volatileMask (status, data outputs) are never cached.
+     */
+    typedef struct I2Cdev_CacheRange {
+        uint8_t devAddr;                    // 7-bit slave address
+        uint8_t regAddr;                    // first register in the span
+        uint8_t length;                     // number of registers (1-32)
+        uint32_t volatileMask;              // bit n set = regAddr + n is never cached
+        uint32_t validMask;                 // bit n set = values[n] is current
+        uint8_t *values;                    // driver-owned storage, length bytes
+        struct I2Cdev_CacheRange *next;
+    } I2Cdev_CacheRange;
+#endif
+
+/** Compile-time descriptor for a register bit field, using the same
+ * bitStart/length convention as readBits()/writeBits(). Everything is an enum
+ * constant, so I2Cdev::readField()/writeField() compile down to a fixed mask
+ * and shift instead of building them at runtime on every call.
+ */
+template <uint8_t RegAddr, uint8_t BitStart, uint8_t Length=1>
+struct I2Cdev_Field {
+    enum {
+        regAddr = RegAddr,
+        bitStart = BitStart,
+        length = Length,
+        shift = BitStart - Length + 1,
+        mask = ((1 << Length) - 1) << (BitStart - Length + 1)
+    };
+};
+
+/** Single-bit register field, for use where readBit()/writeBit() would be. */
+template <uint8_t RegAddr, uint8_t BitNum>
+struct I2Cdev_Bit : I2Cdev_Field<RegAddr, BitNum, 1> {};
+
 class I2Cdev {
     public:
         I2Cdev();
@@ -108,10 +489,240 @@ class I2Cdev {
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static bool runScript(uint8_t devAddr, const uint8_t *script);
+
+        /** Read a register field described by an I2Cdev_Field.
+         * Single-bit fields read back as 0 or 1.
+         * @param devAddr I2C slave device address
+         * @param data Container for right-aligned value
+         * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+         * @return Status of read operation (true = success)
+         */
+        template <class Field> static int8_t readField(uint8_t devAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout) {
+            uint8_t b;
+            int8_t count = readByte(devAddr, Field::regAddr, &b, timeout);
+            if (count > 0) *data = (b & Field::mask) >> Field::shift;
+            return count;
+        }
+
+        /** Write a register field described by an I2Cdev_Field.
+         * Fields covering the whole byte skip the read half of the
+         * read-modify-write; single-bit fields take any nonzero value as 1.
+         * @param devAddr I2C slave device address
+         * @param data Right-aligned value to write
+         * @return Status of operation (true = success)
+         */
+        template <class Field> static bool writeField(uint8_t devAddr, uint8_t data) {
+            uint8_t b = 0;
+            if (Field::mask != 0xFF && !readForUpdate(devAddr, Field::regAddr, &b)) return false;
+            if (Field::length == 1) data = (data != 0);
+            return writeByte(devAddr, Field::regAddr, (b & ~Field::mask) | ((data << Field::shift) & Field::mask));
+        }
+
+        static int16_t readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static bool writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+        static int16_t readRaw(uint8_t devAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+
+        static bool submit(I2Cdev_Transaction *txn);
+        static bool submitFromISR(I2Cdev_Transaction *txn);
+        static bool isComplete(const I2Cdev_Transaction *txn);
+        static int16_t wait(I2Cdev_Transaction *txn, uint16_t timeout=I2Cdev::readTimeout);
+        static bool abort(I2Cdev_Transaction *txn);
+        static uint8_t getQueueCount();
+        static void runDeferred();
+        static uint8_t executeBatch(I2Cdev_Transaction *segments, uint8_t count, uint16_t timeout=I2Cdev::readTimeout);
+
+        #ifdef I2CDEV_REGISTER_CACHE
+            static void addCacheRange(I2Cdev_CacheRange *range, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *values, uint32_t volatileMask=0);
+            static void removeCacheRange(I2Cdev_CacheRange *range);
+            static bool loadCacheRange(I2Cdev_CacheRange *range, uint16_t timeout=I2Cdev::readTimeout);
+            static void invalidateCache(uint8_t devAddr, uint8_t regAddr=0, uint16_t length=256);
+            static bool getCachedByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data);
+        #endif
+
+        static bool isBusStuck();
+        static bool recoverBus();
+
+        static bool setDeviceSpeed(uint8_t devAddr, uint16_t khz);
+        static void clearDeviceSpeed(uint8_t devAddr);
+        static uint16_t probeDeviceSpeed(uint8_t devAddr, uint8_t regAddr, uint16_t maxKhz=400);
+        static void selectSpeed(uint8_t devAddr);
+
+        static bool probe(uint8_t devAddr);
+        static uint8_t scan(uint8_t first=0x08, uint8_t last=0x77);
+        static int8_t isPresent(uint8_t devAddr);
+        static void clearPresence(uint8_t devAddr=0xFF);
+
+        static uint8_t serviceBreakers();
+        static void resetBreaker(uint8_t devAddr=0xFF);
+        #ifdef I2CDEV_DEVICE_BREAKER
+            static const I2Cdev_Breaker *getBreaker(uint8_t devAddr);
+        #endif
+
+        static void recordTransaction(uint8_t devAddr, uint8_t regAddr, uint8_t flags, uint16_t length, const uint8_t *data, uint8_t result, uint32_t started);
+        #ifdef I2CDEV_STATISTICS
+            static const I2Cdev_Stats *getStats(uint8_t devAddr);
+            static void resetStats();
+        #endif
+        #ifdef I2CDEV_TRACE
+            static bool readTrace(I2Cdev_TraceRecord *record);
+            static uint16_t getTraceLost();
+            static void clearTrace();
+            static void dumpTrace();
+        #endif
+
+        /** Time the most recent successful read completed, on any bus.
+         * Call right after the read whose data is being stamped. Without
+         * I2CDEV_TIMESTAMPS this is simply the current time.
+         * @return micros() timestamp
+         */
+        static inline uint32_t getReadTimestamp() {
+            #if defined(I2CDEV_TIMESTAMPS) && defined(I2CDEV_TWI_QUEUE)
+                // written from the TWI interrupt, not atomic on AVR
+                uint8_t sreg = SREG;
+                cli();
+                uint32_t t = lastReadMicros;
+                SREG = sreg;
+                return t;
+            #elif defined(I2CDEV_TIMESTAMPS)
+                return lastReadMicros;
+            #else
+                return micros();
+            #endif
+        }
 
         static uint16_t readTimeout;
+        static const I2Cdev_Transport transport;
+        #ifdef I2CDEV_TIMESTAMPS
+            static volatile uint32_t lastReadMicros;
+        #endif
+        #ifdef I2CDEV_BUS_RECOVERY
+            static I2Cdev_RecoveryStats recoveryStats;
+        #endif
+
+    private:
+        static bool readForUpdate(uint8_t devAddr, uint8_t regAddr, uint8_t *data);
+        static bool admit(uint8_t devAddr);
+        static void checkBus();
+
+        #ifdef I2CDEV_SPEED_PROFILES
+            static uint8_t speedAddr[I2CDEV_SPEED_PROFILES];
+            static uint8_t speedTwbr[I2CDEV_SPEED_PROFILES];
+            static uint8_t speedTwps[I2CDEV_SPEED_PROFILES];
+            static uint8_t speedUsed;
+            static uint8_t defaultTwbr;
+            static uint8_t defaultTwps;
+        #endif
+
+        #ifdef I2CDEV_PRESENCE_MAP
+            static uint8_t presenceKnown[16];   // bit per 7-bit address: probed
+            static uint8_t presenceFound[16];   // bit per 7-bit address: acknowledged
+        #endif
+
+        #ifdef I2CDEV_DEVICE_BREAKER
+            static void recordBreaker(uint8_t devAddr, uint8_t flags, uint16_t length, uint8_t result);
+            static I2Cdev_Breaker *findBreaker(uint8_t devAddr);
+            static I2Cdev_Breaker breakers[I2CDEV_BREAKER_DEVICES];
+            static uint8_t breakersUsed;
+        #endif
+
+        #ifdef I2CDEV_STATISTICS
+            static void recordStats(uint8_t devAddr, uint16_t bytes, uint8_t result, uint32_t started);
+            static I2Cdev_Stats stats[I2CDEV_STATISTICS_DEVICES];
+            static uint8_t statsUsed;
+        #endif
+        #ifdef I2CDEV_TRACE
+            static void appendTrace(uint8_t devAddr, uint8_t regAddr, uint8_t flags, uint16_t length, const uint8_t *data, uint8_t result, uint32_t started);
+            static I2Cdev_TraceRecord traceBuffer[I2CDEV_TRACE_LENGTH];
+            static uint8_t traceHead;
+            static uint8_t traceCount;
+            static uint16_t traceLost;
+        #endif
+
+        #ifdef I2CDEV_REGISTER_CACHE
+            static void updateCache(uint8_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data);
+            static I2Cdev_CacheRange *cacheRanges;
+        #endif
 };
 
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && defined(ARDUINO) && ARDUINO >= 100
+    // I2Cdev_Bus can drive any TwoWire instance (Wire1, Wire2, ...) directly
+    #define I2CDEV_WIRE_BUS
+#endif
+
+/** Handle for one bus a driver talks through: the default I2Cdev bus, a
+ * second TwoWire port, a mux channel (I2Cdev_MuxChannel) or any other
+ * I2Cdev_Transport. It offers the same register accessors as the static
+ * I2Cdev class, so a driver bound to a handle reads exactly like one calling
+ * I2Cdev:: directly. Only the default bus goes through the static I2Cdev
+ * machinery (cache, statistics, trace, speed profiles, recovery); other
+ * transports get plain transfers.
+ */
+class I2Cdev_Bus {
+    public:
+        I2Cdev_Bus(const I2Cdev_Transport *transport=&I2Cdev::transport);
+        #ifdef I2CDEV_WIRE_BUS
+            I2Cdev_Bus(TwoWire *wire);
+        #endif
+
+        int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        int8_t readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+
+        bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
+        bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
+        bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
+        bool writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data);
+        bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data);
+        bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
+        bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        bool runScript(uint8_t devAddr, const uint8_t *script);
+
+        int16_t readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        bool writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+
+        /** Read a register field described by an I2Cdev_Field.
+         * @see I2Cdev::readField()
+         */
+        template <class Field> int8_t readField(uint8_t devAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout) {
+            uint8_t b;
+            int8_t count = readByte(devAddr, Field::regAddr, &b, timeout);
+            if (count > 0) *data = (b & Field::mask) >> Field::shift;
+            return count;
+        }
+
+        /** Write a register field described by an I2Cdev_Field.
+         * @see I2Cdev::writeField()
+         */
+        template <class Field> bool writeField(uint8_t devAddr, uint8_t data) {
+            uint8_t b = 0;
+            if (Field::mask != 0xFF && !I2Cdev_coreFetch(transport, devAddr, Field::regAddr, &b)) return false;
+            if (Field::length == 1) data = (data != 0);
+            return writeByte(devAddr, Field::regAddr, (b & ~Field::mask) | ((data << Field::shift) & Field::mask));
+        }
+
+        /** Whether this handle drives the static I2Cdev bus, i.e. whether
+         * I2Cdev's register cache and other per-address state apply to it.
+         */
+        bool isDefault() const { return transport == &I2Cdev::transport; }
+        const I2Cdev_Transport *getTransport() const { return transport; }
+
+    private:
+        const I2Cdev_Transport *transport;
+        #ifdef I2CDEV_WIRE_BUS
+            I2Cdev_Transport wireTransport;
+        #endif
+};
+
+// handle for the static I2Cdev bus, what drivers bind to unless told otherwise
+extern I2Cdev_Bus I2Cdev_defaultBus;
+
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
     //////////////////////
     // FastWire 0.24
@@ -141,9 +752,24 @@ class I2Cdev {
     #define TW_OK                   0
     #define TW_ERROR                1
 
+    // extra attempts at a slave address that is NACKed (a device busy with
+    // an EEPROM write cycle or still waking up), and the pause before the
+    // first of them, doubled for each one after; the TWI queue retries
+    // at once without the pause, since it runs in interrupt context
+    #ifndef FASTWIRE_RETRIES
+        #define FASTWIRE_RETRIES        2
+    #endif
+    #ifndef FASTWIRE_RETRY_DELAY_US
+        #define FASTWIRE_RETRY_DELAY_US 50
+    #endif
+
     class Fastwire {
         private:
             static boolean waitInt();
+            static byte start(byte sla);
+            static byte readData(byte *data, byte num);
+            static void startNext();
+            static void finish(uint8_t state, uint8_t error);
 
         public:
             static void setup(int khz, boolean pullup);
@@ -151,8 +777,16 @@ class I2Cdev {
             static byte write(byte value);
             static byte writeBuf(byte device, byte address, byte *data, byte num);
             static byte readBuf(byte device, byte address, byte *data, byte num);
+            static byte transfer(byte device, const byte *wdata, byte wnum, byte *rdata, byte rnum, boolean sendStop=true);
             static void reset();
             static byte stop();
+
+            // interrupt-driven transaction queue (used by I2Cdev::submit)
+            static bool enqueue(I2Cdev_Transaction *txn);
+            static bool cancel(I2Cdev_Transaction *txn);
+            static uint8_t queued();
+            static void service();
+            static void resume();
     };
 #endif
 
@@ -161,8 +795,16 @@ class I2Cdev {
     // Originally posted on the Arduino forum at http://arduino.cc/forum/index.php/topic,70705.0.html
     // Originally offered to the i2cdevlib project at http://arduino.cc/forum/index.php/topic,68210.30.html
 
-    #define NBWIRE_BUFFER_LENGTH 32
-    
+    // largest piece moved per bus transfer (1 register byte + up to
+    // NBWIRE_BUFFER_LENGTH - 1 data bytes on writes); longer transactions are
+    // split by the queue. Override before including I2Cdev.h, 2-255.
+    #ifndef NBWIRE_BUFFER_LENGTH
+        #define NBWIRE_BUFFER_LENGTH 32
+    #endif
+    #if NBWIRE_BUFFER_LENGTH < 2 || NBWIRE_BUFFER_LENGTH > 255
+        #error NBWIRE_BUFFER_LENGTH must be between 2 and 255
+    #endif
+
     class TwoWire {
         private:
             static uint8_t rxBuffer[];
@@ -179,6 +821,13 @@ class I2Cdev {
             static void (*user_onReceive)(int);
             static void onRequestService(void);
             static void onReceiveService(uint8_t*, int);
+
+            static void startNext();
+            static void startPiece();
+            static void finish(uint8_t state, uint8_t error);
+            static void addressDone(int result);
+            static void readDone(int count);
+            static void writeDone(int result);
     
         public:
             TwoWire();
@@ -200,6 +849,13 @@ class I2Cdev {
             uint8_t receive(void);
             void onReceive(void (*)(int));
             void onRequest(void (*)(void));
+
+            // interrupt-driven transaction queue (used by I2Cdev::submit)
+            static bool enqueue(I2Cdev_Transaction *txn);
+            static bool cancel(I2Cdev_Transaction *txn);
+            static uint8_t queued();
+            static void service();
+            static void resume();
     };
     
     #define TWI_READY   0
@@ -214,9 +870,15 @@ class I2Cdev {
     #define TW_MT_SLA_NACK      0x20
     #define TW_MT_DATA_NACK     0x30
     
-    #define CPU_FREQ            16000000L
-    #define TWI_FREQ            100000L
-    #define TWI_BUFFER_LENGTH   32
+    #ifdef F_CPU
+        #define CPU_FREQ        F_CPU
+    #else
+        #define CPU_FREQ        16000000L
+    #endif
+    #ifndef TWI_FREQ
+        #define TWI_FREQ        100000L
+    #endif
+    #define TWI_BUFFER_LENGTH   NBWIRE_BUFFER_LENGTH
     
     /* TWI Status is in TWSR, in the top 5 bits: TWS7 - TWS3 */
     
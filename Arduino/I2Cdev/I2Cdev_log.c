@@ -0,0 +1,156 @@
+// I2Cdev library collection - compact binary sample log encoder
+// Delta-encoded records for streaming raw sensor samples over serial or to SD cards
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// See I2Cdev_log.h for the stream format.
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2Cdev_log.h"
+
+// append v as a varint, return bytes written
+static uint8_t I2Cdev_logVarint(uint8_t *out, uint32_t v) {
+    uint8_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)v | 0x80;
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+/** Set up an encoder. The first sample written is always a keyframe.
+ * @param enc Encoder to initialize
+ * @param channels int16 values per sample (1 to I2CDEV_LOG_MAX_CHANNELS)
+ * @param flags I2CDEV_LOG_TIMESTAMPS or 0
+ * @param keyframeInterval Delta records between keyframes (0 = none after the first)
+ */
+void I2Cdev_logInit(I2Cdev_LogEncoder *enc, uint8_t channels, uint8_t flags, uint8_t keyframeInterval) {
+    enc -> channels = channels > I2CDEV_LOG_MAX_CHANNELS ? I2CDEV_LOG_MAX_CHANNELS : channels;
+    enc -> flags = flags;
+    enc -> keyframeInterval = keyframeInterval;
+    enc -> sinceKeyframe = 0;
+    enc -> started = 0;
+    enc -> lastTimestamp = 0;
+}
+
+/** Write a stream header and force the next sample to be a keyframe, so a
+ * header can be repeated (e.g. at the start of each SD file) mid-stream.
+ * @param enc Encoder
+ * @param device Caller-chosen device identifier (e.g. its I2C address)
+ * @param ranges Full-scale range of each channel, or 0 to write zeros
+ * @param period Nominal sample period in microseconds (0 = unknown)
+ * @param out Buffer of at least I2CDEV_LOG_HEADER_MAX(channels) bytes
+ * @return Number of bytes written
+ */
+uint8_t I2Cdev_logHeader(I2Cdev_LogEncoder *enc, uint8_t device, const uint16_t *ranges, uint32_t period, uint8_t *out) {
+    uint8_t n = 0, i;
+    out[n++] = I2CDEV_LOG_TAG_HEADER;
+    out[n++] = 'I';
+    out[n++] = I2CDEV_LOG_VERSION;
+    out[n++] = device;
+    out[n++] = enc -> channels;
+    out[n++] = enc -> flags;
+    for (i = 0; i < enc -> channels; i++) {
+        uint16_t range = ranges ? ranges[i] : 0;
+        out[n++] = (uint8_t)range;
+        out[n++] = (uint8_t)(range >> 8);
+    }
+    for (i = 0; i < 4; i++) out[n++] = (uint8_t)(period >> (8 * i));
+    enc -> started = 0;
+    return n;
+}
+
+/** Encode one sample as a keyframe or delta record.
+ * @param enc Encoder
+ * @param values enc->channels raw values
+ * @param timestamp micros() of the sample (ignored without I2CDEV_LOG_TIMESTAMPS)
+ * @param out Buffer of at least I2CDEV_LOG_RECORD_MAX(channels) bytes
+ * @return Number of bytes written
+ */
+uint8_t I2Cdev_logSample(I2Cdev_LogEncoder *enc, const int16_t *values, uint32_t timestamp, uint8_t *out) {
+    uint8_t n = 0, i;
+    if (!enc -> started || (enc -> keyframeInterval && enc -> sinceKeyframe >= enc -> keyframeInterval)) {
+        out[n++] = I2CDEV_LOG_TAG_KEYFRAME;
+        if (enc -> flags & I2CDEV_LOG_TIMESTAMPS) {
+            for (i = 0; i < 4; i++) out[n++] = (uint8_t)(timestamp >> (8 * i));
+        }
+        for (i = 0; i < enc -> channels; i++) {
+            out[n++] = (uint8_t)values[i];
+            out[n++] = (uint8_t)((uint16_t)values[i] >> 8);
+            enc -> last[i] = values[i];
+        }
+        enc -> started = 1;
+        enc -> sinceKeyframe = 0;
+    } else {
+        out[n++] = I2CDEV_LOG_TAG_DELTA;
+        if (enc -> flags & I2CDEV_LOG_TIMESTAMPS) n += I2Cdev_logVarint(out + n, timestamp - enc -> lastTimestamp);
+        for (i = 0; i < enc -> channels; i++) {
+            // the difference wraps to 16 bits, then zigzag keeps small steps
+            // of either sign in one byte
+            int16_t d = (int16_t)(uint16_t)((uint16_t)values[i] - (uint16_t)enc -> last[i]);
+            n += I2Cdev_logVarint(out + n, (uint16_t)(((uint16_t)d << 1) ^ (uint16_t)(d >> 15)));
+            enc -> last[i] = values[i];
+        }
+        enc -> sinceKeyframe++;
+    }
+    enc -> lastTimestamp = timestamp;
+    return n;
+}
+
+/** Encode a raw burst of fixed-size records straight from a FIFO buffer.
+ * Each record is stride bytes and starts with enc->channels 16-bit values
+ * in the given byte order; e.g. an MPU6050 accel+gyro FIFO read is 12-byte
+ * big-endian records of 6 channels. Records are stamped timestamp,
+ * timestamp + period, ...
+ * @param enc Encoder
+ * @param records Raw burst
+ * @param count Number of records in the burst
+ * @param stride Bytes per record (at least 2 * channels)
+ * @param byteOrder I2CDEV_LOG_BIG_ENDIAN or I2CDEV_LOG_LITTLE_ENDIAN
+ * @param timestamp micros() of the first record
+ * @param period Microseconds between records
+ * @param out Buffer of at least count * I2CDEV_LOG_RECORD_MAX(channels) bytes
+ * @return Number of bytes written
+ */
+uint16_t I2Cdev_logEncodeBlock(I2Cdev_LogEncoder *enc, const uint8_t *records, uint16_t count, uint8_t stride,
+        uint8_t byteOrder, uint32_t timestamp, uint32_t period, uint8_t *out) {
+    int16_t values[I2CDEV_LOG_MAX_CHANNELS];
+    uint16_t n = 0, r;
+    uint8_t i;
+    for (r = 0; r < count; r++, records += stride, timestamp += period) {
+        for (i = 0; i < enc -> channels; i++) {
+            const uint8_t *b = records + 2 * i;
+            values[i] = byteOrder == I2CDEV_LOG_BIG_ENDIAN
+                ? (int16_t)(((uint16_t)b[0] << 8) | b[1])
+                : (int16_t)(((uint16_t)b[1] << 8) | b[0]);
+        }
+        n += I2Cdev_logSample(enc, values, timestamp, out + n);
+    }
+    return n;
+}
@@ -0,0 +1,107 @@
+// I2Cdev library collection - compact binary sample log encoder
+// Delta-encoded records for streaming raw sensor samples over serial or to SD cards
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Plain C with no platform dependencies, so the same encoder runs in a
+// sketch and in host-side tools. Output goes to a caller buffer; hand it to
+// Serial.write() or a file as it fills.
+//
+// Stream format (all multi-byte fixed fields little-endian):
+//
+//   header    A5 'I' version device channels flags range[channels] period
+//             range: uint16 full scale per channel (e.g. 2 for +/-2g,
+//             250 for +/-250dps), physical = raw * range / 32768
+//             period: uint32 nominal sample period in us (0 = unknown)
+//   keyframe  A6 [timestamp] value[channels]
+//             timestamp: uint32 micros(), present with I2CDEV_LOG_TIMESTAMPS
+//             value: int16 absolute channel values
+//   delta     A7 [dt] delta[channels]
+//             dt: varint microseconds since the previous record
+//             delta: zigzag varint of (value - previous) taken modulo 2^16,
+//             so any step fits in at most 3 bytes
+//
+// Varints are 7 bits per byte, least significant group first, bit 7 set on
+// all but the last byte. A slowly changing 6-axis sample costs 8-9 bytes
+// against 12 raw or ~40 as text. A decoder that loses sync skips forward to
+// the next keyframe tag; keyframes come every keyframeInterval records.
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_LOG_H_
+#define _I2CDEV_LOG_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define I2CDEV_LOG_VERSION          1
+
+#define I2CDEV_LOG_TAG_HEADER       0xA5
+#define I2CDEV_LOG_TAG_KEYFRAME     0xA6
+#define I2CDEV_LOG_TAG_DELTA        0xA7
+
+// header flags
+#define I2CDEV_LOG_TIMESTAMPS       0x01 // records carry a timestamp
+
+// byte order of raw bursts handed to I2Cdev_logEncodeBlock()
+#define I2CDEV_LOG_BIG_ENDIAN       0 // MSB first (MPU6050, ITG3200, HMC5883L)
+#define I2CDEV_LOG_LITTLE_ENDIAN    1 // LSB first (ADXL345, L3G4200D, BMA150)
+
+// channels per record, and so int16 values of state kept per encoder
+#ifndef I2CDEV_LOG_MAX_CHANNELS
+    #define I2CDEV_LOG_MAX_CHANNELS 12
+#endif
+
+// worst-case bytes of a header and of one sample record, for sizing buffers
+#define I2CDEV_LOG_HEADER_MAX(channels) (10 + 2 * (channels))
+#define I2CDEV_LOG_RECORD_MAX(channels) (6 + 3 * (channels))
+
+/** Encoder state for one stream of same-shaped samples. */
+typedef struct I2Cdev_LogEncoder {
+    uint8_t channels;           // int16 values per sample
+    uint8_t flags;              // I2CDEV_LOG_* header flags
+    uint8_t keyframeInterval;   // records between keyframes (0 = first record only)
+    uint8_t sinceKeyframe;      // delta records since the last keyframe
+    uint8_t started;            // a keyframe has been written
+    uint32_t lastTimestamp;
+    int16_t last[I2CDEV_LOG_MAX_CHANNELS];
+} I2Cdev_LogEncoder;
+
+void I2Cdev_logInit(I2Cdev_LogEncoder *enc, uint8_t channels, uint8_t flags, uint8_t keyframeInterval);
+uint8_t I2Cdev_logHeader(I2Cdev_LogEncoder *enc, uint8_t device, const uint16_t *ranges, uint32_t period, uint8_t *out);
+uint8_t I2Cdev_logSample(I2Cdev_LogEncoder *enc, const int16_t *values, uint32_t timestamp, uint8_t *out);
+uint16_t I2Cdev_logEncodeBlock(I2Cdev_LogEncoder *enc, const uint8_t *records, uint16_t count, uint8_t stride,
+    uint8_t byteOrder, uint32_t timestamp, uint32_t period, uint8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _I2CDEV_LOG_H_ */
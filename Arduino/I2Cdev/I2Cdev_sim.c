@@ -0,0 +1,555 @@
+// I2Cdev library collection - Host-side simulated I2C bus
+// Register-file device models behind an I2Cdev_Transport, for building and benchmarking drivers on a PC
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-14 - add I2Cdev_simProbe() address-only writes
+//     2026-10-14 - add I2Cdev_simReadCurrent() register-less reads
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// host builds only; the Arduino IDE compiles every file in the library
+// folder, so this one has to vanish there
+#ifndef ARDUINO
+
+#include <string.h>
+#include "I2Cdev_sim.h"
+
+// bit times: START + address + register (+ repeated START + address) + STOP
+// (START + address + STOP alone for a current position read),
+// and 9 clocks (8 data + ACK) per data byte
+#define I2CDEV_SIM_WRITE_BITS(n)    (20 + 9 * (uint32_t)(n))
+#define I2CDEV_SIM_READ_BITS(n)     (30 + 9 * (uint32_t)(n))
+#define I2CDEV_SIM_CURRENT_BITS(n)  (11 + 9 * (uint32_t)(n))
+#define I2CDEV_SIM_NACK_BITS        11
+
+static int16_t I2Cdev_simTransportRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    return I2Cdev_simRead((I2Cdev_SimBus *)context, devAddr, regAddr, length, data);
+}
+
+static uint8_t I2Cdev_simTransportWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    return I2Cdev_simWrite((I2Cdev_SimBus *)context, devAddr, regAddr, length, data);
+}
+
+I2Cdev_SimBus I2Cdev_simBus = {
+    { I2Cdev_simTransportRead, I2Cdev_simTransportWrite, 0, 0, &I2Cdev_simBus },
+    0,
+    I2CDEV_SIM_DEFAULT_CLOCK_HZ,
+    I2CDEV_SIM_DEFAULT_SETUP_NANOS,
+    0,
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+/** Set up a simulated bus with no devices attached.
+ * @param bus Bus to initialise
+ * @param clockHz SCL rate used to model bit times
+ * @param setupNanos Fixed cost charged to every transaction
+ */
+void I2Cdev_simInit(I2Cdev_SimBus *bus, uint32_t clockHz, uint32_t setupNanos) {
+    memset(bus, 0, sizeof(*bus));
+    bus -> transport.read = I2Cdev_simTransportRead;
+    bus -> transport.write = I2Cdev_simTransportWrite;
+    bus -> transport.context = bus;
+    bus -> clockHz = clockHz;
+    bus -> setupNanos = setupNanos;
+}
+
+/** Attach a device to a bus. Devices sharing an address are not detected;
+ * the most recently attached one answers.
+ */
+void I2Cdev_simAttach(I2Cdev_SimBus *bus, I2Cdev_SimDevice *dev) {
+    dev -> next = bus -> devices;
+    bus -> devices = dev;
+}
+
+/** Remove a device from a bus; it stops acknowledging its address. */
+void I2Cdev_simDetach(I2Cdev_SimBus *bus, I2Cdev_SimDevice *dev) {
+    I2Cdev_SimDevice **link;
+    for (link = &bus -> devices; *link; link = &(*link) -> next) {
+        if (*link == dev) {
+            *link = dev -> next;
+            dev -> next = 0;
+            return;
+        }
+    }
+}
+
+/** Clear the bus and per-device traffic counters. Modelled time keeps running. */
+void I2Cdev_simResetCounters(I2Cdev_SimBus *bus) {
+    I2Cdev_SimDevice *dev;
+    memset(&bus -> counters, 0, sizeof(bus -> counters));
+    for (dev = bus -> devices; dev; dev = dev -> next) memset(&dev -> counters, 0, sizeof(dev -> counters));
+}
+
+/** Advance modelled time without bus traffic (a driver delay, host work). */
+void I2Cdev_simDelay(I2Cdev_SimBus *bus, uint64_t nanos) {
+    bus -> nowNanos += nanos;
+}
+
+static I2Cdev_SimDevice *I2Cdev_simFind(I2Cdev_SimBus *bus, uint8_t devAddr) {
+    I2Cdev_SimDevice *dev;
+    for (dev = bus -> devices; dev; dev = dev -> next) {
+        if (dev -> address == devAddr) return dev;
+    }
+    return 0;
+}
+
+static void I2Cdev_simCharge(I2Cdev_SimBus *bus, I2Cdev_SimDevice *dev, uint32_t bits, uint8_t flags, uint16_t length) {
+    uint64_t nanos = bus -> setupNanos + (uint64_t)bits * 1000000000UL / bus -> clockHz;
+    bus -> nowNanos += nanos;
+    bus -> counters.transactions++;
+    bus -> counters.busNanos += nanos;
+    if (!dev) {
+        bus -> counters.nacks++;
+        return;
+    }
+    if (flags) bus -> counters.reads++;
+    else bus -> counters.writes++;
+    bus -> counters.bytes += length;
+    dev -> counters.transactions++;
+    if (flags) dev -> counters.reads++;
+    else dev -> counters.writes++;
+    dev -> counters.bytes += length;
+    dev -> counters.busNanos += nanos;
+}
+
+/** Burst register read from a simulated device.
+ * @return Number of bytes read (-1 if no device answers the address)
+ */
+int16_t I2Cdev_simRead(I2Cdev_SimBus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    I2Cdev_SimDevice *dev = I2Cdev_simFind(bus, devAddr);
+    uint16_t i;
+    if (!dev) {
+        I2Cdev_simCharge(bus, 0, I2CDEV_SIM_NACK_BITS, 1, 0);
+        return -1;
+    }
+    if (dev -> update) dev -> update(dev, bus -> nowNanos);
+    for (i = 0; i < length; i++) {
+        data[i] = dev -> read ? dev -> read(dev, regAddr, i) : dev -> regs[(uint8_t)(regAddr + i)];
+    }
+    dev -> pointer = (uint8_t)(regAddr + length);
+    I2Cdev_simCharge(bus, dev, I2CDEV_SIM_READ_BITS(length), 1, length);
+    return (int16_t)length;
+}
+
+/** Read from a simulated device's current register pointer, without a
+ * register address phase (a plain SLA+R transfer).
+ * @return Number of bytes read (-1 if no device answers the address)
+ */
+int16_t I2Cdev_simReadCurrent(I2Cdev_SimBus *bus, uint8_t devAddr, uint16_t length, uint8_t *data) {
+    I2Cdev_SimDevice *dev = I2Cdev_simFind(bus, devAddr);
+    uint8_t regAddr;
+    uint16_t i;
+    if (!dev) {
+        I2Cdev_simCharge(bus, 0, I2CDEV_SIM_NACK_BITS, 1, 0);
+        return -1;
+    }
+    if (dev -> update) dev -> update(dev, bus -> nowNanos);
+    regAddr = dev -> pointer;
+    for (i = 0; i < length; i++) {
+        data[i] = dev -> read ? dev -> read(dev, regAddr, i) : dev -> regs[(uint8_t)(regAddr + i)];
+    }
+    dev -> pointer = (uint8_t)(regAddr + length);
+    I2Cdev_simCharge(bus, dev, I2CDEV_SIM_CURRENT_BITS(length), 1, length);
+    return (int16_t)length;
+}
+
+/** Burst register write to a simulated device.
+ * @return Nonzero on success, 0 if no device answers the address
+ */
+uint8_t I2Cdev_simWrite(I2Cdev_SimBus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data) {
+    I2Cdev_SimDevice *dev = I2Cdev_simFind(bus, devAddr);
+    uint16_t i;
+    if (!dev) {
+        I2Cdev_simCharge(bus, 0, I2CDEV_SIM_NACK_BITS, 0, 0);
+        return 0;
+    }
+    if (dev -> update) dev -> update(dev, bus -> nowNanos);
+    for (i = 0; i < length; i++) {
+        if (dev -> write) dev -> write(dev, regAddr, i, data[i]);
+        else dev -> regs[(uint8_t)(regAddr + i)] = data[i];
+    }
+    dev -> pointer = (uint8_t)(regAddr + length);
+    I2Cdev_simCharge(bus, dev, I2CDEV_SIM_WRITE_BITS(length), 0, length);
+    return 1;
+}
+
+/** Address-only write (START, SLA+W, STOP), as a bus scan sends.
+ * @return Nonzero if a device answers the address
+ */
+uint8_t I2Cdev_simProbe(I2Cdev_SimBus *bus, uint8_t devAddr) {
+    I2Cdev_SimDevice *dev = I2Cdev_simFind(bus, devAddr);
+    I2Cdev_simCharge(bus, dev, I2CDEV_SIM_NACK_BITS, 0, 0);
+    return dev != 0;
+}
+
+/** Plain register file device: all registers 0, no side effects. */
+void I2Cdev_simInitDevice(I2Cdev_SimDevice *dev, uint8_t address) {
+    memset(dev, 0, sizeof(*dev));
+    dev -> address = address;
+}
+
+// -----------------------------------------------------------------------------
+// MPU6050
+// -----------------------------------------------------------------------------
+
+#define MPU6050_SIM_SMPLRT_DIV      0x19
+#define MPU6050_SIM_CONFIG          0x1A
+#define MPU6050_SIM_FIFO_EN         0x23
+#define MPU6050_SIM_INT_STATUS      0x3A
+#define MPU6050_SIM_ACCEL_XOUT_H    0x3B
+#define MPU6050_SIM_GYRO_ZOUT_L     0x48
+#define MPU6050_SIM_USER_CTRL       0x6A
+#define MPU6050_SIM_PWR_MGMT_1      0x6B
+#define MPU6050_SIM_BANK_SEL        0x6D
+#define MPU6050_SIM_MEM_START_ADDR  0x6E
+#define MPU6050_SIM_MEM_R_W         0x6F
+#define MPU6050_SIM_FIFO_COUNTH     0x72
+#define MPU6050_SIM_FIFO_COUNTL     0x73
+#define MPU6050_SIM_FIFO_R_W        0x74
+#define MPU6050_SIM_WHO_AM_I        0x75
+
+static void I2Cdev_simMPU6050Defaults(I2Cdev_SimDevice *dev) {
+    memset(dev -> regs, 0, sizeof(dev -> regs));
+    dev -> regs[MPU6050_SIM_PWR_MGMT_1] = 0x40; // SLEEP
+    dev -> regs[MPU6050_SIM_WHO_AM_I] = 0x68;
+}
+
+static uint16_t I2Cdev_simMPU6050MemAddr(I2Cdev_SimDevice *dev) {
+    return ((uint16_t)(dev -> regs[MPU6050_SIM_BANK_SEL] & 0x1F) << 8 | dev -> regs[MPU6050_SIM_MEM_START_ADDR]) % I2CDEV_SIM_MPU6050_MEMORY;
+}
+
+static void I2Cdev_simMPU6050MemNext(I2Cdev_SimDevice *dev) {
+    // the address carries into the bank, as the DMP loader expects at bank ends
+    if (++dev -> regs[MPU6050_SIM_MEM_START_ADDR] == 0) {
+        dev -> regs[MPU6050_SIM_BANK_SEL] = (dev -> regs[MPU6050_SIM_BANK_SEL] & 0xE0) | ((dev -> regs[MPU6050_SIM_BANK_SEL] + 1) & 0x1F);
+    }
+}
+
+static void I2Cdev_simMPU6050Push(I2Cdev_SimMPU6050 *s, const uint8_t *bytes, uint8_t length, uint8_t *status) {
+    uint8_t i;
+    for (i = 0; i < length; i++) {
+        if (s -> fifoCount == I2CDEV_SIM_MPU6050_FIFO) {
+            // full: the oldest byte is overwritten
+            s -> fifoHead = (s -> fifoHead + 1) % I2CDEV_SIM_MPU6050_FIFO;
+            s -> fifoCount--;
+            *status |= 0x10; // FIFO_OFLOW_INT
+        }
+        s -> fifo[(s -> fifoHead + s -> fifoCount) % I2CDEV_SIM_MPU6050_FIFO] = bytes[i];
+        s -> fifoCount++;
+    }
+}
+
+static void I2Cdev_simMPU6050Sample(I2Cdev_SimDevice *dev) {
+    I2Cdev_SimMPU6050 *s = (I2Cdev_SimMPU6050 *)dev -> state;
+    uint8_t *out = &dev -> regs[MPU6050_SIM_ACCEL_XOUT_H];
+    uint8_t fifoEnable = dev -> regs[MPU6050_SIM_FIFO_EN];
+    uint8_t userCtrl = dev -> regs[MPU6050_SIM_USER_CTRL];
+    uint8_t i;
+
+    // data registers, big-endian: accel, temperature, gyro
+    for (i = 0; i < 3; i++) {
+        out[i * 2] = (uint8_t)((uint16_t)s -> accel[i] >> 8);
+        out[i * 2 + 1] = (uint8_t)s -> accel[i];
+        out[8 + i * 2] = (uint8_t)((uint16_t)s -> gyro[i] >> 8);
+        out[8 + i * 2 + 1] = (uint8_t)s -> gyro[i];
+    }
+    out[6] = (uint8_t)((uint16_t)s -> temperature >> 8);
+    out[7] = (uint8_t)s -> temperature;
+    dev -> regs[MPU6050_SIM_INT_STATUS] |= 0x01; // DATA_RDY_INT
+
+    if (!(userCtrl & 0x40)) return; // FIFO_EN
+    if (userCtrl & 0x80) {
+        // DMP_EN: one packet per sample, quaternion w = 1.0 (Q30) first
+        uint8_t packet[64];
+        uint8_t size = s -> dmpPacketSize > sizeof(packet) ? sizeof(packet) : s -> dmpPacketSize;
+        memset(packet, 0, sizeof(packet));
+        packet[0] = 0x40;
+        I2Cdev_simMPU6050Push(s, packet, size, &dev -> regs[MPU6050_SIM_INT_STATUS]);
+        dev -> regs[MPU6050_SIM_INT_STATUS] |= 0x02; // DMP_INT
+        return;
+    }
+    if (fifoEnable & 0x08) I2Cdev_simMPU6050Push(s, out, 6, &dev -> regs[MPU6050_SIM_INT_STATUS]);
+    if (fifoEnable & 0x80) I2Cdev_simMPU6050Push(s, out + 6, 2, &dev -> regs[MPU6050_SIM_INT_STATUS]);
+    if (fifoEnable & 0x40) I2Cdev_simMPU6050Push(s, out + 8, 2, &dev -> regs[MPU6050_SIM_INT_STATUS]);
+    if (fifoEnable & 0x20) I2Cdev_simMPU6050Push(s, out + 10, 2, &dev -> regs[MPU6050_SIM_INT_STATUS]);
+    if (fifoEnable & 0x10) I2Cdev_simMPU6050Push(s, out + 12, 2, &dev -> regs[MPU6050_SIM_INT_STATUS]);
+}
+
+static void I2Cdev_simMPU6050Update(I2Cdev_SimDevice *dev, uint64_t nowNanos) {
+    I2Cdev_SimMPU6050 *s = (I2Cdev_SimMPU6050 *)dev -> state;
+    uint8_t dlpf = dev -> regs[MPU6050_SIM_CONFIG] & 0x07;
+    uint32_t gyroRate = (dlpf == 0 || dlpf == 7) ? 8000 : 1000;
+    uint64_t period = 1000000000ULL * (1 + dev -> regs[MPU6050_SIM_SMPLRT_DIV]) / gyroRate;
+
+    if (dev -> regs[MPU6050_SIM_PWR_MGMT_1] & 0x40) {
+        s -> nextSampleNanos = nowNanos + period; // asleep, nothing sampled
+        return;
+    }
+    // after a long gap only the newest FIFO-full of samples can matter
+    if (s -> nextSampleNanos + period * I2CDEV_SIM_MPU6050_FIFO < nowNanos) {
+        s -> nextSampleNanos = nowNanos - period * I2CDEV_SIM_MPU6050_FIFO;
+    }
+    while (s -> nextSampleNanos <= nowNanos) {
+        I2Cdev_simMPU6050Sample(dev);
+        s -> nextSampleNanos += period;
+    }
+}
+
+static uint8_t I2Cdev_simMPU6050Read(I2Cdev_SimDevice *dev, uint8_t regAddr, uint16_t index) {
+    I2Cdev_SimMPU6050 *s = (I2Cdev_SimMPU6050 *)dev -> state;
+    uint8_t reg, value;
+
+    if (regAddr == MPU6050_SIM_FIFO_R_W) {
+        // no auto-increment on the FIFO port; an empty FIFO reads as 0xFF
+        if (s -> fifoCount == 0) return 0xFF;
+        value = s -> fifo[s -> fifoHead];
+        s -> fifoHead = (s -> fifoHead + 1) % I2CDEV_SIM_MPU6050_FIFO;
+        s -> fifoCount--;
+        return value;
+    }
+    if (regAddr == MPU6050_SIM_MEM_R_W) {
+        value = s -> memory[I2Cdev_simMPU6050MemAddr(dev)];
+        I2Cdev_simMPU6050MemNext(dev);
+        return value;
+    }
+    reg = (uint8_t)(regAddr + index);
+    switch (reg) {
+        case MPU6050_SIM_FIFO_COUNTH: return (uint8_t)(s -> fifoCount >> 8);
+        case MPU6050_SIM_FIFO_COUNTL: return (uint8_t)s -> fifoCount;
+        case MPU6050_SIM_INT_STATUS:
+            value = dev -> regs[reg];
+            dev -> regs[reg] = 0; // cleared on read
+            return value;
+    }
+    return dev -> regs[reg];
+}
+
+static void I2Cdev_simMPU6050Write(I2Cdev_SimDevice *dev, uint8_t regAddr, uint16_t index, uint8_t value) {
+    I2Cdev_SimMPU6050 *s = (I2Cdev_SimMPU6050 *)dev -> state;
+    uint8_t reg;
+
+    if (regAddr == MPU6050_SIM_FIFO_R_W) {
+        I2Cdev_simMPU6050Push(s, &value, 1, &dev -> regs[MPU6050_SIM_INT_STATUS]);
+        return;
+    }
+    if (regAddr == MPU6050_SIM_MEM_R_W) {
+        s -> memory[I2Cdev_simMPU6050MemAddr(dev)] = value;
+        I2Cdev_simMPU6050MemNext(dev);
+        return;
+    }
+    reg = (uint8_t)(regAddr + index);
+    switch (reg) {
+        case MPU6050_SIM_USER_CTRL:
+            if (value & 0x04) s -> fifoHead = s -> fifoCount = 0; // FIFO_RESET
+            value &= ~0x0D; // reset bits clear themselves
+            break;
+        case MPU6050_SIM_PWR_MGMT_1:
+            if (value & 0x80) {
+                // DEVICE_RESET restores the registers; DMP memory is left alone
+                I2Cdev_simMPU6050Defaults(dev);
+                s -> fifoHead = s -> fifoCount = 0;
+                return;
+            }
+            break;
+        case MPU6050_SIM_WHO_AM_I:
+        case MPU6050_SIM_INT_STATUS:
+        case MPU6050_SIM_FIFO_COUNTH:
+        case MPU6050_SIM_FIFO_COUNTL:
+            return; // read-only
+    }
+    if (reg >= MPU6050_SIM_ACCEL_XOUT_H && reg <= MPU6050_SIM_GYRO_ZOUT_L) return; // read-only
+    dev -> regs[reg] = value;
+}
+
+/** MPU6050 model: power-on register defaults, sensor registers fed from
+ * state (accel 0,0,+1g at the default range), FIFO, interrupt status and
+ * DMP memory ports. DMP packets are queued at the sample rate but carry no
+ * real sensor fusion.
+ */
+void I2Cdev_simInitMPU6050(I2Cdev_SimDevice *dev, I2Cdev_SimMPU6050 *state, uint8_t address) {
+    I2Cdev_simInitDevice(dev, address);
+    memset(state, 0, sizeof(*state));
+    state -> accel[2] = 16384;
+    state -> dmpPacketSize = 42;
+    dev -> state = state;
+    dev -> read = I2Cdev_simMPU6050Read;
+    dev -> write = I2Cdev_simMPU6050Write;
+    dev -> update = I2Cdev_simMPU6050Update;
+    I2Cdev_simMPU6050Defaults(dev);
+}
+
+// -----------------------------------------------------------------------------
+// ADXL345
+// -----------------------------------------------------------------------------
+
+/** ADXL345 model: flat register file with the power-on defaults and a
+ * resting 1g reading on Z (LSB first); set regs[0x32..0x37] to change it.
+ */
+void I2Cdev_simInitADXL345(I2Cdev_SimDevice *dev, uint8_t address) {
+    I2Cdev_simInitDevice(dev, address);
+    dev -> regs[0x00] = 0xE5; // DEVID
+    dev -> regs[0x2C] = 0x0A; // BW_RATE 100Hz
+    dev -> regs[0x30] = 0x82; // INT_SOURCE: DATA_READY, WATERMARK
+    dev -> regs[0x36] = 0x00; // DATAZ0
+    dev -> regs[0x37] = 0x01; // DATAZ1 (256 LSB = 1g at full resolution)
+}
+
+// -----------------------------------------------------------------------------
+// BMP085
+// -----------------------------------------------------------------------------
+
+static void I2Cdev_simBMP085Write(I2Cdev_SimDevice *dev, uint8_t regAddr, uint16_t index, uint8_t value) {
+    I2Cdev_SimBMP085 *s = (I2Cdev_SimBMP085 *)dev -> state;
+    uint8_t reg = (uint8_t)(regAddr + index);
+    if (reg != 0xF4) {
+        if (reg < 0xAA || reg > 0xD1) dev -> regs[reg] = value; // calibration and ID are read-only
+        return;
+    }
+    // conversions complete instantly; the driver's own delay still costs modelled time
+    if (value == 0x2E) {
+        dev -> regs[0xF6] = (uint8_t)(s -> rawTemperature >> 8);
+        dev -> regs[0xF7] = (uint8_t)s -> rawTemperature;
+    } else if ((value & 0x3F) == 0x34) {
+        uint32_t up = s -> rawPressure << (8 - (value >> 6));
+        dev -> regs[0xF6] = (uint8_t)(up >> 16);
+        dev -> regs[0xF7] = (uint8_t)(up >> 8);
+        dev -> regs[0xF8] = (uint8_t)up;
+    }
+    dev -> regs[0xF4] = value & ~0x20; // SCO clear, conversion done
+}
+
+/** BMP085 model with the calibration set and raw readings from the
+ * datasheet's worked example (15.0C, 69964Pa).
+ */
+void I2Cdev_simInitBMP085(I2Cdev_SimDevice *dev, I2Cdev_SimBMP085 *state, uint8_t address) {
+    static const int16_t calibration[11] = { 408, -72, -14383, 32741, 32757, 23153, 6190, 4, -32768, -8711, 2868 };
+    uint8_t i;
+    I2Cdev_simInitDevice(dev, address);
+    for (i = 0; i < 11; i++) {
+        dev -> regs[0xAA + i * 2] = (uint8_t)((uint16_t)calibration[i] >> 8);
+        dev -> regs[0xAA + i * 2 + 1] = (uint8_t)calibration[i];
+    }
+    dev -> regs[0xD0] = 0x55; // chip ID
+    state -> rawTemperature = 27898;
+    state -> rawPressure = 23843;
+    dev -> state = state;
+    dev -> write = I2Cdev_simBMP085Write;
+}
+
+// -----------------------------------------------------------------------------
+// ADS1115
+// -----------------------------------------------------------------------------
+
+static int16_t I2Cdev_simADS1115Convert(I2Cdev_SimADS1115 *s) {
+    static const uint8_t positive[4] = { 0, 0, 1, 2 };
+    static const uint8_t negative[4] = { 1, 3, 3, 3 };
+    uint8_t mux = (s -> regs[1] >> 12) & 0x07;
+    if (mux >= 4) return s -> inputs[mux - 4];
+    return s -> inputs[positive[mux]] - s -> inputs[negative[mux]];
+}
+
+static uint8_t I2Cdev_simADS1115Read(I2Cdev_SimDevice *dev, uint8_t regAddr, uint16_t index) {
+    I2Cdev_SimADS1115 *s = (I2Cdev_SimADS1115 *)dev -> state;
+    uint8_t reg = regAddr & 0x03;
+    // continuous mode (MODE = 0) always has a fresh result
+    if (reg == 0 && !(s -> regs[1] & 0x0100)) s -> regs[0] = (uint16_t)I2Cdev_simADS1115Convert(s);
+    // pointer register doesn't move: further bytes repeat the same word
+    return (index & 1) ? (uint8_t)s -> regs[reg] : (uint8_t)(s -> regs[reg] >> 8);
+}
+
+static void I2Cdev_simADS1115Write(I2Cdev_SimDevice *dev, uint8_t regAddr, uint16_t index, uint8_t value) {
+    I2Cdev_SimADS1115 *s = (I2Cdev_SimADS1115 *)dev -> state;
+    uint8_t reg = regAddr & 0x03;
+    uint16_t word;
+    if (!(index & 1)) {
+        s -> latch = value;
+        return;
+    }
+    word = (uint16_t)s -> latch << 8 | value;
+    if (reg == 0) return; // conversion register is read-only
+    if (reg == 1) {
+        s -> regs[1] = word | 0x8000; // OS reads 1: not converting
+        if (word & 0x8000) s -> regs[0] = (uint16_t)I2Cdev_simADS1115Convert(s);
+        return;
+    }
+    s -> regs[reg] = word;
+}
+
+/** ADS1115 model: 16-bit registers with power-on defaults; single-shot
+ * conversions complete immediately, returning inputs[] for the selected mux
+ * setting (PGA is ignored, inputs are already in codes).
+ */
+void I2Cdev_simInitADS1115(I2Cdev_SimDevice *dev, I2Cdev_SimADS1115 *state, uint8_t address) {
+    I2Cdev_simInitDevice(dev, address);
+    memset(state, 0, sizeof(*state));
+    state -> regs[1] = 0x8583;
+    state -> regs[2] = 0x8000;
+    state -> regs[3] = 0x7FFF;
+    dev -> state = state;
+    dev -> read = I2Cdev_simADS1115Read;
+    dev -> write = I2Cdev_simADS1115Write;
+}
+
+// -----------------------------------------------------------------------------
+// Arduino timing on the modelled clock
+// -----------------------------------------------------------------------------
+
+uint32_t millis(void) {
+    return (uint32_t)(I2Cdev_simBus.nowNanos / 1000000UL);
+}
+
+uint32_t micros(void) {
+    return (uint32_t)(I2Cdev_simBus.nowNanos / 1000UL);
+}
+
+void delay(uint32_t ms) {
+    I2Cdev_simDelay(&I2Cdev_simBus, (uint64_t)ms * 1000000UL);
+}
+
+void delayMicroseconds(uint32_t us) {
+    I2Cdev_simDelay(&I2Cdev_simBus, (uint64_t)us * 1000UL);
+}
+
+// -----------------------------------------------------------------------------
+// Arduino digital I/O on modelled pins
+// -----------------------------------------------------------------------------
+
+uint8_t I2Cdev_simPins[I2CDEV_SIM_PINS];
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin < I2CDEV_SIM_PINS && mode == INPUT_PULLUP) I2Cdev_simPins[pin] = HIGH;
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < I2CDEV_SIM_PINS ? I2Cdev_simPins[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < I2CDEV_SIM_PINS) I2Cdev_simPins[pin] = value ? HIGH : LOW;
+}
+
+#endif /* ARDUINO */
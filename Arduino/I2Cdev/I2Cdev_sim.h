@@ -0,0 +1,195 @@
+// I2Cdev library collection - Host-side simulated I2C bus
+// Register-file device models behind an I2Cdev_Transport, for building and benchmarking drivers on a PC
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Selected with I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION; not used
+// (and compiled out) in Arduino builds. See Benchmark/I2Cdev_benchmark.cpp.
+//
+// Changelog:
+//     2026-10-14 - add I2Cdev_simProbe() address-only writes
+//     2026-10-14 - add register pointer and I2Cdev_simReadCurrent() register-less reads
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_SIM_H_
+#define _I2CDEV_SIM_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>   // the C library headers Arduino.h would bring in for drivers
+#include "I2Cdev_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// default SCL rate of a new bus
+#define I2CDEV_SIM_DEFAULT_CLOCK_HZ     100000
+
+// default fixed cost per transaction on top of the bit times: driver call,
+// TWI interrupt service and START/STOP setup, roughly as measured on a
+// 16MHz AVR with Wire
+#define I2CDEV_SIM_DEFAULT_SETUP_NANOS  12000
+
+// bytes of MPU6050 DMP memory modelled (banks of 256)
+#define I2CDEV_SIM_MPU6050_MEMORY       (16 * 256)
+
+// depth of the MPU6050 FIFO model
+#define I2CDEV_SIM_MPU6050_FIFO         1024
+
+// GPIO pins modelled for the Arduino digital I/O calls (interrupt/ready lines)
+#define I2CDEV_SIM_PINS                 64
+
+/** Traffic counters, kept for the bus as a whole and for each device. */
+typedef struct I2Cdev_SimCounters {
+    uint32_t transactions;      // addressed transfers (reads and writes)
+    uint32_t reads;             // read transfers
+    uint32_t writes;            // write transfers
+    uint32_t bytes;             // data bytes moved (address and register bytes not included)
+    uint32_t nacks;             // transfers to an address nobody answered
+    uint64_t busNanos;          // modelled bus time, including the per-transaction setup cost
+} I2Cdev_SimCounters;
+
+struct I2Cdev_SimDevice;
+
+/** Device model hooks. A transfer starting at register regAddr calls read or
+ * write once per data byte with index counting from 0; the default (hook
+ * left 0) is a flat auto-incrementing register file in regs[]. update is
+ * called with the modelled time before every transfer to the device, so a
+ * model can produce samples as simulated time passes.
+ */
+typedef uint8_t (*I2Cdev_SimRead)(struct I2Cdev_SimDevice *dev, uint8_t regAddr, uint16_t index);
+typedef void (*I2Cdev_SimWrite)(struct I2Cdev_SimDevice *dev, uint8_t regAddr, uint16_t index, uint8_t value);
+typedef void (*I2Cdev_SimUpdate)(struct I2Cdev_SimDevice *dev, uint64_t nowNanos);
+
+/** One simulated slave. Storage belongs to the caller; attach it to a bus
+ * with I2Cdev_simAttach() after setting it up with one of the model init
+ * functions (or by hand).
+ */
+typedef struct I2Cdev_SimDevice {
+    uint8_t address;            // 7-bit slave address
+    uint8_t regs[256];          // register file
+    I2Cdev_SimRead read;        // per-byte read hook, 0 = regs[regAddr + index]
+    I2Cdev_SimWrite write;      // per-byte write hook, 0 = regs[regAddr + index] = value
+    I2Cdev_SimUpdate update;    // time hook, may be 0
+    uint8_t pointer;            // register pointer left by the last transfer, read by I2Cdev_simReadCurrent()
+    void *state;                // model-specific state
+    I2Cdev_SimCounters counters;
+    struct I2Cdev_SimDevice *next;
+} I2Cdev_SimDevice;
+
+/** Simulated bus. transport may be handed to I2Cdev_Bus or the core
+ * functions like any other backend.
+ */
+typedef struct I2Cdev_SimBus {
+    I2Cdev_Transport transport; // hooks bound to this bus
+    I2Cdev_SimDevice *devices;  // attached slaves
+    uint32_t clockHz;           // SCL rate used for bit times
+    uint32_t setupNanos;        // fixed cost charged to every transaction
+    uint64_t nowNanos;          // modelled time, advanced by transfers and I2Cdev_simDelay()
+    I2Cdev_SimCounters counters;
+} I2Cdev_SimBus;
+
+/** MPU6050 model state: sensor values, FIFO and DMP memory. Samples enter
+ * the FIFO at the rate set by SMPLRT_DIV/CONFIG while it is enabled in
+ * USER_CTRL, in the order selected by FIFO_EN; with the DMP enabled, one
+ * dmpPacketSize packet (a unit quaternion followed by zeros) is queued per
+ * sample instead.
+ */
+typedef struct I2Cdev_SimMPU6050 {
+    int16_t accel[3];
+    int16_t temperature;
+    int16_t gyro[3];
+    uint8_t fifo[I2CDEV_SIM_MPU6050_FIFO];
+    uint16_t fifoHead;
+    uint16_t fifoCount;
+    uint8_t dmpPacketSize;      // bytes queued per sample with the DMP running (default 42)
+    uint64_t nextSampleNanos;
+    uint8_t memory[I2CDEV_SIM_MPU6050_MEMORY];
+} I2Cdev_SimMPU6050;
+
+/** BMP085 model state: raw readings returned by the next conversion. */
+typedef struct I2Cdev_SimBMP085 {
+    uint16_t rawTemperature;    // UT
+    uint32_t rawPressure;       // UP before oversampling shift
+} I2Cdev_SimBMP085;
+
+/** ADS1115 model state: 16-bit register file and pin voltages in codes. */
+typedef struct I2Cdev_SimADS1115 {
+    uint16_t regs[4];           // conversion, config, lo_thresh, hi_thresh
+    int16_t inputs[4];          // AIN0-AIN3 as conversion codes
+    uint8_t latch;              // MSB of a register write in progress
+} I2Cdev_SimADS1115;
+
+void I2Cdev_simInit(I2Cdev_SimBus *bus, uint32_t clockHz, uint32_t setupNanos);
+void I2Cdev_simAttach(I2Cdev_SimBus *bus, I2Cdev_SimDevice *dev);
+void I2Cdev_simDetach(I2Cdev_SimBus *bus, I2Cdev_SimDevice *dev);
+void I2Cdev_simResetCounters(I2Cdev_SimBus *bus);
+void I2Cdev_simDelay(I2Cdev_SimBus *bus, uint64_t nanos);
+
+int16_t I2Cdev_simRead(I2Cdev_SimBus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+uint8_t I2Cdev_simWrite(I2Cdev_SimBus *bus, uint8_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data);
+int16_t I2Cdev_simReadCurrent(I2Cdev_SimBus *bus, uint8_t devAddr, uint16_t length, uint8_t *data);
+uint8_t I2Cdev_simProbe(I2Cdev_SimBus *bus, uint8_t devAddr);
+
+void I2Cdev_simInitDevice(I2Cdev_SimDevice *dev, uint8_t address);
+void I2Cdev_simInitMPU6050(I2Cdev_SimDevice *dev, I2Cdev_SimMPU6050 *state, uint8_t address);
+void I2Cdev_simInitADXL345(I2Cdev_SimDevice *dev, uint8_t address);
+void I2Cdev_simInitBMP085(I2Cdev_SimDevice *dev, I2Cdev_SimBMP085 *state, uint8_t address);
+void I2Cdev_simInitADS1115(I2Cdev_SimDevice *dev, I2Cdev_SimADS1115 *state, uint8_t address);
+
+/** Bus used by the static I2Cdev class and by the Arduino timing functions
+ * below when I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION.
+ */
+extern I2Cdev_SimBus I2Cdev_simBus;
+
+// Arduino timing API on the modelled clock of I2Cdev_simBus, so driver
+// delays cost simulated time rather than wall time
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+// Arduino digital I/O on a bank of modelled pin levels; a benchmark drives
+// a device's interrupt line by writing I2Cdev_simPins[] directly
+#define LOW             0
+#define HIGH            1
+#define INPUT           0
+#define OUTPUT          1
+#define INPUT_PULLUP    2
+
+extern uint8_t I2Cdev_simPins[I2CDEV_SIM_PINS];
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _I2CDEV_SIM_H_ */
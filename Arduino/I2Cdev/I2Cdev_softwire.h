@@ -0,0 +1,283 @@
+// I2Cdev library collection - bit-banged software I2C master
+// Header-only template master on any two GPIO pins, usable as an extra I2Cdev_Bus or as the main bus
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Each I2Cdev_SoftWire<Sda, Scl> instantiation is an independent bus with
+// its own pins, so a board can carry as many buses as it has spare pins;
+// include this header after I2Cdev.h, hand &I2Cdev_SoftWire<...>::transport
+// to an I2Cdev_Bus and bind drivers to that. Buses are driven one at a
+// time by the CPU, not concurrently.
+// With I2CDEV_IMPLEMENTATION == I2CDEV_SOFTWARE_WIRE the static I2Cdev
+// class runs on one of these as well (see I2Cdev.h).
+//
+// Pins are open-drain emulated (driven low or left floating), so external
+// pull-up resistors are required. Slaves may stretch the clock.
+//
+// Changelog:
+//     2026-10-14 - add readCurrent() register-less reads
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_SOFTWIRE_H_
+#define _I2CDEV_SOFTWIRE_H_
+
+#if ARDUINO < 100
+    #include "WProgram.h"
+#else
+    #include "Arduino.h"
+#endif
+#include "I2Cdev_core.h"
+
+// polls of a released SCL line before a clock-stretching slave is given up
+// on (a few ms on a 16MHz AVR); the transfer then fails
+#ifndef I2CDEV_SOFTWIRE_STRETCH_LOOPS
+    #define I2CDEV_SOFTWIRE_STRETCH_LOOPS   10000
+#endif
+
+// CPU cycles per half SCL period spent in the pin accesses and loop
+// bookkeeping themselves, subtracted from the computed delay on AVR
+#define I2CDEV_SOFTWIRE_OVERHEAD_CYCLES     8
+
+/** Portable pin for I2Cdev_SoftWire using pinMode()/digitalRead(). Works on
+ * any core by Arduino pin number, but each access costs a few microseconds,
+ * which caps the bus at roughly 100kHz; use a port pin type declared with
+ * I2CDEV_SOFTWIRE_AVR_PIN for full speed on AVR.
+ */
+template <uint8_t pin> struct I2Cdev_SoftPin {
+    static inline void begin() { digitalWrite(pin, LOW); pinMode(pin, INPUT); }
+    static inline void low() { pinMode(pin, OUTPUT); digitalWrite(pin, LOW); }
+    static inline void release() { pinMode(pin, INPUT); }
+    static inline uint8_t read() { return digitalRead(pin) == HIGH; }
+};
+
+/** Declare a pin type for I2Cdev_SoftWire on AVR port register bit
+ * (port letter, bit number), e.g. I2CDEV_SOFTWIRE_AVR_PIN(BusSDA, D, 2) for
+ * PD2. Every access compiles to a single sbi/cbi/sbic instruction: the
+ * output latch stays 0 and the data direction bit switches between driving
+ * low and floating.
+ */
+#define I2CDEV_SOFTWIRE_AVR_PIN(name, port, bit) \
+    struct name { \
+        static inline void begin() { DDR##port &= ~_BV(bit); PORT##port &= ~_BV(bit); } \
+        static inline void low() { DDR##port |= _BV(bit); } \
+        static inline void release() { DDR##port &= ~_BV(bit); } \
+        static inline uint8_t read() { return (PIN##port >> (bit)) & 1; } \
+    }
+
+/** Bit-banged I2C master on pin types Sda and Scl (I2Cdev_SoftPin or an
+ * I2CDEV_SOFTWIRE_AVR_PIN type) at up to khz kHz. Everything is static, so
+ * each pin pair is its own bus and no object needs to be created; call
+ * begin() once before use.
+ */
+template <class Sda, class Scl, uint16_t khz = 400> class I2Cdev_SoftWire {
+    public:
+        static const I2Cdev_Transport transport;
+
+        /** Release both lines and free a slave left holding SDA low. */
+        static void begin() {
+            Sda::begin();
+            Scl::begin();
+            unstick();
+        }
+
+        /** Read length bytes starting at regAddr, joining the register
+         * address write and the read with a repeated START.
+         * @return Number of bytes read (-1 indicates failure)
+         */
+        static int16_t readRegisters(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+            if (!start() || !write(devAddr << 1) || !write(regAddr) || !restart() || !write((devAddr << 1) | 1)) {
+                stop();
+                return -1;
+            }
+            return readData(length, data);
+        }
+
+        /** Read length bytes from the device's current position, without
+         * sending a register address (plain SLA+R).
+         * @return Number of bytes read (-1 indicates failure)
+         */
+        static int16_t readCurrent(uint8_t devAddr, uint16_t length, uint8_t *data) {
+            if (!start() || !write((devAddr << 1) | 1)) {
+                stop();
+                return -1;
+            }
+            return readData(length, data);
+        }
+
+        /** Write length bytes starting at regAddr in one transaction.
+         * @return Status of operation (true = success)
+         */
+        static bool writeRegisters(uint8_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data) {
+            bool ok = start() && write(devAddr << 1) && write(regAddr);
+            for (uint16_t i = 0; ok && i < length; i++) ok = write(data[i]);
+            stop();
+            return ok;
+        }
+
+        /** Check whether a slave answers at devAddr (address-only write). */
+        static bool probe(uint8_t devAddr) {
+            bool ok = start() && write(devAddr << 1);
+            stop();
+            return ok;
+        }
+
+    private:
+        // half an SCL period, less the time the bit loop itself takes
+        static inline void delayHalf() {
+            #if defined(__AVR__) && defined(F_CPU)
+                enum { cycles = F_CPU / (2000UL * khz) };
+                if (cycles > I2CDEV_SOFTWIRE_OVERHEAD_CYCLES) __builtin_avr_delay_cycles(cycles - I2CDEV_SOFTWIRE_OVERHEAD_CYCLES);
+            #else
+                delayMicroseconds((500 + khz - 1) / khz);
+            #endif
+        }
+
+        // release SCL and wait for any slave stretching the clock
+        static inline bool sclHigh() {
+            Scl::release();
+            for (uint16_t n = I2CDEV_SOFTWIRE_STRETCH_LOOPS; !Scl::read(); ) {
+                if (--n == 0) return false;
+            }
+            return true;
+        }
+
+        // clock out a slave stuck mid-byte (up to 9 pulses) and end with STOP
+        static void unstick() {
+            for (uint8_t i = 0; i < 9 && !Sda::read(); i++) {
+                Scl::low();
+                delayHalf();
+                if (!sclHigh()) return;
+                delayHalf();
+            }
+            Sda::low();
+            delayHalf();
+            sclHigh();
+            delayHalf();
+            Sda::release();
+            delayHalf();
+        }
+
+        static bool start() {
+            if (!Sda::read() || !Scl::read()) {
+                unstick();
+                if (!Sda::read() || !Scl::read()) return false;
+            }
+            Sda::low();
+            delayHalf();
+            Scl::low();
+            return true;
+        }
+
+        static bool restart() {
+            Sda::release();
+            delayHalf();
+            if (!sclHigh()) return false;
+            delayHalf();
+            Sda::low();
+            delayHalf();
+            Scl::low();
+            return true;
+        }
+
+        static void stop() {
+            Sda::low();
+            delayHalf();
+            sclHigh();
+            delayHalf();
+            Sda::release();
+            delayHalf();
+        }
+
+        // send a byte MSB first, true if the slave acknowledged it
+        static bool write(uint8_t b) {
+            for (uint8_t mask = 0x80; mask; mask >>= 1) {
+                if (b & mask) Sda::release();
+                else Sda::low();
+                delayHalf();
+                if (!sclHigh()) return false;
+                delayHalf();
+                Scl::low();
+            }
+            Sda::release();
+            delayHalf();
+            if (!sclHigh()) return false;
+            delayHalf();
+            uint8_t nack = Sda::read();
+            Scl::low();
+            return !nack;
+        }
+
+        // receive a byte MSB first and ACK it (more to come) or NACK it (last)
+        static int16_t read(bool ack) {
+            uint8_t b = 0;
+            Sda::release();
+            for (uint8_t i = 0; i < 8; i++) {
+                delayHalf();
+                if (!sclHigh()) return -1;
+                delayHalf();
+                b = (b << 1) | Sda::read();
+                Scl::low();
+            }
+            if (ack) Sda::low();
+            delayHalf();
+            if (!sclHigh()) return -1;
+            delayHalf();
+            Scl::low();
+            Sda::release();
+            return b;
+        }
+
+        // clock in length bytes after an acknowledged SLA+R, then STOP
+        static int16_t readData(uint16_t length, uint8_t *data) {
+            for (uint16_t i = 0; i < length; i++) {
+                int16_t b = read(i + 1 < length);
+                if (b < 0) {
+                    stop();
+                    return -1;
+                }
+                data[i] = b;
+            }
+            stop();
+            return length;
+        }
+
+        static int16_t transportRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+            return readRegisters(devAddr, regAddr, length, data);
+        }
+
+        static uint8_t transportWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+            return writeRegisters(devAddr, regAddr, length, data);
+        }
+};
+
+template <class Sda, class Scl, uint16_t khz>
+const I2Cdev_Transport I2Cdev_SoftWire<Sda, Scl, khz>::transport = {
+    I2Cdev_SoftWire<Sda, Scl, khz>::transportRead,
+    I2Cdev_SoftWire<Sda, Scl, khz>::transportWrite,
+    0, 0, 0
+};
+
+#endif /* _I2CDEV_SOFTWIRE_H_ */
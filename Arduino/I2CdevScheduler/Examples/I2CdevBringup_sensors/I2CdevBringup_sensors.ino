@@ -0,0 +1,115 @@
+// I2Cdev library collection - I2CdevBringup multi-device start-up Arduino example sketch
+// Brings an MPU6050 (with DMP), BMP085 and DS1307 up side by side
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev, I2CdevScheduler and the device classes must be installed as
+// libraries, or else the .cpp/.h files must be in the include path of your project
+#include "I2Cdev.h"
+#include "I2CdevBringup.h"
+#include "MPU6050_6Axis_MotionApps20.h"
+#include "BMP085.h"
+#include "DS1307.h"
+
+MPU6050 mpu(0x69); // AD0 high: the DS1307 is fixed at 0x68
+BMP085 barometer;
+DS1307 rtc;
+I2CdevBringup bringup;
+
+float temperature;
+int8_t mpuDevice, barometerDevice, rtcDevice;
+
+// MPU6050: dmpInitialize() one step at a time; the reset settle times and
+// the wait for the first DMP packets come back as waits, and the firmware
+// goes up one 256-byte bank per step
+uint32_t mpuStep(void *context, uint8_t *step) {
+    uint32_t wait;
+    uint8_t result = mpu.dmpInitializeStep(step, &wait);
+    if (result == MPU6050_DMP_INIT_PENDING) return wait;
+    return result == 0 ? I2CDEV_BRINGUP_DONE : I2CDEV_BRINGUP_FAILED;
+}
+
+// BMP085: calibration EEPROM, then a first temperature conversion, which is
+// needed before the first pressure reading anyway
+uint32_t barometerStep(void *context, uint8_t *step) {
+    switch ((*step)++) {
+        case 0:
+            if (!barometer.testConnection()) return I2CDEV_BRINGUP_FAILED;
+            barometer.initialize();
+            barometer.setControl(BMP085_MODE_TEMPERATURE);
+            return barometer.getMeasureDelayMicroseconds();
+        default:
+            temperature = barometer.getTemperatureC();
+            return I2CDEV_BRINGUP_DONE;
+    }
+}
+
+// DS1307: a single step; start the oscillator if it was halted
+uint32_t rtcStep(void *context, uint8_t *step) {
+    if (!rtc.testConnection()) return I2CDEV_BRINGUP_FAILED;
+    rtc.initialize();
+    if (!rtc.getClockRunning()) rtc.setClockRunning(true);
+    return I2CDEV_BRINGUP_DONE;
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Serial.begin(38400);
+
+    // longest sequence first, so its reset goes out first
+    mpuDevice = bringup.add(mpuStep, 0);
+    barometerDevice = bringup.add(barometerStep, 0);
+    rtcDevice = bringup.add(rtcStep, 0);
+
+    Serial.println("Initializing I2C devices...");
+    bool ok = bringup.begin(2000000);
+
+    Serial.print(ok ? "All devices ready in " : "Bring-up failed after ");
+    Serial.print(bringup.getElapsedMicros());
+    Serial.print(" us (one after another: ");
+    Serial.print(bringup.getSerialMicros());
+    Serial.println(" us)");
+    Serial.print("MPU6050/BMP085/DS1307 ready at us:\t");
+    Serial.print(bringup.getReadyMicros(mpuDevice)); Serial.print("\t");
+    Serial.print(bringup.getReadyMicros(barometerDevice)); Serial.print("\t");
+    Serial.println(bringup.getReadyMicros(rtcDevice));
+    Serial.print("BMP085 temperature:\t");
+    Serial.println(temperature);
+
+    if (bringup.getState(mpuDevice) == I2CDEV_BRINGUP_READY) mpu.setDMPEnabled(true);
+}
+
+void loop() {
+}
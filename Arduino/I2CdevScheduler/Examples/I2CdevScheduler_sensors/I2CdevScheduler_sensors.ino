@@ -0,0 +1,162 @@
+// I2Cdev library collection - I2CdevScheduler multi-sensor Arduino example sketch
+// Samples an MPU6050, HMC5883L, BMP085 and ADS1115 at independent rates
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-14 - poll MPU6050/HMC5883L on learned data-ready timing, sleep between tasks
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev, I2CdevScheduler and the device classes must be installed as
+// libraries, or else the .cpp/.h files must be in the include path of your project
+#include "I2Cdev.h"
+#include "I2CdevScheduler.h"
+#include "MPU6050.h"
+#include "HMC5883L.h"
+#include "BMP085.h"
+#include "ADS1115.h"
+
+MPU6050 accelgyro;
+HMC5883L mag;
+BMP085 barometer;
+ADS1115 adc;
+I2CdevScheduler scheduler;
+
+int16_t ax, ay, az, gx, gy, gz;
+int16_t mx, my, mz;
+float temperature, pressure;
+int16_t adcValue;
+bool barometerPressure = false; // which BMP085 conversion is in flight
+
+int8_t motionTask, headingTask;
+
+// MPU6050 samples continuously: a read-only task, polled on its data-ready
+// flag so the scheduler learns the sensor's real output rate
+bool motionReady(void *context) {
+    return accelgyro.getIntDataReadyStatus();
+}
+
+void readMotion(void *context) {
+    accelgyro.getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
+}
+
+// HMC5883L one-shots save power between 15 Hz samples; RDY is polled only
+// once the learned conversion time has passed
+uint32_t startHeading(void *context) {
+    mag.setMode(HMC5883L_MODE_SINGLE);
+    return HMC5883L_SINGLE_MEASURE_US;
+}
+
+bool headingReady(void *context) {
+    return mag.getReadyStatus();
+}
+
+void readHeading(void *context) {
+    mag.getHeading(&mx, &my, &mz);
+}
+
+// BMP085 alternates temperature and pressure one-shots; the scheduler reads
+// the other devices while each conversion runs instead of busy-waiting
+uint32_t startBarometer(void *context) {
+    barometer.setControl(barometerPressure ? BMP085_MODE_PRESSURE_3 : BMP085_MODE_TEMPERATURE);
+    return barometer.getMeasureDelayMicroseconds();
+}
+
+void readBarometer(void *context) {
+    if (barometerPressure) pressure = barometer.getPressure();
+    else temperature = barometer.getTemperatureC();
+    barometerPressure = !barometerPressure;
+}
+
+// ADS1115 in continuous mode always holds the latest conversion
+void readAdc(void *context) {
+    adcValue = adc.getConversion();
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Serial.begin(38400);
+
+    Serial.println("Initializing I2C devices...");
+    accelgyro.initialize();
+    // 1kHz (DLPF on) / (1 + 9) = 100 Hz output, flagged in INT_STATUS
+    accelgyro.setDLPFMode(MPU6050_DLPF_BW_42);
+    accelgyro.setRate(9);
+    accelgyro.setIntDataReadyEnabled(true);
+    mag.initialize();
+    barometer.initialize();
+    adc.initialize();
+    adc.setMultiplexer(ADS1115_MUX_P0_NG);
+    adc.setRate(ADS1115_RATE_128);
+    adc.setMode(ADS1115_MODE_CONTINUOUS);
+
+    // periods in microseconds; phases spread the first starts apart
+    motionTask = scheduler.add(0, readMotion, 0, 10000);            // ~100 Hz, learned
+    headingTask = scheduler.add(startHeading, readHeading, 0, 66667, 2500); // 15 Hz
+    scheduler.add(startBarometer, readBarometer, 0, 20000, 5000);   // 25 Hz each of T and P
+    scheduler.add(0, readAdc, 0, 7813, 7500);                       // 128 SPS
+    scheduler.setReadyCheck(motionTask, motionReady);
+    scheduler.setReadyCheck(headingTask, headingReady);
+}
+
+uint32_t lastPrint = 0;
+
+void loop() {
+    scheduler.run();
+
+    // anything else can run here as long as it doesn't block; then sleep
+    // until the next task is due (or any interrupt)
+    scheduler.sleep();
+    if (millis() - lastPrint >= 500) {
+        lastPrint = millis();
+        Serial.print("a/g/m:\t");
+        Serial.print(ax); Serial.print("\t");
+        Serial.print(ay); Serial.print("\t");
+        Serial.print(az); Serial.print("\t");
+        Serial.print(gx); Serial.print("\t");
+        Serial.print(gy); Serial.print("\t");
+        Serial.print(gz); Serial.print("\t");
+        Serial.print(mx); Serial.print("\t");
+        Serial.print(my); Serial.print("\t");
+        Serial.print(mz);
+        Serial.print("\tT/P:\t");
+        Serial.print(temperature); Serial.print("\t");
+        Serial.print(pressure);
+        Serial.print("\tADC:\t");
+        Serial.print(adcValue);
+        Serial.print("\tlearned us/wasted polls/slept:\t");
+        Serial.print(scheduler.getExpectedMicros(motionTask)); Serial.print("\t");
+        Serial.print(scheduler.getExpectedMicros(headingTask)); Serial.print("\t");
+        Serial.print(scheduler.getWastedPolls(motionTask) + scheduler.getWastedPolls(headingTask)); Serial.print("\t");
+        Serial.println(scheduler.getSleptMicros());
+    }
+}
@@ -0,0 +1,192 @@
+// I2Cdev library collection - Multi-device bring-up orchestrator implementation
+// Overlaps the reset, settle and upload steps of several I2C devices at boot
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+
+#include "I2CdevBringup.h"
+
+// true once the micros() timestamp t has been reached (wrap-safe)
+#define I2CDEV_BRINGUP_REACHED(now, t)      ((int32_t)((now) - (t)) >= 0)
+
+/** Default constructor.
+ */
+I2CdevBringup::I2CdevBringup() {
+    for (uint8_t i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) devices[i].state = I2CDEV_BRINGUP_FREE;
+    startedAt = 0;
+    started = false;
+}
+
+/** Register a device. Devices are stepped in the order they were added,
+ * so add the one with the longest sequence first.
+ * @param step Step hook running the device's start-up sequence
+ * @param context Pointer passed to the hook (typically the driver object)
+ * @return Device handle, or -1 if every slot is taken
+ */
+int8_t I2CdevBringup::add(I2Cdev_BringupStep step, void *context) {
+    for (uint8_t i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) {
+        I2Cdev_BringupDevice *device = &devices[i];
+        if (device -> state != I2CDEV_BRINGUP_FREE) continue;
+        device -> step = step;
+        device -> context = context;
+        device -> dueAt = micros();
+        device -> readyAt = 0;
+        device -> serial = 0;
+        device -> next = 0;
+        device -> state = I2CDEV_BRINGUP_PENDING;
+        return i;
+    }
+    return -1;
+}
+
+/** Take one step of every device that is not waiting, without blocking.
+ * Call it from loop() until it returns 0 to bring devices up while other
+ * work goes on, or use begin().
+ * @return Number of devices still pending (0 = all ready or failed)
+ */
+uint8_t I2CdevBringup::run() {
+    uint8_t pending = 0;
+    uint32_t now = micros();
+    if (!started) {
+        startedAt = now;
+        started = true;
+    }
+    for (uint8_t i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) {
+        I2Cdev_BringupDevice *device = &devices[i];
+        if (device -> state != I2CDEV_BRINGUP_PENDING) continue;
+        if (!I2CDEV_BRINGUP_REACHED(now, device -> dueAt)) {
+            pending++;
+            continue;
+        }
+        uint32_t wait = device -> step(device -> context, &device -> next);
+        uint32_t done = micros();
+        device -> serial += done - now;
+        if (wait == I2CDEV_BRINGUP_DONE || wait == I2CDEV_BRINGUP_FAILED) {
+            device -> state = wait == I2CDEV_BRINGUP_DONE ? I2CDEV_BRINGUP_READY : I2CDEV_BRINGUP_ERROR;
+            device -> readyAt = done - startedAt;
+        } else {
+            device -> serial += wait;
+            device -> dueAt = done + wait;
+            pending++;
+        }
+        now = done;
+    }
+    return pending;
+}
+
+/** Bring every device up, waiting only when all of them are waiting.
+ * @param timeoutMicros Give up on devices still pending after this long (0 = never)
+ * @return True if every device is ready, false if any failed or timed out
+ */
+bool I2CdevBringup::begin(uint32_t timeoutMicros) {
+    uint32_t t0 = micros();
+    uint8_t i;
+    while (run()) {
+        uint32_t idle = getIdleMicros();
+        if (timeoutMicros) {
+            uint32_t elapsed = micros() - t0;
+            if (elapsed >= timeoutMicros) {
+                for (i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) {
+                    if (devices[i].state != I2CDEV_BRINGUP_PENDING) continue;
+                    devices[i].state = I2CDEV_BRINGUP_ERROR;
+                    devices[i].readyAt = micros() - startedAt;
+                }
+                return false;
+            }
+            if (idle > timeoutMicros - elapsed) idle = timeoutMicros - elapsed;
+        }
+        if (idle >= 1000) delay(idle / 1000);
+        else if (idle) delayMicroseconds(idle);
+    }
+    for (i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) {
+        if (devices[i].state == I2CDEV_BRINGUP_ERROR) return false;
+    }
+    return true;
+}
+
+/** Get a device's bring-up state.
+ * @param device Handle returned by add()
+ * @return I2CDEV_BRINGUP_PENDING, _READY, _ERROR (or _FREE for a bad handle)
+ */
+uint8_t I2CdevBringup::getState(int8_t device) {
+    if (device < 0 || device >= I2CDEV_BRINGUP_DEVICES) return I2CDEV_BRINGUP_FREE;
+    return devices[device].state;
+}
+
+/** Get the time a device took to come up.
+ * @param device Handle returned by add()
+ * @return Microseconds from the first run() to ready or failed (0 = still pending)
+ */
+uint32_t I2CdevBringup::getReadyMicros(int8_t device) {
+    if (device < 0 || device >= I2CDEV_BRINGUP_DEVICES) return 0;
+    if (devices[device].state == I2CDEV_BRINGUP_PENDING) return 0;
+    return devices[device].readyAt;
+}
+
+/** Get the time until some device has a step to run.
+ * @return Microseconds (0 = a step is due now, 0xFFFFFFFF = nothing pending)
+ */
+uint32_t I2CdevBringup::getIdleMicros() {
+    uint32_t now = micros();
+    uint32_t idle = 0xFFFFFFFF;
+    for (uint8_t i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) {
+        I2Cdev_BringupDevice *device = &devices[i];
+        if (device -> state != I2CDEV_BRINGUP_PENDING) continue;
+        if (I2CDEV_BRINGUP_REACHED(now, device -> dueAt)) return 0;
+        if (device -> dueAt - now < idle) idle = device -> dueAt - now;
+    }
+    return idle;
+}
+
+/** Get the total bring-up time so far.
+ * @return Microseconds from the first run() until the last device finished
+ *         (or until now while any is pending)
+ */
+uint32_t I2CdevBringup::getElapsedMicros() {
+    if (!started) return 0;
+    uint32_t elapsed = 0;
+    for (uint8_t i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) {
+        if (devices[i].state == I2CDEV_BRINGUP_PENDING) return micros() - startedAt;
+        if (devices[i].state != I2CDEV_BRINGUP_FREE && devices[i].readyAt > elapsed) elapsed = devices[i].readyAt;
+    }
+    return elapsed;
+}
+
+/** Estimate how long bringing the devices up one after another would have
+ * taken: the time spent in every step plus every wait the steps asked for.
+ * Compare with getElapsedMicros() to see what the overlap saved.
+ * @return Microseconds
+ */
+uint32_t I2CdevBringup::getSerialMicros() {
+    uint32_t serial = 0;
+    for (uint8_t i = 0; i < I2CDEV_BRINGUP_DEVICES; i++) {
+        if (devices[i].state != I2CDEV_BRINGUP_FREE) serial += devices[i].serial;
+    }
+    return serial;
+}
@@ -0,0 +1,99 @@
+// I2Cdev library collection - Multi-device bring-up orchestrator header file
+// Overlaps the reset, settle and upload steps of several I2C devices at boot
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+
+#ifndef _I2CDEVBRINGUP_H_
+#define _I2CDEVBRINGUP_H_
+
+#include "I2Cdev.h"
+
+// maximum number of registered devices (each costs 18 bytes of RAM on AVR)
+#define I2CDEV_BRINGUP_DEVICES      8
+
+// step hook return values other than a wait
+#define I2CDEV_BRINGUP_DONE         0xFFFFFFFF // device is ready
+#define I2CDEV_BRINGUP_FAILED       0xFFFFFFFE // device gave up
+
+#define I2CDEV_BRINGUP_FREE         0 // slot unused
+#define I2CDEV_BRINGUP_PENDING      1 // steps left to run
+#define I2CDEV_BRINGUP_READY        2 // bring-up finished
+#define I2CDEV_BRINGUP_ERROR        3 // a step failed, or begin() timed out
+
+/** Run one step of a device's start-up sequence. Must not wait: a reset,
+ * a block of configuration writes or one chunk of a firmware upload, then
+ * return how long the device needs before the next step.
+ * @param context Caller-supplied pointer given to I2CdevBringup::add()
+ * @param step Step counter, 0 on the first call; the hook advances it
+ *        (or leaves it alone to repeat a step, e.g. to poll a status bit)
+ * @return Microseconds to wait before the next step (0 = run it as soon as
+ *         possible), I2CDEV_BRINGUP_DONE or I2CDEV_BRINGUP_FAILED
+ */
+typedef uint32_t (*I2Cdev_BringupStep)(void *context, uint8_t *step);
+
+typedef struct I2Cdev_BringupDevice {
+    I2Cdev_BringupStep step;
+    void *context;
+    uint32_t dueAt;             // micros() timestamp the next step may run
+    uint32_t readyAt;           // microseconds from the start to ready (or failed)
+    uint32_t serial;            // step time + requested waits, i.e. a serial bring-up
+    uint8_t next;               // step counter passed to the hook
+    uint8_t state;              // I2CDEV_BRINGUP_*
+} I2Cdev_BringupDevice;
+
+/** Start-up orchestrator for several devices on one bus. Each device
+ * splits its initialization into steps that return instead of calling
+ * delay(); run() takes one step of every device that is not waiting, so
+ * all resets go out first, the settle delays they call for run side by
+ * side, and long steps such as a DMP upload are cut into chunks with the
+ * other devices served in between. Boot time then approaches that of the
+ * slowest device instead of the sum of all of them.
+ */
+class I2CdevBringup {
+    public:
+        I2CdevBringup();
+
+        int8_t add(I2Cdev_BringupStep step, void *context);
+        uint8_t run();
+        bool begin(uint32_t timeoutMicros=0);
+
+        uint8_t getState(int8_t device);
+        uint32_t getReadyMicros(int8_t device);
+        uint32_t getIdleMicros();
+        uint32_t getElapsedMicros();
+        uint32_t getSerialMicros();
+
+    private:
+        I2Cdev_BringupDevice devices[I2CDEV_BRINGUP_DEVICES];
+        uint32_t startedAt;
+        bool started;
+};
+
+#endif /* _I2CDEVBRINGUP_H_ */
@@ -0,0 +1,298 @@
+// I2Cdev library collection - Cooperative sampling scheduler implementation
+// Interleaves periodic start-conversion/read-result pairs on several I2C devices
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-14 - add adaptive readiness polling (governor) and idle sleep
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+
+#include "I2CdevScheduler.h"
+
+#if defined(__AVR__) && (I2CDEV_IMPLEMENTATION != I2CDEV_HOST_SIMULATION)
+    #include <avr/sleep.h>
+#endif
+
+// true once the micros() timestamp t has been reached (wrap-safe)
+#define I2CDEV_SCHEDULER_REACHED(now, t)    ((int32_t)((now) - (t)) >= 0)
+
+/** Default constructor.
+ */
+I2CdevScheduler::I2CdevScheduler() {
+    for (uint8_t i = 0; i < I2CDEV_SCHEDULER_TASKS; i++) tasks[i].state = I2CDEV_TASK_FREE;
+    sleptMicros = 0;
+}
+
+/** Register a periodic task.
+ * Give tasks on different devices different phases to spread their starts
+ * out; two tasks must not share one device, since nothing stops one from
+ * starting while the other is converting.
+ * @param start Conversion start hook (0 for read-only tasks)
+ * @param read Result fetch hook
+ * @param context Pointer passed to both hooks (typically the driver object)
+ * @param periodMicros Time between starts in microseconds
+ * @param phaseMicros Delay before the first start in microseconds
+ * @return Task handle, or -1 if every slot is taken
+ */
+int8_t I2CdevScheduler::add(I2Cdev_TaskStart start, I2Cdev_TaskRead read, void *context, uint32_t periodMicros, uint32_t phaseMicros) {
+    for (uint8_t i = 0; i < I2CDEV_SCHEDULER_TASKS; i++) {
+        I2Cdev_Task *task = &tasks[i];
+        if (task -> state != I2CDEV_TASK_FREE) continue;
+        task -> start = start;
+        task -> read = read;
+        task -> context = context;
+        task -> period = periodMicros;
+        task -> nextStart = micros() + phaseMicros;
+        task -> overruns = 0;
+        task -> state = I2CDEV_TASK_WAITING;
+        task -> ready = 0;
+        task -> expected = 0;
+        task -> wastedPolls = 0;
+        task -> misses = 0;
+        return i;
+    }
+    return -1;
+}
+
+/** Unregister a task. A conversion in progress is abandoned unread.
+ * @param task Handle returned by add()
+ */
+void I2CdevScheduler::remove(int8_t task) {
+    if (task >= 0 && task < I2CDEV_SCHEDULER_TASKS) tasks[task].state = I2CDEV_TASK_FREE;
+}
+
+/** Change a task's period, effective from its next start.
+ * @param task Handle returned by add()
+ * @param periodMicros Time between starts in microseconds
+ */
+void I2CdevScheduler::setPeriod(int8_t task, uint32_t periodMicros) {
+    if (task >= 0 && task < I2CDEV_SCHEDULER_TASKS) tasks[task].period = periodMicros;
+}
+
+/** Get the number of periods a task has missed because run() was called
+ * too late (the start is then rescheduled rather than run in a burst).
+ * @param task Handle returned by add()
+ * @return Number of skipped periods
+ */
+uint16_t I2CdevScheduler::getOverruns(int8_t task) {
+    if (task < 0 || task >= I2CDEV_SCHEDULER_TASKS) return 0;
+    return tasks[task].overruns;
+}
+
+/** Give a task a readiness check and let the scheduler learn when its
+ * results are ready instead of trusting a fixed delay.
+ *
+ * With a start hook, the delay start() returns (the datasheet maximum) is
+ * only the first guess. The task is polled once the learned time has
+ * passed; a result ready at the first poll makes the next guess 1/32
+ * shorter, a result that needed more polls moves the guess half way to
+ * the measured time. Polls that find nothing ready back off
+ * from 1/16 to 1/2 of the guess. The guess settles just around the real
+ * conversion time, which for RC-clocked parts (ADS1115, HMC5883L, BMP085)
+ * is often well under the datasheet maximum.
+ *
+ * A read-only task (free-running sensor with a data-ready flag) is polled
+ * the same way, timed from its previous read, so the polling rate locks
+ * onto the sensor's own output rate; the period given to add() is then only
+ * the first guess, and should not be much longer than the sensor's output
+ * period, since samples are lost until the guess has come down.
+ * @param task Handle returned by add()
+ * @param ready Readiness check, or 0 to go back to fixed timing
+ */
+void I2CdevScheduler::setReadyCheck(int8_t task, I2Cdev_TaskReady ready) {
+    if (task < 0 || task >= I2CDEV_SCHEDULER_TASKS) return;
+    I2Cdev_Task *t = &tasks[task];
+    t -> ready = ready;
+    t -> expected = 0;
+    t -> misses = 0;
+    // a read-only task may have been left mid-cycle; let run() restart it
+    if (t -> state == I2CDEV_TASK_CONVERTING && !t -> start) {
+        t -> state = I2CDEV_TASK_WAITING;
+        t -> nextStart = micros();
+    }
+}
+
+/** Get a task's learned time from start (or previous read) to ready.
+ * @param task Handle returned by add()
+ * @return Microseconds (0 = no readiness check, or nothing measured yet)
+ */
+uint32_t I2CdevScheduler::getExpectedMicros(int8_t task) {
+    if (task < 0 || task >= I2CDEV_SCHEDULER_TASKS) return 0;
+    return tasks[task].expected;
+}
+
+/** Get the number of readiness polls that found nothing ready, i.e. bus
+ * transactions (or pin reads) spent waiting.
+ * @param task Handle returned by add()
+ * @return Number of wasted polls (saturates at 65535)
+ */
+uint16_t I2CdevScheduler::getWastedPolls(int8_t task) {
+    if (task < 0 || task >= I2CDEV_SCHEDULER_TASKS) return 0;
+    return tasks[task].wastedPolls;
+}
+
+// Poll a converting task with a readiness check, adapt its expected time,
+// and back its next poll off if it is not ready yet.
+bool I2CdevScheduler::pollReady(I2Cdev_Task *task, uint32_t now) {
+    if (!task -> ready(task -> context)) {
+        if (task -> wastedPolls < 0xFFFF) task -> wastedPolls++;
+        uint8_t shift = task -> misses < 3 ? 4 - task -> misses : 1;
+        if (task -> misses < 0xFF) task -> misses++;
+        uint32_t gap = task -> expected >> shift;
+        if (gap < I2CDEV_SCHEDULER_MIN_POLL_US) gap = I2CDEV_SCHEDULER_MIN_POLL_US;
+        task -> readyAt = now + gap;
+        return false;
+    }
+    uint32_t measured = now - task -> startedAt;
+    if (task -> misses == 0) {
+        // ready at the first poll, maybe long before it: probe earlier next time
+        task -> expected -= task -> expected >> 5;
+    } else if (measured > task -> expected) {
+        // ready between the last two polls: close in on the measurement
+        task -> expected += (measured - task -> expected) >> 1;
+    }
+    if (task -> expected < I2CDEV_SCHEDULER_MIN_POLL_US) task -> expected = I2CDEV_SCHEDULER_MIN_POLL_US;
+    task -> misses = 0;
+    return true;
+}
+
+/** Service every task once without blocking. Finished conversions are read
+ * before new ones are started, so results come back as early as possible
+ * and freshly started conversions run while the rest of loop() executes.
+ * @return Number of hooks called (0 = nothing was due)
+ */
+uint8_t I2CdevScheduler::run() {
+    uint8_t calls = 0;
+    uint8_t i;
+    uint32_t now = micros();
+
+    // collect results first
+    for (i = 0; i < I2CDEV_SCHEDULER_TASKS; i++) {
+        I2Cdev_Task *task = &tasks[i];
+        if (task -> state != I2CDEV_TASK_CONVERTING || !I2CDEV_SCHEDULER_REACHED(now, task -> readyAt)) continue;
+        if (task -> ready) {
+            calls++;
+            if (!pollReady(task, now)) continue;
+        }
+        task -> state = I2CDEV_TASK_WAITING;
+        task -> read(task -> context);
+        calls++;
+        if (task -> ready && !task -> start) {
+            // free-running sensor: the next sample is timed from this one
+            task -> startedAt = now;
+            task -> readyAt = now + task -> expected;
+            task -> state = I2CDEV_TASK_CONVERTING;
+        }
+    }
+
+    // then start whatever is due
+    now = micros();
+    for (i = 0; i < I2CDEV_SCHEDULER_TASKS; i++) {
+        I2Cdev_Task *task = &tasks[i];
+        if (task -> state != I2CDEV_TASK_WAITING || !I2CDEV_SCHEDULER_REACHED(now, task -> nextStart)) continue;
+        task -> nextStart += task -> period;
+        if (I2CDEV_SCHEDULER_REACHED(now, task -> nextStart)) {
+            // a whole period was lost; keep the rate rather than catching up in a burst
+            task -> overruns++;
+            task -> nextStart = now + task -> period;
+        }
+        uint32_t delay = task -> start ? task -> start(task -> context) : 0;
+        calls++;
+        if (task -> ready) {
+            // first cycle: seed the governor with the datasheet delay or the period
+            if (task -> expected == 0) task -> expected = task -> start ? delay : task -> period;
+            if (task -> expected < I2CDEV_SCHEDULER_MIN_POLL_US) task -> expected = I2CDEV_SCHEDULER_MIN_POLL_US;
+            task -> startedAt = micros();
+            task -> readyAt = task -> startedAt + task -> expected;
+            task -> misses = 0;
+            task -> state = I2CDEV_TASK_CONVERTING;
+        } else if (delay == 0) {
+            task -> read(task -> context);
+            calls++;
+        } else {
+            task -> readyAt = micros() + delay;
+            task -> state = I2CDEV_TASK_CONVERTING;
+        }
+    }
+    return calls;
+}
+
+/** Get the time until the scheduler next has something to do, so the
+ * caller can sleep or do other work in the gap.
+ * @return Microseconds until the next start or read (0 = due now, 0xFFFFFFFF = no tasks)
+ */
+uint32_t I2CdevScheduler::getIdleMicros() {
+    uint32_t now = micros();
+    uint32_t idle = 0xFFFFFFFF;
+    for (uint8_t i = 0; i < I2CDEV_SCHEDULER_TASKS; i++) {
+        I2Cdev_Task *task = &tasks[i];
+        uint32_t due;
+        if (task -> state == I2CDEV_TASK_WAITING) due = task -> nextStart;
+        else if (task -> state == I2CDEV_TASK_CONVERTING) due = task -> readyAt;
+        else continue;
+        if (I2CDEV_SCHEDULER_REACHED(now, due)) return 0;
+        if (due - now < idle) idle = due - now;
+    }
+    return idle;
+}
+
+/** Sleep the MCU until the next interrupt if no task is due for a while.
+ * Call it from loop() after run(). On AVR this is SLEEP_MODE_IDLE, which
+ * keeps timers, TWI, UART and pin interrupts running, so micros() stays
+ * right and a data-ready ISR wakes the CPU at once; otherwise the Timer0
+ * tick ends the sleep within ~1ms, which is why nothing closer than
+ * minMicros is slept through. ARM cores wait for an interrupt the same
+ * way, and the host simulation just advances its clock to the next task.
+ * Elsewhere it returns at once.
+ * @param minMicros Shortest idle time worth sleeping for
+ * @return Microseconds slept (0 = something was due too soon)
+ */
+uint32_t I2CdevScheduler::sleep(uint32_t minMicros) {
+    uint32_t idle = getIdleMicros();
+    if (idle < minMicros) return 0;
+    uint32_t t0 = micros();
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_HOST_SIMULATION)
+        delayMicroseconds(idle == 0xFFFFFFFF ? minMicros : idle);
+    #elif defined(__AVR__)
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_enable();
+        sleep_cpu();
+        sleep_disable();
+    #elif defined(__arm__)
+        __asm__ volatile ("wfi");
+    #endif
+    uint32_t slept = micros() - t0;
+    sleptMicros += slept;
+    return slept;
+}
+
+/** Get the total time spent in sleep(), e.g. to estimate the duty cycle.
+ * @return Microseconds slept since construction (wraps after ~71 minutes)
+ */
+uint32_t I2CdevScheduler::getSleptMicros() {
+    return sleptMicros;
+}
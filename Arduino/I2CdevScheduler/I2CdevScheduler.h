@@ -0,0 +1,123 @@
+// I2Cdev library collection - Cooperative sampling scheduler header file
+// Interleaves periodic start-conversion/read-result pairs on several I2C devices
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-14 - add adaptive readiness polling (governor) and idle sleep
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+
+#ifndef _I2CDEVSCHEDULER_H_
+#define _I2CDEVSCHEDULER_H_
+
+#include "I2Cdev.h"
+
+// maximum number of registered tasks (each costs 34 bytes of RAM on AVR)
+#define I2CDEV_SCHEDULER_TASKS      8
+
+// shortest gap between two readiness polls of one task, in microseconds
+#ifndef I2CDEV_SCHEDULER_MIN_POLL_US
+    #define I2CDEV_SCHEDULER_MIN_POLL_US    100
+#endif
+
+// sleep() only sleeps when the next task is at least this far away; one
+// sleep lasts until the next interrupt, and the 1.024ms Timer0 tick is
+// the one always running on Arduino
+#ifndef I2CDEV_SCHEDULER_SLEEP_MIN_US
+    #define I2CDEV_SCHEDULER_SLEEP_MIN_US   1100
+#endif
+
+#define I2CDEV_TASK_FREE            0 // slot unused
+#define I2CDEV_TASK_WAITING         1 // waiting for its next period
+#define I2CDEV_TASK_CONVERTING      2 // started, result not ready yet
+
+/** Start a conversion (set a control register, trigger a one-shot, ...).
+ * Must not wait for the result.
+ * @param context Caller-supplied pointer given to I2CdevScheduler::add()
+ * @return Microseconds until the result can be read (0 to read right away)
+ */
+typedef uint32_t (*I2Cdev_TaskStart)(void *context);
+
+/** Fetch the finished result of a conversion.
+ * @param context Caller-supplied pointer given to I2CdevScheduler::add()
+ */
+typedef void (*I2Cdev_TaskRead)(void *context);
+
+/** Check whether a result can be read (data-ready status bit, RDY pin, EOC
+ * flag set by an ISR, ...). Should be cheap: it is polled.
+ * @param context Caller-supplied pointer given to I2CdevScheduler::add()
+ * @return True if read() will get a fresh result
+ */
+typedef bool (*I2Cdev_TaskReady)(void *context);
+
+typedef struct I2Cdev_Task {
+    I2Cdev_TaskStart start;     // optional (0 = read-only task, e.g. free-running sensor)
+    I2Cdev_TaskRead read;
+    void *context;
+    uint32_t period;            // microseconds between starts
+    uint32_t nextStart;         // micros() timestamp of the next start
+    uint32_t readyAt;           // micros() timestamp the pending result is ready
+    uint16_t overruns;          // periods skipped because the loop ran late
+    uint8_t state;              // I2CDEV_TASK_*
+    I2Cdev_TaskReady ready;     // optional (0 = trust the start() delay / period)
+    uint32_t expected;          // learned microseconds from start (or last read) to ready
+    uint32_t startedAt;         // micros() timestamp the pending conversion began
+    uint16_t wastedPolls;       // readiness polls that found nothing ready
+    uint8_t misses;             // consecutive failed polls of the pending result
+} I2Cdev_Task;
+
+/** Cooperative scheduler for periodic multi-device sampling. Each device
+ * registers a start/read pair; run() starts whatever is due and collects
+ * whatever is ready without ever waiting, so one device's conversion time
+ * is spent reading the others. Call run() as often as possible from loop().
+ */
+class I2CdevScheduler {
+    public:
+        I2CdevScheduler();
+
+        int8_t add(I2Cdev_TaskStart start, I2Cdev_TaskRead read, void *context, uint32_t periodMicros, uint32_t phaseMicros=0);
+        void remove(int8_t task);
+        void setPeriod(int8_t task, uint32_t periodMicros);
+        uint16_t getOverruns(int8_t task);
+
+        void setReadyCheck(int8_t task, I2Cdev_TaskReady ready);
+        uint32_t getExpectedMicros(int8_t task);
+        uint16_t getWastedPolls(int8_t task);
+
+        uint8_t run();
+        uint32_t getIdleMicros();
+        uint32_t sleep(uint32_t minMicros=I2CDEV_SCHEDULER_SLEEP_MIN_US);
+        uint32_t getSleptMicros();
+
+    private:
+        I2Cdev_Task tasks[I2CDEV_SCHEDULER_TASKS];
+        uint32_t sleptMicros;
+
+        bool pollReady(I2Cdev_Task *task, uint32_t now);
+};
+
+#endif /* _I2CDEVSCHEDULER_H_ */
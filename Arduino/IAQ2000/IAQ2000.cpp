@@ -6,6 +6,7 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - read through I2Cdev::readRaw(), add non-blocking requestIaq()
 //     2012-04-01 - initial release
 
 /* ============================================
@@ -39,6 +40,7 @@ Copyright (c) 2012 Peteris Skorovs, Jeff Rowberg
  */
 IAQ2000::IAQ2000() {
     devAddr = IAQ2000_DEFAULT_ADDRESS;
+    request.state = I2CDEV_TXN_IDLE;
 }
 
 /** Specific address constructor.
@@ -48,6 +50,7 @@ IAQ2000::IAQ2000() {
  */
 IAQ2000::IAQ2000(uint8_t address) {
     devAddr = address;
+    request.state = I2CDEV_TXN_IDLE;
 }
 
 /** Power on and prepare for general usage.
@@ -74,53 +77,47 @@ bool IAQ2000::testConnection() {
  * @return Predicted CO2 concentration based on human induced volatile organic compounds (VOC) detection (in ppm VOC + CO2 equivalents)
  */
 uint16_t IAQ2000::getIaq() {
-  // read bytes from the DATA1 AND DATA2 registers and bit-shifting them into a 16-bit value
-  readAllBytes(devAddr, 2, buffer);
+  // the iAQ-2000 has no address pointer; a plain read returns DATA1 and DATA2,
+  // which are bit-shifted into a 16-bit value
+  if (I2Cdev::readRaw(devAddr, 2, buffer) != 2) return 0;
   return ((buffer[0] << 8) | buffer[1]);
 }
 
-/**  Read bytes from a slave device.
- * This is a "stripped-down" version of the standard Jeff Rowberg's I2Cdev::readBytes method
- * intended to provide compatibility with iAQ-2000,
- * which apparently does not support setting of an address pointer to indicate from which position is to start read from.
- * @param devAddr Address of the slave device to read bytes from
- * @param length Number of bytes to read
- * @param data Buffer to store read data in
- * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Number of bytes read (0 indicates failure)
+/** Start an iAQ-2000 reading without waiting for it.
+ * The sensor stretches the clock for a long time before answering. With the
+ * Fastwire or NBWire I2Cdev implementations the read runs from the TWI
+ * interrupt while the sketch carries on; poll isIaqReady() and collect the
+ * value with getRequestedIaq(). Other implementations complete the read
+ * before returning.
+ * @return True if the read was queued (false = one is already pending or the queue is full)
+ * @see isIaqReady()
  */
-int8_t IAQ2000::readAllBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-#ifdef I2CDEV_SERIAL_DEBUG
-    Serial.print("I2C (0x");
-    Serial.print(devAddr, HEX);
-    Serial.print(") reading ");
-    Serial.print(length, DEC);
-    Serial.print(" bytes...");
-#endif
-    
-    int8_t count = 0;
+bool IAQ2000::requestIaq() {
+    if (request.state == I2CDEV_TXN_QUEUED || request.state == I2CDEV_TXN_ACTIVE) return false;
+    request.devAddr = devAddr;
+    request.regAddr = IAQ2000_RA_DATA1;
+    request.flags = I2CDEV_TXN_READ | I2CDEV_TXN_NOREG;
+    request.length = 2;
+    request.data = requestData; // getIaq() may use buffer meanwhile
+    request.callback = 0;
+    return I2Cdev::submit(&request);
+}
 
-    Wire.requestFrom(devAddr, length);
-    
-    uint32_t t1 = millis();
-    for (; Wire.available() && (timeout == 0 || millis() - t1 < timeout); count++) {
-#if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-        data[count] = Wire.receive();
-#elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-        data[count] = Wire.read();
-#endif
-#ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print(data[count], HEX);
-        if (count + 1 < length) Serial.print(" ");
-#endif
-    }
-    if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
-    
-#ifdef I2CDEV_SERIAL_DEBUG
-    Serial.print(". Done (");
-    Serial.print(count, DEC);
-    Serial.println(" read).");
-#endif
-    
-    return count;
+/** Check whether the read started by requestIaq() has finished.
+ * @return True if a result (or failure) is waiting in getRequestedIaq()
+ */
+bool IAQ2000::isIaqReady() {
+    return request.state != I2CDEV_TXN_IDLE && I2Cdev::isComplete(&request);
+}
+
+/** Collect the result of the read started by requestIaq().
+ * @param iaq Predicted CO2 concentration in ppm, set on success
+ * @return True if the read completed successfully
+ */
+bool IAQ2000::getRequestedIaq(uint16_t *iaq) {
+    if (!isIaqReady()) return false;
+    bool ok = request.state == I2CDEV_TXN_DONE;
+    request.state = I2CDEV_TXN_IDLE;
+    if (ok) *iaq = (requestData[0] << 8) | requestData[1];
+    return ok;
 }
@@ -6,6 +6,7 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - read through I2Cdev::readRaw(), add non-blocking requestIaq()
 //     2012-04-01 - initial release
 
 /* ============================================
@@ -51,11 +52,15 @@ class IAQ2000 {
 		bool testConnection();
         uint16_t getIaq();
 
+        bool requestIaq();
+        bool isIaqReady();
+        bool getRequestedIaq(uint16_t *iaq);
+
     private:
         uint8_t devAddr;
         uint8_t buffer[2];
-    
-        int8_t readAllBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        uint8_t requestData[2];
+        I2Cdev_Transaction request;
 };
 
 #endif /* _IAQ200_H_ */
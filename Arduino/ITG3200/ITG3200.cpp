@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp data-ready samples with their read completion time
+//     2026-10-14 - add combined temperature/rotation burst and data-ready streaming
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -37,6 +39,7 @@ THE SOFTWARE.
  */
 ITG3200::ITG3200() {
     devAddr = ITG3200_DEFAULT_ADDRESS;
+    dataReadyPin = -1;
 }
 
 /** Specific address constructor.
@@ -47,6 +50,7 @@ ITG3200::ITG3200() {
  */
 ITG3200::ITG3200(uint8_t address) {
     devAddr = address;
+    dataReadyPin = -1;
 }
 
 /** Power on and prepare for general usage.
@@ -351,7 +355,7 @@ bool ITG3200::getIntDataReadyStatus() {
  */
 int16_t ITG3200::getTemperature() {
     I2Cdev::readBytes(devAddr, ITG3200_RA_TEMP_OUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 
 // GYRO_*OUT_* registers
@@ -364,9 +368,9 @@ int16_t ITG3200::getTemperature() {
  */
 void ITG3200::getRotation(int16_t* x, int16_t* y, int16_t* z) {
     I2Cdev::readBytes(devAddr, ITG3200_RA_GYRO_XOUT_H, 6, buffer);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 2);
+    *z = I2CDEV_BE16(buffer + 4);
 }
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
@@ -374,7 +378,7 @@ void ITG3200::getRotation(int16_t* x, int16_t* y, int16_t* z) {
  */
 int16_t ITG3200::getRotationX() {
     I2Cdev::readBytes(devAddr, ITG3200_RA_GYRO_XOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Y-axis gyroscope reading.
  * @return Y-axis rotation measurement in 16-bit 2's complement format
@@ -382,7 +386,7 @@ int16_t ITG3200::getRotationX() {
  */
 int16_t ITG3200::getRotationY() {
     I2Cdev::readBytes(devAddr, ITG3200_RA_GYRO_YOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Z-axis gyroscope reading.
  * @return Z-axis rotation measurement in 16-bit 2's complement format
@@ -390,7 +394,72 @@ int16_t ITG3200::getRotationY() {
  */
 int16_t ITG3200::getRotationZ() {
     I2Cdev::readBytes(devAddr, ITG3200_RA_GYRO_ZOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
+}
+
+// Combined TEMP_OUT_*/GYRO_*OUT_* burst
+
+/** Get temperature and 3-axis gyroscope readings in one burst read.
+ * TEMP_OUT_H through GYRO_ZOUT_L are contiguous, so a temperature
+ * compensated sample costs one 8-byte transaction instead of two.
+ * @param t 16-bit signed integer container for temperature
+ * @param x 16-bit signed integer container for X-axis rotation
+ * @param y 16-bit signed integer container for Y-axis rotation
+ * @param z 16-bit signed integer container for Z-axis rotation
+ * @see ITG3200_RA_TEMP_OUT_H
+ */
+void ITG3200::getTemperatureRotation(int16_t* t, int16_t* x, int16_t* y, int16_t* z) {
+    I2Cdev::readBytes(devAddr, ITG3200_RA_TEMP_OUT_H, 8, buffer);
+    *t = I2CDEV_BE16(buffer);
+    *x = I2CDEV_BE16(buffer + 2);
+    *y = I2CDEV_BE16(buffer + 4);
+    *z = I2CDEV_BE16(buffer + 6);
+}
+/** Configure the INT output for data-ready streaming.
+ * Sets INT active-high push-pull, latched until any register read, with
+ * only the data ready interrupt enabled, so reading a sample also clears
+ * INT. getTemperatureRotationIfReady() then only reads the device while INT
+ * is asserted. Pass -1 to poll the data ready status bit instead (the
+ * interrupt configuration is set up the same way).
+ * @param pin Arduino pin wired to INT, -1 for none
+ * @see setInterruptMode()
+ * @see setInterruptLatch()
+ * @see setInterruptLatchClear()
+ */
+void ITG3200::setDataReadyStreaming(int8_t pin) {
+    dataReadyPin = pin;
+    if (pin >= 0) pinMode(pin, INPUT);
+    setInterruptMode(false);
+    setInterruptDrive(false);
+    setInterruptLatch(true);
+    setInterruptLatchClear(true);
+    setIntDeviceReadyEnabled(false);
+    setIntDataReadyEnabled(true);
+}
+/** Read a new temperature and rotation sample if one is available.
+ * With a data-ready pin this costs no bus traffic until INT is high, then
+ * one 8-byte burst. Without one, INT_STATUS is read in the same burst as
+ * the sample (9 bytes from INT_STATUS), so polling is still one
+ * transaction per call and never returns a sample twice.
+ * @param timestamp Optional container for the micros() time the sample read completed
+ * @return True if the containers were filled with a new sample
+ * @see setDataReadyStreaming()
+ * @see I2Cdev::getReadTimestamp()
+ */
+bool ITG3200::getTemperatureRotationIfReady(int16_t* t, int16_t* x, int16_t* y, int16_t* z, uint32_t* timestamp) {
+    if (dataReadyPin >= 0) {
+        if (digitalRead(dataReadyPin) != HIGH) return false;
+        getTemperatureRotation(t, x, y, z);
+    } else {
+        if (I2Cdev::readBytes(devAddr, ITG3200_RA_INT_STATUS, 9, buffer) != 9) return false;
+        if (!(buffer[0] & (1 << ITG3200_INTSTAT_RAW_DATA_READY_BIT))) return false;
+        *t = I2CDEV_BE16(buffer + 1);
+        *x = I2CDEV_BE16(buffer + 3);
+        *y = I2CDEV_BE16(buffer + 5);
+        *z = I2CDEV_BE16(buffer + 7);
+    }
+    if (timestamp) *timestamp = I2Cdev::getReadTimestamp();
+    return true;
 }
 
 // PWR_MGM register
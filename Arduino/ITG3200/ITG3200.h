@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stamp data-ready samples with their read completion time
+//     2026-10-14 - add combined temperature/rotation burst and data-ready streaming
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -158,6 +160,11 @@ class ITG3200 {
         int16_t getRotationY();
         int16_t getRotationZ();
 
+        // combined TEMP_OUT_*/GYRO_*OUT_* burst
+        void getTemperatureRotation(int16_t* t, int16_t* x, int16_t* y, int16_t* z);
+        void setDataReadyStreaming(int8_t pin);
+        bool getTemperatureRotationIfReady(int16_t* t, int16_t* x, int16_t* y, int16_t* z, uint32_t* timestamp=0);
+
         // PWR_MGM register
         void reset();
         bool getSleepEnabled();
@@ -173,7 +180,8 @@ class ITG3200 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[9];
+        int8_t dataReadyPin;
 };
 
 #endif /* _ITG3200_H_ */
@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - initialize() CTRL_REG1-5 from a flash register script in one burst
+//     2026-10-14 - watermark-driven FIFO batch reader with sample timestamps
 //     2013-07-31 - initial release
 
 /* ============================================
@@ -37,6 +39,9 @@ THE SOFTWARE.
  */
 L3G4200D::L3G4200D() {
     devAddr = L3G4200D_DEFAULT_ADDRESS;
+    batchOverruns = 0;
+    batchStarted = false;
+    batchFlag = false;
 }
 
 /** Specific address constructor.
@@ -46,7 +51,21 @@ L3G4200D::L3G4200D() {
  */
 L3G4200D::L3G4200D(uint8_t address) {
     devAddr = address;
-}
+    batchOverruns = 0;
+    batchStarted = false;
+    batchFlag = false;
+}
+
+// initialize() settings, one auto-incremented burst over CTRL_REG1..5
+static const uint8_t initScript[] I2CDEV_SCRIPT_PROGMEM = {
+    I2CDEV_SCRIPT_INCREMENT(L3G4200D_AUTO_INCREMENT),
+    I2CDEV_SCRIPT_WRITE(L3G4200D_RA_CTRL_REG1, 0b00001111),
+    I2CDEV_SCRIPT_WRITE(L3G4200D_RA_CTRL_REG2, 0b00000000),
+    I2CDEV_SCRIPT_WRITE(L3G4200D_RA_CTRL_REG3, 0b00000000),
+    I2CDEV_SCRIPT_WRITE(L3G4200D_RA_CTRL_REG4, 0b00000000),
+    I2CDEV_SCRIPT_WRITE(L3G4200D_RA_CTRL_REG5, 0b00000000),
+    I2CDEV_SCRIPT_END
+};
 
 /** Power on and prepare for general usage.
  * All values are defaults except for the power on bit in CTRL_REG_1
@@ -57,11 +76,20 @@ L3G4200D::L3G4200D(uint8_t address) {
  * @see L3G4200D_RA_CTRL_REG5
  */
 void L3G4200D::initialize() {
-	I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG1, 0b00001111);
-    I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG2, 0b00000000);
-    I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG3, 0b00000000);
-    I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG4, 0b00000000);
-    I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG5, 0b00000000);
+    #ifdef I2CDEV_REGISTER_CACHE
+        // CTRL_REG1 .. INT1_DURATION minus outputs, FIFO_SRC and INT1_SRC; no
+        // burst load here since multi-byte reads need the auto-increment bit,
+        // so everything fills on first use
+        I2Cdev::addCacheRange(&cacheConfig, devAddr, L3G4200D_RA_CTRL_REG1, 25, cacheConfigValues,
+            (0xFFUL << (L3G4200D_RA_OUT_TEMP - L3G4200D_RA_CTRL_REG1)) |
+            (1UL << (L3G4200D_RA_FIFO_SRC - L3G4200D_RA_CTRL_REG1)) |
+            (1UL << (L3G4200D_RA_INT1_SRC - L3G4200D_RA_CTRL_REG1)));
+    #endif
+    I2Cdev::runScript(devAddr, initScript);
+    #ifdef I2CDEV_REGISTER_CACHE
+        // the burst went to the auto-increment alias, which the cache doesn't know
+        I2Cdev::invalidateCache(devAddr, L3G4200D_RA_CTRL_REG1, 5);
+    #endif
 }
 
 /** Verify the I2C connection.
@@ -109,8 +137,7 @@ void L3G4200D::setOutputDataRate(uint16_t rate) {
 		writeVal = L3G4200D_RATE_800;
 	}
 	
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT,
-		L3G4200D_ODR_LENGTH, writeVal); 
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT, L3G4200D_ODR_LENGTH> >(devAddr, writeVal); 
 }
 
 /** Get the current output data rate
@@ -124,8 +151,7 @@ void L3G4200D::setOutputDataRate(uint16_t rate) {
  * @see L3G4200D_RATE_800
  */
 uint16_t L3G4200D::getOutputDataRate() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT, 
-		L3G4200D_ODR_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT, L3G4200D_ODR_LENGTH> >(devAddr, buffer);
 	uint8_t rate = buffer[0];
 
 	if (rate == L3G4200D_RATE_100) {
@@ -149,8 +175,7 @@ uint16_t L3G4200D::getOutputDataRate() {
  * @see L3G4200D_BW_HIGH
  */
 void L3G4200D::setBandwidthCutOffMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, 
-		L3G4200D_BW_LENGTH, mode);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, L3G4200D_BW_LENGTH> >(devAddr, mode);
 }
 
 /** Get the current bandwidth cut-off mode
@@ -164,8 +189,7 @@ void L3G4200D::setBandwidthCutOffMode(uint8_t mode) {
  * @see L3G4200D_BW_HIGH
  */
 uint8_t L3G4200D::getBandwidthCutOffMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, 
-		L3G4200D_BW_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, L3G4200D_BW_LENGTH> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -234,7 +258,7 @@ float L3G4200D::getBandwidthCutOff() {
  * @see L3G4200D_PD_BIT
  */
 void L3G4200D::setPowerOn(bool on) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT, on);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT> >(devAddr, on);
 }
 
 /** Get the current power state
@@ -243,7 +267,7 @@ void L3G4200D::setPowerOn(bool on) {
  * @see L3G4200D_PD_BIT
  */
 bool L3G4200D::getPowerOn() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT, buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -253,7 +277,7 @@ bool L3G4200D::getPowerOn() {
  * @see L3G4200D_ZEN_BIT
  */
 void L3G4200D::setZEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT, enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT> >(devAddr, enabled);
 }
 
 /** Get whether Z axis data is enabled
@@ -262,7 +286,7 @@ void L3G4200D::setZEnabled(bool enabled) {
  * @see L3G4200D_ZEN_BIT
  */
 bool L3G4200D::getZEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT, buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -272,7 +296,7 @@ bool L3G4200D::getZEnabled() {
  * @see L3G4200D_YEN_BIT
  */
 void L3G4200D::setYEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT, enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT> >(devAddr, enabled);
 }
 
 /** Get whether Y axis data is enabled
@@ -281,7 +305,7 @@ void L3G4200D::setYEnabled(bool enabled) {
  * @see L3G4200D_YEN_BIT
  */
 bool L3G4200D::getYEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT, buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -291,7 +315,7 @@ bool L3G4200D::getYEnabled() {
  * @see L3G4200D_XEN_BIT
  */
 void L3G4200D::setXEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT, enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT> >(devAddr, enabled);
 }
 
 /** Get whether X axis data is enabled
@@ -300,7 +324,7 @@ void L3G4200D::setXEnabled(bool enabled) {
  * @see L3G4200D_XEN_BIT
  */
 bool L3G4200D::getXEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT, buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -317,8 +341,7 @@ bool L3G4200D::getXEnabled() {
  * @see L3G4200D_HPM_AUTORESET
  */
 void L3G4200D::setHighPassMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, 
-		L3G4200D_HPM_LENGTH, mode);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, L3G4200D_HPM_LENGTH> >(devAddr, mode);
 }
 
 /** Get the high pass mode
@@ -332,8 +355,7 @@ void L3G4200D::setHighPassMode(uint8_t mode) {
  * @see L3G4200D_HPM_AUTORESET
  */
 uint8_t L3G4200D::getHighPassMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, 
-		L3G4200D_HPM_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, L3G4200D_HPM_LENGTH> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -354,8 +376,7 @@ uint8_t L3G4200D::getHighPassMode() {
  * @see L3G4200D_HPCF10
  */
 void L3G4200D::setHighPassFilterCutOffFrequencyLevel(uint8_t level) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, 
-		L3G4200D_HPCF_LENGTH, level);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, L3G4200D_HPCF_LENGTH> >(devAddr, level);
 }
 
 /** Get the high pass filter cut off frequency level (1 - 10)
@@ -375,8 +396,7 @@ void L3G4200D::setHighPassFilterCutOffFrequencyLevel(uint8_t level) {
  * @see L3G4200D_HPCF10
  */
 uint8_t L3G4200D::getHighPassFilterCutOffFrequencyLevel() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, 
-		L3G4200D_HPCF_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, L3G4200D_HPCF_LENGTH> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -388,8 +408,7 @@ uint8_t L3G4200D::getHighPassFilterCutOffFrequencyLevel() {
  * @see L3G4200D_I1_INT1_BIT
  */
 void L3G4200D::setINT1InterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT> >(devAddr, enabled);
 }
 
 /** Get the INT1 interrupt enabled state
@@ -398,8 +417,7 @@ void L3G4200D::setINT1InterruptEnabled(bool enabled) {
  * @see L3G4200D_I1_INT1_BIT
  */
 bool L3G4200D::getINT1InterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -409,8 +427,7 @@ bool L3G4200D::getINT1InterruptEnabled() {
  * @see L3G4200D_I1_BOOT_BIT
  */
 void L3G4200D::setINT1BootStatusEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT> >(devAddr, enabled);
 }
 
 /** Get the INT1 boot status enabled state
@@ -419,8 +436,7 @@ void L3G4200D::setINT1BootStatusEnabled(bool enabled) {
  * @see L3G4200D_I1_BOOT_BIT
  */
 bool L3G4200D::getINT1BootStatusEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -429,7 +445,7 @@ bool L3G4200D::getINT1BootStatusEnabled() {
  * @see L3G4200D_H_LACTIVE_BIT
  */
 void L3G4200D::interruptActiveINT1Config() {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_H_LACTIVE_BIT, 1);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_H_LACTIVE_BIT> >(devAddr, 1);
 }
 
 /** Set output mode to push-pull or open-drain
@@ -440,8 +456,7 @@ void L3G4200D::interruptActiveINT1Config() {
  * @see L3G4200D_OPEN_DRAIN
  */
 void L3G4200D::setOutputMode(bool mode) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT, 
-		mode);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT> >(devAddr, mode);
 }
 
 /** Get whether mode is push-pull or open drain
@@ -452,8 +467,7 @@ void L3G4200D::setOutputMode(bool mode) {
  * @see L3G4200D_OPEN_DRAIN
  */
 bool L3G4200D::getOutputMode() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -463,8 +477,7 @@ bool L3G4200D::getOutputMode() {
  * @see L3G4200D_I2_DRDY_BIT
  */
 void L3G4200D::setINT2DataReadyEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the data ready interrupt is enabled on the INT2 pin
@@ -473,8 +486,7 @@ void L3G4200D::setINT2DataReadyEnabled(bool enabled) {
  * @see L3G4200D_I2_DRDY_BIT
  */
 bool L3G4200D::getINT2DataReadyEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -488,8 +500,7 @@ bool L3G4200D::getINT2DataReadyEnabled() {
  * @see L3G4200D_I2_WTM_BIT
  */
 void L3G4200D::setINT2FIFOWatermarkInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT> >(devAddr, enabled);
 }
 
 /** Get the INT2 FIFO watermark interrupt enabled state
@@ -498,8 +509,7 @@ void L3G4200D::setINT2FIFOWatermarkInterruptEnabled(bool enabled) {
  * @see L3G4200D_I2_WTM_BIT
  */ 
 bool L3G4200D::getINT2FIFOWatermarkInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -509,8 +519,7 @@ bool L3G4200D::getINT2FIFOWatermarkInterruptEnabled() {
  * @see L3G4200D_I2_ORUN_BIT
  */
 void L3G4200D::setINT2FIFOOverrunInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT> >(devAddr, enabled);
 }
 
 /** Get whether an interrupt is triggered on INT2 when the FIFO is overrun
@@ -519,8 +528,7 @@ void L3G4200D::setINT2FIFOOverrunInterruptEnabled(bool enabled) {
  * @see L3G4200D_I2_ORUN_BIT
  */
 bool L3G4200D::getINT2FIFOOverrunInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT,
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -530,8 +538,7 @@ bool L3G4200D::getINT2FIFOOverrunInterruptEnabled() {
  * @see L3G4200D_I2_EMPTY_BIT
  */
 void L3G4200D::setINT2FIFOEmptyInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the INT2 FIFO empty interrupt is enabled
@@ -540,8 +547,7 @@ void L3G4200D::setINT2FIFOEmptyInterruptEnabled(bool enabled) {
  * @see L3G4200D_I2_EMPTY_BIT
  */
 bool L3G4200D::getINT2FIFOEmptyInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -553,7 +559,7 @@ bool L3G4200D::getINT2FIFOEmptyInterruptEnabled() {
  * @see L3G4200D_BDU_BIT
  */
 void L3G4200D::setBlockDataUpdateEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT, enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT> >(devAddr, enabled);
 }
 
 /** Get the BDU enabled state
@@ -562,7 +568,7 @@ void L3G4200D::setBlockDataUpdateEnabled(bool enabled) {
  * @see L3G4200D_BDU_BIT
  */
 bool L3G4200D::getBlockDataUpdateEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT, buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -577,8 +583,7 @@ bool L3G4200D::getBlockDataUpdateEnabled() {
  * @see L3G4200D_LITTLE_ENDIAN
  */
 void L3G4200D::setEndianMode(bool endianness) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT, 
-		endianness);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT> >(devAddr, endianness);
 }
 
 /** Get the data endian mode
@@ -589,8 +594,7 @@ void L3G4200D::setEndianMode(bool endianness) {
  * @see L3G4200D_LITTLE_ENDIAN
  */
 bool L3G4200D::getEndianMode() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT,
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -614,8 +618,7 @@ void L3G4200D::setFullScale(uint16_t scale) {
 		writeBits = L3G4200D_FS_2000;
 	}
 
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_FS_BIT, 
-		L3G4200D_FS_LENGTH, writeBits);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG4, L3G4200D_FS_BIT, L3G4200D_FS_LENGTH> >(devAddr, writeBits);
 }
 
 /** Get the current full scale of the output data (in dps)
@@ -628,8 +631,7 @@ void L3G4200D::setFullScale(uint16_t scale) {
  * @see L3G4200D_FS_2000
  */
 uint16_t L3G4200D::getFullScale() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG4, 
-		L3G4200D_FS_BIT, L3G4200D_FS_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_CTRL_REG4, L3G4200D_FS_BIT, L3G4200D_FS_LENGTH> >(devAddr, buffer);
 	uint8_t readBits = buffer[0];
 	
 	if (readBits == L3G4200D_FS_250) {
@@ -651,8 +653,7 @@ uint16_t L3G4200D::getFullScale() {
  * @see L3G4200D_SELF_TEST_1
  */
 void L3G4200D::setSelfTestMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, 
-		L3G4200D_ST_LENGTH, mode);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, L3G4200D_ST_LENGTH> >(devAddr, mode);
 }
 
 /** Get the current self test mode
@@ -665,8 +666,7 @@ void L3G4200D::setSelfTestMode(uint8_t mode) {
  * @see L3G4200D_SELF_TEST_1
  */
 uint8_t L3G4200D::getSelfTestMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, 
-		L3G4200D_ST_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, L3G4200D_ST_LENGTH> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -678,7 +678,7 @@ uint8_t L3G4200D::getSelfTestMode() {
  * @see L3G4200D_SPI_3_WIRE
  */
 void L3G4200D::setSPIMode(bool mode) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT, mode);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT> >(devAddr, mode);
 }
 
 /** Get the SPI mode
@@ -689,8 +689,7 @@ void L3G4200D::setSPIMode(bool mode) {
  * @see L3G4200D_SPI_3_WIRE
  */
 bool L3G4200D::getSPIMode() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT> >(devAddr, buffer);
  	return buffer[0];
 }
 
@@ -701,7 +700,10 @@ bool L3G4200D::getSPIMode() {
  * @see L3G4200D_BOOT_BIT
  */
 void L3G4200D::rebootMemoryContent() {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_BOOT_BIT, true);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG5, L3G4200D_BOOT_BIT> >(devAddr, true);
+	#ifdef I2CDEV_REGISTER_CACHE
+		I2Cdev::invalidateCache(devAddr); // BOOT self-clears after reloading trim values
+	#endif
 }
 
 /** Set whether the FIFO buffer is enabled
@@ -710,8 +712,7 @@ void L3G4200D::rebootMemoryContent() {
  * @see L3G4200D_FIFO_EN_BIT
  */
 void L3G4200D::setFIFOEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the FIFO buffer is enabled
@@ -720,8 +721,7 @@ void L3G4200D::setFIFOEnabled(bool enabled) {
  * @see L3G4200D_FIFO_EN_BIT
  */
 bool L3G4200D::getFIFOEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -731,8 +731,7 @@ bool L3G4200D::getFIFOEnabled() {
  * @see L3G4200D_HPEN_BIT
  */
 void L3G4200D::setHighPassFilterEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT, 
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the high pass filter is enabled
@@ -741,8 +740,7 @@ void L3G4200D::setHighPassFilterEnabled(bool enabled) {
  * @see L3G4200D_HPEN_BIT
  */
 bool L3G4200D::getHighPassFilterEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT,
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -771,10 +769,8 @@ void L3G4200D::setDataFilter(uint8_t filter) {
 		setHighPassFilterEnabled(false);
 	}
 	
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, 
-		L3G4200D_OUT_SEL_LENGTH, filter);
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_INT1_SEL_BIT, 
-		L3G4200D_INT1_SEL_LENGTH, filter);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, L3G4200D_OUT_SEL_LENGTH> >(devAddr, filter);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_CTRL_REG5, L3G4200D_INT1_SEL_BIT, L3G4200D_INT1_SEL_LENGTH> >(devAddr, filter);
 }
 
 /** Gets the data filter currently in use
@@ -788,8 +784,7 @@ void L3G4200D::setDataFilter(uint8_t filter) {
  * @see L3G4200D_LOW_HIGH_PASS
  */
 uint8_t L3G4200D::getDataFilter() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, 
-		L3G4200D_OUT_SEL_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, L3G4200D_OUT_SEL_LENGTH> >(devAddr, buffer);
 	uint8_t outBits = buffer[0];
 
 	if (outBits == L3G4200D_NON_HIGH_PASS || outBits == L3G4200D_HIGH_PASS) {
@@ -842,8 +837,7 @@ uint8_t L3G4200D::getTemperature() {
  * @see L3G4200D_ZYXOR_BIT
  */
 bool L3G4200D::getXYZOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZYXOR_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_ZYXOR_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -854,8 +848,7 @@ bool L3G4200D::getXYZOverrun() {
  * @see L3G4200D_ZOR_BIT
  */
 bool L3G4200D::getZOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZOR_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_ZOR_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -866,8 +859,7 @@ bool L3G4200D::getZOverrun() {
  * @see L3G4200D_YOR_BIT
  */
 bool L3G4200D::getYOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_YOR_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_YOR_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -878,8 +870,7 @@ bool L3G4200D::getYOverrun() {
  * @see L3G4200D_XOR_BIT
  */
 bool L3G4200D::getXOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_XOR_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_XOR_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -889,8 +880,7 @@ bool L3G4200D::getXOverrun() {
  * @see L3G4200D_ZYXDA_BIT
  */
 bool L3G4200D::getXYZDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZYXDA_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_ZYXDA_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -900,8 +890,7 @@ bool L3G4200D::getXYZDataAvailable() {
  * @see L3G4200D_ZDA_BIT
  */
 bool L3G4200D::getZDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZDA_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_ZDA_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -911,8 +900,7 @@ bool L3G4200D::getZDataAvailable() {
  * @see L3G4200D_YDA_BIT
  */
 bool L3G4200D::getYDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_YDA_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_YDA_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -922,8 +910,7 @@ bool L3G4200D::getYDataAvailable() {
  * @see L3G4200D_XDA_BIT
  */
 bool L3G4200D::getXDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_XDA_BIT, 
-		buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_STATUS, L3G4200D_XDA_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -952,9 +939,9 @@ void L3G4200D::getAngularVelocity(int16_t* x, int16_t* y, int16_t* z) {
 int16_t L3G4200D::getAngularVelocityX() {
 	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L, 2, buffer);
 	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t)buffer[1]) << 8) | buffer[0];
+		return I2CDEV_LE16(buffer);
 	} else {
-		return (((int16_t)buffer[0]) << 8) | buffer[1];
+		return I2CDEV_BE16(buffer);
 	}
 }
 	
@@ -966,9 +953,9 @@ int16_t L3G4200D::getAngularVelocityX() {
 int16_t L3G4200D::getAngularVelocityY() {
 	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Y_L, 2, buffer);
 	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t)buffer[1]) << 8) | buffer[0];
+		return I2CDEV_LE16(buffer);
 	} else {
-		return (((int16_t)buffer[0]) << 8) | buffer[1];
+		return I2CDEV_BE16(buffer);
 	}
 }
 
@@ -980,9 +967,9 @@ int16_t L3G4200D::getAngularVelocityY() {
 int16_t L3G4200D::getAngularVelocityZ() {
 	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Z_L, 2, buffer);
 	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t)buffer[1]) << 8) | buffer[0];
+		return I2CDEV_LE16(buffer);
 	} else {
-		return (((int16_t)buffer[0]) << 8) | buffer[1];
+		return I2CDEV_BE16(buffer);
 	}
 }
 
@@ -1000,8 +987,7 @@ int16_t L3G4200D::getAngularVelocityZ() {
  * @see L3G4200D_FM_BYPASS_STREAM
  */
 void L3G4200D::setFIFOMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_MODE_BIT, 
-		L3G4200D_FIFO_MODE_LENGTH, mode);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_MODE_BIT, L3G4200D_FIFO_MODE_LENGTH> >(devAddr, mode);
 }
 
 /** Get the FIFO mode to one of the defined modes
@@ -1016,8 +1002,7 @@ void L3G4200D::setFIFOMode(uint8_t mode) {
  * @see L3G4200D_FM_BYPASS_STREAM
  */
 uint8_t L3G4200D::getFIFOMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_FIFO_CTRL, 
-		L3G4200D_FIFO_MODE_BIT, L3G4200D_FIFO_MODE_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_MODE_BIT, L3G4200D_FIFO_MODE_LENGTH> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1028,8 +1013,7 @@ uint8_t L3G4200D::getFIFOMode() {
  * @see L3G4200D_FIFO_WTM_LENGTH
  */
 void L3G4200D::setFIFOThreshold(uint8_t wtm) {
-    I2Cdev::writeBits(devAddr, L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT, 
-        L3G4200D_FIFO_WTM_LENGTH, wtm);
+    I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT, L3G4200D_FIFO_WTM_LENGTH> >(devAddr, wtm);
 }
 
 /** Get the FIFO watermark threshold
@@ -1039,8 +1023,7 @@ void L3G4200D::setFIFOThreshold(uint8_t wtm) {
  * @see L3G4200D_FIFO_WTM_LENGTH
  */
 uint8_t L3G4200D::getFIFOThreshold() {
-    I2Cdev::readBits(devAddr, L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT,
-        L3G4200D_FIFO_WTM_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT, L3G4200D_FIFO_WTM_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1054,8 +1037,7 @@ uint8_t L3G4200D::getFIFOThreshold() {
  * @see L3G4200D_FIFO_STATUS_BIT
  */
 bool L3G4200D::getFIFOAtWatermark() {
-   	I2Cdev::readBit(devAddr, L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_STATUS_BIT, 
-        buffer);
+   	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_STATUS_BIT> >(devAddr, buffer);
    	return buffer[0];
 }
 
@@ -1065,8 +1047,7 @@ bool L3G4200D::getFIFOAtWatermark() {
  * @see L3G4200D_FIFO_OVRN_BIT
  */
 bool L3G4200D::getFIFOOverrun() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_FIFO_SRC, 
-        L3G4200D_FIFO_OVRN_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_OVRN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1076,8 +1057,7 @@ bool L3G4200D::getFIFOOverrun() {
  * @see L3G4200D_FIFO_EMPTY_BIT
  */
 bool L3G4200D::getFIFOEmpty() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_FIFO_SRC,
-        L3G4200D_FIFO_EMPTY_BIT, buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_EMPTY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1088,11 +1068,205 @@ bool L3G4200D::getFIFOEmpty() {
  * @see L3G4200D_FIFO_FSS_LENGTH
  */ 
 uint8_t L3G4200D::getFIFOStoredDataLevel() {
-    I2Cdev::readBits(devAddr, L3G4200D_RA_FIFO_SRC, 
-        L3G4200D_FIFO_FSS_BIT, L3G4200D_FIFO_FSS_LENGTH, buffer);
+    I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_FSS_BIT, L3G4200D_FIFO_FSS_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 
+// FIFO batch reading
+
+// largest whole number of samples the Wire buffer takes in one read
+#ifdef BUFFER_LENGTH
+	#define L3G4200D_BATCH_CHUNK ((BUFFER_LENGTH / 6) * 6)
+#else
+	#define L3G4200D_BATCH_CHUNK (L3G4200D_FIFO_DEPTH * 6)
+#endif
+
+/** Enable the FIFO in stream mode with a watermark for batch reading.
+ * FIFO_CTRL is set in one write, the FIFO is enabled and the watermark is
+ * routed to INT2 (attach its rising edge to an ISR calling notifyWatermark()).
+ * The output data rate and endian mode are sampled here for
+ * readFIFOBatch(), so set them first and restart the batch after changing
+ * either.
+ * @param watermark FIFO level that raises the watermark flag (1-31)
+ * @return True if the watermark was valid
+ * @see readFIFOBatch()
+ */
+bool L3G4200D::startFIFOBatch(uint8_t watermark) {
+	if (watermark == 0 || watermark >= L3G4200D_FIFO_DEPTH) return false;
+	batchPeriod = 1000000UL / getOutputDataRate();
+	batchBigEndian = getEndianMode() == L3G4200D_BIG_ENDIAN;
+	I2Cdev::writeByte(devAddr, L3G4200D_RA_FIFO_CTRL, (L3G4200D_FM_STREAM << 5) | watermark);
+	setFIFOEnabled(true);
+	setINT2FIFOWatermarkInterruptEnabled(true);
+	batchOverruns = 0;
+	batchStarted = false;
+	batchFlag = false;
+	return true;
+}
+
+/** Flag the watermark as reached; call from the INT2 interrupt handler.
+ */
+void L3G4200D::notifyWatermark() {
+	batchFlag = true;
+}
+
+/** Get whether notifyWatermark() was called since the last batch read
+ * @return True if a batch is waiting
+ */
+bool L3G4200D::isWatermarkPending() {
+	return batchFlag;
+}
+
+/** Read all queued FIFO samples in as few bursts as possible.
+ * FIFO_SRC is read once for the fill level and overrun flag, then the
+ * samples are read from OUT_X_L with the auto-increment bit set. In FIFO
+ * mode the address wraps from OUT_Z_H back to OUT_X_L, so consecutive
+ * samples stream in one read (split on whole samples only where the Wire
+ * buffer is smaller). Timestamps come from the output data rate: the
+ * newest queued sample is taken to be up to one period old at the time of
+ * the FIFO_SRC read, and unless the rate-based prediction from the last
+ * batch falls outside that window, the previous timeline is continued so
+ * sample spacing stays exact.
+ * @param samples Output array
+ * @param maxSamples Capacity of samples
+ * @return Number of samples read
+ * @see getFIFOOverrunCount()
+ */
+uint8_t L3G4200D::readFIFOBatch(L3G4200D_Sample *samples, uint8_t maxSamples) {
+	batchFlag = false;
+	if (I2Cdev::readByte(devAddr, L3G4200D_RA_FIFO_SRC, buffer) != 1) return 0;
+	uint32_t anchor = micros();
+	uint8_t level;
+	if (buffer[0] & (1 << L3G4200D_FIFO_OVRN_BIT)) {
+		batchOverruns++;
+		level = L3G4200D_FIFO_DEPTH;
+		batchStarted = false; // timeline broken by lost samples
+	} else if (buffer[0] & (1 << L3G4200D_FIFO_EMPTY_BIT)) {
+		return 0;
+	} else {
+		level = buffer[0] & 0x1F;
+	}
+	uint8_t count = level < maxSamples ? level : maxSamples;
+	if (count == 0) return 0;
+
+	// timestamp of the newest queued sample
+	uint32_t newest = anchor;
+	if (batchStarted) {
+		uint32_t predicted = batchLastMicros + (uint32_t)level * batchPeriod;
+		int32_t error = (int32_t)(anchor - predicted);
+		if (error >= 0 && (uint32_t)error < batchPeriod) newest = predicted;
+	}
+
+	uint8_t *raw = (uint8_t *)samples; // staged at the front of the sample array
+	uint16_t length = (uint16_t)count * 6;
+	for (uint16_t k = 0; k < length; ) {
+		uint8_t n = length - k > L3G4200D_BATCH_CHUNK ? L3G4200D_BATCH_CHUNK : length - k;
+		if (I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | L3G4200D_AUTO_INCREMENT, n, raw + k) != n) return 0;
+		k += n;
+	}
+
+	// each L3G4200D_Sample is at least 6 bytes, so unpacking from the end
+	// never overwrites packed bytes that are still to be read
+	for (uint8_t i = count; i-- > 0; ) {
+		const uint8_t *b = raw + i * 6;
+		int16_t x, y, z;
+		if (batchBigEndian) {
+			x = (((int16_t)b[0]) << 8) | b[1];
+			y = (((int16_t)b[2]) << 8) | b[3];
+			z = (((int16_t)b[4]) << 8) | b[5];
+		} else {
+			x = (((int16_t)b[1]) << 8) | b[0];
+			y = (((int16_t)b[3]) << 8) | b[2];
+			z = (((int16_t)b[5]) << 8) | b[4];
+		}
+		samples[i].x = x;
+		samples[i].y = y;
+		samples[i].z = z;
+		samples[i].timestamp = newest - (uint32_t)(level - 1 - i) * batchPeriod;
+	}
+	batchLastMicros = samples[count - 1].timestamp;
+	batchStarted = true;
+	return count;
+}
+
+/** Read all queued FIFO samples straight into a sample ring.
+ * Samples are decoded in place into the ring's free slots, in two bursts
+ * when the free run wraps past the end of the storage. A full ring leaves
+ * the remaining samples in the FIFO (and the watermark pending) rather
+ * than discarding them; FIFO overruns are added to ring->overruns.
+ * @param ring Destination ring
+ * @return Number of samples queued
+ */
+uint8_t L3G4200D::readFIFOBatch(I2Cdev_Ring<L3G4200D_Sample> *ring) {
+	uint16_t overruns = batchOverruns;
+	uint8_t total = 0, span, n;
+	do {
+		L3G4200D_Sample *slot = ring -> writeSpan(&span);
+		if (span == 0) break;
+		n = readFIFOBatch(slot, span);
+		ring -> commit(n);
+		total += n;
+	} while (n == span);
+	ring -> overruns += batchOverruns - overruns;
+	return total;
+}
+
+/** Read all queued FIFO samples into per-axis arrays.
+ * The structure-of-arrays counterpart of readFIFOBatch(), without
+ * timestamps: FIFO_SRC is read once, the samples are burst-read from
+ * OUT_X_L into a stack buffer (whole samples per Wire buffer) and unpacked
+ * with one straight loop per endian mode. Start the FIFO with
+ * startFIFOBatch(), which also samples the endian mode; overruns are
+ * counted as in readFIFOBatch().
+ * @param x Output X-axis array
+ * @param y Output Y-axis array
+ * @param z Output Z-axis array
+ * @param maxSamples Capacity of each array
+ * @return Number of samples read
+ */
+uint8_t L3G4200D::readFIFOBlock(int16_t *x, int16_t *y, int16_t *z, uint8_t maxSamples) {
+	batchFlag = false;
+	if (I2Cdev::readByte(devAddr, L3G4200D_RA_FIFO_SRC, buffer) != 1) return 0;
+	uint8_t level;
+	if (buffer[0] & (1 << L3G4200D_FIFO_OVRN_BIT)) {
+		batchOverruns++;
+		level = L3G4200D_FIFO_DEPTH;
+	} else if (buffer[0] & (1 << L3G4200D_FIFO_EMPTY_BIT)) {
+		return 0;
+	} else {
+		level = buffer[0] & 0x1F;
+	}
+	uint8_t count = level < maxSamples ? level : maxSamples;
+
+	uint8_t raw[L3G4200D_BATCH_CHUNK];
+	for (uint8_t i = 0; i < count; ) {
+		uint8_t n = (count - i) * 6 > L3G4200D_BATCH_CHUNK ? L3G4200D_BATCH_CHUNK / 6 : count - i;
+		if (I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | L3G4200D_AUTO_INCREMENT, n * 6, raw) != n * 6) return i;
+		const uint8_t *b = raw;
+		if (batchBigEndian) {
+			for (uint8_t k = 0; k < n; k++, i++, b += 6) {
+				x[i] = (((int16_t)b[0]) << 8) | b[1];
+				y[i] = (((int16_t)b[2]) << 8) | b[3];
+				z[i] = (((int16_t)b[4]) << 8) | b[5];
+			}
+		} else {
+			for (uint8_t k = 0; k < n; k++, i++, b += 6) {
+				x[i] = (((int16_t)b[1]) << 8) | b[0];
+				y[i] = (((int16_t)b[3]) << 8) | b[2];
+				z[i] = (((int16_t)b[5]) << 8) | b[4];
+			}
+		}
+	}
+	return count;
+}
+
+/** Get the number of FIFO overruns seen by readFIFOBatch()
+ * @return Overrun count since startFIFOBatch()
+ */
+uint16_t L3G4200D::getFIFOOverrunCount() {
+	return batchOverruns;
+}
+
 // INT1_CFG register, r/w
 
 /** Set the combination mode for interrupt events
@@ -1104,8 +1278,7 @@ uint8_t L3G4200D::getFIFOStoredDataLevel() {
  * @see L3G4200D_INT1_AND
  */
 void L3G4200D::setInterruptCombination(bool combination) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT,
-        combination);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT> >(devAddr, combination);
 }
 
 /** Get the combination mode for interrupt events
@@ -1117,8 +1290,7 @@ void L3G4200D::setInterruptCombination(bool combination) {
  * @see L3G4200D_INT1_AND
  */
 bool L3G4200D::getInterruptCombination() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT,
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1129,7 +1301,7 @@ bool L3G4200D::getInterruptCombination() {
  * @see L3G4200D_INT1_LIR_BIT
  */
 void L3G4200D::setInterruptRequestLatched(bool latched) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT, latched);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT> >(devAddr, latched);
 }
 
 /** Get whether an interrupt request is latched
@@ -1138,8 +1310,7 @@ void L3G4200D::setInterruptRequestLatched(bool latched) {
  * @see L3G4200D_INT1_LIR_BIT
  */
 bool L3G4200D::getInterruptRequestLatched() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT, 
-        buffer); 
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT> >(devAddr, buffer); 
     return buffer[0];
 };
 
@@ -1149,7 +1320,7 @@ bool L3G4200D::getInterruptRequestLatched() {
  * @see L3G4200D_ZHIE_BIT
  */
 void L3G4200D::setZHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Z high is enabled
@@ -1158,8 +1329,7 @@ void L3G4200D::setZHighInterruptEnabled(bool enabled) {
  * @see L3G4200D_ZHIE_BIT
  */
 bool L3G4200D::getZHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT, 
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1169,7 +1339,7 @@ bool L3G4200D::getZHighInterruptEnabled() {
  * @see L3G4200D_ZLIE_BIT
  */
 void L3G4200D::setZLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Z low is enabled
@@ -1178,8 +1348,7 @@ void L3G4200D::setZLowInterruptEnabled(bool enabled) {
  * @see L3G4200D_ZLIE_BIT
  */
 bool L3G4200D::getZLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT, 
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1189,7 +1358,7 @@ bool L3G4200D::getZLowInterruptEnabled() {
  * @see L3G4200D_YHIE_BIT
  */
 void L3G4200D::setYHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Y high is enabled
@@ -1198,8 +1367,7 @@ void L3G4200D::setYHighInterruptEnabled(bool enabled) {
  * @see L3G4200D_YHIE_BIT
  */
 bool L3G4200D::getYHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT, 
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1209,7 +1377,7 @@ bool L3G4200D::getYHighInterruptEnabled() {
  * @see L3G4200D_YLIE_BIT
  */
 void L3G4200D::setYLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Y low is enabled
@@ -1218,8 +1386,7 @@ void L3G4200D::setYLowInterruptEnabled(bool enabled) {
  * @see L3G4200D_YLIE_BIT
  */
 bool L3G4200D::getYLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT, 
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1229,7 +1396,7 @@ bool L3G4200D::getYLowInterruptEnabled() {
  * @see L3G4200D_XHIE_BIT
  */
 void L3G4200D::setXHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the interrupt for X high is enabled
@@ -1238,8 +1405,7 @@ void L3G4200D::setXHighInterruptEnabled(bool enabled) {
  * @see L3G4200D_XHIE_BIT
  */
 bool L3G4200D::getXHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT, 
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1249,7 +1415,7 @@ bool L3G4200D::getXHighInterruptEnabled() {
  * @see L3G4200D_XLIE_BIT
  */
 void L3G4200D::setXLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT, enabled);
+    I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the interrupt for X low is enabled
@@ -1258,8 +1424,7 @@ void L3G4200D::setXLowInterruptEnabled(bool enabled) {
  * @see L3G4200D_XLIE_BIT
  */
 bool L3G4200D::getXLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT, 
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1271,8 +1436,7 @@ bool L3G4200D::getXLowInterruptEnabled() {
  * @see L3G4200D_INT1_IA_BIT
  */
 bool L3G4200D::getInterruptActive() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_IA_BIT,
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_IA_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1282,8 +1446,7 @@ bool L3G4200D::getInterruptActive() {
  * @see L3G4200D_INT1_ZH_BIT
  */
 bool L3G4200D::getZHigh() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZH_BIT,
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZH_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1293,8 +1456,7 @@ bool L3G4200D::getZHigh() {
  * @see L3G4200D_INT1_ZL_BIT
  */
 bool L3G4200D::getZLow() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZL_BIT,
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1304,8 +1466,7 @@ bool L3G4200D::getZLow() {
  * @see L3G4200D_INT1_YH_BIT
  */
 bool L3G4200D::getYHigh() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YH_BIT,
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YH_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1315,8 +1476,7 @@ bool L3G4200D::getYHigh() {
  * @see L3G4200D_INT1_YL_BIT
  */
 bool L3G4200D::getYLow() {
-   	I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YL_BIT,
-        buffer);
+   	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1326,8 +1486,7 @@ bool L3G4200D::getYLow() {
  * @see L3G4200D_INT1_XH_BIT
  */
 bool L3G4200D::getXHigh() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XH_BIT,
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XH_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1337,8 +1496,7 @@ bool L3G4200D::getXHigh() {
  * @see L3G4200D_INT1_XL_BIT
  */
 bool L3G4200D::getXLow() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XL_BIT,
-        buffer);
+    I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1457,8 +1615,7 @@ uint8_t L3G4200D::getZLowThreshold() {
  * @see L3G4200D_INT1_DUR_LENGTH
  */
 void L3G4200D::setDuration(uint8_t duration) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_DUR_BIT,
-		L3G4200D_INT1_DUR_LENGTH, duration);
+	I2Cdev::writeField<I2Cdev_Field<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_DUR_BIT, L3G4200D_INT1_DUR_LENGTH> >(devAddr, duration);
 }
 
 /** Get the minimum duration for an interrupt event to be recognized
@@ -1468,8 +1625,7 @@ void L3G4200D::setDuration(uint8_t duration) {
  * @see L3G4200D_INT1_DUR_LENGTH
  */
 uint8_t L3G4200D::getDuration() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_INT1_DURATION, 
-		L3G4200D_INT1_DUR_BIT, L3G4200D_INT1_DUR_LENGTH, buffer);
+	I2Cdev::readField<I2Cdev_Field<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_DUR_BIT, L3G4200D_INT1_DUR_LENGTH> >(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1483,8 +1639,7 @@ uint8_t L3G4200D::getDuration() {
  * @see L3G4200D_INT1_WAIT_BIT
  */
 void L3G4200D::setWaitEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_WAIT_BIT,
-		enabled);
+	I2Cdev::writeField<I2Cdev_Bit<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_WAIT_BIT> >(devAddr, enabled);
 }
 
 /** Get whether the interrupt wait feature is enabled
@@ -1493,7 +1648,6 @@ void L3G4200D::setWaitEnabled(bool enabled) {
  * @see L3G4200D_INT1_WAIT_BIT
  */
 bool L3G4200D::getWaitEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_DURATION, 
-		L3G4200D_INT1_WAIT_BIT, buffer);
+	I2Cdev::readField<I2Cdev_Bit<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_WAIT_BIT> >(devAddr, buffer);
 	return buffer[0];
 }
@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - watermark-driven FIFO batch reader with sample timestamps
 //     2013-07-31 - initial release
 
 /* ============================================
@@ -65,6 +66,9 @@ THE SOFTWARE.
 #define L3G4200D_RA_INT1_THS_ZL    0x37
 #define L3G4200D_RA_INT1_DURATION  0X38
 
+#define L3G4200D_AUTO_INCREMENT    0x80 // OR into a sub-address for multi-byte reads
+#define L3G4200D_FIFO_DEPTH        32
+
 #define L3G4200D_ODR_BIT           7
 #define L3G4200D_ODR_LENGTH        2
 #define L3G4200D_BW_BIT            5
@@ -187,6 +191,12 @@ THE SOFTWARE.
 #define L3G4200D_XHIE_BIT          1
 #define L3G4200D_XLIE_BIT          0
 
+/** One angular velocity sample from readFIFOBatch(). */
+typedef struct L3G4200D_Sample {
+	int16_t x, y, z;
+	uint32_t timestamp; // micros() at which the sample was taken (reconstructed)
+} L3G4200D_Sample;
+
 #define L3G4200D_INT1_OR           0
 #define L3G4200D_INT1_AND          1
 
@@ -307,6 +317,15 @@ class L3G4200D {
 		bool getFIFOOverrun();
 		bool getFIFOEmpty();
 		uint8_t getFIFOStoredDataLevel();
+
+		// FIFO batch reading
+		bool startFIFOBatch(uint8_t watermark);
+		void notifyWatermark();
+		bool isWatermarkPending();
+		uint8_t readFIFOBatch(L3G4200D_Sample *samples, uint8_t maxSamples);
+		uint8_t readFIFOBatch(I2Cdev_Ring<L3G4200D_Sample> *ring);
+		uint8_t readFIFOBlock(int16_t *x, int16_t *y, int16_t *z, uint8_t maxSamples);
+		uint16_t getFIFOOverrunCount();
 		
 		// INT1_CFG register, r/w
 		void setInterruptCombination(bool combination);
@@ -358,6 +377,16 @@ class L3G4200D {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        uint32_t batchPeriod;       // sample period in microseconds
+        uint32_t batchLastMicros;   // timestamp of the last sample returned
+        uint16_t batchOverruns;
+        bool batchBigEndian;
+        bool batchStarted;
+        volatile bool batchFlag;
+        #ifdef I2CDEV_REGISTER_CACHE
+            I2Cdev_CacheRange cacheConfig;      // CTRL_REG1 .. INT1_DURATION
+            uint8_t cacheConfigValues[25];
+        #endif
 };
 
 #endif /* _L3G4200D_H_ */
@@ -8,12 +8,14 @@
 
 LM73::LM73() {
     devAddr = LM73_DEFAULT_ADDRESS;
+    alertPin = -1;
     devConfig.all = 0x40; // reset state
     devCtrlStat.all = 0x08; // reset state
 }
 
 LM73::LM73(uint8_t address) {
     devAddr = address;
+    alertPin = -1;
     devConfig.all = 0x40; // reset state
     devCtrlStat.all = 0x08; // reset state
 }
@@ -34,6 +36,14 @@ LM73ConfigReg LM73::getConfig() {
     return devConfig;
 }
 
+void LM73::setConfig(LM73ConfigReg value) {
+    // ONE_SHOT and ALRT_RST act on write and always read back 0
+    I2Cdev::writeByte(devAddr, LM73_RA_CONFIG, value.all);
+    value.bit.ONE_SHOT = 0;
+    value.bit.ALRT_RST = 0;
+    devConfig = value;
+}
+
 LM73CtrlStatReg LM73::getCtrlStat() {
     I2Cdev::readByte(devAddr, LM73_RA_CTRL_STAT, buffer);
     devCtrlStat.all = buffer[0];
@@ -66,3 +76,89 @@ void LM73::setResolution(uint8_t resolution) {
     }
 }
 
+// thresholds share the temperature format, 1/128 C per LSB, with the
+// lowest five bits unused (0.25C steps)
+static uint16_t lm73FromCelsius(float temp) {
+    return (uint16_t)(int16_t)(temp * 128.0f) & 0xFFE0;
+}
+
+static float lm73ToCelsius(uint16_t buf) {
+    return (float)(int16_t)buf / 128.0f;
+}
+
+void LM73::setHighThreshold(float temp) {
+    I2Cdev::writeWord(devAddr, LM73_RA_HI_THRESH, lm73FromCelsius(temp));
+}
+
+float LM73::getHighThreshold() {
+    uint16_t buf;
+    I2Cdev::readWord(devAddr, LM73_RA_HI_THRESH, &buf);
+    return lm73ToCelsius(buf);
+}
+
+void LM73::setLowThreshold(float temp) {
+    I2Cdev::writeWord(devAddr, LM73_RA_LO_THRESH, lm73FromCelsius(temp));
+}
+
+float LM73::getLowThreshold() {
+    uint16_t buf;
+    I2Cdev::readWord(devAddr, LM73_RA_LO_THRESH, &buf);
+    return lm73ToCelsius(buf);
+}
+
+void LM73::setAlertEnabled(bool enabled) {
+    LM73ConfigReg config = LM73::getConfig();
+    config.bit.nALRT_EN = !enabled;
+    LM73::setConfig(config);
+}
+
+void LM73::setAlertPolarity(bool activeHigh) {
+    LM73ConfigReg config = LM73::getConfig();
+    config.bit.ALRT_POL = activeHigh;
+    LM73::setConfig(config);
+}
+
+void LM73::resetAlert() {
+    LM73ConfigReg config = devConfig;
+    config.bit.ALRT_RST = 1;
+    LM73::setConfig(config);
+}
+
+void LM73::setAlertPin(int8_t pin) {
+    alertPin = pin;
+    if (pin >= 0) pinMode(pin, INPUT); // ALERT is open-drain, needs a pull-up
+}
+
+bool LM73::isAlertActive() {
+    if (alertPin >= 0) return digitalRead(alertPin) == (devConfig.bit.ALRT_POL ? HIGH : LOW);
+    LM73::getCtrlStat();
+    return devCtrlStat.bit.ALRT_STAT == devConfig.bit.ALRT_POL;
+}
+
+uint8_t LM73::getAlertEvent() {
+    // with a pin, only go to the bus once ALERT has fired; reading CTRL_STAT
+    // returns and clears the THI/TLOW flags latched since the last read
+    if (alertPin >= 0 && !LM73::isAlertActive()) return LM73_ALERT_NONE;
+    LM73::getCtrlStat();
+    return (devCtrlStat.bit.THI ? LM73_ALERT_HIGH : 0) | (devCtrlStat.bit.TLOW ? LM73_ALERT_LOW : 0);
+}
+
+void LM73::setPowerDown(bool powerDown) {
+    LM73ConfigReg config = LM73::getConfig();
+    config.bit.PD = powerDown;
+    LM73::setConfig(config);
+}
+
+uint16_t LM73::startOneShot() {
+    LM73ConfigReg config = devConfig;
+    config.bit.PD = 1;
+    config.bit.ONE_SHOT = 1;
+    LM73::setConfig(config);
+    // maximum conversion time doubles with each bit: 14ms at 11 bits to 112ms at 14 bits
+    return 14 << devCtrlStat.bit.RES;
+}
+
+float LM73::getOneShotTemp() {
+    delay(LM73::startOneShot());
+    return LM73::getTemp();
+}
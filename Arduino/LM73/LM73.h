@@ -55,6 +55,10 @@ typedef union {
     uint8_t all;
 } LM73CtrlStatReg;
 
+#define LM73_ALERT_NONE			0x00
+#define LM73_ALERT_LOW			0x01 // temperature fell below TLOW
+#define LM73_ALERT_HIGH			0x02 // temperature rose above THIGH
+
 class LM73 {
     public:
         LM73();
@@ -70,10 +74,26 @@ class LM73 {
         uint8_t getResolution(); // returns resolution in bits (including sign bit)
         void setResolution(uint8_t resolution); // enter resolution in bits (including sign bit)
         float getTemp(); // return temperature in C
+
+        void setHighThreshold(float temp); // THIGH in C, 0.25C steps; ALERT asserts above it
+        float getHighThreshold();
+        void setLowThreshold(float temp); // TLOW in C, 0.25C steps; ALERT releases below it
+        float getLowThreshold();
+        void setAlertEnabled(bool enabled);
+        void setAlertPolarity(bool activeHigh);
+        void resetAlert();
+        void setAlertPin(int8_t pin); // MCU pin wired to ALERT, -1 for none
+        bool isAlertActive(); // reads the ALERT pin, no bus traffic when a pin is set
+        uint8_t getAlertEvent(); // LM73_ALERT_* flags latched since the last call
+
+        void setPowerDown(bool powerDown);
+        uint16_t startOneShot(); // begin one conversion while powered down, returns ms until the result is valid
+        float getOneShotTemp(); // one conversion at the current resolution, waits the conversion time once
 		
     private:
         uint8_t devAddr;
         uint8_t buffer[1];
+        int8_t alertPin;
         LM73ConfigReg devConfig;
         LM73CtrlStatReg devCtrlStat;
 };
@@ -5,6 +5,8 @@
 // I2C Device Library hosted at http://www.i2cdevlib.com
 //
 // Changelog:
+//     2026-10-14 - shadow port configuration, bulk config commits and single-burst layout restore
+//     2026-10-14 - add frame API staging port levels in a shadow, flushed in bursts
 //     2013-12-15 - initial release
 //
 
@@ -39,6 +41,11 @@ THE SOFTWARE.
  */
 MAX6956::MAX6956() {
     devAddr = MAX6956_DEFAULT_ADDRESS;
+    portsCurrentKnown = false;
+    portsConfigKnown = false;
+    configDirty = 0;
+    currentDirty = 0;
+    statusDirty = 0;
 }
 
 /** Specific address constructor.
@@ -48,6 +55,11 @@ MAX6956::MAX6956() {
  */
 MAX6956::MAX6956(uint8_t address) {
     devAddr = address;
+    portsCurrentKnown = false;
+    portsConfigKnown = false;
+    configDirty = 0;
+    currentDirty = 0;
+    statusDirty = 0;
 }
 
 /** Power on and prepare for general usage. */
@@ -266,11 +278,14 @@ void MAX6956::configPort(uint8_t port, uint8_t portConfig) {
     uint8_t bitPosition = (((port - 44) % 4) * 2) + 1; // bit position to start flipping 
     uint8_t pcArrayIndex = (port - 44) / 4; // array index
     uint8_t portConfigRA = pcArrayIndex + 11; // port config register
-	I2Cdev::writeBits(devAddr, portConfigRA, bitPosition, 2, portConfig);
-    // Update portConfig array
-    bitPosition--; // Remove 1 bit offset
-    portsConfig[pcArrayIndex] &=  ~(3 << bitPosition);
-    portsConfig[pcArrayIndex] |=  portConfig << bitPosition;   
+    if (!portsConfigKnown) {
+        I2Cdev::writeBits(devAddr, portConfigRA, bitPosition, 2, portConfig);
+        setConfigBits(port, portConfig);
+        return;
+    }
+    // shadow is authoritative, write the whole register without reading it
+    setConfigBits(port, portConfig);
+    writeConfigSpan(pcArrayIndex, pcArrayIndex);
 }
 
 /** Configure consecutive range of ports
@@ -314,7 +329,7 @@ void MAX6956::configPorts(uint8_t lower, uint8_t upper, uint8_t portConfig) {
             Serial.println(portConfigRA, HEX);
         #endif
         
-        I2Cdev::writeBits(devAddr, portConfigRA, bitPosition, 2, portConfig);
+        if (!portsConfigKnown) I2Cdev::writeBits(devAddr, portConfigRA, bitPosition, 2, portConfig);
         
         #ifdef MAX6956_SERIAL_DEBUG
             Serial.print("portsConfig ");
@@ -322,9 +337,7 @@ void MAX6956::configPorts(uint8_t lower, uint8_t upper, uint8_t portConfig) {
         #endif
         
         // Update portConfig array
-        bitPosition--; // Remove 1 bit offset
-        portsConfig[pcArrayIndex] &=  ~(3 << bitPosition); //3 == B00000011 Shift over correct number of bits then invert to create the mask
-        portsConfig[pcArrayIndex] |=  portConfig << bitPosition; 
+        setConfigBits(i, portConfig);
         
         #ifdef MAX6956_SERIAL_DEBUG
             Serial.print(" >> ");
@@ -333,7 +346,9 @@ void MAX6956::configPorts(uint8_t lower, uint8_t upper, uint8_t portConfig) {
         
         i++;
     }
-  
+
+    // with a known shadow the whole range goes out as one burst
+    if (portsConfigKnown) writeConfigSpan((lower - 44) / 4, (upper - 44) / 4);
 }
 
 /**	Configure all ports the same
@@ -345,11 +360,89 @@ void MAX6956::configPorts(uint8_t lower, uint8_t upper, uint8_t portConfig) {
 */
 void MAX6956::configAllPorts(uint8_t portConfig) {
     // build byte with config bits shifted to all 4 slots
-    portConfig = portConfig << 6 + portConfig << 4 + portConfig << 2 + portConfig;
+    portConfig = (portConfig << 6) | (portConfig << 4) | (portConfig << 2) | portConfig;
     // copy byte to portsConfig array slots
     memset (portsConfig, portConfig, 5);
     // write bytes all at once to device
-    I2Cdev::writeBytes(devAddr, MAX6956_RA_CONFIG_P15P14P13P12, 5, portsConfig);
+    if (I2Cdev::writeBytes(devAddr, MAX6956_RA_CONFIG_P15P14P13P12, 5, portsConfig)) {
+        portsConfigKnown = true;
+        configDirty = 0;
+    }
+}
+
+/**	Stage a port's configuration for the next commitConfig().
+    Only the shadow changes, so a whole layout can be built up port by port
+    and sent at once.
+ @param port Port register address (MAX6956_RA_PORT12, ect)
+ @param portConfig Valid options are: MAX6956_OUTPUT_LED, MAX6956_OUTPUT_GPIO, MAX6956_INPUT_WO_PULL, MAX6956_INPUT_W_PULL
+ @see commitConfig()
+*/
+void MAX6956::stagePortConfig(uint8_t port, uint8_t portConfig) {
+    if ( port < 44 || port > 63 ) return;
+    uint8_t pcArrayIndex = (port - 44) / 4;
+    uint8_t before = portsConfig[pcArrayIndex];
+    setConfigBits(port, portConfig);
+    if (portsConfig[pcArrayIndex] != before) configDirty |= 1 << pcArrayIndex;
+}
+
+/**	Write the staged port configuration.
+    The changed config registers go out as one auto-increment burst. Ports
+    whose configuration was never set since power-up are written from the
+    shadow as well, so call reset()/initialize() or configAllPorts() first.
+ @return true if the config registers now match the shadow
+*/
+bool MAX6956::commitConfig() {
+    if (!configDirty) return true;
+    uint8_t first = 0, last = 4;
+    while (!(configDirty & (1 << first))) first++;
+    while (!(configDirty & (1 << last))) last--;
+    return writeConfigSpan(first, last);
+}
+
+/**	Copy the current port configuration and current shadows into a layout,
+    e.g. to keep in EEPROM or PROGMEM for restoreLayout().
+ @param layout Destination
+*/
+void MAX6956::saveLayout(MAX6956_Layout *layout) {
+    if (!portsCurrentKnown) loadPortsCurrent();
+    memcpy(layout -> config, portsConfig, sizeof(layout -> config));
+    memcpy(layout -> current, portsCurrent, sizeof(layout -> current));
+}
+
+/**	Write a whole port layout in two bursts.
+    The port configs (0x0B-0x0F) and the P12-P31 current registers
+    (0x16-0x1F) each go out as one auto-increment burst. The registers in
+    between are skipped: 0x10/0x11 are unused and 0x12-0x15 hold the P4-P11
+    currents, which the layout does not cover and are left as they are. Port
+    on/off status is not part of the layout.
+ @param layout Port configuration and current values
+ @return true if the layout was written
+*/
+bool MAX6956::restoreLayout(const MAX6956_Layout *layout) {
+    if (!I2Cdev::writeBytes(devAddr, MAX6956_RA_CONFIG_P15P14P13P12, sizeof(layout -> config), (uint8_t *)layout -> config)) return false;
+    memcpy(portsConfig, layout -> config, sizeof(portsConfig));
+    portsConfigKnown = true;
+    configDirty = 0;
+    if (!I2Cdev::writeBytes(devAddr, MAX6956_RA_CURRENT_0xP13P12, sizeof(layout -> current), (uint8_t *)layout -> current)) return false;
+    memcpy(portsCurrent, layout -> current, sizeof(portsCurrent));
+    portsCurrentKnown = true;
+    currentDirty = 0;
+    return true;
+}
+
+/** Set one port's bit pair in the portsConfig shadow. */
+void MAX6956::setConfigBits(uint8_t port, uint8_t portConfig) {
+    uint8_t bitPosition = ((port - 44) % 4) * 2;
+    uint8_t pcArrayIndex = (port - 44) / 4;
+    portsConfig[pcArrayIndex] &= ~(3 << bitPosition); //3 == B00000011 Shift over correct number of bits then invert to create the mask
+    portsConfig[pcArrayIndex] |= (portConfig & 3) << bitPosition;
+}
+
+/** Write portsConfig[first..last] in one burst. */
+bool MAX6956::writeConfigSpan(uint8_t first, uint8_t last) {
+    if (!I2Cdev::writeBytes(devAddr, MAX6956_RA_CONFIG_P15P14P13P12 + first, last - first + 1, portsConfig + first)) return false;
+    for (uint8_t i = first; i <= last; i++) configDirty &= ~(1 << i);
+    return true;
 }
 
 /** Write 1's to all port registers. This enables ports set as outputs and 
@@ -489,7 +582,7 @@ void MAX6956::setPortLevel(uint8_t port, uint8_t power) {
       }
       
       // Write changes
-      I2Cdev::writeBits(devAddr, portCurrentRA, portCurrentBit, 4, power); // Write changes
+      setCurrentNibble(port, power);
       I2Cdev::writeByte(devAddr, port, MAX6956_ON); // turn on port
   
       #ifdef MAX6956_SERIAL_DEBUG
@@ -544,7 +637,7 @@ void MAX6956::setPortCurrent(uint8_t port, uint8_t power) {
         }
         
         // Write changes
-        I2Cdev::writeBits(devAddr, portCurrentRA, portCurrentBit, 4, power); // Write changes
+        setCurrentNibble(port, power);
         I2Cdev::writeByte(devAddr, port, MAX6956_ON); // turn on port
 
         #ifdef MAX6956_SERIAL_DEBUG
@@ -567,7 +660,97 @@ void MAX6956::setPortCurrent(uint8_t port, uint8_t power) {
     @param power 0 is min, 15 is max brightness.
 */
 void MAX6956::setAllPortsCurrent(uint8_t power) {
-   for (int portCurrentRA=MAX6956_RA_CURRENT_0xP13P12; portCurrentRA <= MAX6956_RA_CURRENT_0xP31P30; portCurrentRA++){
-    I2Cdev::writeByte(devAddr, portCurrentRA, power);
-   } 
+    // the same level in both nibbles of every register, in one burst
+    memset(portsCurrent, (power & 0x0F) | (power << 4), sizeof(portsCurrent));
+    if (I2Cdev::writeBytes(devAddr, MAX6956_RA_CURRENT_0xP13P12, sizeof(portsCurrent), portsCurrent)) {
+        portsCurrentKnown = true;
+        currentDirty = 0;
+    }
+}
+
+/**	Stage a port level for the next commitFrame(), with the same meaning as
+    setPortLevel() (0 = off, 1-15 brightness). Nothing is sent until the
+    frame is committed, so any number of ports can change per frame for the
+    cost of one burst write. Per-port current needs
+    setEnableIndividualCurrent(true).
+ * @param port Port register address (MAX6956_RA_PORT12, ect)
+ * @param power 0 is off, 15 is max brightness.
+ * @see commitFrame()
+*/
+void MAX6956::stagePortLevel(uint8_t port, uint8_t power) {
+    if ( port < 44 || port > 63 || power > 15 ) return;
+    uint8_t index = (port - 44) / 8, bit = 1 << ((port - 44) % 8);
+    uint8_t status = portsStatus[index];
+    if ( power > 0 ) {
+        stagePortCurrent(port, power < 15 ? power - 1 : power);
+        return;
+    }
+    portsStatus[index] &= ~bit;
+    if (portsStatus[index] != status) statusDirty |= 1 << index;
+}
+
+/**	Stage a port current (0-15) for the next commitFrame() and turn the
+    port on, with the same meaning as setPortCurrent().
+ * @param port Port register address (MAX6956_RA_PORT12, ect)
+ * @param power 0 is min, 15 is max brightness.
+ * @see commitFrame()
+*/
+void MAX6956::stagePortCurrent(uint8_t port, uint8_t power) {
+    if ( port < 44 || port > 63 || power > 15 ) return;
+    if (!portsCurrentKnown) loadPortsCurrent();
+    uint8_t n = (port - 44) / 2;
+    uint8_t current = (port % 2) ? ((portsCurrent[n] & 0x0F) | (power << 4)) : ((portsCurrent[n] & 0xF0) | power);
+    if (current != portsCurrent[n]) {
+        portsCurrent[n] = current;
+        currentDirty |= 1 << n;
+    }
+    uint8_t index = (port - 44) / 8, bit = 1 << ((port - 44) % 8);
+    if (!(portsStatus[index] & bit)) {
+        portsStatus[index] |= bit;
+        statusDirty |= 1 << index;
+    }
+}
+
+/**	Write the staged frame to the device.
+    Changed current registers go out as one auto-increment burst covering
+    the first to the last changed register, followed by one write per
+    changed on/off group register (0x4C, 0x54, 0x5C), so a full 20 port
+    frame costs at most four transactions and an unchanged one none.
+ * @return true if every staged change was written
+*/
+bool MAX6956::commitFrame() {
+    static const uint8_t statusRA[3] = { MAX6956_RA_PORTS12_19, MAX6956_RA_PORTS20_27, MAX6956_RA_PORTS28_31 };
+    bool ok = true;
+    if (currentDirty) {
+        uint8_t first = 0, last = sizeof(portsCurrent) - 1;
+        while (!(currentDirty & (1 << first))) first++;
+        while (!(currentDirty & (1 << last))) last--;
+        if (I2Cdev::writeBytes(devAddr, MAX6956_RA_CURRENT_0xP13P12 + first, last - first + 1, portsCurrent + first)) currentDirty = 0;
+        else ok = false;
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+        if (!(statusDirty & (1 << i))) continue;
+        if (I2Cdev::writeByte(devAddr, statusRA[i], portsStatus[i])) statusDirty &= ~(1 << i);
+        else ok = false;
+    }
+    return ok;
+}
+
+/** Read all current registers into the shadow in one burst. */
+void MAX6956::loadPortsCurrent() {
+    if (I2Cdev::readBytes(devAddr, MAX6956_RA_CURRENT_0xP13P12, sizeof(portsCurrent), portsCurrent) == sizeof(portsCurrent)) {
+        portsCurrentKnown = true;
+    }
+}
+
+/** Write one port's current nibble, from the shadow once it is known so no
+    read-modify-write is needed. */
+void MAX6956::setCurrentNibble(uint8_t port, uint8_t power) {
+    uint8_t n = (port - 44) / 2;
+    if (!portsCurrentKnown) {
+        I2Cdev::writeBits(devAddr, portCurrentRA, portCurrentBit, 4, power);
+        return;
+    }
+    portsCurrent[n] = (port % 2) ? ((portsCurrent[n] & 0x0F) | (power << 4)) : ((portsCurrent[n] & 0xF0) | power);
+    if (I2Cdev::writeByte(devAddr, portCurrentRA, portsCurrent[n])) currentDirty &= ~(1 << n);
 }
@@ -5,6 +5,8 @@
 // I2C Device Library hosted at http://www.i2cdevlib.com
 //
 // Changelog:
+//     2026-10-14 - shadow port configuration, bulk config commits and single-burst layout restore
+//     2026-10-14 - add frame API staging port levels in a shadow, flushed in bursts
 //     2013-12-15 - initial release
 //
 
@@ -454,6 +456,14 @@ Individiual Port Registers
 #define MAX6956_CURRENT_14              0x0E
 #define MAX6956_CURRENT_15              0x0F
 
+/** Snapshot of the port configuration and current registers for ports
+    P12-P31, restored in two bursts with MAX6956::restoreLayout().
+*/
+typedef struct {
+    uint8_t config[5]; ///< Config registers 0x0B-0x0F, same layout as portsConfig[]
+    uint8_t current[10]; ///< Current registers 0x16-0x1F, same layout as the current shadow
+} MAX6956_Layout;
+
 /*!
 A library for controlling the MAX6956 using i2C. 
 */
@@ -497,6 +507,10 @@ class MAX6956 {
         void configPort(uint8_t port, uint8_t portConfig);
         void configPorts(uint8_t lower, uint8_t upper, uint8_t portConfig);
         void configAllPorts(uint8_t portConfig);
+        void stagePortConfig(uint8_t port, uint8_t portConfig); ///< configPort() into the shadow, no bus traffic
+        bool commitConfig(); ///< Write staged port configs in one burst
+        void saveLayout(MAX6956_Layout *layout); ///< Copy the config and current shadows
+        bool restoreLayout(const MAX6956_Layout *layout); ///< Write a whole layout in two bursts
         
         void enableAllPorts();
         void disableAllPorts();
@@ -508,6 +522,10 @@ class MAX6956 {
         void setPortLevel(uint8_t port, uint8_t power); ///< 0 = off, 1-15 brightness levels.
         void setPortCurrent(uint8_t port, uint8_t power); ///< 0-15 brightness levels. 
         void setAllPortsCurrent(uint8_t power); ///< 0-15, 0 = min brightness (not off) 15 = max
+
+        void stagePortLevel(uint8_t port, uint8_t power); ///< setPortLevel() into the frame shadow, no bus traffic
+        void stagePortCurrent(uint8_t port, uint8_t power); ///< setPortCurrent() into the frame shadow, no bus traffic
+        bool commitFrame(); ///< Write all staged changes in consolidated bursts
         
         /**
             Array that mirrors the configuration of all the ports.
@@ -568,6 +586,17 @@ class MAX6956 {
         uint8_t portCurrentBit; ///< Holder for the current bit offset
         uint8_t psArrayIndex; ///< array index
         uint8_t psBitPosition; ///< bit position
+        uint8_t portsCurrent[10]; ///< Mirror of current registers 0x16-0x1F (P12-P31, two ports each)
+        bool portsCurrentKnown; ///< portsCurrent[] reflects the device
+        bool portsConfigKnown; ///< portsConfig[] reflects the device
+        uint8_t configDirty; ///< Bit n set = portsConfig[n] staged but not written
+        uint16_t currentDirty; ///< Bit n set = portsCurrent[n] staged but not written
+        uint8_t statusDirty; ///< Bit n set = portsStatus[n] staged but not written
+
+        void loadPortsCurrent();
+        void setCurrentNibble(uint8_t port, uint8_t power);
+        void setConfigBits(uint8_t port, uint8_t portConfig);
+        bool writeConfigSpan(uint8_t first, uint8_t last);
 };
 
 #endif /* _MAX6956_H_ */
@@ -6,6 +6,9 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - initialize() from a flash register script in four burst writes
+//     2026-10-14 - burst filtered data and baseline readout
+//     2026-10-14 - single-read touch status, XOR change events, IRQ pin support
 //     2011-09-03 - add callback support
 //     2011-08-20 - initial release
 
@@ -37,7 +40,11 @@ THE SOFTWARE.
 #include "I2Cdev.h"
 
 MPR121::MPR121(uint8_t address) :
-  m_devAddr(address)
+  m_devAddr(address),
+  m_prevTouchMask(0),
+  m_irqPin(-1),
+  m_irqInterrupt(false),
+  m_irqFlag(false)
 {
   for (int ch = 0; ch < NUM_CHANNELS; ch++) {
     m_callbackMap[ch][TOUCHED] = 0;
@@ -45,8 +52,7 @@ MPR121::MPR121(uint8_t address) :
   }
 }
 
-void MPR121::initialize()
-{
+static const uint8_t initScript[] I2CDEV_SCRIPT_PROGMEM = {
   // These are the configuration values recommended by app note AN3944
   // along with the description in the app note.
 
@@ -62,10 +68,10 @@ void MPR121::initialize()
   //   As the filter is sensitive to setting changes, it is recommended
   //   that users read AN3891 before changing the values. 
   //   In most cases these default values will work.
-  I2Cdev::writeByte(m_devAddr, MHD_RISING,        0x01);
-  I2Cdev::writeByte(m_devAddr, NHD_AMOUNT_RISING, 0x01);
-  I2Cdev::writeByte(m_devAddr, NCL_RISING,        0x00);
-  I2Cdev::writeByte(m_devAddr, FDL_RISING,        0x00);
+  I2CDEV_SCRIPT_WRITE(MHD_RISING,        0x01),
+  I2CDEV_SCRIPT_WRITE(NHD_AMOUNT_RISING, 0x01),
+  I2CDEV_SCRIPT_WRITE(NCL_RISING,        0x00),
+  I2CDEV_SCRIPT_WRITE(FDL_RISING,        0x00),
 
   // Section B
   // Description:
@@ -82,10 +88,10 @@ void MPR121::initialize()
   //   As the filter is sensitive to setting changes, it is recommended 
   //   that users read AN3891 before changing the values.  
   //   In most cases these default values will work.
-  I2Cdev::writeByte(m_devAddr, MHD_FALLING,        0x01);
-  I2Cdev::writeByte(m_devAddr, NHD_AMOUNT_FALLING, 0x01);
-  I2Cdev::writeByte(m_devAddr, NCL_FALLING,        0xFF);
-  I2Cdev::writeByte(m_devAddr, FDL_FALLING,        0x02);
+  I2CDEV_SCRIPT_WRITE(MHD_FALLING,        0x01),
+  I2CDEV_SCRIPT_WRITE(NHD_AMOUNT_FALLING, 0x01),
+  I2CDEV_SCRIPT_WRITE(NCL_FALLING,        0xFF),
+  I2CDEV_SCRIPT_WRITE(FDL_FALLING,        0x02),
 
   // Section C
   // Description:
@@ -100,33 +106,33 @@ void MPR121::initialize()
   //   very large electrodes the reverse is true.  One easy method is 
   //   to view the deltas actually seen in a system and set the touch 
   //   at 80% and release at 70% of delta for good performance.
-  I2Cdev::writeByte(m_devAddr, ELE0_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE0_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE1_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE1_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE2_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE2_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE3_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE3_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
+  I2CDEV_SCRIPT_WRITE(ELE0_TOUCH_THRESHOLD,   TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE0_RELEASE_THRESHOLD, RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE1_TOUCH_THRESHOLD,   TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE1_RELEASE_THRESHOLD, RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE2_TOUCH_THRESHOLD,   TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE2_RELEASE_THRESHOLD, RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE3_TOUCH_THRESHOLD,   TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE3_RELEASE_THRESHOLD, RELEASE_THRESHOLD),
 
   // TODO: enable setting these channels to capsense or GPIO
   // for now they are all capsense
-  I2Cdev::writeByte(m_devAddr, ELE4_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE4_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE5_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE5_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE6_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE6_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE7_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE7_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE8_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE8_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE9_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE9_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE10_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE10_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE11_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE11_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
+  I2CDEV_SCRIPT_WRITE(ELE4_TOUCH_THRESHOLD,    TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE4_RELEASE_THRESHOLD,  RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE5_TOUCH_THRESHOLD,    TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE5_RELEASE_THRESHOLD,  RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE6_TOUCH_THRESHOLD,    TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE6_RELEASE_THRESHOLD,  RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE7_TOUCH_THRESHOLD,    TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE7_RELEASE_THRESHOLD,  RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE8_TOUCH_THRESHOLD,    TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE8_RELEASE_THRESHOLD,  RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE9_TOUCH_THRESHOLD,    TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE9_RELEASE_THRESHOLD,  RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE10_TOUCH_THRESHOLD,   TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE10_RELEASE_THRESHOLD, RELEASE_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE11_TOUCH_THRESHOLD,   TOUCH_THRESHOLD),
+  I2CDEV_SCRIPT_WRITE(ELE11_RELEASE_THRESHOLD, RELEASE_THRESHOLD),
 
   // Section D
   // Description:
@@ -141,7 +147,7 @@ void MPR121::initialize()
   //   0x01 = 2ms, 0x02 = 4 ms; and so on to 0x07 = 128 ms.  Most of 
   //   the time, 0x04 results in the best compromise between power 
   //   consumption and response time.
-  I2Cdev::writeByte(m_devAddr, FILTER_CONFIG, 0x04);
+  I2CDEV_SCRIPT_WRITE(FILTER_CONFIG, 0x04),
 
   // Section E
   // Description:
@@ -157,7 +163,7 @@ void MPR121::initialize()
   //   the number of electrodes and 0x00 every time a register needs 
   //   to change.  In a production system, this register will only need 
   //   to be written when the mode is changed from Standby to Run or vice versa.
-  I2Cdev::writeByte(m_devAddr, ELECTRODE_CONFIG, 0x0C); 
+  I2CDEV_SCRIPT_WRITE(ELECTRODE_CONFIG, 0x0C),
 
   // Section F
   // Description:
@@ -168,11 +174,20 @@ void MPR121::initialize()
   // Variation:
   //   In most cases these values will never need to be changed, but if
   //   a case arises, a full description is found in application note AN3889.
-  //I2Cdev::writeByte(m_devAddr, AUTO_CONFIG_CONTROL_0,    0x0B);
-  //I2Cdev::writeByte(m_devAddr, AUTO_CONFIG_USL,          0x9C);
-  //I2Cdev::writeByte(m_devAddr, AUTO_CONFIG_LSL,          0x65);
-  //I2Cdev::writeByte(m_devAddr, AUTO_CONFIG_TARGET_LEVEL, 0x8C);
-          
+  //I2CDEV_SCRIPT_WRITE(AUTO_CONFIG_CONTROL_0,    0x0B),
+  //I2CDEV_SCRIPT_WRITE(AUTO_CONFIG_USL,          0x9C),
+  //I2CDEV_SCRIPT_WRITE(AUTO_CONFIG_LSL,          0x65),
+  //I2CDEV_SCRIPT_WRITE(AUTO_CONFIG_TARGET_LEVEL, 0x8C),
+
+  I2CDEV_SCRIPT_END
+};
+
+// the script covers three contiguous register spans, so it goes out as four
+// burst writes (of at most I2CDEV_SCRIPT_BURST bytes) instead of 34 single
+// register transactions
+void MPR121::initialize()
+{
+  I2Cdev::runScript(m_devAddr, initScript);
 }
 
 // check to see if the filter configuration register contains 0x04,
@@ -192,30 +207,76 @@ bool MPR121::getTouchStatus(uint8_t channel) {
 }
 
 uint16_t MPR121::getTouchStatus() {
-  uint16_t statusBuf;
-  uint8_t buf;
-  I2Cdev::readByte(m_devAddr, ELE0_ELE7_TOUCH_STATUS, &buf);
-  statusBuf = buf;
-  I2Cdev::readByte(m_devAddr, ELE8_ELE11_ELEPROX_TOUCH_STATUS, &buf);
-  statusBuf += (buf << 8);
-  return statusBuf;
+  // both status registers in one burst, so the 12 channels are sampled together
+  uint8_t buf[2] = { 0, 0 };
+  I2Cdev::readBytes(m_devAddr, ELE0_ELE7_TOUCH_STATUS, 2, buf);
+  return buf[0] | ((uint16_t)buf[1] << 8);
+}
+
+bool MPR121::getFilteredData(uint16_t *data, uint8_t count) {
+  if (count == 0 || count > NUM_ELECTRODES) return false;
+  // read the LSB/MSB pairs straight into the caller's array and decode them
+  // in place; no staging buffer needed
+  uint8_t *raw = (uint8_t *)data;
+  if (I2Cdev::readBytes(m_devAddr, ELE0_FILTERED_DATA_LSB, count * 2, raw) != count * 2) return false;
+  for (uint8_t i = 0; i < count; i++) {
+    data[i] = raw[i * 2] | ((uint16_t)(raw[i * 2 + 1] & 0x03) << 8);
+  }
+  return true;
+}
+
+bool MPR121::getBaselineData(uint16_t *data, uint8_t count) {
+  if (count == 0 || count > NUM_ELECTRODES) return false;
+  // 8-bit values land in the upper half of the array; widening front to back
+  // never overwrites a byte that has not been read yet
+  uint8_t *raw = (uint8_t *)data + count;
+  if (I2Cdev::readBytes(m_devAddr, ELE0_BASELINE_VALUE, count, raw) != count) return false;
+  for (uint8_t i = 0; i < count; i++) {
+    data[i] = (uint16_t)raw[i] << 2;
+  }
+  return true;
 }
 
 void MPR121::setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr) {
   m_callbackMap[channel][event] = callbackPtr;
 }
     
-void MPR121::serviceCallbacks() {
-  for (uint8_t channel = 0; channel < NUM_CHANNELS; channel++) { 
-    bool touchStatus = getTouchStatus(channel);
-    if (touchStatus != m_prevTouchStatus[channel]) {
-      for (uint8_t type = 0; type < NUM_EVENTS; type++) { 
-        const CallbackPtrType cb = touchStatus ? m_callbackMap[channel][TOUCHED] : m_callbackMap[channel][RELEASED]; 
-        if (cb != 0) {
-          cb();           
-        }
-      }
-      m_prevTouchStatus[channel] = touchStatus; 
+uint16_t MPR121::serviceCallbacks() {
+  if (m_irqPin >= 0) {
+    if (!isIrqPending()) return 0;
+    m_irqFlag = false; // cleared before the read so a new edge is not lost
+  }
+
+  const uint16_t touchMask = getTouchStatus() & ((1 << NUM_CHANNELS) - 1);
+  const uint16_t changed = touchMask ^ m_prevTouchMask;
+  m_prevTouchMask = touchMask;
+
+  // visit only the changed bits, lowest channel first
+  for (uint16_t pending = changed; pending != 0; pending &= pending - 1) {
+    uint8_t channel = 0;
+    while (!(pending & (1 << channel))) channel++;
+    const CallbackPtrType cb = (touchMask & (1 << channel)) ? m_callbackMap[channel][TOUCHED] : m_callbackMap[channel][RELEASED];
+    if (cb != 0) {
+      cb();
     }
   }
+  return changed;
+}
+
+void MPR121::setIrqPin(int8_t pin, bool interrupt) {
+  m_irqPin = pin;
+  m_irqInterrupt = interrupt;
+  m_irqFlag = interrupt; // service once right away in case IRQ is already asserted
+  if (pin >= 0) pinMode(pin, INPUT_PULLUP);
+}
+
+// call from the IRQ pin's FALLING edge interrupt handler
+void MPR121::notifyIrq() {
+  m_irqFlag = true;
+}
+
+bool MPR121::isIrqPending() {
+  if (m_irqPin < 0) return true;
+  if (m_irqInterrupt) return m_irqFlag;
+  return digitalRead(m_irqPin) == LOW;
 }
@@ -6,6 +6,8 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - burst filtered data and baseline readout
+//     2026-10-14 - single-read touch status, XOR change events, IRQ pin support
 //     2011-09-03 - add callback support
 //     2011-08-20 - initial release
 
@@ -183,6 +185,7 @@ THE SOFTWARE.
 #define TOUCH_THRESHOLD   0x0F
 #define RELEASE_THRESHOLD 0x0A
 #define NUM_CHANNELS      12
+#define NUM_ELECTRODES    13 // the 12 channels plus the ELEPROX proximity electrode
 
 class MPR121
 {
@@ -210,14 +213,35 @@ class MPR121
     // when not given a channel, returns a bitfield of all touch channels.
     uint16_t getTouchStatus();
 
+    // read the 10-bit filtered electrode data for electrodes 0..count-1 in
+    // one burst (count up to NUM_ELECTRODES, index 12 = ELEPROX)
+    bool getFilteredData(uint16_t *data, uint8_t count = NUM_CHANNELS);
+    // read the baseline values for electrodes 0..count-1 in one burst. the chip
+    // keeps only the upper 8 of 10 bits; values are shifted back to the
+    // filtered data scale, so delta = filtered - baseline
+    bool getBaselineData(uint16_t *data, uint8_t count = NUM_CHANNELS);
+
     void setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr);
     
-    void serviceCallbacks();
+    // reads the touch status once and dispatches callbacks for the channels
+    // that changed since the last call; returns the bitmask of changed channels
+    uint16_t serviceCallbacks();
+
+    // optional IRQ pin (active low, asserted until the status is read). with
+    // interrupt = true an ISR on the FALLING edge must call notifyIrq(),
+    // otherwise the pin level is polled. serviceCallbacks() skips the bus
+    // read while no change is pending.
+    void setIrqPin(int8_t pin, bool interrupt = false);
+    void notifyIrq();
+    bool isIrqPending();
     
   private:
     uint8_t m_devAddr; // contains the I2C address of the device
     CallbackPtrType m_callbackMap[NUM_CHANNELS][NUM_EVENTS];
-    bool m_prevTouchStatus[NUM_CHANNELS];
+    uint16_t m_prevTouchMask; // bit n = channel n touched at the last service
+    int8_t m_irqPin;
+    bool m_irqInterrupt;
+    volatile bool m_irqFlag;
     
 };
 
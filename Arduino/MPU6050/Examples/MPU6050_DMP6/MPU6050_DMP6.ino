@@ -3,6 +3,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//      2026-10-14 - trim DMP packets to the data the selected output uses
+//      2026-10-14 - add OUTPUT_TEAPOT_FRAMED checksummed 200Hz binary output
+//      2026-10-14 - restore accel/gyro offsets from EEPROM, calibrating on first boot
 //      2013-05-08 - added seamless Fastwire support
 //                 - added note about gyro calibration
 //      2012-06-21 - added note about Arduino 1.0.1 + Leonardo compatibility error
@@ -54,6 +57,9 @@ THE SOFTWARE.
     #include "Wire.h"
 #endif
 
+// offsets are kept in EEPROM so later boots come up calibrated immediately
+#include <EEPROM.h>
+
 // class default I2C address is 0x68
 // specific I2C addresses may be passed as a parameter here
 // AD0 low = 0x68 (default for SparkFun breakout and InvenSense evaluation board)
@@ -116,6 +122,16 @@ MPU6050 mpu;
 // format used for the InvenSense teapot demo
 //#define OUTPUT_TEAPOT
 
+// uncomment "OUTPUT_TEAPOT_FRAMED" for a framed, checksummed binary stream of
+// quaternion, accel and gyro with a sequence number and timestamp at the
+// full 200Hz DMP rate; set framed = true in the MPUTeapot Processing sketch
+// to decode it. Frame (multi-byte values MSB first):
+//   AA 55 len=25 | seq time[4] quat[8] accel[6] gyro[6] | sum1 sum2
+//   (sum1 = running 8-bit sum of len..gyro, sum2 = running sum of sum1)
+// The time is micros() just after the FIFO read; enable I2CDEV_TIMESTAMPS in
+// I2Cdev.h to have it taken at the moment the read completed instead.
+//#define OUTPUT_TEAPOT_FRAMED
+
 
 
 #define LED_PIN 13 // (Arduino is 13, Teensy is 11, Teensy++ is 6)
@@ -125,7 +141,7 @@ bool blinkState = false;
 bool dmpReady = false;  // set true if DMP init was successful
 uint8_t mpuIntStatus;   // holds actual interrupt status byte from MPU
 uint8_t devStatus;      // return status after each device operation (0 = success, !0 = error)
-uint16_t packetSize;    // expected DMP packet size (default is 42 bytes)
+uint16_t packetSize;    // expected DMP packet size (18 to 42 bytes, see dmpSetPacketContent())
 uint16_t fifoCount;     // count of all bytes currently in FIFO
 uint8_t fifoBuffer[64]; // FIFO storage buffer
 
@@ -141,6 +157,46 @@ float ypr[3];           // [yaw, pitch, roll]   yaw/pitch/roll container and gra
 // packet structure for InvenSense teapot demo
 uint8_t teapotPacket[14] = { '$', 0x02, 0,0, 0,0, 0,0, 0,0, 0x00, 0x00, '\r', '\n' };
 
+// frame for OUTPUT_TEAPOT_FRAMED: sync, length, 25 payload bytes, checksum
+#define TEAPOT_FRAME_PAYLOAD    25
+uint8_t teapotFrame[3 + TEAPOT_FRAME_PAYLOAD + 2] = { 0xAA, 0x55, TEAPOT_FRAME_PAYLOAD };
+uint8_t teapotFrameSeq = 0;
+
+// stored calibration: [magic] [MPU6050_Calibration] [checksum]
+#define CALIBRATION_EEPROM_ADDRESS  0
+#define CALIBRATION_MAGIC           0x6C
+
+// send 'c' while the sketch waits for a character to force a fresh calibration
+bool forceCalibration = false;
+
+
+
+// ================================================================
+// ===                 CALIBRATION PERSISTENCE                  ===
+// ================================================================
+
+bool loadCalibration(MPU6050_Calibration *cal) {
+    uint8_t *bytes = (uint8_t *)cal;
+    uint8_t sum = CALIBRATION_MAGIC;
+    if (EEPROM.read(CALIBRATION_EEPROM_ADDRESS) != CALIBRATION_MAGIC) return false;
+    for (uint8_t i = 0; i < sizeof(MPU6050_Calibration); i++) {
+        bytes[i] = EEPROM.read(CALIBRATION_EEPROM_ADDRESS + 1 + i);
+        sum += bytes[i];
+    }
+    return EEPROM.read(CALIBRATION_EEPROM_ADDRESS + 1 + sizeof(MPU6050_Calibration)) == sum;
+}
+
+void saveCalibration(const MPU6050_Calibration *cal) {
+    const uint8_t *bytes = (const uint8_t *)cal;
+    uint8_t sum = CALIBRATION_MAGIC;
+    EEPROM.write(CALIBRATION_EEPROM_ADDRESS, CALIBRATION_MAGIC);
+    for (uint8_t i = 0; i < sizeof(MPU6050_Calibration); i++) {
+        EEPROM.write(CALIBRATION_EEPROM_ADDRESS + 1 + i, bytes[i]);
+        sum += bytes[i];
+    }
+    EEPROM.write(CALIBRATION_EEPROM_ADDRESS + 1 + sizeof(MPU6050_Calibration), sum);
+}
+
 
 
 // ================================================================
@@ -188,20 +244,43 @@ void setup() {
     Serial.println(mpu.testConnection() ? F("MPU6050 connection successful") : F("MPU6050 connection failed"));
 
     // wait for ready
-    Serial.println(F("\nSend any character to begin DMP programming and demo: "));
+    Serial.println(F("\nSend any character to begin DMP programming and demo (c to recalibrate): "));
     while (Serial.available() && Serial.read()); // empty buffer
     while (!Serial.available());                 // wait for data
+    forceCalibration = (Serial.peek() == 'c');
     while (Serial.available() && Serial.read()); // empty buffer again
 
     // load and configure the DMP
     Serial.println(F("Initializing DMP..."));
     devStatus = mpu.dmpInitialize();
 
-    // supply your own gyro offsets here, scaled for min sensitivity
-    mpu.setXGyroOffset(220);
-    mpu.setYGyroOffset(76);
-    mpu.setZGyroOffset(-85);
-    mpu.setZAccelOffset(1788); // 1688 factory default for my test chip
+    // only ask the DMP for what the output below uses: orientation alone
+    // is 18 bytes per packet instead of 42
+    if (devStatus == 0) {
+        #if defined(OUTPUT_TEAPOT_FRAMED)
+            mpu.dmpSetPacketContent(MPU6050_DMP_SEND_ALL);
+            mpu.dmpSetFIFORate(0); // full 200Hz DMP output
+        #elif defined(OUTPUT_READABLE_REALACCEL) || defined(OUTPUT_READABLE_WORLDACCEL)
+            mpu.dmpSetPacketContent(MPU6050_DMP_SEND_ACCEL);
+        #else
+            mpu.dmpSetPacketContent(MPU6050_DMP_SEND_QUATERNION);
+        #endif
+    }
+
+    // restore stored offsets in one batch, or calibrate once (keep the
+    // device still and flat, Z up) and store the result for later boots
+    MPU6050_Calibration calibration;
+    if (!forceCalibration && loadCalibration(&calibration)) {
+        Serial.println(F("Restoring stored offsets..."));
+        mpu.setCalibration(&calibration);
+    } else {
+        Serial.println(F("Calibrating offsets, keep the device still..."));
+        if (mpu.calibrate(&calibration)) {
+            saveCalibration(&calibration);
+        } else {
+            Serial.println(F("Calibration did not settle; offsets not stored."));
+        }
+    }
 
     // make sure it worked (returns 0 if so)
     if (devStatus == 0) {
@@ -278,6 +357,9 @@ void loop() {
 
         // read a packet from FIFO
         mpu.getFIFOBytes(fifoBuffer, packetSize);
+        #ifdef OUTPUT_TEAPOT_FRAMED
+            uint32_t packetMicros = I2Cdev::getReadTimestamp();
+        #endif
         
         // track FIFO count here in case there is > 1 packet available
         // (this lets us immediately read more without waiting for an interrupt)
@@ -365,6 +447,30 @@ void loop() {
             teapotPacket[11]++; // packetCount, loops at 0xFF on purpose
         #endif
 
+        #ifdef OUTPUT_TEAPOT_FRAMED
+            // quaternion (high words), accel and gyro straight from the
+            // packet, stamped with the completion time of the FIFO read
+            {
+                static const uint8_t offsets[10] = { 0, 4, 8, 12, 28, 32, 36, 16, 20, 24 };
+                uint32_t t = packetMicros;
+                uint8_t *p = teapotFrame + 3;
+                *p++ = teapotFrameSeq++;
+                *p++ = t >> 24; *p++ = t >> 16; *p++ = t >> 8; *p++ = t;
+                for (uint8_t i = 0; i < 10; i++) {
+                    *p++ = fifoBuffer[offsets[i]];
+                    *p++ = fifoBuffer[offsets[i] + 1];
+                }
+                uint8_t sum1 = 0, sum2 = 0;
+                for (uint8_t *b = teapotFrame + 2; b < p; b++) {
+                    sum1 += *b;
+                    sum2 += sum1;
+                }
+                *p++ = sum1;
+                *p++ = sum2;
+                Serial.write(teapotFrame, sizeof(teapotFrame));
+            }
+        #endif
+
         // blink LED to indicate activity
         blinkState = !blinkState;
         digitalWrite(LED_PIN, blinkState);
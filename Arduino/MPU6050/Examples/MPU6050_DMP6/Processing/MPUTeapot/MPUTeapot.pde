@@ -3,6 +3,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - add framed/checksummed stream decoding (TeapotFrame tab) and CSV recording
+//                - legacy parser no longer discards the rest of a serial read on resync
 //     2012-06-20 - initial release
 
 /* ============================================
@@ -48,6 +50,13 @@ int serialCount = 0;                 // current packet byte position
 int synced = 0;
 int interval = 0;
 
+// set to true for the MPU6050_DMP6 OUTPUT_TEAPOT_FRAMED stream (200Hz quaternion,
+// accel, gyro and timestamps); press 's' to start/stop recording it to CSV
+boolean framed = false;
+TeapotFrame frame = new TeapotFrame();
+PrintWriter recording = null;
+int statsTime = 0;
+
 float[] q = new float[4];
 Quaternion quat = new Quaternion(1, 0, 0, 0);
 
@@ -88,6 +97,11 @@ void draw() {
         port.write('r');
         interval = millis();
     }
+
+    if (framed && millis() - statsTime > 1000) {
+        println("frames " + frame.frames + ", lost " + frame.lost + ", errors " + frame.errors + (recording != null ? " (recording)" : ""));
+        statsTime = millis();
+    }
     
     // black background
     background(0);
@@ -146,16 +160,32 @@ void serialEvent(Serial port) {
     while (port.available() > 0) {
         int ch = port.read();
 
-        if (synced == 0 && ch != '$') return;   // initial synchronization - also used to resync/realign if needed
+        if (framed) {
+            frame.feed(ch);
+            while (frame.next()) {
+                quat.set(frame.q[0], frame.q[1], frame.q[2], frame.q[3]);
+                if (recording != null) {
+                    recording.println(frame.seq + "," + frame.timestamp + ","
+                        + frame.q[0] + "," + frame.q[1] + "," + frame.q[2] + "," + frame.q[3] + ","
+                        + frame.accel[0] + "," + frame.accel[1] + "," + frame.accel[2] + ","
+                        + frame.gyro[0] + "," + frame.gyro[1] + "," + frame.gyro[2]);
+                }
+            }
+            continue;
+        }
+
+        // keep reading on a mismatch; returning here would throw away the
+        // rest of the bytes already received
+        if (synced == 0 && ch != '$') continue; // initial synchronization - also used to resync/realign if needed
         synced = 1;
-        print ((char)ch);
+        //print ((char)ch);
 
         if ((serialCount == 1 && ch != 2)
             || (serialCount == 12 && ch != '\r')
             || (serialCount == 13 && ch != '\n'))  {
             serialCount = 0;
             synced = 0;
-            return;
+            continue;
         }
 
         if (serialCount > 0 || ch == '$') {
@@ -201,6 +231,21 @@ void serialEvent(Serial port) {
     }
 }
 
+void keyPressed() {
+    if (key != 's' || !framed) return;
+    if (recording == null) {
+        String name = "teapot-" + year() + nf(month(), 2) + nf(day(), 2) + "-" + nf(hour(), 2) + nf(minute(), 2) + nf(second(), 2) + ".csv";
+        recording = createWriter(name);
+        recording.println("seq,timestamp_us,qw,qx,qy,qz,ax,ay,az,gx,gy,gz");
+        println("recording to " + name);
+    } else {
+        recording.flush();
+        recording.close();
+        recording = null;
+        println("recording stopped");
+    }
+}
+
 void drawCylinder(float topRadius, float bottomRadius, float tall, int sides) {
     float angle = 0;
     float angleIncrement = TWO_PI / sides;
@@ -0,0 +1,116 @@
+// I2C device class (I2Cdev) demonstration Processing sketch for MPU6050 DMP output
+// Decoder for the framed OUTPUT_TEAPOT_FRAMED stream of the MPU6050_DMP6 sketch
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Frame (multi-byte values MSB first):
+//   AA 55 len=25 | seq time[4] quat[8] accel[6] gyro[6] | sum1 sum2
+// sum1 is the running 8-bit sum of len..gyro and sum2 the running sum of
+// sum1. Bytes are buffered until a whole frame is in, so a frame split over
+// several serial reads is fine; on a bad length or checksum the decoder
+// slides forward one byte and searches for the next sync, so text output
+// and corrupted frames cost only the frames they overlap.
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+class TeapotFrame {
+    static final int PAYLOAD = 25;
+    static final int LENGTH = 3 + PAYLOAD + 2;
+
+    int[] buf = new int[4 * LENGTH];
+    int count = 0;
+
+    // last decoded frame
+    int seq;
+    long timestamp;                     // micros() on the Arduino (unsigned 32-bit)
+    float[] q = new float[4];           // w, x, y, z
+    int[] accel = new int[3];           // raw DMP accel
+    int[] gyro = new int[3];            // raw DMP gyro
+
+    // link statistics
+    int frames = 0;                     // good frames
+    int lost = 0;                       // frames missing from the sequence
+    int errors = 0;                     // bad checksums or lengths
+    boolean started = false;
+
+    /** Append one received byte. */
+    void feed(int ch) {
+        if (count == buf.length) drop(1); // only reached when flooded with junk
+        buf[count++] = ch & 0xFF;
+    }
+
+    /** Decode the next complete frame, if any; call until it returns false. */
+    boolean next() {
+        while (true) {
+            // slide to the next sync
+            int s = 0;
+            while (s < count && !(buf[s] == 0xAA && (s + 1 == count || buf[s + 1] == 0x55))) s++;
+            drop(s);
+            if (count < 3) return false;
+            if (buf[2] != PAYLOAD) {
+                errors++;
+                drop(1);
+                continue;
+            }
+            if (count < LENGTH) return false;
+
+            int sum1 = 0, sum2 = 0;
+            for (int i = 2; i < LENGTH - 2; i++) {
+                sum1 = (sum1 + buf[i]) & 0xFF;
+                sum2 = (sum2 + sum1) & 0xFF;
+            }
+            if (sum1 != buf[LENGTH - 2] || sum2 != buf[LENGTH - 1]) {
+                errors++;
+                drop(1);
+                continue;
+            }
+
+            int s0 = buf[3];
+            if (started) lost += (s0 - seq - 1) & 0xFF;
+            started = true;
+            seq = s0;
+            timestamp = ((long)buf[4] << 24) | (buf[5] << 16) | (buf[6] << 8) | buf[7];
+            for (int i = 0; i < 4; i++) q[i] = be16(8 + 2 * i) / 16384.0f;
+            for (int i = 0; i < 3; i++) accel[i] = be16(16 + 2 * i);
+            for (int i = 0; i < 3; i++) gyro[i] = be16(22 + 2 * i);
+            frames++;
+            drop(LENGTH);
+            return true;
+        }
+    }
+
+    // signed 16-bit value at buf[i], MSB first
+    int be16(int i) {
+        return (short)((buf[i] << 8) | buf[i + 1]);
+    }
+
+    void drop(int n) {
+        if (n <= 0) return;
+        System.arraycopy(buf, n, buf, 0, count - n);
+        count -= n;
+    }
+}
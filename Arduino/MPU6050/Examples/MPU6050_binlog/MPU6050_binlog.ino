@@ -0,0 +1,111 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for MPU6050 class
+// 1kHz accel/gyro logging over serial in the compact binary I2Cdev_log format
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//      2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// I2Cdev and MPU6050 must be installed as libraries, or else the .cpp/.h files
+// for both classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "I2Cdev_log.h"
+#include "MPU6050.h"
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+    #include "Wire.h"
+#endif
+
+// class default I2C address is 0x68
+// specific I2C addresses may be passed as a parameter here
+// AD0 low = 0x68 (default for InvenSense evaluation board)
+// AD0 high = 0x69
+MPU6050 accelgyro;
+//MPU6050 accelgyro(0x69); // <-- use for AD0 high
+
+#define SAMPLE_PERIOD_US    1000    // 1kHz, see setRate() below
+#define RECORD_BYTES        12      // accel + gyro FIFO record
+#define BURST_RECORDS       8
+
+// +/-2g accel and +/-250dps gyro, the initialize() defaults
+const uint16_t ranges[6] = { 2, 2, 2, 250, 250, 250 };
+
+I2Cdev_LogEncoder encoder;
+uint8_t fifo[BURST_RECORDS * RECORD_BYTES];
+uint8_t out[BURST_RECORDS * I2CDEV_LOG_RECORD_MAX(6)];
+uint32_t nextStamp;
+
+void restart() {
+    // a header (which also forces a keyframe) lets a host join at any restart
+    Serial.write(out, I2Cdev_logHeader(&encoder, 0x68, ranges, SAMPLE_PERIOD_US, out));
+    accelgyro.startMotionFIFO();
+    nextStamp = micros() + SAMPLE_PERIOD_US;
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+        Wire.begin();
+        TWBR = 24; // 400kHz I2C clock (200kHz if CPU is 8MHz)
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+        Fastwire::setup(400, true);
+    #endif
+
+    // ~9 bytes per sample at 1kHz; 500000 baud is exact on a 16MHz AVR
+    Serial.begin(500000);
+
+    accelgyro.initialize();
+
+    // 1kHz internal rate (DLPF on) / (1 + 0) = 1kHz samples
+    accelgyro.setDLPFMode(MPU6050_DLPF_BW_188);
+    accelgyro.setRate(0);
+
+    // 6 channels with timestamps, a keyframe every 100 records
+    I2Cdev_logInit(&encoder, 6, I2CDEV_LOG_TIMESTAMPS, 100);
+    restart();
+}
+
+void loop() {
+    uint16_t count = accelgyro.getFIFOCount();
+    if (count >= 1024) {
+        // overflowed: record boundaries are lost, start over
+        restart();
+        return;
+    }
+    uint16_t records = count / RECORD_BYTES;
+    if (records > BURST_RECORDS) records = BURST_RECORDS;
+    if (records == 0) return;
+
+    // encode straight from the raw burst; FIFO records are evenly spaced,
+    // so one running stamp covers them all
+    accelgyro.getFIFOBytes(fifo, records * RECORD_BYTES);
+    uint16_t n = I2Cdev_logEncodeBlock(&encoder, fifo, records, RECORD_BYTES, I2CDEV_LOG_BIG_ENDIAN,
+        nextStamp, SAMPLE_PERIOD_US, out);
+    nextStamp += (uint32_t)records * SAMPLE_PERIOD_US;
+    Serial.write(out, n);
+}
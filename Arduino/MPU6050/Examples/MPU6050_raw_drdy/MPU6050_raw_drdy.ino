@@ -0,0 +1,122 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for MPU6050 class
+// Data-ready interrupt sampling: every sample exactly once, with timestamps
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//      2026-10-14 - submit the burst from the interrupt with every implementation
+//      2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// I2Cdev and MPU6050 must be installed as libraries, or else the .cpp/.h files
+// for both classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "MPU6050.h"
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+    #include "Wire.h"
+#endif
+
+// class default I2C address is 0x68
+// specific I2C addresses may be passed as a parameter here
+// AD0 low = 0x68 (default for InvenSense evaluation board)
+// AD0 high = 0x69
+MPU6050 accelgyro;
+//MPU6050 accelgyro(0x69); // <-- use for AD0 high
+
+/* =========================================================================
+   NOTE: this sketch depends on the MPU-6050's INT pin being connected to
+   the Arduino's external interrupt #0 pin (digital I/O pin 2 on the Uno and
+   Mega 2560).
+ * ========================================================================= */
+
+// samples handed from the interrupt side to loop() (size must be a power of 2)
+MPU6050_Sample sampleStorage[16];
+MPU6050_SampleQueue samples;
+
+void dataReady() {
+    accelgyro.notifyDataReady();
+}
+
+#define LED_PIN 13
+bool blinkState = false;
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+        Wire.begin();
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+        Fastwire::setup(400, true);
+    #endif
+
+    // initialize serial communication
+    Serial.begin(115200);
+
+    // initialize device
+    Serial.println("Initializing I2C devices...");
+    accelgyro.initialize();
+
+    // verify connection
+    Serial.println("Testing device connections...");
+    Serial.println(accelgyro.testConnection() ? "MPU6050 connection successful" : "MPU6050 connection failed");
+
+    // 1kHz internal rate (DLPF on) / (1 + 9) = 100Hz samples
+    accelgyro.setDLPFMode(MPU6050_DLPF_BW_42);
+    accelgyro.setRate(9);
+
+    samples.init(sampleStorage, 16);
+    accelgyro.startMotionStream(&samples);
+    attachInterrupt(0, dataReady, RISING);
+
+    // configure Arduino LED for
+    pinMode(LED_PIN, OUTPUT);
+}
+
+void loop() {
+    // with Fastwire the burst already ran in the background; with Wire it
+    // ran right after whatever transfer the edge interrupted, or runs here
+    // if the bus was idle
+    accelgyro.serviceMotionStream();
+
+    MPU6050_Sample s;
+    while (samples.pop(&s)) {
+        // display timestamp and tab-separated accel/gyro x/y/z values
+        Serial.print(s.timestamp); Serial.print("\ta/g:\t");
+        Serial.print(s.ax); Serial.print("\t");
+        Serial.print(s.ay); Serial.print("\t");
+        Serial.print(s.az); Serial.print("\t");
+        Serial.print(s.gx); Serial.print("\t");
+        Serial.print(s.gy); Serial.print("\t");
+        Serial.print(s.gz); Serial.print("\t");
+        Serial.print(samples.overruns); Serial.print("\t");
+        Serial.println(samples.dropped);
+
+        // blink LED to indicate activity
+        blinkState = !blinkState;
+        digitalWrite(LED_PIN, blinkState);
+    }
+}
@@ -0,0 +1,145 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for MPU6050 class
+// Battery-friendly sampling: sleep until motion, stream at full rate while moving
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//      2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// I2Cdev and MPU6050 must be installed as libraries, or else the .cpp/.h files
+// for both classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "MPU6050.h"
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+    #include "Wire.h"
+#endif
+
+// class default I2C address is 0x68
+// specific I2C addresses may be passed as a parameter here
+// AD0 low = 0x68 (default for InvenSense evaluation board)
+// AD0 high = 0x69
+MPU6050 accelgyro;
+//MPU6050 accelgyro(0x69); // <-- use for AD0 high
+
+/* =========================================================================
+   NOTE: this sketch depends on the MPU-6050's INT pin being connected to
+   the Arduino's external interrupt #0 pin (digital I/O pin 2 on the Uno and
+   Mega 2560). Between bursts of motion both the MPU-6050 (accel only, 5Hz) and the
+   AVR (SLEEP_MODE_PWR_DOWN) sleep; the latched, active-low INT level wakes
+   the AVR again.
+ * ========================================================================= */
+
+#include <avr/sleep.h>
+
+#define INT_PIN 2
+#define LED_PIN 13
+
+int16_t ax[32], ay[32], az[32], gx[32], gy[32], gz[32];
+MPU6050_MotionBlock block = { ax, ay, az, gx, gy, gz };
+
+void wake() {
+    // LOW level interrupts repeat while the pin is held; run once per sleep
+    detachInterrupt(0);
+}
+
+void sleepUntilMotion() {
+    Serial.flush();
+    digitalWrite(LED_PIN, LOW);
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    noInterrupts();
+    if (digitalRead(INT_PIN) == HIGH) {
+        // INT still inactive: arm the wake-up and sleep, with no window for
+        // the edge to slip in between the check and the sleep
+        attachInterrupt(0, wake, LOW);
+        sleep_enable();
+        interrupts();
+        sleep_cpu();
+        sleep_disable();
+    } else {
+        interrupts();
+    }
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+        Wire.begin();
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+        Fastwire::setup(400, true);
+    #endif
+
+    // initialize serial communication
+    Serial.begin(115200);
+
+    // initialize device
+    Serial.println("Initializing I2C devices...");
+    accelgyro.initialize();
+
+    // verify connection
+    Serial.println("Testing device connections...");
+    Serial.println(accelgyro.testConnection() ? "MPU6050 connection successful" : "MPU6050 connection failed");
+
+    // 1kHz internal rate (DLPF on) / (1 + 9) = 100Hz samples while awake
+    accelgyro.setDLPFMode(MPU6050_DLPF_BW_42);
+    accelgyro.setRate(9);
+
+    // wake on 40mg of movement; sleep after ~2s (32 x 64ms) within 16mg
+    pinMode(INT_PIN, INPUT);
+    pinMode(LED_PIN, OUTPUT);
+    accelgyro.startWakeOnMotion(20, 1, 8, 32, MPU6050_WAKE_FREQ_5);
+}
+
+void loop() {
+    uint8_t state = accelgyro.getWakeState();
+    if (state == MPU6050_WAKE_SLEEPING) {
+        sleepUntilMotion();
+    }
+
+    // INT low means a latched motion / zero-motion event to act on
+    if (digitalRead(INT_PIN) == LOW) {
+        uint8_t next = accelgyro.serviceWakeOnMotion();
+        if (next != state) Serial.println(next == MPU6050_WAKE_ACTIVE ? "moving" : "still, sleeping");
+        state = next;
+    }
+    if (state != MPU6050_WAKE_ACTIVE) return;
+
+    // awake: drain full-rate samples
+    digitalWrite(LED_PIN, HIGH);
+    uint16_t n = accelgyro.getMotion6Block(&block, 32);
+    for (uint16_t i = 0; i < n; i++) {
+        // display tab-separated accel/gyro x/y/z values
+        Serial.print("a/g:\t");
+        Serial.print(ax[i]); Serial.print("\t");
+        Serial.print(ay[i]); Serial.print("\t");
+        Serial.print(az[i]); Serial.print("\t");
+        Serial.print(gx[i]); Serial.print("\t");
+        Serial.print(gy[i]); Serial.print("\t");
+        Serial.println(gz[i]);
+    }
+}
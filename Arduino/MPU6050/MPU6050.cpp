@@ -36,11 +36,27 @@ THE SOFTWARE.
 
 #include "MPU6050.h"
 
+#ifdef MPU6050_FEATURE_DMP
+/** CRC-16/CCITT step (polynomial 0x1021, MSB first) used to verify DMP memory. */
+static uint16_t MPU6050_crc16(uint16_t crc, uint8_t data) {
+    crc ^= (uint16_t)data << 8;
+    for (uint8_t k = 0; k < 8; k++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    return crc;
+}
+#endif
+
 /** Default constructor, uses default I2C address.
  * @see MPU6050_DEFAULT_ADDRESS
  */
 MPU6050::MPU6050() {
     devAddr = MPU6050_DEFAULT_ADDRESS;
+    bus = &I2Cdev_defaultBus;
+    magType = MPU6050_MAG_NONE;
+    streamQueue = 0;
+    streamPending = false;
+    #ifdef MPU6050_FEATURE_WAKE_ON_MOTION
+        wakeState = MPU6050_WAKE_OFF;
+    #endif
 }
 
 /** Specific address constructor.
@@ -51,7 +67,42 @@ MPU6050::MPU6050() {
  */
 MPU6050::MPU6050(uint8_t address) {
     devAddr = address;
-}
+    bus = &I2Cdev_defaultBus;
+    magType = MPU6050_MAG_NONE;
+    streamQueue = 0;
+    streamPending = false;
+    #ifdef MPU6050_FEATURE_WAKE_ON_MOTION
+        wakeState = MPU6050_WAKE_OFF;
+    #endif
+}
+
+/** Specific bus and address constructor, for a device on a second TWI port
+ * or behind a bus multiplexer channel.
+ * @param bus Bus handle the device is attached to (must outlive this object)
+ * @param address I2C address
+ * @see I2Cdev_Bus
+ * @see MPU6050_DEFAULT_ADDRESS
+ */
+MPU6050::MPU6050(I2Cdev_Bus *bus, uint8_t address) {
+    devAddr = address;
+    this -> bus = bus;
+    magType = MPU6050_MAG_NONE;
+    streamQueue = 0;
+    streamPending = false;
+    #ifdef MPU6050_FEATURE_WAKE_ON_MOTION
+        wakeState = MPU6050_WAKE_OFF;
+    #endif
+}
+
+// initialize() settings; with the register cache loaded this is one write
+// to PWR_MGMT_1 and one burst to GYRO_CONFIG..ACCEL_CONFIG
+static const uint8_t initScript[] I2CDEV_SCRIPT_PROGMEM = {
+    I2CDEV_SCRIPT_BITS(MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, MPU6050_CLOCK_PLL_XGYRO),
+    I2CDEV_SCRIPT_BIT(MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT, 0), // thanks to Jack Elston for pointing this one out!
+    I2CDEV_SCRIPT_BITS(MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, MPU6050_GYRO_FS_250),
+    I2CDEV_SCRIPT_BITS(MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, MPU6050_ACCEL_FS_2),
+    I2CDEV_SCRIPT_END
+};
 
 /** Power on and prepare for general usage.
  * This will activate the device and take it out of sleep mode (which must be done
@@ -61,10 +112,20 @@ MPU6050::MPU6050(uint8_t address) {
  * the default internal clock source.
  */
 void MPU6050::initialize() {
-    setClockSource(MPU6050_CLOCK_PLL_XGYRO);
-    setFullScaleGyroRange(MPU6050_GYRO_FS_250);
-    setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
-    setSleepEnabled(false); // thanks to Jack Elston for pointing this one out!
+    #ifdef I2CDEV_REGISTER_CACHE
+        // configuration registers, so the setters below skip their reads;
+        // SLV4 (self-clearing enable, DI) and status registers stay uncached.
+        // The cache is keyed by address alone, so it only serves the default bus.
+        if (bus -> isDefault()) {
+            I2Cdev::addCacheRange(&cacheConfig, devAddr, MPU6050_RA_SMPLRT_DIV, 32, cacheConfigValues,
+                0x3FUL << (MPU6050_RA_I2C_SLV4_ADDR - MPU6050_RA_SMPLRT_DIV));
+            I2Cdev::addCacheRange(&cachePower, devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, 6, cachePowerValues,
+                1UL << (MPU6050_RA_SIGNAL_PATH_RESET - MPU6050_RA_I2C_MST_DELAY_CTRL));
+            I2Cdev::loadCacheRange(&cacheConfig);
+            I2Cdev::loadCacheRange(&cachePower);
+        }
+    #endif
+    bus -> runScript(devAddr, initScript);
 }
 
 /** Verify the I2C connection.
@@ -84,7 +145,7 @@ bool MPU6050::testConnection() {
  * @return I2C supply voltage level (0=VLOGIC, 1=VDD)
  */
 uint8_t MPU6050::getAuxVDDIOLevel() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set the auxiliary I2C supply voltage level.
@@ -94,7 +155,7 @@ uint8_t MPU6050::getAuxVDDIOLevel() {
  * @param level I2C supply voltage level (0=VLOGIC, 1=VDD)
  */
 void MPU6050::setAuxVDDIOLevel(uint8_t level) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT, level);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT> >(devAddr, level);
 }
 
 // SMPLRT_DIV register
@@ -121,7 +182,7 @@ void MPU6050::setAuxVDDIOLevel(uint8_t level) {
  * @see MPU6050_RA_SMPLRT_DIV
  */
 uint8_t MPU6050::getRate() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_SMPLRT_DIV, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_SMPLRT_DIV, buffer);
     return buffer[0];
 }
 /** Set gyroscope sample rate divider.
@@ -130,7 +191,7 @@ uint8_t MPU6050::getRate() {
  * @see MPU6050_RA_SMPLRT_DIV
  */
 void MPU6050::setRate(uint8_t rate) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_SMPLRT_DIV, rate);
+    bus -> writeByte(devAddr, MPU6050_RA_SMPLRT_DIV, rate);
 }
 
 // CONFIG register
@@ -163,7 +224,7 @@ void MPU6050::setRate(uint8_t rate) {
  * @return FSYNC configuration value
  */
 uint8_t MPU6050::getExternalFrameSync() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set external FSYNC configuration.
@@ -172,7 +233,7 @@ uint8_t MPU6050::getExternalFrameSync() {
  * @param sync New FSYNC configuration value
  */
 void MPU6050::setExternalFrameSync(uint8_t sync) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH, sync);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH> >(devAddr, sync);
 }
 /** Get digital low-pass filter configuration.
  * The DLPF_CFG parameter sets the digital low pass filter configuration. It
@@ -203,7 +264,7 @@ void MPU6050::setExternalFrameSync(uint8_t sync) {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 uint8_t MPU6050::getDLPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set digital low-pass filter configuration.
@@ -215,7 +276,7 @@ uint8_t MPU6050::getDLPFMode() {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 void MPU6050::setDLPFMode(uint8_t mode) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, mode);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH> >(devAddr, mode);
 }
 
 // GYRO_CONFIG register
@@ -238,7 +299,7 @@ void MPU6050::setDLPFMode(uint8_t mode) {
  * @see MPU6050_GCONFIG_FS_SEL_LENGTH
  */
 uint8_t MPU6050::getFullScaleGyroRange() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set full-scale gyroscope range.
@@ -250,7 +311,7 @@ uint8_t MPU6050::getFullScaleGyroRange() {
  * @see MPU6050_GCONFIG_FS_SEL_LENGTH
  */
 void MPU6050::setFullScaleGyroRange(uint8_t range) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, range);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH> >(devAddr, range);
 }
 
 // ACCEL_CONFIG register
@@ -260,7 +321,7 @@ void MPU6050::setFullScaleGyroRange(uint8_t range) {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050::getAccelXSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get self-test enabled setting for accelerometer X axis.
@@ -268,14 +329,14 @@ bool MPU6050::getAccelXSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setAccelXSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT> >(devAddr, enabled);
 }
 /** Get self-test enabled value for accelerometer Y axis.
  * @return Self-test enabled value
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050::getAccelYSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get self-test enabled value for accelerometer Y axis.
@@ -283,14 +344,14 @@ bool MPU6050::getAccelYSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setAccelYSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT> >(devAddr, enabled);
 }
 /** Get self-test enabled value for accelerometer Z axis.
  * @return Self-test enabled value
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050::getAccelZSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set self-test enabled value for accelerometer Z axis.
@@ -298,7 +359,7 @@ bool MPU6050::getAccelZSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setAccelZSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT> >(devAddr, enabled);
 }
 /** Get full-scale accelerometer range.
  * The FS_SEL parameter allows setting the full-scale range of the accelerometer
@@ -318,7 +379,7 @@ void MPU6050::setAccelZSelfTest(bool enabled) {
  * @see MPU6050_ACONFIG_AFS_SEL_LENGTH
  */
 uint8_t MPU6050::getFullScaleAccelRange() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set full-scale accelerometer range.
@@ -326,7 +387,7 @@ uint8_t MPU6050::getFullScaleAccelRange() {
  * @see getFullScaleAccelRange()
  */
 void MPU6050::setFullScaleAccelRange(uint8_t range) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, range);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH> >(devAddr, range);
 }
 /** Get the high-pass filter configuration.
  * The DHPF is a filter module in the path leading to motion detectors (Free
@@ -364,7 +425,7 @@ void MPU6050::setFullScaleAccelRange(uint8_t range) {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 uint8_t MPU6050::getDHPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set the high-pass filter configuration.
@@ -374,9 +435,10 @@ uint8_t MPU6050::getDHPFMode() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050::setDHPFMode(uint8_t bandwidth) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, bandwidth);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH> >(devAddr, bandwidth);
 }
 
+#ifdef MPU6050_FEATURE_MOTION_DETECT
 // FF_THR register
 
 /** Get free-fall event acceleration threshold.
@@ -395,7 +457,7 @@ void MPU6050::setDHPFMode(uint8_t bandwidth) {
  * @see MPU6050_RA_FF_THR
  */
 uint8_t MPU6050::getFreefallDetectionThreshold() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_FF_THR, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_FF_THR, buffer);
     return buffer[0];
 }
 /** Get free-fall event acceleration threshold.
@@ -404,7 +466,7 @@ uint8_t MPU6050::getFreefallDetectionThreshold() {
  * @see MPU6050_RA_FF_THR
  */
 void MPU6050::setFreefallDetectionThreshold(uint8_t threshold) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_FF_THR, threshold);
+    bus -> writeByte(devAddr, MPU6050_RA_FF_THR, threshold);
 }
 
 // FF_DUR register
@@ -427,7 +489,7 @@ void MPU6050::setFreefallDetectionThreshold(uint8_t threshold) {
  * @see MPU6050_RA_FF_DUR
  */
 uint8_t MPU6050::getFreefallDetectionDuration() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_FF_DUR, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_FF_DUR, buffer);
     return buffer[0];
 }
 /** Get free-fall event duration threshold.
@@ -436,7 +498,7 @@ uint8_t MPU6050::getFreefallDetectionDuration() {
  * @see MPU6050_RA_FF_DUR
  */
 void MPU6050::setFreefallDetectionDuration(uint8_t duration) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_FF_DUR, duration);
+    bus -> writeByte(devAddr, MPU6050_RA_FF_DUR, duration);
 }
 
 // MOT_THR register
@@ -461,7 +523,7 @@ void MPU6050::setFreefallDetectionDuration(uint8_t duration) {
  * @see MPU6050_RA_MOT_THR
  */
 uint8_t MPU6050::getMotionDetectionThreshold() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_MOT_THR, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_MOT_THR, buffer);
     return buffer[0];
 }
 /** Set free-fall event acceleration threshold.
@@ -470,7 +532,7 @@ uint8_t MPU6050::getMotionDetectionThreshold() {
  * @see MPU6050_RA_MOT_THR
  */
 void MPU6050::setMotionDetectionThreshold(uint8_t threshold) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_MOT_THR, threshold);
+    bus -> writeByte(devAddr, MPU6050_RA_MOT_THR, threshold);
 }
 
 // MOT_DUR register
@@ -491,7 +553,7 @@ void MPU6050::setMotionDetectionThreshold(uint8_t threshold) {
  * @see MPU6050_RA_MOT_DUR
  */
 uint8_t MPU6050::getMotionDetectionDuration() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_MOT_DUR, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_MOT_DUR, buffer);
     return buffer[0];
 }
 /** Set motion detection event duration threshold.
@@ -500,7 +562,7 @@ uint8_t MPU6050::getMotionDetectionDuration() {
  * @see MPU6050_RA_MOT_DUR
  */
 void MPU6050::setMotionDetectionDuration(uint8_t duration) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_MOT_DUR, duration);
+    bus -> writeByte(devAddr, MPU6050_RA_MOT_DUR, duration);
 }
 
 // ZRMOT_THR register
@@ -531,7 +593,7 @@ void MPU6050::setMotionDetectionDuration(uint8_t duration) {
  * @see MPU6050_RA_ZRMOT_THR
  */
 uint8_t MPU6050::getZeroMotionDetectionThreshold() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_ZRMOT_THR, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_ZRMOT_THR, buffer);
     return buffer[0];
 }
 /** Set zero motion detection event acceleration threshold.
@@ -540,7 +602,7 @@ uint8_t MPU6050::getZeroMotionDetectionThreshold() {
  * @see MPU6050_RA_ZRMOT_THR
  */
 void MPU6050::setZeroMotionDetectionThreshold(uint8_t threshold) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_ZRMOT_THR, threshold);
+    bus -> writeByte(devAddr, MPU6050_RA_ZRMOT_THR, threshold);
 }
 
 // ZRMOT_DUR register
@@ -562,7 +624,7 @@ void MPU6050::setZeroMotionDetectionThreshold(uint8_t threshold) {
  * @see MPU6050_RA_ZRMOT_DUR
  */
 uint8_t MPU6050::getZeroMotionDetectionDuration() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_ZRMOT_DUR, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_ZRMOT_DUR, buffer);
     return buffer[0];
 }
 /** Set zero motion detection event duration threshold.
@@ -571,9 +633,11 @@ uint8_t MPU6050::getZeroMotionDetectionDuration() {
  * @see MPU6050_RA_ZRMOT_DUR
  */
 void MPU6050::setZeroMotionDetectionDuration(uint8_t duration) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_ZRMOT_DUR, duration);
+    bus -> writeByte(devAddr, MPU6050_RA_ZRMOT_DUR, duration);
 }
+#endif
 
+#ifdef MPU6050_FEATURE_FIFO
 // FIFO_EN register
 
 /** Get temperature FIFO enabled value.
@@ -583,7 +647,7 @@ void MPU6050::setZeroMotionDetectionDuration(uint8_t duration) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getTempFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set temperature FIFO enabled value.
@@ -592,7 +656,7 @@ bool MPU6050::getTempFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setTempFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get gyroscope X-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_XOUT_H and GYRO_XOUT_L (Registers 67 and
@@ -601,7 +665,7 @@ void MPU6050::setTempFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getXGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set gyroscope X-axis FIFO enabled value.
@@ -610,7 +674,7 @@ bool MPU6050::getXGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setXGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get gyroscope Y-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_YOUT_H and GYRO_YOUT_L (Registers 69 and
@@ -619,7 +683,7 @@ void MPU6050::setXGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getYGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set gyroscope Y-axis FIFO enabled value.
@@ -628,7 +692,7 @@ bool MPU6050::getYGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setYGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get gyroscope Z-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_ZOUT_H and GYRO_ZOUT_L (Registers 71 and
@@ -637,7 +701,7 @@ void MPU6050::setYGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getZGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set gyroscope Z-axis FIFO enabled value.
@@ -646,7 +710,7 @@ bool MPU6050::getZGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setZGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get accelerometer FIFO enabled value.
  * When set to 1, this bit enables ACCEL_XOUT_H, ACCEL_XOUT_L, ACCEL_YOUT_H,
@@ -656,7 +720,7 @@ void MPU6050::setZGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getAccelFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set accelerometer FIFO enabled value.
@@ -665,7 +729,7 @@ bool MPU6050::getAccelFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setAccelFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get Slave 2 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -674,7 +738,7 @@ void MPU6050::setAccelFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getSlave2FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 2 FIFO enabled value.
@@ -683,7 +747,7 @@ bool MPU6050::getSlave2FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setSlave2FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get Slave 1 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -692,7 +756,7 @@ void MPU6050::setSlave2FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getSlave1FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 1 FIFO enabled value.
@@ -701,7 +765,7 @@ bool MPU6050::getSlave1FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setSlave1FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get Slave 0 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -710,7 +774,7 @@ void MPU6050::setSlave1FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050::getSlave0FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 0 FIFO enabled value.
@@ -719,9 +783,11 @@ bool MPU6050::getSlave0FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050::setSlave0FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT> >(devAddr, enabled);
 }
+#endif
 
+#ifdef MPU6050_FEATURE_AUX_MASTER
 // I2C_MST_CTRL register
 
 /** Get multi-master enabled value.
@@ -740,7 +806,7 @@ void MPU6050::setSlave0FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050::getMultiMasterEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set multi-master enabled value.
@@ -749,7 +815,7 @@ bool MPU6050::getMultiMasterEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setMultiMasterEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT> >(devAddr, enabled);
 }
 /** Get wait-for-external-sensor-data enabled value.
  * When the WAIT_FOR_ES bit is set to 1, the Data Ready interrupt will be
@@ -763,7 +829,7 @@ void MPU6050::setMultiMasterEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050::getWaitForExternalSensorEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set wait-for-external-sensor-data enabled value.
@@ -772,7 +838,7 @@ bool MPU6050::getWaitForExternalSensorEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setWaitForExternalSensorEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT> >(devAddr, enabled);
 }
 /** Get Slave 3 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -781,7 +847,7 @@ void MPU6050::setWaitForExternalSensorEnabled(bool enabled) {
  * @see MPU6050_RA_MST_CTRL
  */
 bool MPU6050::getSlave3FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 3 FIFO enabled value.
@@ -790,7 +856,7 @@ bool MPU6050::getSlave3FIFOEnabled() {
  * @see MPU6050_RA_MST_CTRL
  */
 void MPU6050::setSlave3FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get slave read/write transition enabled value.
  * The I2C_MST_P_NSR bit configures the I2C Master's transition from one slave
@@ -803,7 +869,7 @@ void MPU6050::setSlave3FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050::getSlaveReadWriteTransitionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set slave read/write transition enabled value.
@@ -812,7 +878,7 @@ bool MPU6050::getSlaveReadWriteTransitionEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setSlaveReadWriteTransitionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT> >(devAddr, enabled);
 }
 /** Get I2C master clock speed.
  * I2C_MST_CLK is a 4 bit unsigned value which configures a divider on the
@@ -844,7 +910,7 @@ void MPU6050::setSlaveReadWriteTransitionEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 uint8_t MPU6050::getMasterClockSpeed() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C master clock speed.
@@ -852,7 +918,7 @@ uint8_t MPU6050::getMasterClockSpeed() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050::setMasterClockSpeed(uint8_t speed) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, speed);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH> >(devAddr, speed);
 }
 
 // I2C_SLV* registers (Slave 0-3)
@@ -900,7 +966,7 @@ void MPU6050::setMasterClockSpeed(uint8_t speed) {
  */
 uint8_t MPU6050::getSlaveAddress(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readByte(devAddr, MPU6050_RA_I2C_SLV0_ADDR + num*3, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_I2C_SLV0_ADDR + num*3, buffer);
     return buffer[0];
 }
 /** Set the I2C address of the specified slave (0-3).
@@ -911,7 +977,7 @@ uint8_t MPU6050::getSlaveAddress(uint8_t num) {
  */
 void MPU6050::setSlaveAddress(uint8_t num, uint8_t address) {
     if (num > 3) return;
-    I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV0_ADDR + num*3, address);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV0_ADDR + num*3, address);
 }
 /** Get the active internal register for the specified slave (0-3).
  * Read/write operations for this slave will be done to whatever internal
@@ -926,7 +992,7 @@ void MPU6050::setSlaveAddress(uint8_t num, uint8_t address) {
  */
 uint8_t MPU6050::getSlaveRegister(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readByte(devAddr, MPU6050_RA_I2C_SLV0_REG + num*3, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_I2C_SLV0_REG + num*3, buffer);
     return buffer[0];
 }
 /** Set the active internal register for the specified slave (0-3).
@@ -937,7 +1003,7 @@ uint8_t MPU6050::getSlaveRegister(uint8_t num) {
  */
 void MPU6050::setSlaveRegister(uint8_t num, uint8_t reg) {
     if (num > 3) return;
-    I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV0_REG + num*3, reg);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV0_REG + num*3, reg);
 }
 /** Get the enabled value for the specified slave (0-3).
  * When set to 1, this bit enables Slave 0 for data transfer operations. When
@@ -948,7 +1014,7 @@ void MPU6050::setSlaveRegister(uint8_t num, uint8_t reg) {
  */
 bool MPU6050::getSlaveEnabled(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_EN_BIT, buffer);
+    bus -> readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_EN_BIT, buffer);
     return buffer[0];
 }
 /** Set the enabled value for the specified slave (0-3).
@@ -959,7 +1025,7 @@ bool MPU6050::getSlaveEnabled(uint8_t num) {
  */
 void MPU6050::setSlaveEnabled(uint8_t num, bool enabled) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_EN_BIT, enabled);
+    bus -> writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_EN_BIT, enabled);
 }
 /** Get word pair byte-swapping enabled for the specified slave (0-3).
  * When set to 1, this bit enables byte swapping. When byte swapping is enabled,
@@ -974,7 +1040,7 @@ void MPU6050::setSlaveEnabled(uint8_t num, bool enabled) {
  */
 bool MPU6050::getSlaveWordByteSwap(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_BYTE_SW_BIT, buffer);
+    bus -> readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_BYTE_SW_BIT, buffer);
     return buffer[0];
 }
 /** Set word pair byte-swapping enabled for the specified slave (0-3).
@@ -985,7 +1051,7 @@ bool MPU6050::getSlaveWordByteSwap(uint8_t num) {
  */
 void MPU6050::setSlaveWordByteSwap(uint8_t num, bool enabled) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_BYTE_SW_BIT, enabled);
+    bus -> writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_BYTE_SW_BIT, enabled);
 }
 /** Get write mode for the specified slave (0-3).
  * When set to 1, the transaction will read or write data only. When cleared to
@@ -999,7 +1065,7 @@ void MPU6050::setSlaveWordByteSwap(uint8_t num, bool enabled) {
  */
 bool MPU6050::getSlaveWriteMode(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_REG_DIS_BIT, buffer);
+    bus -> readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_REG_DIS_BIT, buffer);
     return buffer[0];
 }
 /** Set write mode for the specified slave (0-3).
@@ -1010,7 +1076,7 @@ bool MPU6050::getSlaveWriteMode(uint8_t num) {
  */
 void MPU6050::setSlaveWriteMode(uint8_t num, bool mode) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_REG_DIS_BIT, mode);
+    bus -> writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_REG_DIS_BIT, mode);
 }
 /** Get word pair grouping order offset for the specified slave (0-3).
  * This sets specifies the grouping order of word pairs received from registers.
@@ -1025,7 +1091,7 @@ void MPU6050::setSlaveWriteMode(uint8_t num, bool mode) {
  */
 bool MPU6050::getSlaveWordGroupOffset(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_GRP_BIT, buffer);
+    bus -> readBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_GRP_BIT, buffer);
     return buffer[0];
 }
 /** Set word pair grouping order offset for the specified slave (0-3).
@@ -1036,7 +1102,7 @@ bool MPU6050::getSlaveWordGroupOffset(uint8_t num) {
  */
 void MPU6050::setSlaveWordGroupOffset(uint8_t num, bool enabled) {
     if (num > 3) return;
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_GRP_BIT, enabled);
+    bus -> writeBit(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_GRP_BIT, enabled);
 }
 /** Get number of bytes to read for the specified slave (0-3).
  * Specifies the number of bytes transferred to and from Slave 0. Clearing this
@@ -1047,7 +1113,7 @@ void MPU6050::setSlaveWordGroupOffset(uint8_t num, bool enabled) {
  */
 uint8_t MPU6050::getSlaveDataLength(uint8_t num) {
     if (num > 3) return 0;
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH, buffer);
+    bus -> readBits(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH, buffer);
     return buffer[0];
 }
 /** Set number of bytes to read for the specified slave (0-3).
@@ -1058,7 +1124,7 @@ uint8_t MPU6050::getSlaveDataLength(uint8_t num) {
  */
 void MPU6050::setSlaveDataLength(uint8_t num, uint8_t length) {
     if (num > 3) return;
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH, length);
+    bus -> writeBits(devAddr, MPU6050_RA_I2C_SLV0_CTRL + num*3, MPU6050_I2C_SLV_LEN_BIT, MPU6050_I2C_SLV_LEN_LENGTH, length);
 }
 
 // I2C_SLV* registers (Slave 4)
@@ -1073,7 +1139,7 @@ void MPU6050::setSlaveDataLength(uint8_t num, uint8_t length) {
  * @see MPU6050_RA_I2C_SLV4_ADDR
  */
 uint8_t MPU6050::getSlave4Address() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_I2C_SLV4_ADDR, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_I2C_SLV4_ADDR, buffer);
     return buffer[0];
 }
 /** Set the I2C address of Slave 4.
@@ -1082,7 +1148,7 @@ uint8_t MPU6050::getSlave4Address() {
  * @see MPU6050_RA_I2C_SLV4_ADDR
  */
 void MPU6050::setSlave4Address(uint8_t address) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV4_ADDR, address);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV4_ADDR, address);
 }
 /** Get the active internal register for the Slave 4.
  * Read/write operations for this slave will be done to whatever internal
@@ -1092,7 +1158,7 @@ void MPU6050::setSlave4Address(uint8_t address) {
  * @see MPU6050_RA_I2C_SLV4_REG
  */
 uint8_t MPU6050::getSlave4Register() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_I2C_SLV4_REG, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_I2C_SLV4_REG, buffer);
     return buffer[0];
 }
 /** Set the active internal register for Slave 4.
@@ -1101,7 +1167,7 @@ uint8_t MPU6050::getSlave4Register() {
  * @see MPU6050_RA_I2C_SLV4_REG
  */
 void MPU6050::setSlave4Register(uint8_t reg) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV4_REG, reg);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV4_REG, reg);
 }
 /** Set new byte to write to Slave 4.
  * This register stores the data to be written into the Slave 4. If I2C_SLV4_RW
@@ -1110,7 +1176,7 @@ void MPU6050::setSlave4Register(uint8_t reg) {
  * @see MPU6050_RA_I2C_SLV4_DO
  */
 void MPU6050::setSlave4OutputByte(uint8_t data) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV4_DO, data);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV4_DO, data);
 }
 /** Get the enabled value for the Slave 4.
  * When set to 1, this bit enables Slave 4 for data transfer operations. When
@@ -1119,7 +1185,7 @@ void MPU6050::setSlave4OutputByte(uint8_t data) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050::getSlave4Enabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set the enabled value for Slave 4.
@@ -1128,7 +1194,7 @@ bool MPU6050::getSlave4Enabled() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT> >(devAddr, enabled);
 }
 /** Get the enabled value for Slave 4 transaction interrupts.
  * When set to 1, this bit enables the generation of an interrupt signal upon
@@ -1140,7 +1206,7 @@ void MPU6050::setSlave4Enabled(bool enabled) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050::getSlave4InterruptEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set the enabled value for Slave 4 transaction interrupts.
@@ -1149,7 +1215,7 @@ bool MPU6050::getSlave4InterruptEnabled() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4InterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT> >(devAddr, enabled);
 }
 /** Get write mode for Slave 4.
  * When set to 1, the transaction will read or write data only. When cleared to
@@ -1161,7 +1227,7 @@ void MPU6050::setSlave4InterruptEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050::getSlave4WriteMode() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set write mode for the Slave 4.
@@ -1170,7 +1236,7 @@ bool MPU6050::getSlave4WriteMode() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4WriteMode(bool mode) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT, mode);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT> >(devAddr, mode);
 }
 /** Get Slave 4 master delay value.
  * This configures the reduced access rate of I2C slaves relative to the Sample
@@ -1188,7 +1254,7 @@ void MPU6050::setSlave4WriteMode(bool mode) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 uint8_t MPU6050::getSlave4MasterDelay() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Slave 4 master delay value.
@@ -1197,7 +1263,7 @@ uint8_t MPU6050::getSlave4MasterDelay() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050::setSlave4MasterDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, delay);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH> >(devAddr, delay);
 }
 /** Get last available byte read from Slave 4.
  * This register stores the data read from Slave 4. This field is populated
@@ -1206,7 +1272,7 @@ void MPU6050::setSlave4MasterDelay(uint8_t delay) {
  * @see MPU6050_RA_I2C_SLV4_DI
  */
 uint8_t MPU6050::getSlate4InputByte() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_I2C_SLV4_DI, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_I2C_SLV4_DI, buffer);
     return buffer[0];
 }
 
@@ -1222,7 +1288,7 @@ uint8_t MPU6050::getSlate4InputByte() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getPassthroughStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_PASS_THROUGH_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_PASS_THROUGH_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 4 transaction done status.
@@ -1234,7 +1300,7 @@ bool MPU6050::getPassthroughStatus() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave4IsDone() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_DONE_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_DONE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get master arbitration lost status.
@@ -1245,7 +1311,7 @@ bool MPU6050::getSlave4IsDone() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getLostArbitration() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_LOST_ARB_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_LOST_ARB_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 4 NACK status.
@@ -1256,7 +1322,7 @@ bool MPU6050::getLostArbitration() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave4Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_NACK_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_NACK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 3 NACK status.
@@ -1267,7 +1333,7 @@ bool MPU6050::getSlave4Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave3Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV3_NACK_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV3_NACK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 2 NACK status.
@@ -1278,7 +1344,7 @@ bool MPU6050::getSlave3Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave2Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV2_NACK_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV2_NACK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 1 NACK status.
@@ -1289,7 +1355,7 @@ bool MPU6050::getSlave2Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave1Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV1_NACK_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV1_NACK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Slave 0 NACK status.
@@ -1300,9 +1366,10 @@ bool MPU6050::getSlave1Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050::getSlave0Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV0_NACK_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV0_NACK_BIT> >(devAddr, buffer);
     return buffer[0];
 }
+#endif
 
 // INT_PIN_CFG register
 
@@ -1313,7 +1380,7 @@ bool MPU6050::getSlave0Nack() {
  * @see MPU6050_INTCFG_INT_LEVEL_BIT
  */
 bool MPU6050::getInterruptMode() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt logic level mode.
@@ -1323,7 +1390,7 @@ bool MPU6050::getInterruptMode() {
  * @see MPU6050_INTCFG_INT_LEVEL_BIT
  */
 void MPU6050::setInterruptMode(bool mode) {
-   I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT, mode);
+   bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT> >(devAddr, mode);
 }
 /** Get interrupt drive mode.
  * Will be set 0 for push-pull, 1 for open-drain.
@@ -1332,7 +1399,7 @@ void MPU6050::setInterruptMode(bool mode) {
  * @see MPU6050_INTCFG_INT_OPEN_BIT
  */
 bool MPU6050::getInterruptDrive() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt drive mode.
@@ -1342,7 +1409,7 @@ bool MPU6050::getInterruptDrive() {
  * @see MPU6050_INTCFG_INT_OPEN_BIT
  */
 void MPU6050::setInterruptDrive(bool drive) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT, drive);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT> >(devAddr, drive);
 }
 /** Get interrupt latch mode.
  * Will be set 0 for 50us-pulse, 1 for latch-until-int-cleared.
@@ -1351,7 +1418,7 @@ void MPU6050::setInterruptDrive(bool drive) {
  * @see MPU6050_INTCFG_LATCH_INT_EN_BIT
  */
 bool MPU6050::getInterruptLatch() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt latch mode.
@@ -1361,7 +1428,7 @@ bool MPU6050::getInterruptLatch() {
  * @see MPU6050_INTCFG_LATCH_INT_EN_BIT
  */
 void MPU6050::setInterruptLatch(bool latch) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT, latch);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT> >(devAddr, latch);
 }
 /** Get interrupt latch clear mode.
  * Will be set 0 for status-read-only, 1 for any-register-read.
@@ -1370,7 +1437,7 @@ void MPU6050::setInterruptLatch(bool latch) {
  * @see MPU6050_INTCFG_INT_RD_CLEAR_BIT
  */
 bool MPU6050::getInterruptLatchClear() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set interrupt latch clear mode.
@@ -1380,7 +1447,7 @@ bool MPU6050::getInterruptLatchClear() {
  * @see MPU6050_INTCFG_INT_RD_CLEAR_BIT
  */
 void MPU6050::setInterruptLatchClear(bool clear) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT, clear);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT> >(devAddr, clear);
 }
 /** Get FSYNC interrupt logic level mode.
  * @return Current FSYNC interrupt mode (0=active-high, 1=active-low)
@@ -1389,7 +1456,7 @@ void MPU6050::setInterruptLatchClear(bool clear) {
  * @see MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT
  */
 bool MPU6050::getFSyncInterruptLevel() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FSYNC interrupt logic level mode.
@@ -1399,7 +1466,7 @@ bool MPU6050::getFSyncInterruptLevel() {
  * @see MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT
  */
 void MPU6050::setFSyncInterruptLevel(bool level) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT, level);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT> >(devAddr, level);
 }
 /** Get FSYNC pin interrupt enabled setting.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1408,7 +1475,7 @@ void MPU6050::setFSyncInterruptLevel(bool level) {
  * @see MPU6050_INTCFG_FSYNC_INT_EN_BIT
  */
 bool MPU6050::getFSyncInterruptEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FSYNC pin interrupt enabled setting.
@@ -1418,7 +1485,7 @@ bool MPU6050::getFSyncInterruptEnabled() {
  * @see MPU6050_INTCFG_FSYNC_INT_EN_BIT
  */
 void MPU6050::setFSyncInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT> >(devAddr, enabled);
 }
 /** Get I2C bypass enabled status.
  * When this bit is equal to 1 and I2C_MST_EN (Register 106 bit[5]) is equal to
@@ -1432,7 +1499,7 @@ void MPU6050::setFSyncInterruptEnabled(bool enabled) {
  * @see MPU6050_INTCFG_I2C_BYPASS_EN_BIT
  */
 bool MPU6050::getI2CBypassEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C bypass enabled status.
@@ -1447,7 +1514,7 @@ bool MPU6050::getI2CBypassEnabled() {
  * @see MPU6050_INTCFG_I2C_BYPASS_EN_BIT
  */
 void MPU6050::setI2CBypassEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT> >(devAddr, enabled);
 }
 /** Get reference clock output enabled status.
  * When this bit is equal to 1, a reference clock output is provided at the
@@ -1459,7 +1526,7 @@ void MPU6050::setI2CBypassEnabled(bool enabled) {
  * @see MPU6050_INTCFG_CLKOUT_EN_BIT
  */
 bool MPU6050::getClockOutputEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set reference clock output enabled status.
@@ -1472,7 +1539,7 @@ bool MPU6050::getClockOutputEnabled() {
  * @see MPU6050_INTCFG_CLKOUT_EN_BIT
  */
 void MPU6050::setClockOutputEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT> >(devAddr, enabled);
 }
 
 // INT_ENABLE register
@@ -1485,7 +1552,7 @@ void MPU6050::setClockOutputEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 uint8_t MPU6050::getIntEnabled() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_INT_ENABLE, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_INT_ENABLE, buffer);
     return buffer[0];
 }
 /** Set full interrupt enabled status.
@@ -1497,7 +1564,7 @@ uint8_t MPU6050::getIntEnabled() {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 void MPU6050::setIntEnabled(uint8_t enabled) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_INT_ENABLE, enabled);
+    bus -> writeByte(devAddr, MPU6050_RA_INT_ENABLE, enabled);
 }
 /** Get Free Fall interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1506,7 +1573,7 @@ void MPU6050::setIntEnabled(uint8_t enabled) {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 bool MPU6050::getIntFreefallEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Free Fall interrupt enabled status.
@@ -1516,7 +1583,7 @@ bool MPU6050::getIntFreefallEnabled() {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 void MPU6050::setIntFreefallEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT> >(devAddr, enabled);
 }
 /** Get Motion Detection interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1525,7 +1592,7 @@ void MPU6050::setIntFreefallEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_MOT_BIT
  **/
 bool MPU6050::getIntMotionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Motion Detection interrupt enabled status.
@@ -1535,7 +1602,7 @@ bool MPU6050::getIntMotionEnabled() {
  * @see MPU6050_INTERRUPT_MOT_BIT
  **/
 void MPU6050::setIntMotionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT> >(devAddr, enabled);
 }
 /** Get Zero Motion Detection interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1544,7 +1611,7 @@ void MPU6050::setIntMotionEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  **/
 bool MPU6050::getIntZeroMotionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Zero Motion Detection interrupt enabled status.
@@ -1554,7 +1621,7 @@ bool MPU6050::getIntZeroMotionEnabled() {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  **/
 void MPU6050::setIntZeroMotionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT> >(devAddr, enabled);
 }
 /** Get FIFO Buffer Overflow interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1563,7 +1630,7 @@ void MPU6050::setIntZeroMotionEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  **/
 bool MPU6050::getIntFIFOBufferOverflowEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FIFO Buffer Overflow interrupt enabled status.
@@ -1573,7 +1640,7 @@ bool MPU6050::getIntFIFOBufferOverflowEnabled() {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  **/
 void MPU6050::setIntFIFOBufferOverflowEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT> >(devAddr, enabled);
 }
 /** Get I2C Master interrupt enabled status.
  * This enables any of the I2C Master interrupt sources to generate an
@@ -1583,7 +1650,7 @@ void MPU6050::setIntFIFOBufferOverflowEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  **/
 bool MPU6050::getIntI2CMasterEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C Master interrupt enabled status.
@@ -1593,7 +1660,7 @@ bool MPU6050::getIntI2CMasterEnabled() {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  **/
 void MPU6050::setIntI2CMasterEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT> >(devAddr, enabled);
 }
 /** Get Data Ready interrupt enabled setting.
  * This event occurs each time a write operation to all of the sensor registers
@@ -1603,7 +1670,7 @@ void MPU6050::setIntI2CMasterEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 bool MPU6050::getIntDataReadyEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Data Ready interrupt enabled status.
@@ -1613,7 +1680,7 @@ bool MPU6050::getIntDataReadyEnabled() {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 void MPU6050::setIntDataReadyEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT> >(devAddr, enabled);
 }
 
 // INT_STATUS register
@@ -1626,7 +1693,7 @@ void MPU6050::setIntDataReadyEnabled(bool enabled) {
  * @see MPU6050_RA_INT_STATUS
  */
 uint8_t MPU6050::getIntStatus() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_INT_STATUS, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_INT_STATUS, buffer);
     return buffer[0];
 }
 /** Get Free Fall interrupt status.
@@ -1637,7 +1704,7 @@ uint8_t MPU6050::getIntStatus() {
  * @see MPU6050_INTERRUPT_FF_BIT
  */
 bool MPU6050::getIntFreefallStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FF_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FF_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Motion Detection interrupt status.
@@ -1648,7 +1715,7 @@ bool MPU6050::getIntFreefallStatus() {
  * @see MPU6050_INTERRUPT_MOT_BIT
  */
 bool MPU6050::getIntMotionStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_MOT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_MOT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Zero Motion Detection interrupt status.
@@ -1659,7 +1726,7 @@ bool MPU6050::getIntMotionStatus() {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  */
 bool MPU6050::getIntZeroMotionStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_ZMOT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_ZMOT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get FIFO Buffer Overflow interrupt status.
@@ -1670,7 +1737,7 @@ bool MPU6050::getIntZeroMotionStatus() {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  */
 bool MPU6050::getIntFIFOBufferOverflowStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FIFO_OFLOW_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get I2C Master interrupt status.
@@ -1682,7 +1749,7 @@ bool MPU6050::getIntFIFOBufferOverflowStatus() {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  */
 bool MPU6050::getIntI2CMasterStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_I2C_MST_INT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_I2C_MST_INT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Data Ready interrupt status.
@@ -1693,14 +1760,19 @@ bool MPU6050::getIntI2CMasterStatus() {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 bool MPU6050::getIntDataReadyStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DATA_RDY_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DATA_RDY_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
 // ACCEL_*OUT_* registers
 
+#ifdef MPU6050_FEATURE_AUX_MASTER
 /** Get raw 9-axis motion sensor readings (accel/gyro/compass).
- * FUNCTION NOT FULLY IMPLEMENTED YET.
+ * Once a magnetometer has been attached with setMotion9Magnetometer(), the
+ * auxiliary I2C master copies its output into EXT_SENS_DATA_00..05 at every
+ * sample, so accel, temperature, gyro and compass come back together in one
+ * 20-byte burst and belong to the same sample. Without one, this behaves
+ * like getMotion6() and the compass values are zero.
  * @param ax 16-bit signed integer container for accelerometer X-axis value
  * @param ay 16-bit signed integer container for accelerometer Y-axis value
  * @param az 16-bit signed integer container for accelerometer Z-axis value
@@ -1711,14 +1783,93 @@ bool MPU6050::getIntDataReadyStatus() {
  * @param my 16-bit signed integer container for magnetometer Y-axis value
  * @param mz 16-bit signed integer container for magnetometer Z-axis value
  * @see getMotion6()
- * @see getAcceleration()
- * @see getRotation()
+ * @see setMotion9Magnetometer()
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz) {
-    getMotion6(ax, ay, az, gx, gy, gz);
-    // TODO: magnetometer integration
+    if (magType == MPU6050_MAG_NONE) {
+        getMotion6(ax, ay, az, gx, gy, gz);
+        *mx = *my = *mz = 0;
+        return;
+    }
+    bus -> readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, MPU6050_MOTION9_LENGTH, buffer);
+    *ax = I2CDEV_BE16(buffer);
+    *ay = I2CDEV_BE16(buffer + 2);
+    *az = I2CDEV_BE16(buffer + 4);
+    *gx = I2CDEV_BE16(buffer + 8);
+    *gy = I2CDEV_BE16(buffer + 10);
+    *gz = I2CDEV_BE16(buffer + 12);
+    if (magType == MPU6050_MAG_HMC5883L) {
+        // big-endian, X/Z/Y register order
+        *mx = I2CDEV_BE16(buffer + 14);
+        *mz = I2CDEV_BE16(buffer + 16);
+        *my = I2CDEV_BE16(buffer + 18);
+    } else {
+        // little-endian, X/Y/Z register order
+        *mx = I2CDEV_LE16(buffer + 14);
+        *my = I2CDEV_LE16(buffer + 16);
+        *mz = I2CDEV_LE16(buffer + 18);
+    }
+}
+/** Attach a magnetometer on the auxiliary bus for getMotion9().
+ * The magnetometer is configured once through the bypass switch (HMC5883L:
+ * 75Hz continuous measurement; AK8975: WIA identity check), then Slave 0 is
+ * set to read its six data registers into EXT_SENS_DATA_00..05 every sample.
+ * The AK8975 only does single measurements, so Slave 1 re-arms it after each
+ * read; keep the sample rate at or below 100Hz for it to keep up. Data ready
+ * waits for the external sensor so each sample is complete. This takes
+ * over Slaves 0 and 1 and the I2C master, so do not combine it with the
+ * MotionApps 4.1 DMP, which sets them up itself.
+ * @param type MPU6050_MAG_HMC5883L, MPU6050_MAG_AK8975 or MPU6050_MAG_NONE to detach
+ * @param address 7-bit magnetometer address, 0 for the type's default
+ * @return True if the magnetometer responded and the slaves were set up
+ * @see getMotion9()
+ */
+bool MPU6050::setMotion9Magnetometer(uint8_t type, uint8_t address) {
+    magType = MPU6050_MAG_NONE;
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV0_CTRL, 0);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV1_CTRL, 0);
+    if (type == MPU6050_MAG_NONE) return true;
+    if (address == 0) address = (type == MPU6050_MAG_HMC5883L) ? 0x1E : 0x0C;
+
+    // talk to the magnetometer directly once
+    setI2CMasterModeEnabled(false);
+    setI2CBypassEnabled(true);
+    bool ok;
+    if (type == MPU6050_MAG_HMC5883L) {
+        // CONFIG_A: 1-sample average, 75Hz; MODE: continuous measurement
+        ok = bus -> writeByte(address, 0x00, 0x18) && bus -> writeByte(address, 0x02, 0x00);
+    } else {
+        ok = bus -> readByte(address, 0x00, buffer) == 1 && buffer[0] == 0x48;
+    }
+    setI2CBypassEnabled(false);
+    if (!ok) return false;
+
+    setMasterClockSpeed(13); // 400kHz
+    setWaitForExternalSensorEnabled(true);
+
+    // Slave 0: read 6 bytes from the first data register (0x03 on both parts)
+    setSlaveAddress(0, 0x80 | address);
+    setSlaveRegister(0, 0x03);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV0_CTRL, 0x80 | 6);
+    if (type == MPU6050_MAG_AK8975) {
+        // Slave 1: write CNTL = single measurement after every read
+        setSlaveAddress(1, address);
+        setSlaveRegister(1, 0x0A);
+        setSlaveOutputByte(1, 0x01);
+        bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV1_CTRL, 0x80 | 1);
+    }
+    setI2CMasterModeEnabled(true);
+    magType = type;
+    return true;
+}
+/** Get the magnetometer attached with setMotion9Magnetometer().
+ * @return MPU6050_MAG_* type
+ */
+uint8_t MPU6050::getMotion9Magnetometer() {
+    return magType;
 }
+#endif
 /** Get raw 6-axis motion sensor readings (accel/gyro).
  * Retrieves all currently available motion sensor values.
  * @param ax 16-bit signed integer container for accelerometer X-axis value
@@ -1732,14 +1883,269 @@ void MPU6050::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, buffer);
-    *ax = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *ay = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *az = (((int16_t)buffer[4]) << 8) | buffer[5];
-    *gx = (((int16_t)buffer[8]) << 8) | buffer[9];
-    *gy = (((int16_t)buffer[10]) << 8) | buffer[11];
-    *gz = (((int16_t)buffer[12]) << 8) | buffer[13];
-}
+    bus -> readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, buffer);
+    *ax = I2CDEV_BE16(buffer);
+    *ay = I2CDEV_BE16(buffer + 2);
+    *az = I2CDEV_BE16(buffer + 4);
+    *gx = I2CDEV_BE16(buffer + 8);
+    *gy = I2CDEV_BE16(buffer + 10);
+    *gz = I2CDEV_BE16(buffer + 12);
+}
+
+#ifdef MPU6050_FEATURE_FIFO
+// structure-of-arrays FIFO blocks
+
+/** Queue accel+gyro samples in the FIFO for getMotion6Block().
+ * FIFO_EN is set to accel and X/Y/Z gyro in one write, so each record is
+ * ACCEL_XOUT_H..ACCEL_ZOUT_L followed by GYRO_XOUT_H..GYRO_ZOUT_L (12 bytes)
+ * at the configured sample rate. The FIFO is reset and enabled.
+ */
+void MPU6050::startMotionFIFO() {
+    bus -> writeByte(devAddr, MPU6050_RA_FIFO_EN, (1 << MPU6050_XG_FIFO_EN_BIT) | (1 << MPU6050_YG_FIFO_EN_BIT)
+        | (1 << MPU6050_ZG_FIFO_EN_BIT) | (1 << MPU6050_ACCEL_FIFO_EN_BIT));
+    resetFIFO();
+    setFIFOEnabled(true);
+}
+/** Drain whole accel+gyro FIFO records into per-axis arrays.
+ * FIFO_COUNT is read once, then records are read in bursts of up to
+ * MPU6050_MOTION_BLOCK_CHUNK through a stack buffer and unpacked with one
+ * straight loop per burst. If the FIFO has overflowed, record boundaries
+ * are lost, so it is reset and nothing is returned.
+ * @param block Destination arrays
+ * @param maxSamples Capacity of each destination array
+ * @return Number of samples stored
+ * @see startMotionFIFO()
+ */
+uint16_t MPU6050::getMotion6Block(MPU6050_MotionBlock *block, uint16_t maxSamples) {
+    uint8_t raw[MPU6050_MOTION_BLOCK_CHUNK * 12];
+    uint16_t count = getFIFOCount();
+    if (count >= MPU6050_FIFO_SIZE) {
+        resetFIFO();
+        return 0;
+    }
+    count /= 12;
+    if (count > maxSamples) count = maxSamples;
+    int16_t *ax = block -> ax, *ay = block -> ay, *az = block -> az;
+    int16_t *gx = block -> gx, *gy = block -> gy, *gz = block -> gz;
+    for (uint16_t i = 0; i < count; ) {
+        uint8_t n = count - i > MPU6050_MOTION_BLOCK_CHUNK ? MPU6050_MOTION_BLOCK_CHUNK : count - i;
+        if (bus -> readBlock(devAddr, MPU6050_RA_FIFO_R_W, (uint16_t)n * 12, raw) != (int16_t)n * 12) return i;
+        const uint8_t *b = raw;
+        for (uint8_t k = 0; k < n; k++, i++, b += 12) {
+            ax[i] = (((int16_t)b[0]) << 8) | b[1];
+            ay[i] = (((int16_t)b[2]) << 8) | b[3];
+            az[i] = (((int16_t)b[4]) << 8) | b[5];
+            gx[i] = (((int16_t)b[6]) << 8) | b[7];
+            gy[i] = (((int16_t)b[8]) << 8) | b[9];
+            gz[i] = (((int16_t)b[10]) << 8) | b[11];
+        }
+    }
+    return count;
+}
+#endif
+
+#ifdef MPU6050_FEATURE_STREAM
+// data-ready sample stream
+
+/** Start delivering every sample at the configured sample rate into a queue.
+ * Enables the DATA_RDY interrupt with the INT pin pulsing active high
+ * (50us, push-pull); wire it to an external interrupt whose handler calls
+ * notifyDataReady(). Each edge submits a 14-byte ACCEL_XOUT_H..GYRO_ZOUT_L
+ * burst (see I2CDEV_ISR_SUBMIT): with Fastwire and NBWire it runs in the
+ * background and the sample is queued from the TWI interrupt on completion;
+ * with Wire it is deferred until the transfer loop() has in progress ends,
+ * or until serviceMotionStream(). Elsewhere, or on a bus other than the
+ * default one, the edge is only recorded and serviceMotionStream() performs
+ * the read. Either way each sample is delivered once, stamped with the time
+ * of its data-ready edge.
+ * @param queue Initialized queue that receives samples
+ * @see MPU6050_SampleQueue
+ */
+void MPU6050::startMotionStream(MPU6050_SampleQueue *queue) {
+    streamQueue = queue;
+    streamPending = false;
+    streamTxn.devAddr = devAddr;
+    streamTxn.regAddr = MPU6050_RA_ACCEL_XOUT_H;
+    streamTxn.flags = I2CDEV_TXN_READ;
+    streamTxn.length = 14;
+    streamTxn.data = streamData;
+    streamTxn.callback = motionStreamDone;
+    streamTxn.context = this;
+    streamTxn.state = I2CDEV_TXN_IDLE;
+    setInterruptMode(false);
+    setInterruptDrive(false);
+    setInterruptLatch(false);
+    setIntEnabled(1 << MPU6050_INTERRUPT_DATA_RDY_BIT);
+    getIntStatus();
+}
+/** Stop the data-ready stream and disable the MPU's interrupt output. */
+void MPU6050::stopMotionStream() {
+    setIntEnabled(0);
+    streamQueue = 0;
+    streamPending = false;
+    #ifdef MPU6050_FEATURE_WAKE_ON_MOTION
+        wakeState = MPU6050_WAKE_OFF;
+    #endif
+}
+/** Data-ready edge handler; call from the INT pin's interrupt routine.
+ * An edge that arrives while the previous sample is still being read is
+ * counted in the queue's overruns counter rather than re-reading stale data.
+ */
+void MPU6050::notifyDataReady() {
+    if (!streamQueue) return;
+    uint32_t now = micros();
+    if (streamPending || streamTxn.state == I2CDEV_TXN_QUEUED || streamTxn.state == I2CDEV_TXN_ACTIVE) {
+        streamQueue -> overruns++;
+        return;
+    }
+    streamStamp = now;
+    #ifdef I2CDEV_ISR_SUBMIT
+        if (bus -> isDefault()) {
+            if (!I2Cdev::submitFromISR(&streamTxn)) streamQueue -> overruns++;
+            return;
+        }
+    #endif
+    streamPending = true;
+}
+/** Read a sample flagged by notifyDataReady() on the calling (main) context.
+ * With a deferred burst pending this runs it now; not needed when samples
+ * are read asynchronously with Fastwire or NBWire.
+ * @return Number of samples queued by this call (0 or 1)
+ */
+uint8_t MPU6050::serviceMotionStream() {
+    if (streamTxn.state == I2CDEV_TXN_QUEUED) {
+        I2Cdev::runDeferred();
+        return streamTxn.state == I2CDEV_TXN_DONE;
+    }
+    if (!streamPending || !streamQueue) return 0;
+    bool ok = bus -> readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, streamData) == 14;
+    if (ok) pushMotionSample();
+    streamPending = false;
+    return ok;
+}
+/** Completion callback for the asynchronous data-ready burst. */
+void MPU6050::motionStreamDone(I2Cdev_Transaction *txn) {
+    MPU6050 *mpu = (MPU6050 *)txn -> context;
+    if (txn -> state == I2CDEV_TXN_DONE && mpu -> streamQueue) mpu -> pushMotionSample();
+}
+/** Decode streamData and append it to the stream queue. */
+void MPU6050::pushMotionSample() {
+    MPU6050_Sample *sample = streamQueue -> reserve();
+    if (!sample) return;
+    sample -> ax = (((int16_t)streamData[0]) << 8) | streamData[1];
+    sample -> ay = (((int16_t)streamData[2]) << 8) | streamData[3];
+    sample -> az = (((int16_t)streamData[4]) << 8) | streamData[5];
+    sample -> gx = (((int16_t)streamData[8]) << 8) | streamData[9];
+    sample -> gy = (((int16_t)streamData[10]) << 8) | streamData[11];
+    sample -> gz = (((int16_t)streamData[12]) << 8) | streamData[13];
+    sample -> timestamp = streamStamp;
+    streamQueue -> commit();
+}
+#endif
+
+#ifdef MPU6050_FEATURE_WAKE_ON_MOTION
+// wake-on-motion pipeline
+
+/** Run the device in accel-only low-power cycle mode until it moves, then
+ * at full rate (accel+gyro FIFO, as startMotionFIFO()) until it has been
+ * still for stillDuration, then back down, and so on.
+ *
+ * Asleep, the gyros and temperature sensor are in standby and the accel
+ * wakes at wakeFrequency for one sample; the motion detector compares it
+ * against the reference held by the high-pass filter on entry, so motion
+ * means "moved away from where it was set down". The INT pin is set active
+ * low and latched until INT_STATUS is read: an AVR INT0/INT1 LOW level or
+ * pin change interrupt can wake the host from SLEEP_MODE_PWR_DOWN on it.
+ * Awake, the INT pin reports zero-motion changes.
+ *
+ * Call serviceWakeOnMotion() after each INT edge (or periodically) to move
+ * between the two states; sample rate, DLPF and ranges are left as set.
+ * The gyros need ~30ms after each wake to settle, and nothing from before
+ * the motion event is kept.
+ * @param motionThreshold MOT_THR in 2mg LSBs that wakes the device
+ * @param motionDuration MOT_DUR in wake-up samples (1 = the first one over)
+ * @param stillThreshold ZRMOT_THR in 2mg LSBs under which it counts as still
+ * @param stillDuration ZRMOT_DUR in 64ms LSBs of stillness before sleeping again
+ * @param wakeFrequency MPU6050_WAKE_FREQ_* accel sampling rate while asleep
+ */
+void MPU6050::startWakeOnMotion(uint8_t motionThreshold, uint8_t motionDuration, uint8_t stillThreshold,
+        uint8_t stillDuration, uint8_t wakeFrequency) {
+    wakeMotionThreshold = motionThreshold;
+    wakeMotionDuration = motionDuration;
+    wakeStillThreshold = stillThreshold;
+    wakeStillDuration = stillDuration;
+    this -> wakeFrequency = wakeFrequency;
+    setInterruptMode(MPU6050_INTMODE_ACTIVELOW);
+    setInterruptDrive(MPU6050_INTDRV_PUSHPULL);
+    setInterruptLatch(MPU6050_INTLATCH_WAITCLEAR);
+    setInterruptLatchClear(MPU6050_INTCLEAR_STATUSREAD);
+    enterWakeSleeping();
+}
+
+/** Leave the pipeline at full rate with the FIFO running and its
+ * interrupts disabled.
+ */
+void MPU6050::stopWakeOnMotion() {
+    if (wakeState == MPU6050_WAKE_SLEEPING) enterWakeActive();
+    setIntEnabled(0);
+    wakeState = MPU6050_WAKE_OFF;
+}
+
+/** Read (and so clear) INT_STATUS and change state on a motion or
+ * zero-motion event. One register read when nothing has happened.
+ * @return MPU6050_WAKE_* state after servicing; compare with the previous
+ *         value to spot a wake-up (start draining the FIFO) or a sleep
+ */
+uint8_t MPU6050::serviceWakeOnMotion() {
+    if (wakeState == MPU6050_WAKE_OFF) return wakeState;
+    uint8_t status = getIntStatus();
+    if (wakeState == MPU6050_WAKE_SLEEPING) {
+        if (status & (1 << MPU6050_INTERRUPT_MOT_BIT)) enterWakeActive();
+    } else if ((status & (1 << MPU6050_INTERRUPT_ZMOT_BIT)) && getZeroMotionDetected()) {
+        // ZMOT fires when stillness starts and when it ends; only the start counts
+        enterWakeSleeping();
+    }
+    return wakeState;
+}
+
+/** Get the wake-on-motion pipeline state.
+ * @return MPU6050_WAKE_OFF, MPU6050_WAKE_SLEEPING or MPU6050_WAKE_ACTIVE
+ */
+uint8_t MPU6050::getWakeState() {
+    return wakeState;
+}
+
+void MPU6050::enterWakeSleeping() {
+    setFIFOEnabled(false);
+    bus -> writeByte(devAddr, MPU6050_RA_FIFO_EN, 0);
+    setIntEnabled(1 << MPU6050_INTERRUPT_MOT_BIT);
+    setMotionDetectionThreshold(wakeMotionThreshold);
+    setMotionDetectionDuration(wakeMotionDuration);
+    // hold the current sample as the reference motion is measured against
+    setDHPFMode(MPU6050_DHPF_HOLD);
+    // one write each, so the device never runs half configured: gyros and
+    // temperature off, accel cycling on the internal oscillator
+    bus -> writeByte(devAddr, MPU6050_RA_PWR_MGMT_2, (wakeFrequency << (MPU6050_PWR2_LP_WAKE_CTRL_BIT - MPU6050_PWR2_LP_WAKE_CTRL_LENGTH + 1))
+        | (1 << MPU6050_PWR2_STBY_XG_BIT) | (1 << MPU6050_PWR2_STBY_YG_BIT) | (1 << MPU6050_PWR2_STBY_ZG_BIT));
+    bus -> writeByte(devAddr, MPU6050_RA_PWR_MGMT_1, (1 << MPU6050_PWR1_CYCLE_BIT) | (1 << MPU6050_PWR1_TEMP_DIS_BIT)
+        | MPU6050_CLOCK_INTERNAL);
+    getIntStatus(); // drop any event latched on the way down
+    wakeState = MPU6050_WAKE_SLEEPING;
+}
+
+void MPU6050::enterWakeActive() {
+    bus -> writeByte(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_CLOCK_PLL_XGYRO);
+    bus -> writeByte(devAddr, MPU6050_RA_PWR_MGMT_2, 0);
+    // zero-motion detection needs a running high-pass filter
+    setDHPFMode(MPU6050_DHPF_5);
+    setZeroMotionDetectionThreshold(wakeStillThreshold);
+    setZeroMotionDetectionDuration(wakeStillDuration);
+    setIntEnabled(1 << MPU6050_INTERRUPT_ZMOT_BIT);
+    startMotionFIFO();
+    wakeState = MPU6050_WAKE_ACTIVE;
+}
+#endif
+
 /** Get 3-axis accelerometer readings.
  * These registers store the most recent accelerometer measurements.
  * Accelerometer measurements are written to these registers at the Sample Rate
@@ -1777,10 +2183,10 @@ void MPU6050::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, buffer);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    bus -> readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, buffer);
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 2);
+    *z = I2CDEV_BE16(buffer + 4);
 }
 /** Get X-axis accelerometer reading.
  * @return X-axis acceleration measurement in 16-bit 2's complement format
@@ -1788,8 +2194,8 @@ void MPU6050::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 int16_t MPU6050::getAccelerationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 /** Get Y-axis accelerometer reading.
  * @return Y-axis acceleration measurement in 16-bit 2's complement format
@@ -1797,8 +2203,8 @@ int16_t MPU6050::getAccelerationX() {
  * @see MPU6050_RA_ACCEL_YOUT_H
  */
 int16_t MPU6050::getAccelerationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 /** Get Z-axis accelerometer reading.
  * @return Z-axis acceleration measurement in 16-bit 2's complement format
@@ -1806,8 +2212,8 @@ int16_t MPU6050::getAccelerationY() {
  * @see MPU6050_RA_ACCEL_ZOUT_H
  */
 int16_t MPU6050::getAccelerationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 
 // TEMP_OUT_* registers
@@ -1817,8 +2223,8 @@ int16_t MPU6050::getAccelerationZ() {
  * @see MPU6050_RA_TEMP_OUT_H
  */
 int16_t MPU6050::getTemperature() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 
 // GYRO_*OUT_* registers
@@ -1856,10 +2262,10 @@ int16_t MPU6050::getTemperature() {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050::getRotation(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, buffer);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    bus -> readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, buffer);
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 2);
+    *z = I2CDEV_BE16(buffer + 4);
 }
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
@@ -1867,8 +2273,8 @@ void MPU6050::getRotation(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 int16_t MPU6050::getRotationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 /** Get Y-axis gyroscope reading.
  * @return Y-axis rotation measurement in 16-bit 2's complement format
@@ -1876,8 +2282,8 @@ int16_t MPU6050::getRotationX() {
  * @see MPU6050_RA_GYRO_YOUT_H
  */
 int16_t MPU6050::getRotationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 /** Get Z-axis gyroscope reading.
  * @return Z-axis rotation measurement in 16-bit 2's complement format
@@ -1885,10 +2291,11 @@ int16_t MPU6050::getRotationY() {
  * @see MPU6050_RA_GYRO_ZOUT_H
  */
 int16_t MPU6050::getRotationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 
+#ifdef MPU6050_FEATURE_AUX_MASTER
 // EXT_SENS_DATA_* registers
 
 /** Read single byte from external sensor data register.
@@ -1966,7 +2373,7 @@ int16_t MPU6050::getRotationZ() {
  * @return Byte read from register
  */
 uint8_t MPU6050::getExternalSensorByte(int position) {
-    I2Cdev::readByte(devAddr, MPU6050_RA_EXT_SENS_DATA_00 + position, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_EXT_SENS_DATA_00 + position, buffer);
     return buffer[0];
 }
 /** Read word (2 bytes) from external sensor data registers.
@@ -1975,7 +2382,7 @@ uint8_t MPU6050::getExternalSensorByte(int position) {
  * @see getExternalSensorByte()
  */
 uint16_t MPU6050::getExternalSensorWord(int position) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_EXT_SENS_DATA_00 + position, 2, buffer);
+    bus -> readBytes(devAddr, MPU6050_RA_EXT_SENS_DATA_00 + position, 2, buffer);
     return (((uint16_t)buffer[0]) << 8) | buffer[1];
 }
 /** Read double word (4 bytes) from external sensor data registers.
@@ -1984,10 +2391,12 @@ uint16_t MPU6050::getExternalSensorWord(int position) {
  * @see getExternalSensorByte()
  */
 uint32_t MPU6050::getExternalSensorDWord(int position) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_EXT_SENS_DATA_00 + position, 4, buffer);
+    bus -> readBytes(devAddr, MPU6050_RA_EXT_SENS_DATA_00 + position, 4, buffer);
     return (((uint32_t)buffer[0]) << 24) | (((uint32_t)buffer[1]) << 16) | (((uint16_t)buffer[2]) << 8) | buffer[3];
 }
+#endif
 
+#ifdef MPU6050_FEATURE_MOTION_DETECT
 // MOT_DETECT_STATUS register
 
 /** Get X-axis negative motion detection interrupt status.
@@ -1996,7 +2405,7 @@ uint32_t MPU6050::getExternalSensorDWord(int position) {
  * @see MPU6050_MOTION_MOT_XNEG_BIT
  */
 bool MPU6050::getXNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XNEG_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XNEG_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get X-axis positive motion detection interrupt status.
@@ -2005,7 +2414,7 @@ bool MPU6050::getXNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_XPOS_BIT
  */
 bool MPU6050::getXPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XPOS_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XPOS_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Y-axis negative motion detection interrupt status.
@@ -2014,7 +2423,7 @@ bool MPU6050::getXPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_YNEG_BIT
  */
 bool MPU6050::getYNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YNEG_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YNEG_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Y-axis positive motion detection interrupt status.
@@ -2023,7 +2432,7 @@ bool MPU6050::getYNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_YPOS_BIT
  */
 bool MPU6050::getYPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YPOS_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YPOS_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Z-axis negative motion detection interrupt status.
@@ -2032,7 +2441,7 @@ bool MPU6050::getYPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZNEG_BIT
  */
 bool MPU6050::getZNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZNEG_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZNEG_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get Z-axis positive motion detection interrupt status.
@@ -2041,7 +2450,7 @@ bool MPU6050::getZNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZPOS_BIT
  */
 bool MPU6050::getZPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZPOS_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZPOS_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Get zero motion detection interrupt status.
@@ -2050,10 +2459,12 @@ bool MPU6050::getZPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZRMOT_BIT
  */
 bool MPU6050::getZeroMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZRMOT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZRMOT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
+#endif
 
+#ifdef MPU6050_FEATURE_AUX_MASTER
 // I2C_SLV*_DO register
 
 /** Write byte to Data Output container for specified slave.
@@ -2066,7 +2477,7 @@ bool MPU6050::getZeroMotionDetected() {
  */
 void MPU6050::setSlaveOutputByte(uint8_t num, uint8_t data) {
     if (num > 3) return;
-    I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV0_DO + num, data);
+    bus -> writeByte(devAddr, MPU6050_RA_I2C_SLV0_DO + num, data);
 }
 
 // I2C_MST_DELAY_CTRL register
@@ -2080,7 +2491,7 @@ void MPU6050::setSlaveOutputByte(uint8_t num, uint8_t data) {
  * @see MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT
  */
 bool MPU6050::getExternalShadowDelayEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set external data shadow delay enabled status.
@@ -2090,7 +2501,7 @@ bool MPU6050::getExternalShadowDelayEnabled() {
  * @see MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT
  */
 void MPU6050::setExternalShadowDelayEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT> >(devAddr, enabled);
 }
 /** Get slave delay enabled status.
  * When a particular slave delay is enabled, the rate of access for the that
@@ -2113,7 +2524,7 @@ void MPU6050::setExternalShadowDelayEnabled(bool enabled) {
 bool MPU6050::getSlaveDelayEnabled(uint8_t num) {
     // MPU6050_DELAYCTRL_I2C_SLV4_DLY_EN_BIT is 4, SLV3 is 3, etc.
     if (num > 4) return 0;
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, num, buffer);
+    bus -> readBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, num, buffer);
     return buffer[0];
 }
 /** Set slave delay enabled status.
@@ -2123,8 +2534,9 @@ bool MPU6050::getSlaveDelayEnabled(uint8_t num) {
  * @see MPU6050_DELAYCTRL_I2C_SLV0_DLY_EN_BIT
  */
 void MPU6050::setSlaveDelayEnabled(uint8_t num, bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, num, enabled);
+    bus -> writeBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, num, enabled);
 }
+#endif
 
 // SIGNAL_PATH_RESET register
 
@@ -2135,7 +2547,7 @@ void MPU6050::setSlaveDelayEnabled(uint8_t num, bool enabled) {
  * @see MPU6050_PATHRESET_GYRO_RESET_BIT
  */
 void MPU6050::resetGyroscopePath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_GYRO_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_GYRO_RESET_BIT> >(devAddr, true);
 }
 /** Reset accelerometer signal path.
  * The reset will revert the signal path analog to digital converters and
@@ -2144,7 +2556,7 @@ void MPU6050::resetGyroscopePath() {
  * @see MPU6050_PATHRESET_ACCEL_RESET_BIT
  */
 void MPU6050::resetAccelerometerPath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_ACCEL_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_ACCEL_RESET_BIT> >(devAddr, true);
 }
 /** Reset temperature sensor signal path.
  * The reset will revert the signal path analog to digital converters and
@@ -2153,9 +2565,10 @@ void MPU6050::resetAccelerometerPath() {
  * @see MPU6050_PATHRESET_TEMP_RESET_BIT
  */
 void MPU6050::resetTemperaturePath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_TEMP_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_TEMP_RESET_BIT> >(devAddr, true);
 }
 
+#ifdef MPU6050_FEATURE_MOTION_DETECT
 // MOT_DETECT_CTRL register
 
 /** Get accelerometer power-on delay.
@@ -2173,7 +2586,7 @@ void MPU6050::resetTemperaturePath() {
  * @see MPU6050_DETECT_ACCEL_ON_DELAY_BIT
  */
 uint8_t MPU6050::getAccelerometerPowerOnDelay() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set accelerometer power-on delay.
@@ -2183,7 +2596,7 @@ uint8_t MPU6050::getAccelerometerPowerOnDelay() {
  * @see MPU6050_DETECT_ACCEL_ON_DELAY_BIT
  */
 void MPU6050::setAccelerometerPowerOnDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH, delay);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH> >(devAddr, delay);
 }
 /** Get Free Fall detection counter decrement configuration.
  * Detection is registered by the Free Fall detection module after accelerometer
@@ -2212,7 +2625,7 @@ void MPU6050::setAccelerometerPowerOnDelay(uint8_t delay) {
  * @see MPU6050_DETECT_FF_COUNT_BIT
  */
 uint8_t MPU6050::getFreefallDetectionCounterDecrement() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Free Fall detection counter decrement configuration.
@@ -2222,7 +2635,7 @@ uint8_t MPU6050::getFreefallDetectionCounterDecrement() {
  * @see MPU6050_DETECT_FF_COUNT_BIT
  */
 void MPU6050::setFreefallDetectionCounterDecrement(uint8_t decrement) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH, decrement);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH> >(devAddr, decrement);
 }
 /** Get Motion detection counter decrement configuration.
  * Detection is registered by the Motion detection module after accelerometer
@@ -2248,7 +2661,7 @@ void MPU6050::setFreefallDetectionCounterDecrement(uint8_t decrement) {
  *
  */
 uint8_t MPU6050::getMotionDetectionCounterDecrement() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Motion detection counter decrement configuration.
@@ -2258,8 +2671,9 @@ uint8_t MPU6050::getMotionDetectionCounterDecrement() {
  * @see MPU6050_DETECT_MOT_COUNT_BIT
  */
 void MPU6050::setMotionDetectionCounterDecrement(uint8_t decrement) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, decrement);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH> >(devAddr, decrement);
 }
+#endif
 
 // USER_CTRL register
 
@@ -2272,7 +2686,7 @@ void MPU6050::setMotionDetectionCounterDecrement(uint8_t decrement) {
  * @see MPU6050_USERCTRL_FIFO_EN_BIT
  */
 bool MPU6050::getFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set FIFO enabled status.
@@ -2282,7 +2696,7 @@ bool MPU6050::getFIFOEnabled() {
  * @see MPU6050_USERCTRL_FIFO_EN_BIT
  */
 void MPU6050::setFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT> >(devAddr, enabled);
 }
 /** Get I2C Master Mode enabled status.
  * When this mode is enabled, the MPU-60X0 acts as the I2C Master to the
@@ -2296,7 +2710,7 @@ void MPU6050::setFIFOEnabled(bool enabled) {
  * @see MPU6050_USERCTRL_I2C_MST_EN_BIT
  */
 bool MPU6050::getI2CMasterModeEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set I2C Master Mode enabled status.
@@ -2306,14 +2720,14 @@ bool MPU6050::getI2CMasterModeEnabled() {
  * @see MPU6050_USERCTRL_I2C_MST_EN_BIT
  */
 void MPU6050::setI2CMasterModeEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT> >(devAddr, enabled);
 }
 /** Switch from I2C to SPI mode (MPU-6000 only)
  * If this is set, the primary SPI interface will be enabled in place of the
  * disabled primary I2C interface.
  */
 void MPU6050::switchSPIEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_IF_DIS_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_IF_DIS_BIT> >(devAddr, enabled);
 }
 /** Reset the FIFO.
  * This bit resets the FIFO buffer when set to 1 while FIFO_EN equals 0. This
@@ -2322,7 +2736,10 @@ void MPU6050::switchSPIEnabled(bool enabled) {
  * @see MPU6050_USERCTRL_FIFO_RESET_BIT
  */
 void MPU6050::resetFIFO() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT> >(devAddr, true);
+    #ifdef I2CDEV_REGISTER_CACHE
+        I2Cdev::invalidateCache(devAddr, MPU6050_RA_USER_CTRL, 1); // bit self-clears
+    #endif
 }
 /** Reset the I2C Master.
  * This bit resets the I2C Master when set to 1 while I2C_MST_EN equals 0.
@@ -2331,7 +2748,10 @@ void MPU6050::resetFIFO() {
  * @see MPU6050_USERCTRL_I2C_MST_RESET_BIT
  */
 void MPU6050::resetI2CMaster() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_RESET_BIT> >(devAddr, true);
+    #ifdef I2CDEV_REGISTER_CACHE
+        I2Cdev::invalidateCache(devAddr, MPU6050_RA_USER_CTRL, 1); // bit self-clears
+    #endif
 }
 /** Reset all sensor registers and signal paths.
  * When set to 1, this bit resets the signal paths for all sensors (gyroscopes,
@@ -2346,7 +2766,10 @@ void MPU6050::resetI2CMaster() {
  * @see MPU6050_USERCTRL_SIG_COND_RESET_BIT
  */
 void MPU6050::resetSensors() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_SIG_COND_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_SIG_COND_RESET_BIT> >(devAddr, true);
+    #ifdef I2CDEV_REGISTER_CACHE
+        I2Cdev::invalidateCache(devAddr, MPU6050_RA_USER_CTRL, 1); // bit self-clears
+    #endif
 }
 
 // PWR_MGMT_1 register
@@ -2357,7 +2780,10 @@ void MPU6050::resetSensors() {
  * @see MPU6050_PWR1_DEVICE_RESET_BIT
  */
 void MPU6050::reset() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT> >(devAddr, true);
+    #ifdef I2CDEV_REGISTER_CACHE
+        I2Cdev::invalidateCache(devAddr); // every register returns to its default
+    #endif
 }
 /** Get sleep mode status.
  * Setting the SLEEP bit in the register puts the device into very low power
@@ -2371,7 +2797,7 @@ void MPU6050::reset() {
  * @see MPU6050_PWR1_SLEEP_BIT
  */
 bool MPU6050::getSleepEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set sleep mode status.
@@ -2381,7 +2807,7 @@ bool MPU6050::getSleepEnabled() {
  * @see MPU6050_PWR1_SLEEP_BIT
  */
 void MPU6050::setSleepEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT> >(devAddr, enabled);
 }
 /** Get wake cycle enabled status.
  * When this bit is set to 1 and SLEEP is disabled, the MPU-60X0 will cycle
@@ -2392,7 +2818,7 @@ void MPU6050::setSleepEnabled(bool enabled) {
  * @see MPU6050_PWR1_CYCLE_BIT
  */
 bool MPU6050::getWakeCycleEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set wake cycle enabled status.
@@ -2402,7 +2828,7 @@ bool MPU6050::getWakeCycleEnabled() {
  * @see MPU6050_PWR1_CYCLE_BIT
  */
 void MPU6050::setWakeCycleEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT> >(devAddr, enabled);
 }
 /** Get temperature sensor enabled status.
  * Control the usage of the internal temperature sensor.
@@ -2416,7 +2842,7 @@ void MPU6050::setWakeCycleEnabled(bool enabled) {
  * @see MPU6050_PWR1_TEMP_DIS_BIT
  */
 bool MPU6050::getTempSensorEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT> >(devAddr, buffer);
     return buffer[0] == 0; // 1 is actually disabled here
 }
 /** Set temperature sensor enabled status.
@@ -2431,7 +2857,7 @@ bool MPU6050::getTempSensorEnabled() {
  */
 void MPU6050::setTempSensorEnabled(bool enabled) {
     // 1 is actually disabled here
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT, !enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT> >(devAddr, !enabled);
 }
 /** Get clock source setting.
  * @return Current clock source setting
@@ -2440,7 +2866,7 @@ void MPU6050::setTempSensorEnabled(bool enabled) {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 uint8_t MPU6050::getClockSource() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set clock source setting.
@@ -2474,7 +2900,7 @@ uint8_t MPU6050::getClockSource() {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 void MPU6050::setClockSource(uint8_t source) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, source);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH> >(devAddr, source);
 }
 
 // PWR_MGMT_2 register
@@ -2503,7 +2929,7 @@ void MPU6050::setClockSource(uint8_t source) {
  * @see MPU6050_RA_PWR_MGMT_2
  */
 uint8_t MPU6050::getWakeFrequency() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set wake frequency in Accel-Only Low Power Mode.
@@ -2511,7 +2937,7 @@ uint8_t MPU6050::getWakeFrequency() {
  * @see MPU6050_RA_PWR_MGMT_2
  */
 void MPU6050::setWakeFrequency(uint8_t frequency) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH, frequency);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH> >(devAddr, frequency);
 }
 
 /** Get X-axis accelerometer standby enabled status.
@@ -2521,7 +2947,7 @@ void MPU6050::setWakeFrequency(uint8_t frequency) {
  * @see MPU6050_PWR2_STBY_XA_BIT
  */
 bool MPU6050::getStandbyXAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set X-axis accelerometer standby enabled status.
@@ -2531,7 +2957,7 @@ bool MPU6050::getStandbyXAccelEnabled() {
  * @see MPU6050_PWR2_STBY_XA_BIT
  */
 void MPU6050::setStandbyXAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT> >(devAddr, enabled);
 }
 /** Get Y-axis accelerometer standby enabled status.
  * If enabled, the Y-axis will not gather or report data (or use power).
@@ -2540,7 +2966,7 @@ void MPU6050::setStandbyXAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_YA_BIT
  */
 bool MPU6050::getStandbyYAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Y-axis accelerometer standby enabled status.
@@ -2550,7 +2976,7 @@ bool MPU6050::getStandbyYAccelEnabled() {
  * @see MPU6050_PWR2_STBY_YA_BIT
  */
 void MPU6050::setStandbyYAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT> >(devAddr, enabled);
 }
 /** Get Z-axis accelerometer standby enabled status.
  * If enabled, the Z-axis will not gather or report data (or use power).
@@ -2559,7 +2985,7 @@ void MPU6050::setStandbyYAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_ZA_BIT
  */
 bool MPU6050::getStandbyZAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Z-axis accelerometer standby enabled status.
@@ -2569,7 +2995,7 @@ bool MPU6050::getStandbyZAccelEnabled() {
  * @see MPU6050_PWR2_STBY_ZA_BIT
  */
 void MPU6050::setStandbyZAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT> >(devAddr, enabled);
 }
 /** Get X-axis gyroscope standby enabled status.
  * If enabled, the X-axis will not gather or report data (or use power).
@@ -2578,7 +3004,7 @@ void MPU6050::setStandbyZAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_XG_BIT
  */
 bool MPU6050::getStandbyXGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set X-axis gyroscope standby enabled status.
@@ -2588,7 +3014,7 @@ bool MPU6050::getStandbyXGyroEnabled() {
  * @see MPU6050_PWR2_STBY_XG_BIT
  */
 void MPU6050::setStandbyXGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT> >(devAddr, enabled);
 }
 /** Get Y-axis gyroscope standby enabled status.
  * If enabled, the Y-axis will not gather or report data (or use power).
@@ -2597,7 +3023,7 @@ void MPU6050::setStandbyXGyroEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_YG_BIT
  */
 bool MPU6050::getStandbyYGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Y-axis gyroscope standby enabled status.
@@ -2607,7 +3033,7 @@ bool MPU6050::getStandbyYGyroEnabled() {
  * @see MPU6050_PWR2_STBY_YG_BIT
  */
 void MPU6050::setStandbyYGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT> >(devAddr, enabled);
 }
 /** Get Z-axis gyroscope standby enabled status.
  * If enabled, the Z-axis will not gather or report data (or use power).
@@ -2616,7 +3042,7 @@ void MPU6050::setStandbyYGyroEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_ZG_BIT
  */
 bool MPU6050::getStandbyZGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Z-axis gyroscope standby enabled status.
@@ -2626,9 +3052,10 @@ bool MPU6050::getStandbyZGyroEnabled() {
  * @see MPU6050_PWR2_STBY_ZG_BIT
  */
 void MPU6050::setStandbyZGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT> >(devAddr, enabled);
 }
 
+#ifdef MPU6050_FEATURE_FIFO
 // FIFO_COUNT* registers
 
 /** Get current FIFO buffer size.
@@ -2639,7 +3066,7 @@ void MPU6050::setStandbyZGyroEnabled(bool enabled) {
  * @return Current FIFO buffer size
  */
 uint16_t MPU6050::getFIFOCount() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, buffer);
+    bus -> readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, buffer);
     return (((uint16_t)buffer[0]) << 8) | buffer[1];
 }
 
@@ -2671,19 +3098,34 @@ uint16_t MPU6050::getFIFOCount() {
  * @return Byte from FIFO buffer
  */
 uint8_t MPU6050::getFIFOByte() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_FIFO_R_W, buffer);
     return buffer[0];
 }
-void MPU6050::getFIFOBytes(uint8_t *data, uint8_t length) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_R_W, length, data);
+void MPU6050::getFIFOBytes(uint8_t *data, uint16_t length) {
+    bus -> readBlock(devAddr, MPU6050_RA_FIFO_R_W, length, data);
+}
+/** Read and throw away FIFO bytes, e.g. to flush a FIFO_COUNT worth of
+ * stale data, through a MPU6050_FIFO_DISCARD_CHUNK stack buffer rather than
+ * a caller array sized for the worst case (up to MPU6050_FIFO_SIZE bytes).
+ * @param length Number of bytes to discard
+ * @see getFIFOBytes()
+ */
+void MPU6050::discardFIFOBytes(uint16_t length) {
+    uint8_t chunk[MPU6050_FIFO_DISCARD_CHUNK];
+    while (length > 0) {
+        uint8_t n = length < sizeof(chunk) ? length : sizeof(chunk);
+        bus -> readBytes(devAddr, MPU6050_RA_FIFO_R_W, n, chunk);
+        length -= n;
+    }
 }
 /** Write byte to FIFO buffer.
  * @see getFIFOByte()
  * @see MPU6050_RA_FIFO_R_W
  */
 void MPU6050::setFIFOByte(uint8_t data) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_R_W, data);
+    bus -> writeByte(devAddr, MPU6050_RA_FIFO_R_W, data);
 }
+#endif
 
 // WHO_AM_I register
 
@@ -2695,7 +3137,7 @@ void MPU6050::setFIFOByte(uint8_t data) {
  * @see MPU6050_WHO_AM_I_LENGTH
  */
 uint8_t MPU6050::getDeviceID() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 /** Set Device ID.
@@ -2708,204 +3150,323 @@ uint8_t MPU6050::getDeviceID() {
  * @see MPU6050_WHO_AM_I_LENGTH
  */
 void MPU6050::setDeviceID(uint8_t id) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH> >(devAddr, id);
 }
 
 // ======== UNDOCUMENTED/DMP REGISTERS/METHODS ========
 
+#ifdef MPU6050_FEATURE_OFFSETS
 // XG_OFFS_TC register
 
 uint8_t MPU6050::getOTPBankValid() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setOTPBankValid(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT> >(devAddr, enabled);
 }
 int8_t MPU6050::getXGyroOffsetTC() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setXGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH> >(devAddr, offset);
 }
 
 // YG_OFFS_TC register
 
 int8_t MPU6050::getYGyroOffsetTC() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setYGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH> >(devAddr, offset);
 }
 
 // ZG_OFFS_TC register
 
 int8_t MPU6050::getZGyroOffsetTC() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer);
+    bus -> readField<I2Cdev_Field<MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH> >(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setZGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset);
+    bus -> writeField<I2Cdev_Field<MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH> >(devAddr, offset);
 }
 
 // X_FINE_GAIN register
 
 int8_t MPU6050::getXFineGain() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_X_FINE_GAIN, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_X_FINE_GAIN, buffer);
     return buffer[0];
 }
 void MPU6050::setXFineGain(int8_t gain) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_X_FINE_GAIN, gain);
+    bus -> writeByte(devAddr, MPU6050_RA_X_FINE_GAIN, gain);
 }
 
 // Y_FINE_GAIN register
 
 int8_t MPU6050::getYFineGain() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_Y_FINE_GAIN, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_Y_FINE_GAIN, buffer);
     return buffer[0];
 }
 void MPU6050::setYFineGain(int8_t gain) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_Y_FINE_GAIN, gain);
+    bus -> writeByte(devAddr, MPU6050_RA_Y_FINE_GAIN, gain);
 }
 
 // Z_FINE_GAIN register
 
 int8_t MPU6050::getZFineGain() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_Z_FINE_GAIN, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_Z_FINE_GAIN, buffer);
     return buffer[0];
 }
 void MPU6050::setZFineGain(int8_t gain) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_Z_FINE_GAIN, gain);
+    bus -> writeByte(devAddr, MPU6050_RA_Z_FINE_GAIN, gain);
 }
 
 // XA_OFFS_* registers
 
 int16_t MPU6050::getXAccelOffset() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_XA_OFFS_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_XA_OFFS_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 void MPU6050::setXAccelOffset(int16_t offset) {
-    I2Cdev::writeWord(devAddr, MPU6050_RA_XA_OFFS_H, offset);
+    bus -> writeWord(devAddr, MPU6050_RA_XA_OFFS_H, offset);
 }
 
 // YA_OFFS_* register
 
 int16_t MPU6050::getYAccelOffset() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_YA_OFFS_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_YA_OFFS_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 void MPU6050::setYAccelOffset(int16_t offset) {
-    I2Cdev::writeWord(devAddr, MPU6050_RA_YA_OFFS_H, offset);
+    bus -> writeWord(devAddr, MPU6050_RA_YA_OFFS_H, offset);
 }
 
 // ZA_OFFS_* register
 
 int16_t MPU6050::getZAccelOffset() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ZA_OFFS_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_ZA_OFFS_H, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 void MPU6050::setZAccelOffset(int16_t offset) {
-    I2Cdev::writeWord(devAddr, MPU6050_RA_ZA_OFFS_H, offset);
+    bus -> writeWord(devAddr, MPU6050_RA_ZA_OFFS_H, offset);
 }
 
 // XG_OFFS_USR* registers
 
 int16_t MPU6050::getXGyroOffset() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 void MPU6050::setXGyroOffset(int16_t offset) {
-    I2Cdev::writeWord(devAddr, MPU6050_RA_XG_OFFS_USRH, offset);
+    bus -> writeWord(devAddr, MPU6050_RA_XG_OFFS_USRH, offset);
 }
 
 // YG_OFFS_USR* register
 
 int16_t MPU6050::getYGyroOffset() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_YG_OFFS_USRH, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_YG_OFFS_USRH, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 void MPU6050::setYGyroOffset(int16_t offset) {
-    I2Cdev::writeWord(devAddr, MPU6050_RA_YG_OFFS_USRH, offset);
+    bus -> writeWord(devAddr, MPU6050_RA_YG_OFFS_USRH, offset);
 }
 
 // ZG_OFFS_USR* register
 
 int16_t MPU6050::getZGyroOffset() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ZG_OFFS_USRH, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    bus -> readBytes(devAddr, MPU6050_RA_ZG_OFFS_USRH, 2, buffer);
+    return I2CDEV_BE16(buffer);
 }
 void MPU6050::setZGyroOffset(int16_t offset) {
-    I2Cdev::writeWord(devAddr, MPU6050_RA_ZG_OFFS_USRH, offset);
+    bus -> writeWord(devAddr, MPU6050_RA_ZG_OFFS_USRH, offset);
+}
+
+// offset calibration
+
+/** Read all six accel/gyro offset registers.
+ * Two 6-byte bursts, XA_OFFS_H..ZA_OFFS_L_TC and XG_OFFS_USRH..ZG_OFFS_USRL.
+ * @param cal Calibration container to fill
+ * @see setCalibration()
+ */
+void MPU6050::getCalibration(MPU6050_Calibration *cal) {
+    bus -> readBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, buffer);
+    bus -> readBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, buffer + 6);
+    for (uint8_t i = 0; i < 3; i++) {
+        cal -> accelOffset[i] = (((int16_t)buffer[i*2]) << 8) | buffer[i*2 + 1];
+        cal -> gyroOffset[i] = (((int16_t)buffer[i*2 + 6]) << 8) | buffer[i*2 + 7];
+    }
+}
+/** Restore all six accel/gyro offset registers.
+ * Two 6-byte burst writes instead of six word writes, so a stored calibration
+ * (e.g. from EEPROM) is applied in a couple of bus transactions at boot.
+ * @param cal Calibration to apply, as produced by getCalibration()/calibrate()
+ */
+void MPU6050::setCalibration(const MPU6050_Calibration *cal) {
+    uint8_t data[12];
+    for (uint8_t i = 0; i < 3; i++) {
+        data[i*2] = cal -> accelOffset[i] >> 8;
+        data[i*2 + 1] = cal -> accelOffset[i];
+        data[i*2 + 6] = cal -> gyroOffset[i] >> 8;
+        data[i*2 + 7] = cal -> gyroOffset[i];
+    }
+    bus -> writeBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data);
+    bus -> writeBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data + 6);
+}
+#ifdef MPU6050_FEATURE_FIFO
+/** Compute accel/gyro offsets for a stationary, Z-up device.
+ * Each round collects one FIFO burst of accel+gyro records at 1kHz, averages
+ * it, and corrects the offsets so the average reads (0, 0, +1g) and zero
+ * rotation. Rounds stop early once every axis is within
+ * MPU6050_CALIBRATION_*_TOLERANCE. Sample rate, DLPF, full-scale ranges and
+ * FIFO configuration are restored afterwards; the FIFO is left reset.
+ * @param cal Calibration container; receives the final offsets, which are
+ *        also left applied to the device
+ * @param rounds Maximum number of averaging rounds
+ * @return True if the offsets converged within tolerance
+ */
+bool MPU6050::calibrate(MPU6050_Calibration *cal, uint8_t rounds) {
+    uint8_t rate = getRate();
+    uint8_t dlpf = getDLPFMode();
+    uint8_t gyroRange = getFullScaleGyroRange();
+    uint8_t accelRange = getFullScaleAccelRange();
+    bool fifoEnabled = getFIFOEnabled();
+    uint8_t fifoSources;
+    bus -> readByte(devAddr, MPU6050_RA_FIFO_EN, &fifoSources);
+
+    setRate(0);
+    setDLPFMode(MPU6050_DLPF_BW_188);
+    setFullScaleGyroRange(MPU6050_GYRO_FS_250);
+    setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
+    delay(MPU6050_CALIBRATION_BURST_MS); // let the filters settle on the new ranges
+
+    getCalibration(cal);
+    bool settled = false;
+    for (uint8_t round = 0; round < rounds && !settled; round++) {
+        int32_t sums[6];
+        uint16_t samples = getCalibrationBurst(sums);
+        if (samples == 0) break;
+        settled = true;
+        for (uint8_t i = 0; i < 3; i++) {
+            int32_t accelError = sums[i] / samples - (i == 2 ? 16384 : 0);
+            int32_t gyroError = sums[i + 3] / samples;
+            if (accelError > MPU6050_CALIBRATION_ACCEL_TOLERANCE || accelError < -MPU6050_CALIBRATION_ACCEL_TOLERANCE
+                || gyroError > MPU6050_CALIBRATION_GYRO_TOLERANCE || gyroError < -MPU6050_CALIBRATION_GYRO_TOLERANCE) {
+                settled = false;
+            }
+            // accel offsets are in 2048 LSB/g (8x coarser than +/-2g) and
+            // keep bit 0; gyro offsets in 32.8 LSB/deg/sec (4x coarser than +/-250)
+            int16_t accel = cal -> accelOffset[i] - accelError / 8;
+            cal -> accelOffset[i] = (accel & ~1) | (cal -> accelOffset[i] & 1);
+            cal -> gyroOffset[i] -= gyroError / 4;
+        }
+        setCalibration(cal);
+    }
+
+    setRate(rate);
+    setDLPFMode(dlpf);
+    setFullScaleGyroRange(gyroRange);
+    setFullScaleAccelRange(accelRange);
+    bus -> writeByte(devAddr, MPU6050_RA_FIFO_EN, fifoSources);
+    setFIFOEnabled(fifoEnabled);
+    resetFIFO();
+    return settled;
+}
+/** Collect one FIFO burst of accel+gyro records and sum each axis.
+ * @param sums Six accumulators: accel x/y/z, gyro x/y/z
+ * @return Number of records summed
+ */
+uint16_t MPU6050::getCalibrationBurst(int32_t *sums) {
+    for (uint8_t i = 0; i < 6; i++) sums[i] = 0;
+    setFIFOEnabled(true);
+    resetFIFO();
+    bus -> writeByte(devAddr, MPU6050_RA_FIFO_EN, (1 << MPU6050_XG_FIFO_EN_BIT) | (1 << MPU6050_YG_FIFO_EN_BIT)
+        | (1 << MPU6050_ZG_FIFO_EN_BIT) | (1 << MPU6050_ACCEL_FIFO_EN_BIT));
+    delay(MPU6050_CALIBRATION_BURST_MS);
+    bus -> writeByte(devAddr, MPU6050_RA_FIFO_EN, 0);
+
+    // records are accel x/y/z then gyro x/y/z, 12 bytes, in register order
+    uint16_t samples = getFIFOCount() / 12;
+    for (uint16_t n = 0; n < samples; n++) {
+        getFIFOBytes(buffer, 12);
+        for (uint8_t i = 0; i < 6; i++) sums[i] += (int16_t)((((int16_t)buffer[i*2]) << 8) | buffer[i*2 + 1]);
+    }
+    return samples;
 }
+#endif
+#endif
 
+#ifdef MPU6050_FEATURE_DMP
 // INT_ENABLE register (DMP functions)
 
 bool MPU6050::getIntPLLReadyEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setIntPLLReadyEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT> >(devAddr, enabled);
 }
 bool MPU6050::getIntDMPEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setIntDMPEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT> >(devAddr, enabled);
 }
 
 // DMP_INT_STATUS
 
 bool MPU6050::getDMPInt5Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_5_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_5_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt4Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_4_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_4_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt3Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_3_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_3_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt2Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_2_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_2_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt1Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_1_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_1_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getDMPInt0Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_0_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_0_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
 // INT_STATUS register (DMP functions)
 
 bool MPU6050::getIntPLLReadyStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_PLL_RDY_INT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 bool MPU6050::getIntDMPStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DMP_INT_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DMP_INT_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 
 // USER_CTRL register (DMP functions)
 
 bool MPU6050::getDMPEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, buffer);
+    bus -> readField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT> >(devAddr, buffer);
     return buffer[0];
 }
 void MPU6050::setDMPEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, enabled);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT> >(devAddr, enabled);
 }
 void MPU6050::resetDMP() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT, true);
+    bus -> writeField<I2Cdev_Bit<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT> >(devAddr, true);
+    #ifdef I2CDEV_REGISTER_CACHE
+        I2Cdev::invalidateCache(devAddr, MPU6050_RA_USER_CTRL, 1); // bit self-clears
+    #endif
 }
 
 // BANK_SEL register
@@ -2914,23 +3475,23 @@ void MPU6050::setMemoryBank(uint8_t bank, bool prefetchEnabled, bool userBank) {
     bank &= 0x1F;
     if (userBank) bank |= 0x20;
     if (prefetchEnabled) bank |= 0x40;
-    I2Cdev::writeByte(devAddr, MPU6050_RA_BANK_SEL, bank);
+    bus -> writeByte(devAddr, MPU6050_RA_BANK_SEL, bank);
 }
 
 // MEM_START_ADDR register
 
 void MPU6050::setMemoryStartAddress(uint8_t address) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_MEM_START_ADDR, address);
+    bus -> writeByte(devAddr, MPU6050_RA_MEM_START_ADDR, address);
 }
 
 // MEM_R_W register
 
 uint8_t MPU6050::readMemoryByte() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_MEM_R_W, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_MEM_R_W, buffer);
     return buffer[0];
 }
 void MPU6050::writeMemoryByte(uint8_t data) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_MEM_R_W, data);
+    bus -> writeByte(devAddr, MPU6050_RA_MEM_R_W, data);
 }
 void MPU6050::readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address) {
     setMemoryBank(bank);
@@ -2938,7 +3499,7 @@ void MPU6050::readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, ui
     uint8_t chunkSize;
     for (uint16_t i = 0; i < dataSize;) {
         // determine correct chunk size according to bank position and data size
-        chunkSize = MPU6050_DMP_MEMORY_CHUNK_SIZE;
+        chunkSize = MPU6050_DMP_MEMORY_BURST_SIZE;
 
         // make sure we don't go past the data size
         if (i + chunkSize > dataSize) chunkSize = dataSize - i;
@@ -2947,7 +3508,7 @@ void MPU6050::readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, ui
         if (chunkSize > 256 - address) chunkSize = 256 - address;
 
         // read the chunk of data as specified
-        I2Cdev::readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, data + i);
+        bus -> readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, data + i);
         
         // increase byte index by [chunkSize]
         i += chunkSize;
@@ -2955,72 +3516,95 @@ void MPU6050::readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, ui
         // uint8_t automatically wraps to 0 at 256
         address += chunkSize;
 
-        // if we aren't done, update bank (if necessary) and address
-        if (i < dataSize) {
-            if (address == 0) bank++;
-            setMemoryBank(bank);
-            setMemoryStartAddress(address);
+        // the start address auto-increments with each byte, so the pointer
+        // only needs reloading when the next chunk starts a new bank
+        if (i < dataSize && address == 0) {
+            setMemoryBank(++bank);
+            setMemoryStartAddress(0);
         }
     }
 }
-bool MPU6050::writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify, bool useProgMem) {
+/** Read a block of DMP memory and return its CRC-16 (CCITT, 0xFFFF seed).
+ * Reads in the same bank-aligned bursts as readMemoryBlock() through a small
+ * stack buffer, so whole firmware images can be checked without a RAM copy.
+ * @param dataSize Number of bytes to read
+ * @param bank Starting memory bank
+ * @param address Starting address within the bank
+ * @return CRC-16 of the bytes read
+ * @see getMemoryImageCRC()
+ */
+uint16_t MPU6050::readMemoryBlockCRC(uint16_t dataSize, uint8_t bank, uint8_t address) {
+    uint8_t chunk[MPU6050_DMP_MEMORY_BURST_SIZE];
+    uint8_t chunkSize;
+    uint16_t crc = 0xFFFF;
     setMemoryBank(bank);
     setMemoryStartAddress(address);
+    for (uint16_t i = 0; i < dataSize;) {
+        chunkSize = MPU6050_DMP_MEMORY_BURST_SIZE;
+        if (i + chunkSize > dataSize) chunkSize = dataSize - i;
+        if (chunkSize > 256 - address) chunkSize = 256 - address;
+        bus -> readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, chunk);
+        for (uint8_t j = 0; j < chunkSize; j++) crc = MPU6050_crc16(crc, chunk[j]);
+        i += chunkSize;
+        address += chunkSize;
+        if (i < dataSize && address == 0) {
+            setMemoryBank(++bank);
+            setMemoryStartAddress(0);
+        }
+    }
+    return crc;
+}
+/** Compute the CRC-16 of a local memory image, as readMemoryBlockCRC() would
+ * report it once the image is resident in DMP memory.
+ * @param data Image to checksum
+ * @param dataSize Number of bytes
+ * @param useProgMem True if the image lives in flash (PROGMEM)
+ * @return CRC-16 of the image
+ */
+uint16_t MPU6050::getMemoryImageCRC(const uint8_t *data, uint16_t dataSize, bool useProgMem) {
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < dataSize; i++) {
+        crc = MPU6050_crc16(crc, useProgMem ? pgm_read_byte(data + i) : data[i]);
+    }
+    return crc;
+}
+/** Write a block into DMP memory.
+ * The data is streamed in bursts of MPU6050_DMP_MEMORY_BURST_SIZE bytes that
+ * never straddle a bank boundary, staged through a stack buffer (read
+ * directly from flash when useProgMem is set). The bank and start address are
+ * written once up front and again only at bank crossings, since the start
+ * address auto-increments with each byte. Verification reads the block back
+ * once and compares its CRC-16 with the one accumulated while writing.
+ * @param data Data to write
+ * @param dataSize Number of bytes
+ * @param bank Starting memory bank
+ * @param address Starting address within the bank
+ * @param verify True to read back and check the written block
+ * @param useProgMem True if data lives in flash (PROGMEM)
+ * @return True if the bus accepted every burst (and verification matched)
+ */
+bool MPU6050::writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify, bool useProgMem) {
+    uint8_t chunk[MPU6050_DMP_MEMORY_BURST_SIZE];
     uint8_t chunkSize;
-    uint8_t *verifyBuffer;
-    uint8_t *progBuffer;
-    uint16_t i;
-    uint8_t j;
-    if (verify) verifyBuffer = (uint8_t *)malloc(MPU6050_DMP_MEMORY_CHUNK_SIZE);
-    if (useProgMem) progBuffer = (uint8_t *)malloc(MPU6050_DMP_MEMORY_CHUNK_SIZE);
-    for (i = 0; i < dataSize;) {
+    uint8_t startBank = bank, startAddress = address;
+    uint16_t crc = 0xFFFF;
+    setMemoryBank(bank);
+    setMemoryStartAddress(address);
+    for (uint16_t i = 0; i < dataSize;) {
         // determine correct chunk size according to bank position and data size
-        chunkSize = MPU6050_DMP_MEMORY_CHUNK_SIZE;
+        chunkSize = MPU6050_DMP_MEMORY_BURST_SIZE;
 
         // make sure we don't go past the data size
         if (i + chunkSize > dataSize) chunkSize = dataSize - i;
 
         // make sure this chunk doesn't go past the bank boundary (256 bytes)
         if (chunkSize > 256 - address) chunkSize = 256 - address;
-        
-        if (useProgMem) {
-            // write the chunk of data as specified
-            for (j = 0; j < chunkSize; j++) progBuffer[j] = pgm_read_byte(data + i + j);
-        } else {
-            // write the chunk of data as specified
-            progBuffer = (uint8_t *)data + i;
-        }
 
-        I2Cdev::writeBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, progBuffer);
-
-        // verify data if needed
-        if (verify && verifyBuffer) {
-            setMemoryBank(bank);
-            setMemoryStartAddress(address);
-            I2Cdev::readBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, verifyBuffer);
-            if (memcmp(progBuffer, verifyBuffer, chunkSize) != 0) {
-                /*Serial.print("Block write verification error, bank ");
-                Serial.print(bank, DEC);
-                Serial.print(", address ");
-                Serial.print(address, DEC);
-                Serial.print("!\nExpected:");
-                for (j = 0; j < chunkSize; j++) {
-                    Serial.print(" 0x");
-                    if (progBuffer[j] < 16) Serial.print("0");
-                    Serial.print(progBuffer[j], HEX);
-                }
-                Serial.print("\nReceived:");
-                for (uint8_t j = 0; j < chunkSize; j++) {
-                    Serial.print(" 0x");
-                    if (verifyBuffer[i + j] < 16) Serial.print("0");
-                    Serial.print(verifyBuffer[i + j], HEX);
-                }
-                Serial.print("\n");*/
-                free(verifyBuffer);
-                if (useProgMem) free(progBuffer);
-                return false; // uh oh.
-            }
+        for (uint8_t j = 0; j < chunkSize; j++) {
+            chunk[j] = useProgMem ? pgm_read_byte(data + i + j) : data[i + j];
+            crc = MPU6050_crc16(crc, chunk[j]);
         }
+        if (!bus -> writeBytes(devAddr, MPU6050_RA_MEM_R_W, chunkSize, chunk)) return false;
 
         // increase byte index by [chunkSize]
         i += chunkSize;
@@ -3028,26 +3612,20 @@ bool MPU6050::writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t b
         // uint8_t automatically wraps to 0 at 256
         address += chunkSize;
 
-        // if we aren't done, update bank (if necessary) and address
-        if (i < dataSize) {
-            if (address == 0) bank++;
-            setMemoryBank(bank);
-            setMemoryStartAddress(address);
+        // only a bank crossing needs the memory pointer reloaded
+        if (i < dataSize && address == 0) {
+            setMemoryBank(++bank);
+            setMemoryStartAddress(0);
         }
     }
-    if (verify) free(verifyBuffer);
-    if (useProgMem) free(progBuffer);
-    return true;
+    return !verify || readMemoryBlockCRC(dataSize, startBank, startAddress) == crc;
 }
 bool MPU6050::writeProgMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify) {
     return writeMemoryBlock(data, dataSize, bank, address, verify, true);
 }
 bool MPU6050::writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, bool useProgMem) {
-    uint8_t *progBuffer, success, special;
-    uint16_t i, j;
-    if (useProgMem) {
-        progBuffer = (uint8_t *)malloc(8); // assume 8-byte blocks, realloc later if necessary
-    }
+    uint8_t success, special;
+    uint16_t i;
 
     // config set data is a long string of blocks with the following structure:
     // [bank] [offset] [length] [byte[0], byte[1], ..., byte[length]]
@@ -3072,13 +3650,7 @@ bool MPU6050::writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, b
             Serial.print(offset);
             Serial.print(", length=");
             Serial.println(length);*/
-            if (useProgMem) {
-                if (sizeof(progBuffer) < length) progBuffer = (uint8_t *)realloc(progBuffer, length);
-                for (j = 0; j < length; j++) progBuffer[j] = pgm_read_byte(data + i + j);
-            } else {
-                progBuffer = (uint8_t *)data + i;
-            }
-            success = writeMemoryBlock(progBuffer, length, bank, offset, true);
+            success = writeMemoryBlock(data + i, length, bank, offset, true, useProgMem);
             i += length;
         } else {
             // special instruction
@@ -3100,7 +3672,7 @@ bool MPU6050::writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, b
                 //setIntZeroMotionEnabled(true);
                 //setIntFIFOBufferOverflowEnabled(true);
                 //setIntDMPEnabled(true);
-                I2Cdev::writeByte(devAddr, MPU6050_RA_INT_ENABLE, 0x32);  // single operation
+                bus -> writeByte(devAddr, MPU6050_RA_INT_ENABLE, 0x32);  // single operation
 
                 success = true;
             } else {
@@ -3109,12 +3681,8 @@ bool MPU6050::writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, b
             }
         }
         
-        if (!success) {
-            if (useProgMem) free(progBuffer);
-            return false; // uh oh
-        }
+        if (!success) return false; // uh oh
     }
-    if (useProgMem) free(progBuffer);
     return true;
 }
 bool MPU6050::writeProgDMPConfigurationSet(const uint8_t *data, uint16_t dataSize) {
@@ -3124,19 +3692,20 @@ bool MPU6050::writeProgDMPConfigurationSet(const uint8_t *data, uint16_t dataSiz
 // DMP_CFG_1 register
 
 uint8_t MPU6050::getDMPConfig1() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_DMP_CFG_1, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_DMP_CFG_1, buffer);
     return buffer[0];
 }
 void MPU6050::setDMPConfig1(uint8_t config) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_DMP_CFG_1, config);
+    bus -> writeByte(devAddr, MPU6050_RA_DMP_CFG_1, config);
 }
 
 // DMP_CFG_2 register
 
 uint8_t MPU6050::getDMPConfig2() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_DMP_CFG_2, buffer);
+    bus -> readByte(devAddr, MPU6050_RA_DMP_CFG_2, buffer);
     return buffer[0];
 }
 void MPU6050::setDMPConfig2(uint8_t config) {
-    I2Cdev::writeByte(devAddr, MPU6050_RA_DMP_CFG_2, config);
-}
\ No newline at end of file
+    bus -> writeByte(devAddr, MPU6050_RA_DMP_CFG_2, config);
+}
+#endif
@@ -39,9 +39,39 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 
+// -----------------------------------------------------------------------------
+// Feature sets (comment out to save flash)
+// -----------------------------------------------------------------------------
+// Each set declares and compiles one group of accessors; core sampling
+// (initialize, clock/range/rate/DLPF, sensor reads, interrupts, power,
+// USER_CTRL, WHO_AM_I) is always built. MPU6050.cpp is compiled on its own,
+// so make the selection here (or with -D for every file, after defining
+// MPU6050_FEATURES_CUSTOM) rather than in the sketch.
+#ifndef MPU6050_FEATURES_CUSTOM
+    #define MPU6050_FEATURE_MOTION_DETECT   // free-fall/motion/zero-motion thresholds, status, MOT_DETECT_CTRL
+    #define MPU6050_FEATURE_FIFO            // FIFO_EN, FIFO count/data, getMotion6Block(), calibrate()
+    #define MPU6050_FEATURE_AUX_MASTER      // auxiliary I2C master, slaves 0-4, EXT_SENS_DATA, getMotion9()
+    #define MPU6050_FEATURE_STREAM          // data-ready sample stream (startMotionStream())
+    #define MPU6050_FEATURE_WAKE_ON_MOTION  // low-power motion wake / full-rate FIFO pipeline
+    #define MPU6050_FEATURE_OFFSETS         // OTP/offset/fine gain registers, get/setCalibration()
+    #define MPU6050_FEATURE_DMP             // DMP memory, banks, configuration sets, DMP interrupts
+#endif
+
+// the MotionApps dmpInitialize() sequences touch every group
+#if defined(MPU6050_FEATURE_DMP) && !(defined(MPU6050_FEATURE_MOTION_DETECT) && defined(MPU6050_FEATURE_FIFO) \
+    && defined(MPU6050_FEATURE_AUX_MASTER) && defined(MPU6050_FEATURE_OFFSETS))
+    #error MPU6050_FEATURE_DMP needs the MOTION_DETECT, FIFO, AUX_MASTER and OFFSETS feature sets
+#endif
+#if defined(MPU6050_FEATURE_WAKE_ON_MOTION) && !(defined(MPU6050_FEATURE_MOTION_DETECT) && defined(MPU6050_FEATURE_FIFO))
+    #error MPU6050_FEATURE_WAKE_ON_MOTION needs the MOTION_DETECT and FIFO feature sets
+#endif
+#if (defined(MPU6050_INCLUDE_DMP_MOTIONAPPS20) || defined(MPU6050_INCLUDE_DMP_MOTIONAPPS41)) && !defined(MPU6050_FEATURE_DMP)
+    #error The MotionApps headers need MPU6050_FEATURE_DMP
+#endif
+
 // supporting link:  http://forum.arduino.cc/index.php?&topic=143444.msg1079517#msg1079517
 // also: http://forum.arduino.cc/index.php?&topic=141571.msg1062899#msg1062899s
-#ifndef __arm__
+#if !defined(__arm__) && I2CDEV_IMPLEMENTATION != I2CDEV_HOST_SIMULATION
 #include <avr/pgmspace.h>
 #else
 #define PROGMEM /* empty */
@@ -406,12 +436,117 @@ THE SOFTWARE.
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
 
+// largest DMP memory write the bus layer can send in one transaction
+// (one byte of the Wire buffer goes to the MEM_R_W register address)
+#ifdef BUFFER_LENGTH
+    #define MPU6050_DMP_MEMORY_BURST_SIZE   (BUFFER_LENGTH - 1)
+#else
+    #define MPU6050_DMP_MEMORY_BURST_SIZE   MPU6050_DMP_MEMORY_CHUNK_SIZE
+#endif
+
+#define MPU6050_FIFO_SIZE               1024
+
+// bytes read per transaction by discardFIFOBytes() (one Wire buffer)
+#define MPU6050_FIFO_DISCARD_CHUNK      32
+
+#ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
+    /** Whole DMP packets drained from the FIFO by dmpReadFIFOBatch().
+     * Packets stay in the caller's buffer; next() steps through them and
+     * returns 0 once all have been visited.
+     */
+    typedef struct MPU6050_FIFOBatch {
+        uint8_t *buffer;        // caller-provided storage
+        uint16_t packetSize;    // bytes per packet (dmpPacketSize at read time)
+        uint8_t count;          // number of packets read
+        uint8_t index;          // next packet returned by next()
+
+        const uint8_t *next() {
+            return index < count ? buffer + (uint16_t)index++ * packetSize : 0;
+        }
+    } MPU6050_FIFOBatch;
+
+    /** Everything in a default MotionApps 2.0 packet, decoded in one pass by
+     * dmpDecodePacket(). Accel, gravity and linear accel share the packet's
+     * accel scale (8192 = 1g), so no float math is needed to use them.
+     */
+    typedef struct MPU6050_DMPData {
+        int32_t quat[4];        // w, x, y, z in Q30 (1073741824 = 1.0), DMP native
+        int16_t gyro[3];        // x, y, z raw gyro
+        int16_t accel[3];       // x, y, z raw accel
+        int16_t gravity[3];     // x, y, z gravity direction
+        int16_t linearAccel[3]; // accel minus gravity
+    } MPU6050_DMPData;
+#endif
+
 // note: DMP code memory blocks defined at end of header file
 
+// magnetometers getMotion9() can pull in through the auxiliary I2C master
+#define MPU6050_MAG_NONE            0
+#define MPU6050_MAG_HMC5883L        1   // e.g. GY-86 style boards, default address 0x1E
+#define MPU6050_MAG_AK8975          2   // MPU9150 internal die, default address 0x0C
+
+#define MPU6050_MOTION9_LENGTH      20  // ACCEL_XOUT_H .. EXT_SENS_DATA_05
+
+/** One accel+gyro sample captured by the data-ready stream. */
+typedef struct MPU6050_Sample {
+    int16_t ax, ay, az;
+    int16_t gx, gy, gz;
+    uint32_t timestamp;         // micros() at the data-ready edge
+} MPU6050_Sample;
+
+/** Caller-owned ring of samples filled by the data-ready stream.
+ * overruns counts data-ready edges that arrived while the previous read was
+ * still pending.
+ * @see I2Cdev_Ring
+ */
+typedef I2Cdev_Ring<MPU6050_Sample> MPU6050_SampleQueue;
+
+/** Structure-of-arrays destination for getMotion6Block(). Each pointer
+ * addresses an array with room for the requested number of samples, so
+ * block filters can run over contiguous per-axis data.
+ */
+typedef struct MPU6050_MotionBlock {
+    int16_t *ax, *ay, *az;
+    int16_t *gx, *gy, *gz;
+} MPU6050_MotionBlock;
+
+// accel+gyro FIFO records staged per burst by getMotion6Block() (12 bytes each)
+#ifndef MPU6050_MOTION_BLOCK_CHUNK
+    #define MPU6050_MOTION_BLOCK_CHUNK  8
+#endif
+
+// startWakeOnMotion() pipeline states
+#define MPU6050_WAKE_OFF        0 // pipeline not running
+#define MPU6050_WAKE_SLEEPING   1 // accel-only cycle mode, waiting for motion
+#define MPU6050_WAKE_ACTIVE     2 // full-rate FIFO streaming, waiting for zero motion
+
+// worst-case RAM: sizeof(MPU6050) per object and no heap; the largest stack
+// scratch in any one call is the getMotion6Block() burst, a DMP memory
+// burst or a 48-byte MotionApps 4.1 packet, whichever is biggest
+#define MPU6050_STACK_BYTES     (MPU6050_MOTION_BLOCK_CHUNK * 12 > MPU6050_DMP_MEMORY_BURST_SIZE \
+    ? (MPU6050_MOTION_BLOCK_CHUNK * 12 > 48 ? MPU6050_MOTION_BLOCK_CHUNK * 12 : 48) \
+    : (MPU6050_DMP_MEMORY_BURST_SIZE > 48 ? MPU6050_DMP_MEMORY_BURST_SIZE : 48))
+
+// calibrate() convergence limits, in +/-2g / +/-250 deg/sec LSBs
+#define MPU6050_CALIBRATION_ACCEL_TOLERANCE 16
+#define MPU6050_CALIBRATION_GYRO_TOLERANCE  4
+#define MPU6050_CALIBRATION_BURST_MS        40  // 40 records at 1kHz, 480 FIFO bytes
+
+/** Accel/gyro offset register contents, as read or written by
+ * getCalibration()/setCalibration(). Values are the raw XA_OFFS_* and
+ * XG_OFFS_USR* words (accel bit 0 is the factory temperature compensation
+ * bit and is kept as read), so the struct can be stored verbatim.
+ */
+typedef struct MPU6050_Calibration {
+    int16_t accelOffset[3];     // XA_OFFS, YA_OFFS, ZA_OFFS (+/-16g scale)
+    int16_t gyroOffset[3];      // XG_OFFS_USR, YG_OFFS_USR, ZG_OFFS_USR (+/-1000 deg/sec scale)
+} MPU6050_Calibration;
+
 class MPU6050 {
     public:
         MPU6050();
         MPU6050(uint8_t address);
+        MPU6050(I2Cdev_Bus *bus, uint8_t address=MPU6050_DEFAULT_ADDRESS);
 
         void initialize();
         bool testConnection();
@@ -446,6 +581,7 @@ class MPU6050 {
         uint8_t getDHPFMode();
         void setDHPFMode(uint8_t mode);
 
+        #ifdef MPU6050_FEATURE_MOTION_DETECT
         // FF_THR register
         uint8_t getFreefallDetectionThreshold();
         void setFreefallDetectionThreshold(uint8_t threshold);
@@ -469,7 +605,9 @@ class MPU6050 {
         // ZRMOT_DUR register
         uint8_t getZeroMotionDetectionDuration();
         void setZeroMotionDetectionDuration(uint8_t duration);
+        #endif
 
+        #ifdef MPU6050_FEATURE_FIFO
         // FIFO_EN register
         bool getTempFIFOEnabled();
         void setTempFIFOEnabled(bool enabled);
@@ -487,7 +625,9 @@ class MPU6050 {
         void setSlave1FIFOEnabled(bool enabled);
         bool getSlave0FIFOEnabled();
         void setSlave0FIFOEnabled(bool enabled);
+        #endif
 
+        #ifdef MPU6050_FEATURE_AUX_MASTER
         // I2C_MST_CTRL register
         bool getMultiMasterEnabled();
         void setMultiMasterEnabled(bool enabled);
@@ -541,6 +681,7 @@ class MPU6050 {
         bool getSlave2Nack();
         bool getSlave1Nack();
         bool getSlave0Nack();
+        #endif
 
         // INT_PIN_CFG register
         bool getInterruptMode();
@@ -586,7 +727,33 @@ class MPU6050 {
         bool getIntDataReadyStatus();
 
         // ACCEL_*OUT_* registers
+        #ifdef MPU6050_FEATURE_AUX_MASTER
         void getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz);
+        bool setMotion9Magnetometer(uint8_t type, uint8_t address=0);
+        uint8_t getMotion9Magnetometer();
+        #endif
+
+        #ifdef MPU6050_FEATURE_FIFO
+        // structure-of-arrays FIFO blocks
+        void startMotionFIFO();
+        uint16_t getMotion6Block(MPU6050_MotionBlock *block, uint16_t maxSamples);
+        #endif
+
+        #ifdef MPU6050_FEATURE_STREAM
+        // data-ready sample stream
+        void startMotionStream(MPU6050_SampleQueue *queue);
+        void stopMotionStream();
+        void notifyDataReady();
+        uint8_t serviceMotionStream();
+        #endif
+        #ifdef MPU6050_FEATURE_WAKE_ON_MOTION
+        // wake-on-motion pipeline
+        void startWakeOnMotion(uint8_t motionThreshold, uint8_t motionDuration, uint8_t stillThreshold,
+            uint8_t stillDuration, uint8_t wakeFrequency=MPU6050_WAKE_FREQ_5);
+        void stopWakeOnMotion();
+        uint8_t serviceWakeOnMotion();
+        uint8_t getWakeState();
+        #endif
         void getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz);
         void getAcceleration(int16_t* x, int16_t* y, int16_t* z);
         int16_t getAccelerationX();
@@ -602,11 +769,14 @@ class MPU6050 {
         int16_t getRotationY();
         int16_t getRotationZ();
 
+        #ifdef MPU6050_FEATURE_AUX_MASTER
         // EXT_SENS_DATA_* registers
         uint8_t getExternalSensorByte(int position);
         uint16_t getExternalSensorWord(int position);
         uint32_t getExternalSensorDWord(int position);
+        #endif
 
+        #ifdef MPU6050_FEATURE_MOTION_DETECT
         // MOT_DETECT_STATUS register
         bool getXNegMotionDetected();
         bool getXPosMotionDetected();
@@ -615,7 +785,9 @@ class MPU6050 {
         bool getZNegMotionDetected();
         bool getZPosMotionDetected();
         bool getZeroMotionDetected();
+        #endif
 
+        #ifdef MPU6050_FEATURE_AUX_MASTER
         // I2C_SLV*_DO register
         void setSlaveOutputByte(uint8_t num, uint8_t data);
 
@@ -624,12 +796,14 @@ class MPU6050 {
         void setExternalShadowDelayEnabled(bool enabled);
         bool getSlaveDelayEnabled(uint8_t num);
         void setSlaveDelayEnabled(uint8_t num, bool enabled);
+        #endif
 
         // SIGNAL_PATH_RESET register
         void resetGyroscopePath();
         void resetAccelerometerPath();
         void resetTemperaturePath();
 
+        #ifdef MPU6050_FEATURE_MOTION_DETECT
         // MOT_DETECT_CTRL register
         uint8_t getAccelerometerPowerOnDelay();
         void setAccelerometerPowerOnDelay(uint8_t delay);
@@ -637,6 +811,7 @@ class MPU6050 {
         void setFreefallDetectionCounterDecrement(uint8_t decrement);
         uint8_t getMotionDetectionCounterDecrement();
         void setMotionDetectionCounterDecrement(uint8_t decrement);
+        #endif
 
         // USER_CTRL register
         bool getFIFOEnabled();
@@ -675,13 +850,16 @@ class MPU6050 {
         bool getStandbyZGyroEnabled();
         void setStandbyZGyroEnabled(bool enabled);
 
+        #ifdef MPU6050_FEATURE_FIFO
         // FIFO_COUNT_* registers
         uint16_t getFIFOCount();
 
         // FIFO_R_W register
         uint8_t getFIFOByte();
         void setFIFOByte(uint8_t data);
-        void getFIFOBytes(uint8_t *data, uint8_t length);
+        void getFIFOBytes(uint8_t *data, uint16_t length);
+        void discardFIFOBytes(uint16_t length);
+        #endif
 
         // WHO_AM_I register
         uint8_t getDeviceID();
@@ -689,6 +867,7 @@ class MPU6050 {
         
         // ======== UNDOCUMENTED/DMP REGISTERS/METHODS ========
         
+        #ifdef MPU6050_FEATURE_OFFSETS
         // XG_OFFS_TC register
         uint8_t getOTPBankValid();
         void setOTPBankValid(bool enabled);
@@ -738,7 +917,16 @@ class MPU6050 {
         // ZG_OFFS_USR* register
         int16_t getZGyroOffset();
         void setZGyroOffset(int16_t offset);
+
+        // offset calibration
+        void getCalibration(MPU6050_Calibration *cal);
+        void setCalibration(const MPU6050_Calibration *cal);
+        #ifdef MPU6050_FEATURE_FIFO
+        bool calibrate(MPU6050_Calibration *cal, uint8_t rounds=6);
+        #endif
+        #endif
         
+        #ifdef MPU6050_FEATURE_DMP
         // INT_ENABLE register (DMP functions)
         bool getIntPLLReadyEnabled();
         void setIntPLLReadyEnabled(bool enabled);
@@ -774,6 +962,8 @@ class MPU6050 {
         void readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank=0, uint8_t address=0);
         bool writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank=0, uint8_t address=0, bool verify=true, bool useProgMem=false);
         bool writeProgMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank=0, uint8_t address=0, bool verify=true);
+        uint16_t readMemoryBlockCRC(uint16_t dataSize, uint8_t bank=0, uint8_t address=0);
+        static uint16_t getMemoryImageCRC(const uint8_t *data, uint16_t dataSize, bool useProgMem=false);
 
         bool writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, bool useProgMem=false);
         bool writeProgDMPConfigurationSet(const uint8_t *data, uint16_t dataSize);
@@ -785,17 +975,29 @@ class MPU6050 {
         // DMP_CFG_2 register
         uint8_t getDMPConfig2();
         void setDMPConfig2(uint8_t config);
+        #endif
+
+        // DMP packet state, declared in every build: MPU6050.cpp is compiled
+        // without the MotionApps defines, so members that only exist in the
+        // sketch's translation unit would shift (and overlap) the ones below
+        uint8_t *dmpPacketBuffer;
+        uint16_t dmpPacketSize;
+        uint8_t dmpGyroOffset;      // packet offset of gyro / accel, 0 = not sent
+        uint8_t dmpAccelOffset;
 
         // special methods for MotionApps 2.0 implementation
         #ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
-            uint8_t *dmpPacketBuffer;
-            uint16_t dmpPacketSize;
-
             uint8_t dmpInitialize();
+            uint8_t dmpInitializeStep(uint8_t *step, uint32_t *waitMicros);
+            bool dmpIsResident(bool *customized=0);
+            void dmpSetRegisterDefaults();
+            uint16_t dmpGetImageSignature();
             bool dmpPacketAvailable();
 
             uint8_t dmpSetFIFORate(uint8_t fifoRate);
             uint8_t dmpGetFIFORate();
+            uint8_t dmpSetPacketContent(uint8_t content);
+            uint8_t dmpGetPacketContent();
             uint8_t dmpGetSampleStepSizeMS();
             uint8_t dmpGetSampleFrequency();
             int32_t dmpDecodeTemperature(int8_t tempReg);
@@ -868,12 +1070,24 @@ class MPU6050 {
             uint8_t dmpGetEuler(float *data, Quaternion *q);
             uint8_t dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gravity);
 
+            #ifdef HELPER_3DMATH_FIXED
+                // Get fixed-point math helper data from FIFO
+                uint8_t dmpGetQuaternion(QuaternionFixed *q, const uint8_t* packet=0);
+                uint8_t dmpGetGravity(VectorFixed *v, QuaternionFixed *q);
+                uint8_t dmpGetLinearAccel(VectorInt16 *v, VectorInt16 *vRaw, VectorFixed *gravity);
+                uint8_t dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, QuaternionFixed *q);
+            #endif
+
             // Get Floating Point data from FIFO
             uint8_t dmpGetAccelFloat(float *data, const uint8_t* packet=0);
             uint8_t dmpGetQuaternionFloat(float *data, const uint8_t* packet=0);
 
+            // Decode a whole packet at once
+            uint8_t dmpDecodePacket(MPU6050_DMPData *data, const uint8_t* packet=0, Quaternion *q=0, VectorFloat *gravity=0);
+
             uint8_t dmpProcessFIFOPacket(const unsigned char *dmpData);
             uint8_t dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed=NULL);
+            uint8_t dmpReadFIFOBatch(uint8_t *buffer, uint16_t bufferSize, MPU6050_FIFOBatch *batch);
 
             uint8_t dmpSetFIFOProcessedCallback(void (*func) (void));
 
@@ -889,10 +1103,10 @@ class MPU6050 {
 
         // special methods for MotionApps 4.1 implementation
         #ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS41
-            uint8_t *dmpPacketBuffer;
-            uint16_t dmpPacketSize;
-
             uint8_t dmpInitialize();
+            bool dmpIsResident();
+            void dmpSetRegisterDefaults();
+            uint16_t dmpGetImageSignature();
             bool dmpPacketAvailable();
 
             uint8_t dmpSetFIFORate(uint8_t fifoRate);
@@ -991,7 +1205,33 @@ class MPU6050 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[14];
+        I2Cdev_Bus *bus;
+        uint8_t buffer[MPU6050_MOTION9_LENGTH];
+        uint8_t magType;
+        uint16_t getCalibrationBurst(int32_t *sums);
+        MPU6050_SampleQueue *streamQueue;
+        I2Cdev_Transaction streamTxn;
+        uint8_t streamData[14];
+        volatile uint32_t streamStamp;
+        volatile bool streamPending;
+        #ifdef MPU6050_FEATURE_WAKE_ON_MOTION
+        uint8_t wakeState;
+        uint8_t wakeMotionThreshold, wakeMotionDuration;
+        uint8_t wakeStillThreshold, wakeStillDuration;
+        uint8_t wakeFrequency;
+        void enterWakeSleeping();
+        void enterWakeActive();
+        #endif
+        #ifdef MPU6050_FEATURE_STREAM
+        void pushMotionSample();
+        static void motionStreamDone(I2Cdev_Transaction *txn);
+        #endif
+        #ifdef I2CDEV_REGISTER_CACHE
+            I2Cdev_CacheRange cacheConfig;      // SMPLRT_DIV .. INT_ENABLE
+            I2Cdev_CacheRange cachePower;       // I2C_MST_DELAY_CTRL .. PWR_MGMT_2
+            uint8_t cacheConfigValues[32];
+            uint8_t cachePowerValues[6];
+        #endif
 };
 
 #endif /* _MPU6050_H_ */
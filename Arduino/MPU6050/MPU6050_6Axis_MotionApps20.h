@@ -43,7 +43,7 @@ THE SOFTWARE.
 
 // Tom Carpenter's conditional PROGMEM code
 // http://forum.arduino.cc/index.php?topic=129407.0
-#ifndef __arm__
+#if !defined(__arm__) && I2CDEV_IMPLEMENTATION != I2CDEV_HOST_SIMULATION
     #include <avr/pgmspace.h>
 #else
     // Teensy 3.0 library conditional PROGMEM code from Paul Stoffregen
@@ -115,8 +115,29 @@ THE SOFTWARE.
 
 #define MPU6050_DMP_CODE_SIZE       1929    // dmpMemory[]
 #define MPU6050_DMP_CONFIG_SIZE     192     // dmpConfig[]
+#define MPU6050_DMP_PACKET_SIZE     42      // quaternion, gyro, accel + footer (largest)
+
+// dmpSetPacketContent() selections; the quaternion (16 bytes) and footer
+// (2 bytes) are always sent, gyro and accel add 12 bytes each
+#define MPU6050_DMP_SEND_QUATERNION 0x00
+#define MPU6050_DMP_SEND_GYRO       0x01
+#define MPU6050_DMP_SEND_ACCEL      0x02
+#define MPU6050_DMP_SEND_ALL        (MPU6050_DMP_SEND_GYRO | MPU6050_DMP_SEND_ACCEL)
 #define MPU6050_DMP_UPDATES_SIZE    47      // dmpUpdates[]
 
+// warm-start signature, stored just past the end of the firmware image
+#define MPU6050_DMP_SIGNATURE_BANK      (MPU6050_DMP_CODE_SIZE >> 8)
+#define MPU6050_DMP_SIGNATURE_ADDRESS   (MPU6050_DMP_CODE_SIZE & 0xFF)
+// followed by a flag byte, set once the packet content or rate leaves the defaults
+#define MPU6050_DMP_CUSTOMIZED_ADDRESS  (MPU6050_DMP_SIGNATURE_ADDRESS + 2)
+
+// dmpInitializeStep() sequence: reset, wake, one step per firmware bank,
+// configuration, then two waits for DMP output
+#define MPU6050_DMP_CODE_BANKS      ((MPU6050_DMP_CODE_SIZE + 255) >> 8)
+#define MPU6050_DMP_STEP_CONFIG     (2 + MPU6050_DMP_CODE_BANKS)
+#define MPU6050_DMP_FIFO_POLL_US    1000    // DMP packets come every 5ms at first
+#define MPU6050_DMP_INIT_PENDING    0xFF    // dmpInitializeStep(): more steps to run
+
 /* ================================================================================================ *
  | Default MotionApps v2.0 42-byte FIFO packet structure:                                           |
  |                                                                                                  |
@@ -322,228 +343,349 @@ const unsigned char dmpUpdates[MPU6050_DMP_UPDATES_SIZE] PROGMEM = {
     0x00,   0x60,   0x04,   0x00, 0x40, 0x00, 0x00
 };
 
-uint8_t MPU6050::dmpInitialize() {
-    // reset device
-    DEBUG_PRINTLN(F("\n\nResetting MPU6050..."));
-    reset();
-    delay(30); // wait after reset
-
-    // enable sleep mode and wake cycle
-    /*Serial.println(F("Enabling sleep mode..."));
-    setSleepEnabled(true);
-    Serial.println(F("Enabling wake cycle..."));
-    setWakeCycleEnabled(true);*/
-
-    // disable sleep mode
-    DEBUG_PRINTLN(F("Disabling sleep mode..."));
-    setSleepEnabled(false);
-
-    // get MPU hardware revision
-    DEBUG_PRINTLN(F("Selecting user bank 16..."));
-    setMemoryBank(0x10, true, true);
-    DEBUG_PRINTLN(F("Selecting memory byte 6..."));
-    setMemoryStartAddress(0x06);
-    DEBUG_PRINTLN(F("Checking hardware revision..."));
-    uint8_t hwRevision = readMemoryByte();
-    DEBUG_PRINT(F("Revision @ user[16][6] = "));
-    DEBUG_PRINTLNF(hwRevision, HEX);
-    DEBUG_PRINTLN(F("Resetting memory bank selection to 0..."));
-    setMemoryBank(0, false, false);
-
-    // check OTP bank valid
-    DEBUG_PRINTLN(F("Reading OTP bank valid flag..."));
-    uint8_t otpValid = getOTPBankValid();
-    DEBUG_PRINT(F("OTP bank is "));
-    DEBUG_PRINTLN(otpValid ? F("valid!") : F("invalid!"));
-
-    // get X/Y/Z gyro offsets
-    DEBUG_PRINTLN(F("Reading gyro offset TC values..."));
-    int8_t xgOffsetTC = getXGyroOffsetTC();
-    int8_t ygOffsetTC = getYGyroOffsetTC();
-    int8_t zgOffsetTC = getZGyroOffsetTC();
-    DEBUG_PRINT(F("X gyro offset = "));
-    DEBUG_PRINTLN(xgOffset);
-    DEBUG_PRINT(F("Y gyro offset = "));
-    DEBUG_PRINTLN(ygOffset);
-    DEBUG_PRINT(F("Z gyro offset = "));
-    DEBUG_PRINTLN(zgOffset);
-
-    // setup weird slave stuff (?)
-    DEBUG_PRINTLN(F("Setting slave 0 address to 0x7F..."));
-    setSlaveAddress(0, 0x7F);
-    DEBUG_PRINTLN(F("Disabling I2C Master mode..."));
-    setI2CMasterModeEnabled(false);
-    DEBUG_PRINTLN(F("Setting slave 0 address to 0x68 (self)..."));
-    setSlaveAddress(0, 0x68);
-    DEBUG_PRINTLN(F("Resetting I2C Master control..."));
-    resetI2CMaster();
-    delay(20);
-
-    // load DMP code into memory banks
-    DEBUG_PRINT(F("Writing DMP code to MPU memory banks ("));
-    DEBUG_PRINT(MPU6050_DMP_CODE_SIZE);
-    DEBUG_PRINTLN(F(" bytes)"));
-    if (writeProgMemoryBlock(dmpMemory, MPU6050_DMP_CODE_SIZE)) {
-        DEBUG_PRINTLN(F("Success! DMP code written and verified."));
+/** Compute the warm-start signature of the compiled DMP image.
+ * CRC-16 of the firmware, configuration and update tables, so any change to
+ * the image (or switching MotionApps versions) invalidates a resident copy.
+ */
+uint16_t MPU6050::dmpGetImageSignature() {
+    return getMemoryImageCRC(dmpMemory, MPU6050_DMP_CODE_SIZE, true)
+        ^ getMemoryImageCRC(dmpConfig, MPU6050_DMP_CONFIG_SIZE, true)
+        ^ getMemoryImageCRC(dmpUpdates, MPU6050_DMP_UPDATES_SIZE, true);
+}
+/** Check whether this firmware image is already loaded and configured.
+ * dmpInitialize() finishes by storing the image signature in the two DMP
+ * memory bytes just past the firmware, which the upload never writes. Those
+ * bytes and the cleared SLEEP bit only survive while the MPU stays powered,
+ * so a match means the upload and configuration can be skipped. Anything
+ * that disturbs them (power loss, reset(), another image) forces a cold load.
+ * @param customized Optional, set to whether dmpSetPacketContent() or
+ *        dmpSetFIFORate() have been used on the resident image since
+ * @return True if the resident DMP matches the compiled image
+ */
+bool MPU6050::dmpIsResident(bool *customized) {
+    uint8_t signature[3];
+    if (getSleepEnabled()) return false;
+    readMemoryBlock(signature, 3, MPU6050_DMP_SIGNATURE_BANK, MPU6050_DMP_SIGNATURE_ADDRESS);
+    if (customized) *customized = signature[2] != 0;
+    return (((uint16_t)signature[0] << 8) | signature[1]) == dmpGetImageSignature();
+}
 
-        // write DMP configuration
-        DEBUG_PRINT(F("Writing DMP configuration to MPU memory banks ("));
-        DEBUG_PRINT(MPU6050_DMP_CONFIG_SIZE);
-        DEBUG_PRINTLN(F(" bytes in config def)"));
-        if (writeProgDMPConfigurationSet(dmpConfig, MPU6050_DMP_CONFIG_SIZE)) {
-            DEBUG_PRINTLN(F("Success! DMP configuration written and verified."));
+/** Write the MPU register settings the DMP image expects.
+ * These live in ordinary registers rather than DMP memory, so initialize()
+ * or the sketch may have changed them since the image was loaded (the
+ * default initialize() selects the X gyro clock and +/- 250 deg/sec).
+ * The warm start reapplies them along with the cold load.
+ */
+void MPU6050::dmpSetRegisterDefaults() {
+    DEBUG_PRINTLN(F("Setting clock source to Z Gyro..."));
+    setClockSource(MPU6050_CLOCK_PLL_ZGYRO);
 
-            DEBUG_PRINTLN(F("Setting clock source to Z Gyro..."));
-            setClockSource(MPU6050_CLOCK_PLL_ZGYRO);
+    DEBUG_PRINTLN(F("Setting DMP and FIFO_OFLOW interrupts enabled..."));
+    setIntEnabled(0x12);
 
-            DEBUG_PRINTLN(F("Setting DMP and FIFO_OFLOW interrupts enabled..."));
-            setIntEnabled(0x12);
+    DEBUG_PRINTLN(F("Setting sample rate to 200Hz..."));
+    setRate(4); // 1khz / (1 + 4) = 200 Hz
 
-            DEBUG_PRINTLN(F("Setting sample rate to 200Hz..."));
-            setRate(4); // 1khz / (1 + 4) = 200 Hz
+    DEBUG_PRINTLN(F("Setting external frame sync to TEMP_OUT_L[0]..."));
+    setExternalFrameSync(MPU6050_EXT_SYNC_TEMP_OUT_L);
 
-            DEBUG_PRINTLN(F("Setting external frame sync to TEMP_OUT_L[0]..."));
-            setExternalFrameSync(MPU6050_EXT_SYNC_TEMP_OUT_L);
+    DEBUG_PRINTLN(F("Setting DLPF bandwidth to 42Hz..."));
+    setDLPFMode(MPU6050_DLPF_BW_42);
 
-            DEBUG_PRINTLN(F("Setting DLPF bandwidth to 42Hz..."));
-            setDLPFMode(MPU6050_DLPF_BW_42);
+    DEBUG_PRINTLN(F("Setting gyro sensitivity to +/- 2000 deg/sec..."));
+    setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
 
-            DEBUG_PRINTLN(F("Setting gyro sensitivity to +/- 2000 deg/sec..."));
-            setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
+    DEBUG_PRINTLN(F("Setting DMP configuration bytes (function unknown)..."));
+    setDMPConfig1(0x03);
+    setDMPConfig2(0x00);
 
-            DEBUG_PRINTLN(F("Setting DMP configuration bytes (function unknown)..."));
-            setDMPConfig1(0x03);
-            setDMPConfig2(0x00);
+    DEBUG_PRINTLN(F("Setting motion detection threshold to 2..."));
+    setMotionDetectionThreshold(2);
 
-            DEBUG_PRINTLN(F("Clearing OTP Bank flag..."));
-            setOTPBankValid(false);
+    DEBUG_PRINTLN(F("Setting zero-motion detection threshold to 156..."));
+    setZeroMotionDetectionThreshold(156);
 
-            DEBUG_PRINTLN(F("Setting X/Y/Z gyro offset TCs to previous values..."));
-            setXGyroOffsetTC(xgOffsetTC);
-            setYGyroOffsetTC(ygOffsetTC);
-            setZGyroOffsetTC(zgOffsetTC);
+    DEBUG_PRINTLN(F("Setting motion detection duration to 80..."));
+    setMotionDetectionDuration(80);
 
-            //DEBUG_PRINTLN(F("Setting X/Y/Z gyro user offsets to zero..."));
-            //setXGyroOffset(0);
-            //setYGyroOffset(0);
-            //setZGyroOffset(0);
+    DEBUG_PRINTLN(F("Setting zero-motion detection duration to 0..."));
+    setZeroMotionDetectionDuration(0);
+}
 
-            DEBUG_PRINTLN(F("Writing final memory update 1/7 (function unknown)..."));
-            uint8_t dmpUpdate[16], j;
-            uint16_t pos = 0;
-            for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
-            writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+// copy DMP memory update n (0-6) out of dmpUpdates[]: bank, address, length, data
+static void dmpLoadUpdate(uint8_t n, uint8_t *update) {
+    uint16_t pos = 0;
+    while (n--) pos += 3 + pgm_read_byte(&dmpUpdates[pos + 2]);
+    uint8_t size = 3 + pgm_read_byte(&dmpUpdates[pos + 2]);
+    for (uint8_t j = 0; j < size; j++) update[j] = pgm_read_byte(&dmpUpdates[pos + j]);
+}
 
-            DEBUG_PRINTLN(F("Writing final memory update 2/7 (function unknown)..."));
-            for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
-            writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+uint8_t MPU6050::dmpInitialize() {
+    uint8_t step = 0, result;
+    uint32_t wait;
+    while ((result = dmpInitializeStep(&step, &wait)) == MPU6050_DMP_INIT_PENDING) {
+        if (wait) delay((wait + 999) / 1000);
+    }
+    return result;
+}
 
-            DEBUG_PRINTLN(F("Resetting FIFO..."));
-            resetFIFO();
+/** Run the next step of dmpInitialize() without waiting, so several devices
+ * can be brought up at once (see I2CdevBringup). The post-reset settle
+ * delays and the DMP's first output packets are handed back as waits, and
+ * the firmware upload is split into one step per 256-byte memory bank.
+ * In between, the caller is free to use the bus for other devices.
+ * @param step Step counter, 0 to begin; advanced by each call (left alone
+ *        while a step is waiting on the DMP)
+ * @param waitMicros Set to the time to wait before the next call
+ * @return 0 when done, 1 or 2 on failure as for dmpInitialize(), or
+ *         MPU6050_DMP_INIT_PENDING while there are steps left
+ */
+uint8_t MPU6050::dmpInitializeStep(uint8_t *step, uint32_t *waitMicros) {
+    uint8_t dmpUpdate[16];
+    uint16_t fifoCount;
+    uint8_t mpuIntStatus;
+    *waitMicros = 0;
+
+    if (*step == 0) {
+        #ifndef MPU6050_DMP_NO_WARM_START
+            // warm start: firmware and configuration are still resident
+            bool customized;
+            if (dmpIsResident(&customized)) {
+                DEBUG_PRINTLN(F("DMP firmware already resident, skipping upload..."));
+                setDMPEnabled(false);
+                // a previous run changed the packet or rate: back to the
+                // defaults a cold start would load
+                if (customized) {
+                    const uint8_t defaults = 0;
+                    if (dmpSetPacketContent(MPU6050_DMP_SEND_ALL) || dmpSetFIFORate(1)) return 2;
+                    writeMemoryBlock(&defaults, 1, MPU6050_DMP_SIGNATURE_BANK, MPU6050_DMP_CUSTOMIZED_ADDRESS);
+                }
+                // the registers are not covered by the signature and may
+                // have been changed since (e.g. by initialize())
+                dmpSetRegisterDefaults();
+                setFIFOEnabled(true);
+                // this object may be new (MCU reset), so set up the default
+                // packet layout the resident image sends either way
+                dmpPacketSize = MPU6050_DMP_PACKET_SIZE;
+                dmpGyroOffset = 16;
+                dmpAccelOffset = 28;
+                resetFIFO();
+                getIntStatus();
+                return 0; // success
+            }
+        #endif
+
+        // reset device
+        DEBUG_PRINTLN(F("\n\nResetting MPU6050..."));
+        reset();
+        *waitMicros = 30000; // wait after reset
+        *step = 1;
+        return MPU6050_DMP_INIT_PENDING;
+    }
 
-            DEBUG_PRINTLN(F("Reading FIFO count..."));
-            uint16_t fifoCount = getFIFOCount();
-            uint8_t fifoBuffer[128];
+    if (*step == 1) {
+        // enable sleep mode and wake cycle
+        /*Serial.println(F("Enabling sleep mode..."));
+        setSleepEnabled(true);
+        Serial.println(F("Enabling wake cycle..."));
+        setWakeCycleEnabled(true);*/
+
+        // disable sleep mode
+        DEBUG_PRINTLN(F("Disabling sleep mode..."));
+        setSleepEnabled(false);
+
+        // get MPU hardware revision
+        DEBUG_PRINTLN(F("Selecting user bank 16..."));
+        setMemoryBank(0x10, true, true);
+        DEBUG_PRINTLN(F("Selecting memory byte 6..."));
+        setMemoryStartAddress(0x06);
+        DEBUG_PRINTLN(F("Checking hardware revision..."));
+        uint8_t hwRevision = readMemoryByte();
+        DEBUG_PRINT(F("Revision @ user[16][6] = "));
+        DEBUG_PRINTLNF(hwRevision, HEX);
+        DEBUG_PRINTLN(F("Resetting memory bank selection to 0..."));
+        setMemoryBank(0, false, false);
+
+        // check OTP bank valid
+        DEBUG_PRINTLN(F("Reading OTP bank valid flag..."));
+        uint8_t otpValid = getOTPBankValid();
+        DEBUG_PRINT(F("OTP bank is "));
+        DEBUG_PRINTLN(otpValid ? F("valid!") : F("invalid!"));
+
+        // setup weird slave stuff (?)
+        DEBUG_PRINTLN(F("Setting slave 0 address to 0x7F..."));
+        setSlaveAddress(0, 0x7F);
+        DEBUG_PRINTLN(F("Disabling I2C Master mode..."));
+        setI2CMasterModeEnabled(false);
+        DEBUG_PRINTLN(F("Setting slave 0 address to 0x68 (self)..."));
+        setSlaveAddress(0, 0x68);
+        DEBUG_PRINTLN(F("Resetting I2C Master control..."));
+        resetI2CMaster();
+        *waitMicros = 20000;
+        *step = 2;
+        return MPU6050_DMP_INIT_PENDING;
+    }
 
-            DEBUG_PRINT(F("Current FIFO count="));
-            DEBUG_PRINTLN(fifoCount);
-            getFIFOBytes(fifoBuffer, fifoCount);
+    if (*step < MPU6050_DMP_STEP_CONFIG) {
+        // load DMP code into memory banks, one bank per step
+        uint8_t bank = *step - 2;
+        uint16_t offset = (uint16_t)bank << 8;
+        uint16_t size = MPU6050_DMP_CODE_SIZE - offset > 256 ? 256 : MPU6050_DMP_CODE_SIZE - offset;
+        DEBUG_PRINT(F("Writing DMP code to MPU memory bank "));
+        DEBUG_PRINT(bank);
+        DEBUG_PRINT(F(" ("));
+        DEBUG_PRINT(size);
+        DEBUG_PRINTLN(F(" bytes)"));
+        if (!writeProgMemoryBlock(dmpMemory + offset, size, bank, 0)) {
+            DEBUG_PRINTLN(F("ERROR! DMP code verification failed."));
+            return 1; // main binary block loading failed
+        }
+        (*step)++;
+        return MPU6050_DMP_INIT_PENDING;
+    }
 
-            DEBUG_PRINTLN(F("Setting motion detection threshold to 2..."));
-            setMotionDetectionThreshold(2);
+    if (*step == MPU6050_DMP_STEP_CONFIG) {
+        DEBUG_PRINTLN(F("Success! DMP code written and verified."));
 
-            DEBUG_PRINTLN(F("Setting zero-motion detection threshold to 156..."));
-            setZeroMotionDetectionThreshold(156);
+        // write DMP configuration
+        DEBUG_PRINT(F("Writing DMP configuration to MPU memory banks ("));
+        DEBUG_PRINT(MPU6050_DMP_CONFIG_SIZE);
+        DEBUG_PRINTLN(F(" bytes in config def)"));
+        if (!writeProgDMPConfigurationSet(dmpConfig, MPU6050_DMP_CONFIG_SIZE)) {
+            DEBUG_PRINTLN(F("ERROR! DMP configuration verification failed."));
+            return 2; // configuration block loading failed
+        }
+        DEBUG_PRINTLN(F("Success! DMP configuration written and verified."));
 
-            DEBUG_PRINTLN(F("Setting motion detection duration to 80..."));
-            setMotionDetectionDuration(80);
+        // get X/Y/Z gyro offsets (nothing since the reset has changed them)
+        DEBUG_PRINTLN(F("Reading gyro offset TC values..."));
+        int8_t xgOffsetTC = getXGyroOffsetTC();
+        int8_t ygOffsetTC = getYGyroOffsetTC();
+        int8_t zgOffsetTC = getZGyroOffsetTC();
+        DEBUG_PRINT(F("X gyro offset = "));
+        DEBUG_PRINTLN(xgOffsetTC);
+        DEBUG_PRINT(F("Y gyro offset = "));
+        DEBUG_PRINTLN(ygOffsetTC);
+        DEBUG_PRINT(F("Z gyro offset = "));
+        DEBUG_PRINTLN(zgOffsetTC);
 
-            DEBUG_PRINTLN(F("Setting zero-motion detection duration to 0..."));
-            setZeroMotionDetectionDuration(0);
+        dmpSetRegisterDefaults();
 
-            DEBUG_PRINTLN(F("Resetting FIFO..."));
-            resetFIFO();
+        DEBUG_PRINTLN(F("Clearing OTP Bank flag..."));
+        setOTPBankValid(false);
 
-            DEBUG_PRINTLN(F("Enabling FIFO..."));
-            setFIFOEnabled(true);
+        DEBUG_PRINTLN(F("Setting X/Y/Z gyro offset TCs to previous values..."));
+        setXGyroOffsetTC(xgOffsetTC);
+        setYGyroOffsetTC(ygOffsetTC);
+        setZGyroOffsetTC(zgOffsetTC);
 
-            DEBUG_PRINTLN(F("Enabling DMP..."));
-            setDMPEnabled(true);
+        //DEBUG_PRINTLN(F("Setting X/Y/Z gyro user offsets to zero..."));
+        //setXGyroOffset(0);
+        //setYGyroOffset(0);
+        //setZGyroOffset(0);
 
-            DEBUG_PRINTLN(F("Resetting DMP..."));
-            resetDMP();
+        DEBUG_PRINTLN(F("Writing final memory update 1/7 (function unknown)..."));
+        dmpLoadUpdate(0, dmpUpdate);
+        writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
-            DEBUG_PRINTLN(F("Writing final memory update 3/7 (function unknown)..."));
-            for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
-            writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+        DEBUG_PRINTLN(F("Writing final memory update 2/7 (function unknown)..."));
+        dmpLoadUpdate(1, dmpUpdate);
+        writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
-            DEBUG_PRINTLN(F("Writing final memory update 4/7 (function unknown)..."));
-            for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
-            writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+        DEBUG_PRINTLN(F("Resetting FIFO..."));
+        resetFIFO();
 
-            DEBUG_PRINTLN(F("Writing final memory update 5/7 (function unknown)..."));
-            for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
-            writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+        DEBUG_PRINTLN(F("Reading FIFO count..."));
+        fifoCount = getFIFOCount();
 
-            DEBUG_PRINTLN(F("Waiting for FIFO count > 2..."));
-            while ((fifoCount = getFIFOCount()) < 3);
+        DEBUG_PRINT(F("Current FIFO count="));
+        DEBUG_PRINTLN(fifoCount);
+        discardFIFOBytes(fifoCount);
 
-            DEBUG_PRINT(F("Current FIFO count="));
-            DEBUG_PRINTLN(fifoCount);
-            DEBUG_PRINTLN(F("Reading FIFO data..."));
-            getFIFOBytes(fifoBuffer, fifoCount);
+        DEBUG_PRINTLN(F("Resetting FIFO..."));
+        resetFIFO();
 
-            DEBUG_PRINTLN(F("Reading interrupt status..."));
-            uint8_t mpuIntStatus = getIntStatus();
+        DEBUG_PRINTLN(F("Enabling FIFO..."));
+        setFIFOEnabled(true);
 
-            DEBUG_PRINT(F("Current interrupt status="));
-            DEBUG_PRINTLNF(mpuIntStatus, HEX);
+        DEBUG_PRINTLN(F("Enabling DMP..."));
+        setDMPEnabled(true);
 
-            DEBUG_PRINTLN(F("Reading final memory update 6/7 (function unknown)..."));
-            for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
-            readMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+        DEBUG_PRINTLN(F("Resetting DMP..."));
+        resetDMP();
 
-            DEBUG_PRINTLN(F("Waiting for FIFO count > 2..."));
-            while ((fifoCount = getFIFOCount()) < 3);
+        DEBUG_PRINTLN(F("Writing final memory update 3/7 (function unknown)..."));
+        dmpLoadUpdate(2, dmpUpdate);
+        writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
-            DEBUG_PRINT(F("Current FIFO count="));
-            DEBUG_PRINTLN(fifoCount);
+        DEBUG_PRINTLN(F("Writing final memory update 4/7 (function unknown)..."));
+        dmpLoadUpdate(3, dmpUpdate);
+        writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
-            DEBUG_PRINTLN(F("Reading FIFO data..."));
-            getFIFOBytes(fifoBuffer, fifoCount);
+        DEBUG_PRINTLN(F("Writing final memory update 5/7 (function unknown)..."));
+        dmpLoadUpdate(4, dmpUpdate);
+        writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
-            DEBUG_PRINTLN(F("Reading interrupt status..."));
-            mpuIntStatus = getIntStatus();
+        DEBUG_PRINTLN(F("Waiting for FIFO count > 2..."));
+        *waitMicros = MPU6050_DMP_FIFO_POLL_US;
+        (*step)++;
+        return MPU6050_DMP_INIT_PENDING;
+    }
 
-            DEBUG_PRINT(F("Current interrupt status="));
-            DEBUG_PRINTLNF(mpuIntStatus, HEX);
+    // the two remaining steps each wait for DMP output first
+    if ((fifoCount = getFIFOCount()) < 3) {
+        *waitMicros = MPU6050_DMP_FIFO_POLL_US;
+        return MPU6050_DMP_INIT_PENDING;
+    }
 
-            DEBUG_PRINTLN(F("Writing final memory update 7/7 (function unknown)..."));
-            for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
-            writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+    DEBUG_PRINT(F("Current FIFO count="));
+    DEBUG_PRINTLN(fifoCount);
+    DEBUG_PRINTLN(F("Reading FIFO data..."));
+    discardFIFOBytes(fifoCount);
 
-            DEBUG_PRINTLN(F("DMP is good to go! Finally."));
+    DEBUG_PRINTLN(F("Reading interrupt status..."));
+    mpuIntStatus = getIntStatus();
 
-            DEBUG_PRINTLN(F("Disabling DMP (you turn it on later)..."));
-            setDMPEnabled(false);
+    DEBUG_PRINT(F("Current interrupt status="));
+    DEBUG_PRINTLNF(mpuIntStatus, HEX);
 
-            DEBUG_PRINTLN(F("Setting up internal 42-byte (default) DMP packet buffer..."));
-            dmpPacketSize = 42;
-            /*if ((dmpPacketBuffer = (uint8_t *)malloc(42)) == 0) {
-                return 3; // TODO: proper error code for no memory
-            }*/
+    if (*step == MPU6050_DMP_STEP_CONFIG + 1) {
+        DEBUG_PRINTLN(F("Reading final memory update 6/7 (function unknown)..."));
+        dmpLoadUpdate(5, dmpUpdate);
+        readMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
-            DEBUG_PRINTLN(F("Resetting FIFO and clearing INT status one last time..."));
-            resetFIFO();
-            getIntStatus();
-        } else {
-            DEBUG_PRINTLN(F("ERROR! DMP configuration verification failed."));
-            return 2; // configuration block loading failed
-        }
-    } else {
-        DEBUG_PRINTLN(F("ERROR! DMP code verification failed."));
-        return 1; // main binary block loading failed
+        DEBUG_PRINTLN(F("Waiting for FIFO count > 2..."));
+        *waitMicros = MPU6050_DMP_FIFO_POLL_US;
+        (*step)++;
+        return MPU6050_DMP_INIT_PENDING;
     }
+
+    DEBUG_PRINTLN(F("Writing final memory update 7/7 (function unknown)..."));
+    dmpLoadUpdate(6, dmpUpdate);
+    writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
+
+    DEBUG_PRINTLN(F("DMP is good to go! Finally."));
+
+    DEBUG_PRINTLN(F("Disabling DMP (you turn it on later)..."));
+    setDMPEnabled(false);
+
+    DEBUG_PRINTLN(F("Setting up internal 42-byte (default) DMP packet buffer..."));
+    dmpPacketSize = MPU6050_DMP_PACKET_SIZE;
+    dmpGyroOffset = 16;
+    dmpAccelOffset = 28;
+    /*if ((dmpPacketBuffer = (uint8_t *)malloc(42)) == 0) {
+        return 3; // TODO: proper error code for no memory
+    }*/
+
+    DEBUG_PRINTLN(F("Resetting FIFO and clearing INT status one last time..."));
+    resetFIFO();
+    getIntStatus();
+
+    // record the image signature for the next warm start
+    uint16_t signature = dmpGetImageSignature();
+    uint8_t signatureBytes[3] = { (uint8_t)(signature >> 8), (uint8_t)signature, 0 };
+    writeMemoryBlock(signatureBytes, 3, MPU6050_DMP_SIGNATURE_BANK, MPU6050_DMP_SIGNATURE_ADDRESS);
+    (*step)++;
     return 0; // success
 }
 
@@ -551,8 +693,61 @@ bool MPU6050::dmpPacketAvailable() {
     return getFIFOCount() >= dmpGetFIFOPacketSize();
 }
 
-// uint8_t MPU6050::dmpSetFIFORate(uint8_t fifoRate);
-// uint8_t MPU6050::dmpGetFIFORate();
+/** Set the DMP output rate, effective at once.
+ * Packets come out at 200Hz / (1 + fifoRate); dmpInitialize() sets 1
+ * (100Hz). Lower rates cost proportionally fewer FIFO bytes and reads.
+ * @param fifoRate Rate divider (0 = 200Hz, 1 = 100Hz, 9 = 20Hz, ...)
+ * @return 0 on success, 1 if the DMP memory write failed
+ */
+uint8_t MPU6050::dmpSetFIFORate(uint8_t fifoRate) {
+    const uint8_t rate[2] = { 0x00, fifoRate }; // D_0_22 inv_set_fifo_rate
+    const uint8_t customized = 1;
+    if (!writeMemoryBlock(rate, 2, 0x02, 0x16)) return 1;
+    writeMemoryBlock(&customized, 1, MPU6050_DMP_SIGNATURE_BANK, MPU6050_DMP_CUSTOMIZED_ADDRESS);
+    return 0;
+}
+
+/** Get the DMP output rate divider.
+ * @return fifoRate as passed to dmpSetFIFORate()
+ */
+uint8_t MPU6050::dmpGetFIFORate() {
+    uint8_t rate[2];
+    readMemoryBlock(rate, 2, 0x02, 0x16);
+    return rate[1];
+}
+
+/** Choose what each DMP packet carries besides the quaternion, so the FIFO
+ * only holds what is consumed: 18 bytes per packet for orientation alone,
+ * 30 with gyro or accel, 42 with both (the dmpInitialize() default).
+ * Rewrites the CFG_9 (gyro) and CFG_12 (accel) FIFO send steps of the DMP
+ * program, with no-ops (DINAA3) for the parts left out as the MPL does;
+ * updates dmpGetFIFOPacketSize() and the offsets used by dmpGetGyro(),
+ * dmpGetAccel() and dmpDecodePacket(), and resets the FIFO so the next
+ * packet starts on a new boundary. Getters for parts not sent return 1.
+ * @param content MPU6050_DMP_SEND_* bits
+ * @return 0 on success, 1 if a DMP memory write failed
+ */
+uint8_t MPU6050::dmpSetPacketContent(uint8_t content) {
+    static const uint8_t send[4] = { 0xF1, 0x28, 0x30, 0x38 }; // push X, Y, Z
+    static const uint8_t skip[4] = { 0xA3, 0xA3, 0xA3, 0xA3 };
+    bool gyro = content & MPU6050_DMP_SEND_GYRO, accel = content & MPU6050_DMP_SEND_ACCEL;
+    if (!writeMemoryBlock(gyro ? send : skip, 4, 0x07, 0x47)) return 1;   // CFG_9 inv_send_gyro
+    if (!writeMemoryBlock(accel ? send : skip, 4, 0x07, 0x6C)) return 1;  // CFG_12 inv_send_accel
+    const uint8_t customized = 1;
+    writeMemoryBlock(&customized, 1, MPU6050_DMP_SIGNATURE_BANK, MPU6050_DMP_CUSTOMIZED_ADDRESS);
+    dmpGyroOffset = gyro ? 16 : 0;
+    dmpAccelOffset = accel ? (gyro ? 28 : 16) : 0;
+    dmpPacketSize = 18 + (gyro ? 12 : 0) + (accel ? 12 : 0);
+    resetFIFO();
+    return 0;
+}
+
+/** Get the current packet content.
+ * @return MPU6050_DMP_SEND_* bits
+ */
+uint8_t MPU6050::dmpGetPacketContent() {
+    return (dmpGyroOffset ? MPU6050_DMP_SEND_GYRO : 0) | (dmpAccelOffset ? MPU6050_DMP_SEND_ACCEL : 0);
+}
 // uint8_t MPU6050::dmpGetSampleStepSizeMS();
 // uint8_t MPU6050::dmpGetSampleFrequency();
 // int32_t MPU6050::dmpDecodeTemperature(int8_t tempReg);
@@ -575,27 +770,30 @@ bool MPU6050::dmpPacketAvailable() {
 // uint8_t MPU6050::dmpSendEIS(uint_fast16_t elements, uint_fast16_t accuracy);
 
 uint8_t MPU6050::dmpGetAccel(int32_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
+    if (dmpAccelOffset == 0) return 1; // not sent, see dmpSetPacketContent()
     if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = ((packet[28] << 24) + (packet[29] << 16) + (packet[30] << 8) + packet[31]);
-    data[1] = ((packet[32] << 24) + (packet[33] << 16) + (packet[34] << 8) + packet[35]);
-    data[2] = ((packet[36] << 24) + (packet[37] << 16) + (packet[38] << 8) + packet[39]);
+    packet += dmpAccelOffset;
+    data[0] = ((packet[0] << 24) + (packet[1] << 16) + (packet[2] << 8) + packet[3]);
+    data[1] = ((packet[4] << 24) + (packet[5] << 16) + (packet[6] << 8) + packet[7]);
+    data[2] = ((packet[8] << 24) + (packet[9] << 16) + (packet[10] << 8) + packet[11]);
     return 0;
 }
 uint8_t MPU6050::dmpGetAccel(int16_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
+    if (dmpAccelOffset == 0) return 1; // not sent, see dmpSetPacketContent()
     if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = (packet[28] << 8) + packet[29];
-    data[1] = (packet[32] << 8) + packet[33];
-    data[2] = (packet[36] << 8) + packet[37];
+    packet += dmpAccelOffset;
+    data[0] = (packet[0] << 8) + packet[1];
+    data[1] = (packet[4] << 8) + packet[5];
+    data[2] = (packet[8] << 8) + packet[9];
     return 0;
 }
 uint8_t MPU6050::dmpGetAccel(VectorInt16 *v, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
+    if (dmpAccelOffset == 0) return 1; // not sent, see dmpSetPacketContent()
     if (packet == 0) packet = dmpPacketBuffer;
-    v -> x = (packet[28] << 8) + packet[29];
-    v -> y = (packet[32] << 8) + packet[33];
-    v -> z = (packet[36] << 8) + packet[37];
+    packet += dmpAccelOffset;
+    v -> x = (packet[0] << 8) + packet[1];
+    v -> y = (packet[4] << 8) + packet[5];
+    v -> z = (packet[8] << 8) + packet[9];
     return 0;
 }
 uint8_t MPU6050::dmpGetQuaternion(int32_t *data, const uint8_t* packet) {
@@ -632,19 +830,21 @@ uint8_t MPU6050::dmpGetQuaternion(Quaternion *q, const uint8_t* packet) {
 // uint8_t MPU6050::dmpGet6AxisQuaternion(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetRelativeQuaternion(long *data, const uint8_t* packet);
 uint8_t MPU6050::dmpGetGyro(int32_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
+    if (dmpGyroOffset == 0) return 1; // not sent, see dmpSetPacketContent()
     if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = ((packet[16] << 24) + (packet[17] << 16) + (packet[18] << 8) + packet[19]);
-    data[1] = ((packet[20] << 24) + (packet[21] << 16) + (packet[22] << 8) + packet[23]);
-    data[2] = ((packet[24] << 24) + (packet[25] << 16) + (packet[26] << 8) + packet[27]);
+    packet += dmpGyroOffset;
+    data[0] = ((packet[0] << 24) + (packet[1] << 16) + (packet[2] << 8) + packet[3]);
+    data[1] = ((packet[4] << 24) + (packet[5] << 16) + (packet[6] << 8) + packet[7]);
+    data[2] = ((packet[8] << 24) + (packet[9] << 16) + (packet[10] << 8) + packet[11]);
     return 0;
 }
 uint8_t MPU6050::dmpGetGyro(int16_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
+    if (dmpGyroOffset == 0) return 1; // not sent, see dmpSetPacketContent()
     if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = (packet[16] << 8) + packet[17];
-    data[1] = (packet[20] << 8) + packet[21];
-    data[2] = (packet[24] << 8) + packet[25];
+    packet += dmpGyroOffset;
+    data[0] = (packet[0] << 8) + packet[1];
+    data[1] = (packet[4] << 8) + packet[5];
+    data[2] = (packet[8] << 8) + packet[9];
     return 0;
 }
 // uint8_t MPU6050::dmpSetLinearAccelFilterCoefficient(float coef);
@@ -675,6 +875,39 @@ uint8_t MPU6050::dmpGetGravity(VectorFloat *v, Quaternion *q) {
     v -> z = q -> w*q -> w - q -> x*q -> x - q -> y*q -> y + q -> z*q -> z;
     return 0;
 }
+
+#ifdef HELPER_3DMATH_FIXED
+uint8_t MPU6050::dmpGetQuaternion(QuaternionFixed *q, const uint8_t* packet) {
+    // DMP quaternion is already Q30, so only the byte order needs handling
+    // (widened before shifting so this also holds where int is 16 bits)
+    if (packet == 0) packet = dmpPacketBuffer;
+    int32_t *qI[4] = { &q -> w, &q -> x, &q -> y, &q -> z };
+    for (uint8_t i = 0; i < 4; i++, packet += 4) {
+        *qI[i] = ((int32_t)packet[0] << 24) | ((int32_t)packet[1] << 16) | ((int32_t)packet[2] << 8) | packet[3];
+    }
+    return 0;
+}
+uint8_t MPU6050::dmpGetGravity(VectorFixed *v, QuaternionFixed *q) {
+    // Q30 * Q30 = Q60, down to Q15; +1g lands on 32768 so clamp z
+    v -> x = ((int64_t)q -> x*q -> z - (int64_t)q -> w*q -> y) >> 44;
+    v -> y = ((int64_t)q -> w*q -> x + (int64_t)q -> y*q -> z) >> 44;
+    int32_t z = ((int64_t)q -> w*q -> w - (int64_t)q -> x*q -> x - (int64_t)q -> y*q -> y + (int64_t)q -> z*q -> z) >> 45;
+    v -> z = z > 32767 ? 32767 : (z < -32767 ? -32767 : z);
+    return 0;
+}
+uint8_t MPU6050::dmpGetLinearAccel(VectorInt16 *v, VectorInt16 *vRaw, VectorFixed *gravity) {
+    // gravity is Q15, +1g = +8192 in standard DMP FIFO packet
+    v -> x = vRaw -> x - (gravity -> x >> 2);
+    v -> y = vRaw -> y - (gravity -> y >> 2);
+    v -> z = vRaw -> z - (gravity -> z >> 2);
+    return 0;
+}
+uint8_t MPU6050::dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, QuaternionFixed *q) {
+    memcpy(v, vReal, sizeof(VectorInt16));
+    v -> rotate(q);
+    return 0;
+}
+#endif
 // uint8_t MPU6050::dmpGetUnquantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetQuantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetExternalSensorData(long *data, int size, const uint8_t* packet);
@@ -699,6 +932,54 @@ uint8_t MPU6050::dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gra
 // uint8_t MPU6050::dmpGetAccelFloat(float *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetQuaternionFloat(float *data, const uint8_t* packet);
 
+/** Decode quaternion, gyro, accel, gravity and linear accel in one pass.
+ * Gravity is derived from the top 16 bits of the quaternion with integer
+ * math, matching dmpGetGravity() followed by dmpGetLinearAccel(). Pass q
+ * and/or gravity to also get the float forms used by dmpGetYawPitchRoll();
+ * leave them off to skip float conversion entirely.
+ * @param data Decoded packet contents
+ * @param packet Packet to decode (leave off to use dmpPacketBuffer)
+ * @param q Optional float quaternion output
+ * @param gravity Optional float gravity output
+ * @return 0 on success
+ */
+uint8_t MPU6050::dmpDecodePacket(MPU6050_DMPData *data, const uint8_t* packet, Quaternion *q, VectorFloat *gravity) {
+    if (packet == 0) packet = dmpPacketBuffer;
+    int32_t qi[4]; // Q14 copies for the gravity math
+    for (uint8_t i = 0; i < 4; i++) {
+        const uint8_t *p = packet + i*4;
+        data -> quat[i] = ((int32_t)p[0] << 24) | ((int32_t)p[1] << 16) | ((int32_t)p[2] << 8) | p[3];
+        qi[i] = (int16_t)((p[0] << 8) | p[1]);
+    }
+    // parts left out by dmpSetPacketContent() decode as zero
+    const uint8_t *g = packet + dmpGyroOffset, *a = packet + dmpAccelOffset;
+    for (uint8_t i = 0; i < 3; i++) {
+        data -> gyro[i] = dmpGyroOffset ? (int16_t)((g[i*4] << 8) | g[i*4 + 1]) : 0;
+        data -> accel[i] = dmpAccelOffset ? (int16_t)((a[i*4] << 8) | a[i*4 + 1]) : 0;
+    }
+
+    // Q14 * Q14 = Q28, scaled down to the accel's 8192 = 1g (Q13)
+    data -> gravity[0] = (int16_t)((qi[1]*qi[3] - qi[0]*qi[2]) >> 14);                              // 2(xz - wy)
+    data -> gravity[1] = (int16_t)((qi[0]*qi[1] + qi[2]*qi[3]) >> 14);                              // 2(wx + yz)
+    data -> gravity[2] = (int16_t)((qi[0]*qi[0] - qi[1]*qi[1] - qi[2]*qi[2] + qi[3]*qi[3]) >> 15);  // ww - xx - yy + zz
+    for (uint8_t i = 0; i < 3; i++) {
+        data -> linearAccel[i] = dmpAccelOffset ? data -> accel[i] - data -> gravity[i] : 0;
+    }
+
+    if (q != 0) {
+        q -> w = (float)qi[0] / 16384.0f;
+        q -> x = (float)qi[1] / 16384.0f;
+        q -> y = (float)qi[2] / 16384.0f;
+        q -> z = (float)qi[3] / 16384.0f;
+    }
+    if (gravity != 0) {
+        gravity -> x = (float)data -> gravity[0] / 8192.0f;
+        gravity -> y = (float)data -> gravity[1] / 8192.0f;
+        gravity -> z = (float)data -> gravity[2] / 8192.0f;
+    }
+    return 0;
+}
+
 uint8_t MPU6050::dmpProcessFIFOPacket(const unsigned char *dmpData) {
     /*for (uint8_t k = 0; k < dmpPacketSize; k++) {
         if (dmpData[k] < 0x10) Serial.print("0");
@@ -711,7 +992,7 @@ uint8_t MPU6050::dmpProcessFIFOPacket(const unsigned char *dmpData) {
 }
 uint8_t MPU6050::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed) {
     uint8_t status;
-    uint8_t buf[dmpPacketSize];
+    uint8_t buf[MPU6050_DMP_PACKET_SIZE];
     for (uint8_t i = 0; i < numPackets; i++) {
         // read packet from FIFO
         getFIFOBytes(buf, dmpPacketSize);
@@ -720,8 +1001,40 @@ uint8_t MPU6050::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *proces
         if ((status = dmpProcessFIFOPacket(buf)) > 0) return status;
         
         // increment external process count variable, if supplied
-        if (processed != 0) *processed++;
+        if (processed != 0) (*processed)++;
+    }
+    return 0;
+}
+
+/** Drain as many whole DMP packets as fit in a buffer with one burst read.
+ * A full FIFO means data has already been lost and the remaining contents
+ * may no longer start on a packet boundary, so the FIFO is reset and the
+ * batch comes back empty; the next call resumes on a fresh packet boundary.
+ * A trailing partial packet is left in the FIFO for the next call.
+ * @param buffer Storage for the packets (a multiple of dmpPacketSize is best)
+ * @param bufferSize Size of buffer in bytes
+ * @param batch Filled with the packets read, iterate with batch->next()
+ * @return 0 on success, 1 if the FIFO overflowed and was reset, 2 on read failure
+ */
+uint8_t MPU6050::dmpReadFIFOBatch(uint8_t *buffer, uint16_t bufferSize, MPU6050_FIFOBatch *batch) {
+    batch -> buffer = buffer;
+    batch -> packetSize = dmpPacketSize;
+    batch -> count = 0;
+    batch -> index = 0;
+
+    uint16_t fifoCount = getFIFOCount();
+    if (fifoCount >= MPU6050_FIFO_SIZE) {
+        resetFIFO();
+        return 1;
     }
+
+    uint16_t packets = fifoCount / dmpPacketSize;
+    if (packets > bufferSize / dmpPacketSize) packets = bufferSize / dmpPacketSize;
+    if (packets == 0) return 0;
+
+    uint16_t length = packets * dmpPacketSize;
+    if (bus -> readBlock(devAddr, MPU6050_RA_FIFO_R_W, length, buffer) != (int16_t)length) return 2;
+    batch -> count = packets;
     return 0;
 }
 
@@ -43,7 +43,7 @@ THE SOFTWARE.
 
 // Tom Carpenter's conditional PROGMEM code
 // http://forum.arduino.cc/index.php?topic=129407.0
-#ifndef __arm__
+#if !defined(__arm__) && I2CDEV_IMPLEMENTATION != I2CDEV_HOST_SIMULATION
     #include <avr/pgmspace.h>
 #else
     // Teensy 3.0 library conditional PROGMEM code from Paul Stoffregen
@@ -107,6 +107,11 @@ THE SOFTWARE.
 #define MPU6050_DMP_CODE_SIZE       1962    // dmpMemory[]
 #define MPU6050_DMP_CONFIG_SIZE     232     // dmpConfig[]
 #define MPU6050_DMP_UPDATES_SIZE    140     // dmpUpdates[]
+#define MPU6050_DMP_PACKET_SIZE     48      // quaternion, gyro, accel, mag + footer
+
+// warm-start signature, stored just past the end of the firmware image
+#define MPU6050_DMP_SIGNATURE_BANK      (MPU6050_DMP_CODE_SIZE >> 8)
+#define MPU6050_DMP_SIGNATURE_ADDRESS   (MPU6050_DMP_CODE_SIZE & 0xFF)
 
 /* ================================================================================================ *
  | Default MotionApps v4.1 48-byte FIFO packet structure:                                           |
@@ -334,7 +339,71 @@ const prog_uchar dmpUpdates[MPU6050_DMP_UPDATES_SIZE] PROGMEM = {
     0x00,   0x60,   0x04,   0x00, 0x40, 0x00, 0x00
 };
 
+/** Compute the warm-start signature of the compiled DMP image.
+ * CRC-16 of the firmware, configuration and update tables, so any change to
+ * the image (or switching MotionApps versions) invalidates a resident copy.
+ */
+uint16_t MPU6050::dmpGetImageSignature() {
+    return getMemoryImageCRC(dmpMemory, MPU6050_DMP_CODE_SIZE, true)
+        ^ getMemoryImageCRC(dmpConfig, MPU6050_DMP_CONFIG_SIZE, true)
+        ^ getMemoryImageCRC(dmpUpdates, MPU6050_DMP_UPDATES_SIZE, true);
+}
+/** Check whether this firmware image is already loaded and configured.
+ * dmpInitialize() finishes by storing the image signature in the two DMP
+ * memory bytes just past the firmware, which the upload never writes. Those
+ * bytes and the cleared SLEEP bit only survive while the MPU stays powered,
+ * so a match means the upload and configuration can be skipped. Anything
+ * that disturbs them (power loss, reset(), another image) forces a cold load.
+ * @return True if the resident DMP matches the compiled image
+ */
+bool MPU6050::dmpIsResident() {
+    uint8_t signature[2];
+    if (getSleepEnabled()) return false;
+    readMemoryBlock(signature, 2, MPU6050_DMP_SIGNATURE_BANK, MPU6050_DMP_SIGNATURE_ADDRESS);
+    return (((uint16_t)signature[0] << 8) | signature[1]) == dmpGetImageSignature();
+}
+
+/** Write the MPU register settings the DMP image expects.
+ * The warm start's counterpart to the register writes dmpInitialize()
+ * spreads through the cold load (between the AK8975 and memory updates);
+ * they are not covered by the signature, and initialize() or the sketch
+ * may have changed them (the default initialize() selects the X gyro clock
+ * and +/- 250 deg/sec). The AK8975 slave setup is left alone.
+ */
+void MPU6050::dmpSetRegisterDefaults() {
+    setIntEnabled(0x12);
+    setRate(4); // 1khz / (1 + 4) = 200 Hz
+    setClockSource(MPU6050_CLOCK_PLL_ZGYRO);
+    setDLPFMode(MPU6050_DLPF_BW_42);
+    setExternalFrameSync(MPU6050_EXT_SYNC_TEMP_OUT_L);
+    setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
+    setDMPConfig1(0x03);
+    setDMPConfig2(0x00);
+    bus -> writeByte(devAddr, MPU6050_RA_PWR_MGMT_2, 0x00);
+    bus -> writeByte(devAddr, MPU6050_RA_ACCEL_CONFIG, 0x00);
+    setMotionDetectionThreshold(2);
+    setZeroMotionDetectionThreshold(156);
+    setMotionDetectionDuration(80);
+    setZeroMotionDetectionDuration(0);
+    bus -> writeByte(devAddr, MPU6050_RA_INT_PIN_CFG, 0x00);
+    setI2CMasterModeEnabled(true);
+    setFIFOEnabled(true);
+}
+
 uint8_t MPU6050::dmpInitialize() {
+    #ifndef MPU6050_DMP_NO_WARM_START
+        // warm start: firmware and configuration are still resident
+        if (dmpIsResident()) {
+            DEBUG_PRINTLN(F("DMP firmware already resident, skipping upload..."));
+            setDMPEnabled(false);
+            dmpSetRegisterDefaults();
+            dmpPacketSize = MPU6050_DMP_PACKET_SIZE;
+            resetFIFO();
+            getIntStatus();
+            return 0; // success
+        }
+    #endif
+
     // reset device
     DEBUG_PRINTLN(F("\n\nResetting MPU6050..."));
     reset();
@@ -380,10 +449,10 @@ uint8_t MPU6050::dmpInitialize() {
     DEBUG_PRINT(F("Z gyro offset = "));
     DEBUG_PRINTLN(zgOffset);
     
-    I2Cdev::readByte(devAddr, MPU6050_RA_USER_CTRL, buffer); // ?
+    bus -> readByte(devAddr, MPU6050_RA_USER_CTRL, buffer); // ?
     
     DEBUG_PRINTLN(F("Enabling interrupt latch, clear on any read, AUX bypass enabled"));
-    I2Cdev::writeByte(devAddr, MPU6050_RA_INT_PIN_CFG, 0x32);
+    bus -> writeByte(devAddr, MPU6050_RA_INT_PIN_CFG, 0x32);
 
     // enable MPU AUX I2C bypass mode
     //DEBUG_PRINTLN(F("Enabling AUX I2C bypass mode..."));
@@ -391,16 +460,16 @@ uint8_t MPU6050::dmpInitialize() {
 
     DEBUG_PRINTLN(F("Setting magnetometer mode to power-down..."));
     //mag -> setMode(0);
-    I2Cdev::writeByte(0x0E, 0x0A, 0x00);
+    bus -> writeByte(0x0E, 0x0A, 0x00);
 
     DEBUG_PRINTLN(F("Setting magnetometer mode to fuse access..."));
     //mag -> setMode(0x0F);
-    I2Cdev::writeByte(0x0E, 0x0A, 0x0F);
+    bus -> writeByte(0x0E, 0x0A, 0x0F);
 
     DEBUG_PRINTLN(F("Reading mag magnetometer factory calibration..."));
     int8_t asax, asay, asaz;
     //mag -> getAdjustment(&asax, &asay, &asaz);
-    I2Cdev::readBytes(0x0E, 0x10, 3, buffer);
+    bus -> readBytes(0x0E, 0x10, 3, buffer);
     asax = (int8_t)buffer[0];
     asay = (int8_t)buffer[1];
     asaz = (int8_t)buffer[2];
@@ -413,7 +482,7 @@ uint8_t MPU6050::dmpInitialize() {
 
     DEBUG_PRINTLN(F("Setting magnetometer mode to power-down..."));
     //mag -> setMode(0);
-    I2Cdev::writeByte(0x0E, 0x0A, 0x00);
+    bus -> writeByte(0x0E, 0x0A, 0x00);
 
     // load DMP code into memory banks
     DEBUG_PRINT(F("Writing DMP code to MPU memory banks ("));
@@ -480,12 +549,11 @@ uint8_t MPU6050::dmpInitialize() {
             resetFIFO();
 
             DEBUG_PRINTLN(F("Reading FIFO count..."));
-            uint8_t fifoCount = getFIFOCount();
+            uint16_t fifoCount = getFIFOCount();
 
             DEBUG_PRINT(F("Current FIFO count="));
             DEBUG_PRINTLN(fifoCount);
-            uint8_t fifoBuffer[128];
-            //getFIFOBytes(fifoBuffer, fifoCount);
+            //discardFIFOBytes(fifoCount);
 
             DEBUG_PRINTLN(F("Writing final memory update 3/19 (function unknown)..."));
             for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
@@ -496,10 +564,10 @@ uint8_t MPU6050::dmpInitialize() {
             writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
             DEBUG_PRINTLN(F("Disabling all standby flags..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_PWR_MGMT_2, 0x00);
+            bus -> writeByte(0x68, MPU6050_RA_PWR_MGMT_2, 0x00);
 
             DEBUG_PRINTLN(F("Setting accelerometer sensitivity to +/- 2g..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_ACCEL_CONFIG, 0x00);
+            bus -> writeByte(0x68, MPU6050_RA_ACCEL_CONFIG, 0x00);
 
             DEBUG_PRINTLN(F("Setting motion detection threshold to 2..."));
             setMotionDetectionThreshold(2);
@@ -515,39 +583,39 @@ uint8_t MPU6050::dmpInitialize() {
 
             DEBUG_PRINTLN(F("Setting AK8975 to single measurement mode..."));
             //mag -> setMode(1);
-            I2Cdev::writeByte(0x0E, 0x0A, 0x01);
+            bus -> writeByte(0x0E, 0x0A, 0x01);
 
             // setup AK8975 (0x0E) as Slave 0 in read mode
             DEBUG_PRINTLN(F("Setting up AK8975 read slave 0..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_ADDR, 0x8E);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_REG,  0x01);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_CTRL, 0xDA);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV0_ADDR, 0x8E);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV0_REG,  0x01);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV0_CTRL, 0xDA);
 
             // setup AK8975 (0x0E) as Slave 2 in write mode
             DEBUG_PRINTLN(F("Setting up AK8975 write slave 2..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_ADDR, 0x0E);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_REG,  0x0A);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_CTRL, 0x81);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_DO,   0x01);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV2_ADDR, 0x0E);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV2_REG,  0x0A);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV2_CTRL, 0x81);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV2_DO,   0x01);
 
             // setup I2C timing/delay control
             DEBUG_PRINTLN(F("Setting up slave access delay..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV4_CTRL, 0x18);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_MST_DELAY_CTRL, 0x05);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_SLV4_CTRL, 0x18);
+            bus -> writeByte(0x68, MPU6050_RA_I2C_MST_DELAY_CTRL, 0x05);
 
             // enable interrupts
             DEBUG_PRINTLN(F("Enabling default interrupt behavior/no bypass..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_INT_PIN_CFG, 0x00);
+            bus -> writeByte(0x68, MPU6050_RA_INT_PIN_CFG, 0x00);
 
             // enable I2C master mode and reset DMP/FIFO
             DEBUG_PRINTLN(F("Enabling I2C master mode..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20);
+            bus -> writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20);
             DEBUG_PRINTLN(F("Resetting FIFO..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x24);
+            bus -> writeByte(0x68, MPU6050_RA_USER_CTRL, 0x24);
             DEBUG_PRINTLN(F("Rewriting I2C master mode enabled because...I don't know"));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20);
+            bus -> writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20);
             DEBUG_PRINTLN(F("Enabling and resetting DMP/FIFO..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0xE8);
+            bus -> writeByte(0x68, MPU6050_RA_USER_CTRL, 0xE8);
 
             DEBUG_PRINTLN(F("Writing final memory update 5/19 (function unknown)..."));
             for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
@@ -602,7 +670,7 @@ uint8_t MPU6050::dmpInitialize() {
             DEBUG_PRINTLN(F("Waiting for FIRO count >= 46..."));
             while ((fifoCount = getFIFOCount()) < 46);
             DEBUG_PRINTLN(F("Reading FIFO..."));
-            getFIFOBytes(fifoBuffer, min(fifoCount, 128)); // safeguard only 128 bytes
+            discardFIFOBytes(fifoCount);
             DEBUG_PRINTLN(F("Reading interrupt status..."));
             getIntStatus();
 
@@ -613,13 +681,13 @@ uint8_t MPU6050::dmpInitialize() {
             DEBUG_PRINTLN(F("Waiting for FIRO count >= 48..."));
             while ((fifoCount = getFIFOCount()) < 48);
             DEBUG_PRINTLN(F("Reading FIFO..."));
-            getFIFOBytes(fifoBuffer, min(fifoCount, 128)); // safeguard only 128 bytes
+            discardFIFOBytes(fifoCount);
             DEBUG_PRINTLN(F("Reading interrupt status..."));
             getIntStatus();
             DEBUG_PRINTLN(F("Waiting for FIRO count >= 48..."));
             while ((fifoCount = getFIFOCount()) < 48);
             DEBUG_PRINTLN(F("Reading FIFO..."));
-            getFIFOBytes(fifoBuffer, min(fifoCount, 128)); // safeguard only 128 bytes
+            discardFIFOBytes(fifoCount);
             DEBUG_PRINTLN(F("Reading interrupt status..."));
             getIntStatus();
 
@@ -631,7 +699,7 @@ uint8_t MPU6050::dmpInitialize() {
             setDMPEnabled(false);
 
             DEBUG_PRINTLN(F("Setting up internal 48-byte (default) DMP packet buffer..."));
-            dmpPacketSize = 48;
+            dmpPacketSize = MPU6050_DMP_PACKET_SIZE;
             /*if ((dmpPacketBuffer = (uint8_t *)malloc(42)) == 0) {
                 return 3; // TODO: proper error code for no memory
             }*/
@@ -639,6 +707,11 @@ uint8_t MPU6050::dmpInitialize() {
             DEBUG_PRINTLN(F("Resetting FIFO and clearing INT status one last time..."));
             resetFIFO();
             getIntStatus();
+
+            // record the image signature for the next warm start
+            uint16_t signature = dmpGetImageSignature();
+            uint8_t signatureBytes[2] = { (uint8_t)(signature >> 8), (uint8_t)signature };
+            writeMemoryBlock(signatureBytes, 2, MPU6050_DMP_SIGNATURE_BANK, MPU6050_DMP_SIGNATURE_ADDRESS);
         } else {
             DEBUG_PRINTLN(F("ERROR! DMP configuration verification failed."));
             return 2; // configuration block loading failed
@@ -822,7 +895,7 @@ uint8_t MPU6050::dmpProcessFIFOPacket(const unsigned char *dmpData) {
 }
 uint8_t MPU6050::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed) {
     uint8_t status;
-    uint8_t buf[dmpPacketSize];
+    uint8_t buf[MPU6050_DMP_PACKET_SIZE];
     for (uint8_t i = 0; i < numPackets; i++) {
         // read packet from FIFO
         getFIFOBytes(buf, dmpPacketSize);
@@ -831,7 +904,7 @@ uint8_t MPU6050::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *proces
         if ((status = dmpProcessFIFOPacket(buf)) > 0) return status;
         
         // increment external process count variable, if supplied
-        if (processed != 0) *processed++;
+        if (processed != 0) (*processed)++;
     }
     return 0;
 }
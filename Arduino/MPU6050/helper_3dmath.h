@@ -3,6 +3,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - add optional Q30/Q15 fixed-point quaternion and vector classes
 //     2012-06-05 - add 3D math helper file to DMP6 example sketch
 
 /* ============================================
@@ -32,6 +33,10 @@ THE SOFTWARE.
 #ifndef _HELPER_3DMATH_H_
 #define _HELPER_3DMATH_H_
 
+// Define HELPER_3DMATH_FIXED before including the MotionApps header to get the
+// QuaternionFixed/VectorFixed classes and the matching dmpGet*() overloads,
+// which avoid software float and sqrt() entirely.
+
 class Quaternion {
     public:
         float w;
@@ -89,6 +94,100 @@ class Quaternion {
         }
 };
 
+#ifdef HELPER_3DMATH_FIXED
+/** Reciprocal square root for fixed-point normalization.
+ * Scales v by a power of 4 into [2^28, 2^30), i.e. [0.25, 1.0) in Q30, then
+ * refines a linear seed with four Newton steps, y = y * (3 - v*y*y) / 2.
+ * @param v Value to take the reciprocal square root of (must be nonzero)
+ * @param shift Power of 2 the result must be divided by, from the scaling
+ * @return 1/sqrt(scaled v) in Q30, in the range (1.0, 2.0]
+ */
+static inline uint32_t helper3dInvSqrt(uint32_t v, int8_t *shift) {
+    int8_t k = 0;
+    while (v >= 0x40000000UL) { v >>= 2; k++; }
+    while (v < 0x10000000UL) { v <<= 2; k--; }
+    *shift = k;
+    int64_t y = 0x90000000LL - v - (v >> 2); // 2.25 - 1.25v
+    for (uint8_t i = 0; i < 4; i++) {
+        int64_t t = ((((int64_t)v * y) >> 30) * y) >> 30;
+        y = (y * (0xC0000000LL - t)) >> 31;
+    }
+    return (uint32_t)y;
+}
+
+class QuaternionFixed {
+    public:
+        int32_t w; // all Q30 (1073741824 = 1.0), the DMP's native format
+        int32_t x;
+        int32_t y;
+        int32_t z;
+
+        QuaternionFixed() {
+            w = 0x40000000L;
+            x = 0;
+            y = 0;
+            z = 0;
+        }
+
+        QuaternionFixed(int32_t nw, int32_t nx, int32_t ny, int32_t nz) {
+            w = nw;
+            x = nx;
+            y = ny;
+            z = nz;
+        }
+
+        QuaternionFixed getProduct(QuaternionFixed q) {
+            // same terms as Quaternion::getProduct(), Q30 * Q30 = Q60 >> 30
+            return QuaternionFixed(
+                ((int64_t)w*q.w - (int64_t)x*q.x - (int64_t)y*q.y - (int64_t)z*q.z) >> 30,  // new w
+                ((int64_t)w*q.x + (int64_t)x*q.w + (int64_t)y*q.z - (int64_t)z*q.y) >> 30,  // new x
+                ((int64_t)w*q.y - (int64_t)x*q.z + (int64_t)y*q.w + (int64_t)z*q.x) >> 30,  // new y
+                ((int64_t)w*q.z + (int64_t)x*q.y - (int64_t)y*q.x + (int64_t)z*q.w) >> 30); // new z
+        }
+
+        QuaternionFixed getConjugate() {
+            return QuaternionFixed(w, -x, -y, -z);
+        }
+
+        void normalize() {
+            // squares >> 34 keep the sum of four within 32 bits
+            uint32_t m = (uint32_t)(((int64_t)w*w) >> 34) + (uint32_t)(((int64_t)x*x) >> 34)
+                       + (uint32_t)(((int64_t)y*y) >> 34) + (uint32_t)(((int64_t)z*z) >> 34);
+            if (m == 0) return;
+            int8_t k;
+            int64_t r = helper3dInvSqrt(m, &k);
+            w = ((int64_t)w * r) >> (32 + k);
+            x = ((int64_t)x * r) >> (32 + k);
+            y = ((int64_t)y * r) >> (32 + k);
+            z = ((int64_t)z * r) >> (32 + k);
+        }
+
+        QuaternionFixed getNormalized() {
+            QuaternionFixed r(w, x, y, z);
+            r.normalize();
+            return r;
+        }
+
+        Quaternion toFloat() {
+            return Quaternion(w / 1073741824.0f, x / 1073741824.0f, y / 1073741824.0f, z / 1073741824.0f);
+        }
+};
+
+/** Rotate an integer vector by a Q30 quaternion in place.
+ * Uses v' = v + w*t + u x t with t = 2(u x v), which costs far fewer
+ * multiplies than the two full quaternion products of q * v * conj(q).
+ * The vector keeps whatever scale it came in with.
+ */
+static inline void helper3dRotate(int16_t *vx, int16_t *vy, int16_t *vz, const QuaternionFixed *q) {
+    int32_t tx = ((int64_t)q -> y * *vz - (int64_t)q -> z * *vy) >> 29;
+    int32_t ty = ((int64_t)q -> z * *vx - (int64_t)q -> x * *vz) >> 29;
+    int32_t tz = ((int64_t)q -> x * *vy - (int64_t)q -> y * *vx) >> 29;
+    *vx += ((int64_t)q -> w * tx + (int64_t)q -> y * tz - (int64_t)q -> z * ty) >> 30;
+    *vy += ((int64_t)q -> w * ty + (int64_t)q -> z * tx - (int64_t)q -> x * tz) >> 30;
+    *vz += ((int64_t)q -> w * tz + (int64_t)q -> x * ty - (int64_t)q -> y * tx) >> 30;
+}
+#endif
+
 class VectorInt16 {
     public:
         int16_t x;
@@ -154,6 +253,18 @@ class VectorInt16 {
             r.rotate(q);
             return r;
         }
+
+#ifdef HELPER_3DMATH_FIXED
+        void rotate(QuaternionFixed *q) {
+            helper3dRotate(&x, &y, &z, q);
+        }
+
+        VectorInt16 getRotated(QuaternionFixed *q) {
+            VectorInt16 r(x, y, z);
+            r.rotate(q);
+            return r;
+        }
+#endif
 };
 
 class VectorFloat {
@@ -213,4 +324,64 @@ class VectorFloat {
         }
 };
 
+#ifdef HELPER_3DMATH_FIXED
+class VectorFixed {
+    public:
+        int16_t x; // all Q15 (32767 = ~1.0)
+        int16_t y;
+        int16_t z;
+
+        VectorFixed() {
+            x = 0;
+            y = 0;
+            z = 0;
+        }
+
+        VectorFixed(int16_t nx, int16_t ny, int16_t nz) {
+            x = nx;
+            y = ny;
+            z = nz;
+        }
+
+        void normalize() {
+            // each square fits int32, but three full-scale ones overflow it
+            uint32_t m = (uint32_t)((int32_t)x*x) + (uint32_t)((int32_t)y*y) + (uint32_t)((int32_t)z*z);
+            if (m == 0) return;
+            int8_t k;
+            int64_t r = helper3dInvSqrt(m, &k);
+            // a full-scale component would land on +/-32768, so clamp to Q15 range
+            int32_t n[3] = { (int32_t)(((int64_t)x * r) >> (30 + k)),
+                             (int32_t)(((int64_t)y * r) >> (30 + k)),
+                             (int32_t)(((int64_t)z * r) >> (30 + k)) };
+            for (uint8_t i = 0; i < 3; i++) {
+                if (n[i] > 32767) n[i] = 32767;
+                else if (n[i] < -32767) n[i] = -32767;
+            }
+            x = n[0];
+            y = n[1];
+            z = n[2];
+        }
+
+        VectorFixed getNormalized() {
+            VectorFixed r(x, y, z);
+            r.normalize();
+            return r;
+        }
+
+        void rotate(QuaternionFixed *q) {
+            helper3dRotate(&x, &y, &z, q);
+        }
+
+        VectorFixed getRotated(QuaternionFixed *q) {
+            VectorFixed r(x, y, z);
+            r.rotate(q);
+            return r;
+        }
+
+        VectorFloat toFloat() {
+            return VectorFloat(x / 32768.0f, y / 32768.0f, z / 32768.0f);
+        }
+};
+#endif
+
 #endif /* _HELPER_3DMATH_H_ */
\ No newline at end of file
@@ -0,0 +1,482 @@
+// I2C device class (I2Cdev) 3D math helper: Madgwick/Mahony AHRS sensor fusion
+// For accelerometer + gyroscope (+ magnetometer) stacks without a DMP, e.g.
+// ADXL345 + ITG3200/L3G4200D + HMC5883L
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Filters keep their orientation in the Quaternion/QuaternionFixed classes
+// of helper_3dmath.h, so the result can go through the same rotate() and
+// dmpGet*()-style math as a DMP quaternion. Gyro input is raw LSBs times a
+// per-part scale (rad/s per LSB, see HELPER_AHRS_*_SCALE); accelerometer
+// and magnetometer input is only used as a direction, so raw counts in any
+// range work as they are. All three sensors must be mapped onto the same
+// body axes by the caller before the update.
+//
+// The algorithms follow S. Madgwick's open-source reference implementations
+// (gradient descent, Madgwick 2010; complementary PI filter, Mahony 2008).
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_AHRS_H_
+#define _HELPER_AHRS_H_
+
+// Define HELPER_3DMATH_FIXED before including this header to also get
+// MahonyAHRSFixed, which runs on Q30/Q15 integers with no float or sqrt().
+#include "helper_3dmath.h"
+
+// gyro scales in rad/s per LSB
+#define HELPER_AHRS_DEG_TO_RAD          0.0174532925f
+#define HELPER_AHRS_ITG3200_SCALE       (HELPER_AHRS_DEG_TO_RAD / 14.375f)  // fixed +/-2000 deg/s
+#define HELPER_AHRS_L3G4200D_SCALE_250  (HELPER_AHRS_DEG_TO_RAD * 0.00875f)
+#define HELPER_AHRS_L3G4200D_SCALE_500  (HELPER_AHRS_DEG_TO_RAD * 0.0175f)
+#define HELPER_AHRS_L3G4200D_SCALE_2000 (HELPER_AHRS_DEG_TO_RAD * 0.07f)
+
+// default gains: Madgwick beta, Mahony 2 * proportional and 2 * integral
+#define HELPER_AHRS_MADGWICK_BETA       0.1f
+#define HELPER_AHRS_MAHONY_TWO_KP       1.0f
+#define HELPER_AHRS_MAHONY_TWO_KI       0.0f
+
+/** Fast approximate 1/sqrt(x) for x > 0: the bit-level seed refined by one
+ * Newton step, within 0.2% of the exact value. Every filter step ends with
+ * a quaternion normalization, so the error does not accumulate.
+ */
+static inline float helperAhrsInvSqrt(float x) {
+    union { float f; int32_t i; } u;
+    u.f = x;
+    u.i = 0x5F3759DFL - (u.i >> 1);
+    return u.f * (1.5f - 0.5f * x * u.f * u.f);
+}
+
+/** Advance q by gyro rates already multiplied by dt / 2 (radians) and
+ * renormalize it; the integration step shared by both float filters.
+ */
+static inline void helperAhrsIntegrate(Quaternion *q, float gx, float gy, float gz) {
+    float pw = q -> w, px = q -> x, py = q -> y, pz = q -> z;
+    float qw = pw - px*gx - py*gy - pz*gz;
+    float qx = px + pw*gx + py*gz - pz*gy;
+    float qy = py + pw*gy - px*gz + pz*gx;
+    float qz = pz + pw*gz + px*gy - py*gx;
+    float r = helperAhrsInvSqrt(qw*qw + qx*qx + qy*qy + qz*qz);
+    q -> w = qw * r;
+    q -> x = qx * r;
+    q -> y = qy * r;
+    q -> z = qz * r;
+}
+
+/** Madgwick gradient-descent orientation filter. beta trades gyro drift
+ * correction against accelerometer noise (larger = faster convergence).
+ */
+class MadgwickAHRS {
+    public:
+        Quaternion q;
+        float beta;
+
+        /** @param samplePeriod Seconds between updates (1 / output data rate)
+         * @param gyroScale rad/s per raw gyro LSB, for updateRaw()/updateBlock()
+         */
+        MadgwickAHRS(float samplePeriod, float gyroScale, float nbeta=HELPER_AHRS_MADGWICK_BETA) {
+            dt = samplePeriod;
+            scale = gyroScale;
+            beta = nbeta;
+        }
+
+        void setSamplePeriod(float samplePeriod) { dt = samplePeriod; }
+        void reset() { q = Quaternion(); }
+        Quaternion getQuaternion() { return q; }
+
+        /** Accelerometer + gyroscope step; gyro in rad/s. A zero accel
+         * vector (free fall or missing sample) integrates the gyro only.
+         */
+        void update(float gx, float gy, float gz, float ax, float ay, float az) {
+            float q0 = q.w, q1 = q.x, q2 = q.y, q3 = q.z;
+            float qDot0 = 0.5f * (-q1*gx - q2*gy - q3*gz);
+            float qDot1 = 0.5f * ( q0*gx + q2*gz - q3*gy);
+            float qDot2 = 0.5f * ( q0*gy - q1*gz + q3*gx);
+            float qDot3 = 0.5f * ( q0*gz + q1*gy - q2*gx);
+
+            if (ax != 0.0f || ay != 0.0f || az != 0.0f) {
+                float r = helperAhrsInvSqrt(ax*ax + ay*ay + az*az);
+                ax *= r;
+                ay *= r;
+                az *= r;
+
+                float _2q0 = 2.0f*q0, _2q1 = 2.0f*q1, _2q2 = 2.0f*q2, _2q3 = 2.0f*q3;
+                float _4q0 = 4.0f*q0, _4q1 = 4.0f*q1, _4q2 = 4.0f*q2;
+                float _8q1 = 8.0f*q1, _8q2 = 8.0f*q2;
+                float q0q0 = q0*q0, q1q1 = q1*q1, q2q2 = q2*q2, q3q3 = q3*q3;
+
+                // gradient of the gravity objective function
+                float s0 = _4q0*q2q2 + _2q2*ax + _4q0*q1q1 - _2q1*ay;
+                float s1 = _4q1*q3q3 - _2q3*ax + 4.0f*q0q0*q1 - _2q0*ay - _4q1 + _8q1*q1q1 + _8q1*q2q2 + _4q1*az;
+                float s2 = 4.0f*q0q0*q2 + _2q0*ax + _4q2*q3q3 - _2q3*ay - _4q2 + _8q2*q1q1 + _8q2*q2q2 + _4q2*az;
+                float s3 = 4.0f*q1q1*q3 - _2q1*ax + 4.0f*q2q2*q3 - _2q2*ay;
+                applyStep(&qDot0, &qDot1, &qDot2, &qDot3, s0, s1, s2, s3);
+            }
+            integrate(qDot0, qDot1, qDot2, qDot3);
+        }
+
+        /** Accelerometer + gyroscope + magnetometer step; gyro in rad/s. A
+         * zero magnetometer vector falls back to update() without it.
+         */
+        void update(float gx, float gy, float gz, float ax, float ay, float az, float mx, float my, float mz) {
+            if (mx == 0.0f && my == 0.0f && mz == 0.0f) {
+                update(gx, gy, gz, ax, ay, az);
+                return;
+            }
+            float q0 = q.w, q1 = q.x, q2 = q.y, q3 = q.z;
+            float qDot0 = 0.5f * (-q1*gx - q2*gy - q3*gz);
+            float qDot1 = 0.5f * ( q0*gx + q2*gz - q3*gy);
+            float qDot2 = 0.5f * ( q0*gy - q1*gz + q3*gx);
+            float qDot3 = 0.5f * ( q0*gz + q1*gy - q2*gx);
+
+            if (ax != 0.0f || ay != 0.0f || az != 0.0f) {
+                float r = helperAhrsInvSqrt(ax*ax + ay*ay + az*az);
+                ax *= r;
+                ay *= r;
+                az *= r;
+                r = helperAhrsInvSqrt(mx*mx + my*my + mz*mz);
+                mx *= r;
+                my *= r;
+                mz *= r;
+
+                float _2q0mx = 2.0f*q0*mx, _2q0my = 2.0f*q0*my, _2q0mz = 2.0f*q0*mz, _2q1mx = 2.0f*q1*mx;
+                float _2q0 = 2.0f*q0, _2q1 = 2.0f*q1, _2q2 = 2.0f*q2, _2q3 = 2.0f*q3;
+                float _2q0q2 = 2.0f*q0*q2, _2q2q3 = 2.0f*q2*q3;
+                float q0q0 = q0*q0, q0q1 = q0*q1, q0q2 = q0*q2, q0q3 = q0*q3;
+                float q1q1 = q1*q1, q1q2 = q1*q2, q1q3 = q1*q3;
+                float q2q2 = q2*q2, q2q3 = q2*q3, q3q3 = q3*q3;
+
+                // reference direction of the earth's field (x north, z down)
+                float hx = mx*q0q0 - _2q0my*q3 + _2q0mz*q2 + mx*q1q1 + _2q1*my*q2 + _2q1*mz*q3 - mx*q2q2 - mx*q3q3;
+                float hy = _2q0mx*q3 + my*q0q0 - _2q0mz*q1 + _2q1mx*q2 - my*q1q1 + my*q2q2 + _2q2*mz*q3 - my*q3q3;
+                float _2bx = sqrt(hx*hx + hy*hy);
+                float _2bz = -_2q0mx*q2 + _2q0my*q1 + mz*q0q0 + _2q1mx*q3 - mz*q1q1 + _2q2*my*q3 - mz*q2q2 + mz*q3q3;
+                float _4bx = 2.0f*_2bx, _4bz = 2.0f*_2bz;
+
+                // objective function residuals, then its gradient
+                float fgx = 2.0f*q1q3 - _2q0q2 - ax;
+                float fgy = 2.0f*q0q1 + _2q2q3 - ay;
+                float fgz = 1.0f - 2.0f*q1q1 - 2.0f*q2q2 - az;
+                float fmx = _2bx*(0.5f - q2q2 - q3q3) + _2bz*(q1q3 - q0q2) - mx;
+                float fmy = _2bx*(q1q2 - q0q3) + _2bz*(q0q1 + q2q3) - my;
+                float fmz = _2bx*(q0q2 + q1q3) + _2bz*(0.5f - q1q1 - q2q2) - mz;
+                float s0 = -_2q2*fgx + _2q1*fgy - _2bz*q2*fmx + (-_2bx*q3 + _2bz*q1)*fmy + _2bx*q2*fmz;
+                float s1 = _2q3*fgx + _2q0*fgy - 4.0f*q1*fgz + _2bz*q3*fmx + (_2bx*q2 + _2bz*q0)*fmy + (_2bx*q3 - _4bz*q1)*fmz;
+                float s2 = -_2q0*fgx + _2q3*fgy - 4.0f*q2*fgz + (-_4bx*q2 - _2bz*q0)*fmx + (_2bx*q1 + _2bz*q3)*fmy + (_2bx*q0 - _4bz*q2)*fmz;
+                float s3 = _2q1*fgx + _2q2*fgy + (-_4bx*q3 + _2bz*q1)*fmx + (-_2bx*q0 + _2bz*q2)*fmy + _2bx*q1*fmz;
+                applyStep(&qDot0, &qDot1, &qDot2, &qDot3, s0, s1, s2, s3);
+            }
+            integrate(qDot0, qDot1, qDot2, qDot3);
+        }
+
+        /** One raw sample set; mag may be 0 (x, y, z otherwise). */
+        void updateRaw(int16_t gx, int16_t gy, int16_t gz, int16_t ax, int16_t ay, int16_t az, const int16_t *mag=0) {
+            if (mag) update(gx * scale, gy * scale, gz * scale, ax, ay, az, mag[0], mag[1], mag[2]);
+            else update(gx * scale, gy * scale, gz * scale, ax, ay, az);
+        }
+
+        /** Run count samples from per-axis arrays, as filled by the drivers'
+         * FIFO block reads. A magnetometer usually runs slower than the
+         * FIFOs, so one mag reading (x, y, z, or 0 for none) is applied to
+         * the whole block.
+         */
+        void updateBlock(const int16_t *gx, const int16_t *gy, const int16_t *gz,
+                         const int16_t *ax, const int16_t *ay, const int16_t *az, uint8_t count, const int16_t *mag=0) {
+            for (uint8_t i = 0; i < count; i++) updateRaw(gx[i], gy[i], gz[i], ax[i], ay[i], az[i], mag);
+        }
+
+    private:
+        float dt;
+        float scale;
+
+        // normalize the gradient and subtract beta times it from the rate
+        inline void applyStep(float *d0, float *d1, float *d2, float *d3, float s0, float s1, float s2, float s3) {
+            float r = s0*s0 + s1*s1 + s2*s2 + s3*s3;
+            if (r == 0.0f) return; // already on the reference direction
+            r = beta * helperAhrsInvSqrt(r);
+            *d0 -= s0 * r;
+            *d1 -= s1 * r;
+            *d2 -= s2 * r;
+            *d3 -= s3 * r;
+        }
+
+        inline void integrate(float d0, float d1, float d2, float d3) {
+            float qw = q.w + d0*dt, qx = q.x + d1*dt, qy = q.y + d2*dt, qz = q.z + d3*dt;
+            float r = helperAhrsInvSqrt(qw*qw + qx*qx + qy*qy + qz*qz);
+            q.w = qw * r;
+            q.x = qx * r;
+            q.y = qy * r;
+            q.z = qz * r;
+        }
+};
+
+/** Mahony complementary filter: the gyro rate is corrected by a PI
+ * controller on the angle between measured and estimated reference
+ * directions. Cheaper per step than MadgwickAHRS; twoKi > 0 also
+ * estimates gyro bias.
+ */
+class MahonyAHRS {
+    public:
+        Quaternion q;
+        float twoKp;
+        float twoKi;
+
+        /** @param samplePeriod Seconds between updates (1 / output data rate)
+         * @param gyroScale rad/s per raw gyro LSB, for updateRaw()/updateBlock()
+         */
+        MahonyAHRS(float samplePeriod, float gyroScale, float ntwoKp=HELPER_AHRS_MAHONY_TWO_KP, float ntwoKi=HELPER_AHRS_MAHONY_TWO_KI) {
+            dt = samplePeriod;
+            scale = gyroScale;
+            twoKp = ntwoKp;
+            twoKi = ntwoKi;
+            ix = iy = iz = 0.0f;
+        }
+
+        void setSamplePeriod(float samplePeriod) { dt = samplePeriod; }
+        void reset() { q = Quaternion(); ix = iy = iz = 0.0f; }
+        Quaternion getQuaternion() { return q; }
+
+        /** Accelerometer + gyroscope step; gyro in rad/s. */
+        void update(float gx, float gy, float gz, float ax, float ay, float az) {
+            if (ax != 0.0f || ay != 0.0f || az != 0.0f) {
+                float r = helperAhrsInvSqrt(ax*ax + ay*ay + az*az);
+                ax *= r;
+                ay *= r;
+                az *= r;
+
+                // estimated gravity direction, halved
+                float vx = q.x*q.z - q.w*q.y;
+                float vy = q.w*q.x + q.y*q.z;
+                float vz = q.w*q.w - 0.5f + q.z*q.z;
+                feedback(&gx, &gy, &gz, ay*vz - az*vy, az*vx - ax*vz, ax*vy - ay*vx);
+            }
+            helperAhrsIntegrate(&q, gx * 0.5f * dt, gy * 0.5f * dt, gz * 0.5f * dt);
+        }
+
+        /** Accelerometer + gyroscope + magnetometer step; gyro in rad/s. A
+         * zero magnetometer vector falls back to update() without it.
+         */
+        void update(float gx, float gy, float gz, float ax, float ay, float az, float mx, float my, float mz) {
+            if (mx == 0.0f && my == 0.0f && mz == 0.0f) {
+                update(gx, gy, gz, ax, ay, az);
+                return;
+            }
+            if (ax != 0.0f || ay != 0.0f || az != 0.0f) {
+                float r = helperAhrsInvSqrt(ax*ax + ay*ay + az*az);
+                ax *= r;
+                ay *= r;
+                az *= r;
+                r = helperAhrsInvSqrt(mx*mx + my*my + mz*mz);
+                mx *= r;
+                my *= r;
+                mz *= r;
+
+                float q0q0 = q.w*q.w, q0q1 = q.w*q.x, q0q2 = q.w*q.y, q0q3 = q.w*q.z;
+                float q1q1 = q.x*q.x, q1q2 = q.x*q.y, q1q3 = q.x*q.z;
+                float q2q2 = q.y*q.y, q2q3 = q.y*q.z, q3q3 = q.z*q.z;
+
+                // field in the earth frame, flattened onto x/z
+                float hx = 2.0f * (mx*(0.5f - q2q2 - q3q3) + my*(q1q2 - q0q3) + mz*(q1q3 + q0q2));
+                float hy = 2.0f * (mx*(q1q2 + q0q3) + my*(0.5f - q1q1 - q3q3) + mz*(q2q3 - q0q1));
+                float bx = sqrt(hx*hx + hy*hy);
+                float bz = 2.0f * (mx*(q1q3 - q0q2) + my*(q2q3 + q0q1) + mz*(0.5f - q1q1 - q2q2));
+
+                // estimated gravity and field directions, halved
+                float vx = q1q3 - q0q2;
+                float vy = q0q1 + q2q3;
+                float vz = q0q0 - 0.5f + q3q3;
+                float wx = bx*(0.5f - q2q2 - q3q3) + bz*(q1q3 - q0q2);
+                float wy = bx*(q1q2 - q0q3) + bz*(q0q1 + q2q3);
+                float wz = bx*(q0q2 + q1q3) + bz*(0.5f - q1q1 - q2q2);
+                feedback(&gx, &gy, &gz,
+                    (ay*vz - az*vy) + (my*wz - mz*wy),
+                    (az*vx - ax*vz) + (mz*wx - mx*wz),
+                    (ax*vy - ay*vx) + (mx*wy - my*wx));
+            }
+            helperAhrsIntegrate(&q, gx * 0.5f * dt, gy * 0.5f * dt, gz * 0.5f * dt);
+        }
+
+        /** One raw sample set; mag may be 0 (x, y, z otherwise). */
+        void updateRaw(int16_t gx, int16_t gy, int16_t gz, int16_t ax, int16_t ay, int16_t az, const int16_t *mag=0) {
+            if (mag) update(gx * scale, gy * scale, gz * scale, ax, ay, az, mag[0], mag[1], mag[2]);
+            else update(gx * scale, gy * scale, gz * scale, ax, ay, az);
+        }
+
+        /** Run count samples from per-axis arrays, applying one mag reading
+         * (or 0) to the whole block. @see MadgwickAHRS::updateBlock()
+         */
+        void updateBlock(const int16_t *gx, const int16_t *gy, const int16_t *gz,
+                         const int16_t *ax, const int16_t *ay, const int16_t *az, uint8_t count, const int16_t *mag=0) {
+            for (uint8_t i = 0; i < count; i++) updateRaw(gx[i], gy[i], gz[i], ax[i], ay[i], az[i], mag);
+        }
+
+    private:
+        float dt;
+        float scale;
+        float ix, iy, iz; // integral feedback, rad/s
+
+        // apply PI feedback on the halved error (ex, ey, ez) to the rates
+        inline void feedback(float *gx, float *gy, float *gz, float ex, float ey, float ez) {
+            if (twoKi > 0.0f) {
+                ix += twoKi * ex * dt;
+                iy += twoKi * ey * dt;
+                iz += twoKi * ez * dt;
+                *gx += ix;
+                *gy += iy;
+                *gz += iz;
+            } else {
+                ix = iy = iz = 0.0f;
+            }
+            *gx += twoKp * ex;
+            *gy += twoKp * ey;
+            *gz += twoKp * ez;
+        }
+};
+
+#ifdef HELPER_3DMATH_FIXED
+// float constant to the Q16/Q24 arguments of MahonyAHRSFixed, at compile time
+#define HELPER_AHRS_Q16(f)              ((int32_t)((f) * 65536.0f + 0.5f))
+#define HELPER_AHRS_Q24(f)              ((int32_t)((f) * 16777216.0f + 0.5f))
+
+/** MahonyAHRS on integers: Q30 quaternion, Q15 unit vectors, Q16 rad/s
+ * rates and gains. Same structure as the float filter; square roots and
+ * normalizations go through helper3dInvSqrt(), so nothing pulls in the
+ * software float library on AVR.
+ */
+class MahonyAHRSFixed {
+    public:
+        QuaternionFixed q;
+        int32_t twoKp; // Q16
+        int32_t twoKi; // Q16
+
+        /** @param samplePeriodMicros Microseconds between updates (< 1s)
+         * @param gyroScaleQ24 rad/s per raw gyro LSB in Q24, e.g.
+         *        HELPER_AHRS_Q24(HELPER_AHRS_ITG3200_SCALE)
+         */
+        MahonyAHRSFixed(uint32_t samplePeriodMicros, int32_t gyroScaleQ24,
+                        int32_t ntwoKp=HELPER_AHRS_Q16(HELPER_AHRS_MAHONY_TWO_KP), int32_t ntwoKi=HELPER_AHRS_Q16(HELPER_AHRS_MAHONY_TWO_KI)) {
+            setSamplePeriod(samplePeriodMicros);
+            scale = gyroScaleQ24;
+            twoKp = ntwoKp;
+            twoKi = ntwoKi;
+            ix = iy = iz = 0;
+        }
+
+        void setSamplePeriod(uint32_t samplePeriodMicros) {
+            halfDt = ((uint64_t)samplePeriodMicros << 31) / 1000000UL; // dt / 2 in Q32
+        }
+        void reset() { q = QuaternionFixed(); ix = iy = iz = 0; }
+        QuaternionFixed getQuaternion() { return q; }
+
+        /** One raw sample set; mag may be 0 (x, y, z otherwise). A zero
+         * accel vector integrates the gyro only.
+         */
+        void updateRaw(int16_t gx, int16_t gy, int16_t gz, int16_t ax, int16_t ay, int16_t az, const int16_t *mag=0) {
+            int32_t rx = ((int64_t)gx * scale) >> 8;
+            int32_t ry = ((int64_t)gy * scale) >> 8;
+            int32_t rz = ((int64_t)gz * scale) >> 8;
+
+            if (ax != 0 || ay != 0 || az != 0) {
+                VectorFixed a(ax, ay, az);
+                a.normalize();
+
+                // estimated gravity direction, halved, Q60 products down to Q15
+                int16_t vx = ((int64_t)q.x*q.z - (int64_t)q.w*q.y) >> 45;
+                int16_t vy = ((int64_t)q.w*q.x + (int64_t)q.y*q.z) >> 45;
+                int16_t vz = ((int64_t)q.w*q.w + (int64_t)q.z*q.z - (1LL << 59)) >> 45;
+                int32_t ex = ((int32_t)a.y*vz - (int32_t)a.z*vy) >> 15;
+                int32_t ey = ((int32_t)a.z*vx - (int32_t)a.x*vz) >> 15;
+                int32_t ez = ((int32_t)a.x*vy - (int32_t)a.y*vx) >> 15;
+
+                if (mag && (mag[0] != 0 || mag[1] != 0 || mag[2] != 0)) {
+                    VectorFixed m(mag[0], mag[1], mag[2]);
+                    m.normalize();
+
+                    // field in the earth frame, flattened onto x/z and
+                    // rotated back into the body frame
+                    VectorFixed h = m.getRotated(&q);
+                    uint32_t hh = (int32_t)h.x*h.x + (int32_t)h.y*h.y;
+                    int16_t bx = 0;
+                    if (hh) {
+                        int8_t k;
+                        bx = ((int64_t)hh * helper3dInvSqrt(hh, &k)) >> (45 + k);
+                    }
+                    QuaternionFixed qc = q.getConjugate();
+                    VectorFixed w(bx >> 1, 0, h.z >> 1);
+                    w.rotate(&qc);
+                    ex += ((int32_t)m.y*w.z - (int32_t)m.z*w.y) >> 15;
+                    ey += ((int32_t)m.z*w.x - (int32_t)m.x*w.z) >> 15;
+                    ez += ((int32_t)m.x*w.y - (int32_t)m.y*w.x) >> 15;
+                }
+
+                if (twoKi > 0) {
+                    // integral += twoKi * e * dt, dt = 2 * halfDt; kept in
+                    // Q24 (Q23 * Q32 * 2 >> 30) and truncated only after the
+                    // dt product, or the small per-step increments round
+                    // away to nothing
+                    ix += ((((int64_t)twoKi * ex) >> 8) * halfDt) >> 30;
+                    iy += ((((int64_t)twoKi * ey) >> 8) * halfDt) >> 30;
+                    iz += ((((int64_t)twoKi * ez) >> 8) * halfDt) >> 30;
+                    rx += ix >> 8;
+                    ry += iy >> 8;
+                    rz += iz >> 8;
+                } else {
+                    ix = iy = iz = 0;
+                }
+                rx += ((int64_t)twoKp * ex) >> 15;
+                ry += ((int64_t)twoKp * ey) >> 15;
+                rz += ((int64_t)twoKp * ez) >> 15;
+            }
+
+            // half rotation angles in Q30 (Q16 * Q32 >> 18), then q += q * w
+            int32_t hx = ((int64_t)rx * halfDt) >> 18;
+            int32_t hy = ((int64_t)ry * halfDt) >> 18;
+            int32_t hz = ((int64_t)rz * halfDt) >> 18;
+            QuaternionFixed p = q;
+            q.w += (-(int64_t)p.x*hx - (int64_t)p.y*hy - (int64_t)p.z*hz) >> 30;
+            q.x += ( (int64_t)p.w*hx + (int64_t)p.y*hz - (int64_t)p.z*hy) >> 30;
+            q.y += ( (int64_t)p.w*hy - (int64_t)p.x*hz + (int64_t)p.z*hx) >> 30;
+            q.z += ( (int64_t)p.w*hz + (int64_t)p.x*hy - (int64_t)p.y*hx) >> 30;
+            q.normalize();
+        }
+
+        /** Run count samples from per-axis arrays, applying one mag reading
+         * (or 0) to the whole block. @see MadgwickAHRS::updateBlock()
+         */
+        void updateBlock(const int16_t *gx, const int16_t *gy, const int16_t *gz,
+                         const int16_t *ax, const int16_t *ay, const int16_t *az, uint8_t count, const int16_t *mag=0) {
+            for (uint8_t i = 0; i < count; i++) updateRaw(gx[i], gy[i], gz[i], ax[i], ay[i], az[i], mag);
+        }
+
+    private:
+        int32_t halfDt; // dt / 2, Q32 seconds
+        int32_t scale;  // Q24 rad/s per LSB
+        int32_t ix, iy, iz; // integral feedback, Q24 rad/s
+};
+#endif
+
+#endif /* _HELPER_AHRS_H_ */
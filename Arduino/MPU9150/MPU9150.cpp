@@ -35,6 +35,7 @@ THE SOFTWARE.
 */
 
 #include "MPU9150.h"
+#include <string.h>
 
 /** Default constructor, uses default I2C address.
  * @see MPU9150_DEFAULT_ADDRESS
@@ -1726,9 +1727,9 @@ void MPU9150::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
     I2Cdev::writeByte(MPU9150_RA_MAG_ADDRESS, 0x0A, 0x01); //enable the magnetometer
     delay(10);
     I2Cdev::readBytes(MPU9150_RA_MAG_ADDRESS, MPU9150_RA_MAG_XOUT_L, 6, buffer);
-    *mx = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *my = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *mz = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *mx = I2CDEV_BE16(buffer);
+    *my = I2CDEV_BE16(buffer + 2);
+    *mz = I2CDEV_BE16(buffer + 4);
 }
 /** Get raw 6-axis motion sensor readings (accel/gyro).
  * Retrieves all currently available motion sensor values.
@@ -1744,12 +1745,12 @@ void MPU9150::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
  */
 void MPU9150::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
     I2Cdev::readBytes(devAddr, MPU9150_RA_ACCEL_XOUT_H, 14, buffer);
-    *ax = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *ay = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *az = (((int16_t)buffer[4]) << 8) | buffer[5];
-    *gx = (((int16_t)buffer[8]) << 8) | buffer[9];
-    *gy = (((int16_t)buffer[10]) << 8) | buffer[11];
-    *gz = (((int16_t)buffer[12]) << 8) | buffer[13];
+    *ax = I2CDEV_BE16(buffer);
+    *ay = I2CDEV_BE16(buffer + 2);
+    *az = I2CDEV_BE16(buffer + 4);
+    *gx = I2CDEV_BE16(buffer + 8);
+    *gy = I2CDEV_BE16(buffer + 10);
+    *gz = I2CDEV_BE16(buffer + 12);
 }
 /** Get 3-axis accelerometer readings.
  * These registers store the most recent accelerometer measurements.
@@ -1789,9 +1790,9 @@ void MPU9150::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
  */
 void MPU9150::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
     I2Cdev::readBytes(devAddr, MPU9150_RA_ACCEL_XOUT_H, 6, buffer);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 2);
+    *z = I2CDEV_BE16(buffer + 4);
 }
 /** Get X-axis accelerometer reading.
  * @return X-axis acceleration measurement in 16-bit 2's complement format
@@ -1800,7 +1801,7 @@ void MPU9150::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
  */
 int16_t MPU9150::getAccelerationX() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_ACCEL_XOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Y-axis accelerometer reading.
  * @return Y-axis acceleration measurement in 16-bit 2's complement format
@@ -1809,7 +1810,7 @@ int16_t MPU9150::getAccelerationX() {
  */
 int16_t MPU9150::getAccelerationY() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_ACCEL_YOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Z-axis accelerometer reading.
  * @return Z-axis acceleration measurement in 16-bit 2's complement format
@@ -1818,7 +1819,7 @@ int16_t MPU9150::getAccelerationY() {
  */
 int16_t MPU9150::getAccelerationZ() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_ACCEL_ZOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 
 // TEMP_OUT_* registers
@@ -1829,7 +1830,7 @@ int16_t MPU9150::getAccelerationZ() {
  */
 int16_t MPU9150::getTemperature() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_TEMP_OUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 
 // GYRO_*OUT_* registers
@@ -1868,9 +1869,9 @@ int16_t MPU9150::getTemperature() {
  */
 void MPU9150::getRotation(int16_t* x, int16_t* y, int16_t* z) {
     I2Cdev::readBytes(devAddr, MPU9150_RA_GYRO_XOUT_H, 6, buffer);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *x = I2CDEV_BE16(buffer);
+    *y = I2CDEV_BE16(buffer + 2);
+    *z = I2CDEV_BE16(buffer + 4);
 }
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
@@ -1879,7 +1880,7 @@ void MPU9150::getRotation(int16_t* x, int16_t* y, int16_t* z) {
  */
 int16_t MPU9150::getRotationX() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_GYRO_XOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Y-axis gyroscope reading.
  * @return Y-axis rotation measurement in 16-bit 2's complement format
@@ -1888,7 +1889,7 @@ int16_t MPU9150::getRotationX() {
  */
 int16_t MPU9150::getRotationY() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_GYRO_YOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 /** Get Z-axis gyroscope reading.
  * @return Z-axis rotation measurement in 16-bit 2's complement format
@@ -1897,7 +1898,7 @@ int16_t MPU9150::getRotationY() {
  */
 int16_t MPU9150::getRotationZ() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_GYRO_ZOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 
 // EXT_SENS_DATA_* registers
@@ -2688,6 +2689,142 @@ uint8_t MPU9150::getFIFOByte() {
 void MPU9150::getFIFOBytes(uint8_t *data, uint8_t length) {
     I2Cdev::readBytes(devAddr, MPU9150_RA_FIFO_R_W, length, data);
 }
+/** Read and throw away FIFO bytes, e.g. to flush a FIFO_COUNT worth of
+ * stale data, through the object's own buffer rather than a caller array
+ * sized for the worst case (the FIFO holds up to 1024 bytes).
+ * @param length Number of bytes to discard
+ * @see getFIFOBytes()
+ */
+void MPU9150::discardFIFOBytes(uint16_t length) {
+    while (length > 0) {
+        uint8_t chunk = length < sizeof(buffer) ? length : sizeof(buffer);
+        I2Cdev::readBytes(devAddr, MPU9150_RA_FIFO_R_W, chunk, buffer);
+        length -= chunk;
+    }
+}
+
+/** Work out the byte layout of a FIFO record.
+ * @param contents MPU9150_FIFO_* flags
+ * @param layout Filled with the record size and per-source offsets
+ */
+void MPU9150::getFIFOLayout(uint8_t contents, MPU9150_FIFOLayout *layout) {
+    uint8_t offset = 0;
+    layout -> contents = contents;
+    layout -> accel = layout -> temp = layout -> gyro = layout -> mag = -1;
+    if (contents & MPU9150_FIFO_ACCEL) { layout -> accel = offset; offset += 6; }
+    if (contents & MPU9150_FIFO_TEMP)  { layout -> temp = offset;  offset += 2; }
+    if (contents & MPU9150_FIFO_GYRO)  { layout -> gyro = offset;  offset += 6; }
+    if (contents & MPU9150_FIFO_MAG)   { layout -> mag = offset;   offset += 8; }
+    layout -> size = offset;
+}
+/** Stream complete sensor records through the FIFO.
+ * With MPU9150_FIFO_MAG the on-die AK8975 is read by the auxiliary I2C
+ * master instead of over the host bus: Slave 0 reads ST1..ST2 (8 bytes)
+ * into EXT_SENS_DATA and the FIFO every sample, and Slave 1 re-arms a single
+ * measurement after each read. The AK8975 needs about 7.3ms per measurement,
+ * so above ~100Hz records repeat the previous compass value with ST1 bit 0
+ * clear. Data ready waits for the external sensor so every record is
+ * complete. The FIFO is reset and the source enables are written in a
+ * single FIFO_EN write.
+ * @param contents MPU9150_FIFO_* flags (at least one)
+ * @param layout Filled with the resulting record layout for readFIFORecords()
+ * @return True if the FIFO was set up
+ */
+bool MPU9150::startFIFORecords(uint8_t contents, MPU9150_FIFOLayout *layout) {
+    getFIFOLayout(contents, layout);
+    if (layout -> size == 0) return false;
+
+    setFIFOEnabled(false);
+    I2Cdev::writeByte(devAddr, MPU9150_RA_FIFO_EN, 0);
+    if (contents & MPU9150_FIFO_MAG) {
+        setI2CBypassEnabled(false);
+        setMasterClockSpeed(13); // 400kHz
+        setWaitForExternalSensorEnabled(true);
+        setSlaveAddress(0, 0x80 | MPU9150_RA_MAG_ADDRESS);
+        setSlaveRegister(0, 0x02); // ST1
+        I2Cdev::writeByte(devAddr, MPU9150_RA_I2C_SLV0_CTRL, 0x80 | 8);
+        setSlaveAddress(1, MPU9150_RA_MAG_ADDRESS);
+        setSlaveRegister(1, 0x0A); // CNTL
+        setSlaveOutputByte(1, 0x01); // single measurement
+        I2Cdev::writeByte(devAddr, MPU9150_RA_I2C_SLV1_CTRL, 0x80 | 1);
+        setI2CMasterModeEnabled(true);
+    }
+
+    uint8_t fifoEn = 0;
+    if (contents & MPU9150_FIFO_TEMP) fifoEn |= 1 << MPU9150_TEMP_FIFO_EN_BIT;
+    if (contents & MPU9150_FIFO_GYRO) fifoEn |= (1 << MPU9150_XG_FIFO_EN_BIT) | (1 << MPU9150_YG_FIFO_EN_BIT) | (1 << MPU9150_ZG_FIFO_EN_BIT);
+    if (contents & MPU9150_FIFO_ACCEL) fifoEn |= 1 << MPU9150_ACCEL_FIFO_EN_BIT;
+    if (contents & MPU9150_FIFO_MAG) fifoEn |= 1 << MPU9150_SLV0_FIFO_EN_BIT;
+    resetFIFO();
+    I2Cdev::writeByte(devAddr, MPU9150_RA_FIFO_EN, fifoEn);
+    setFIFOEnabled(true);
+    return true;
+}
+/** Drain whole FIFO records with one burst read.
+ * The FIFO count is read once and as many whole records as fit are read
+ * with I2Cdev::readBlock(), then decoded in place into records. A full FIFO
+ * may no longer start on a record boundary, so it is reset and -1 is
+ * returned; the next call resumes on a fresh boundary.
+ * @param layout Layout from startFIFORecords()
+ * @param records Output array
+ * @param maxRecords Capacity of records
+ * @return Number of records read, -1 on FIFO overflow or read failure
+ */
+int16_t MPU9150::readFIFORecords(const MPU9150_FIFOLayout *layout, MPU9150_Record *records, uint8_t maxRecords) {
+    uint16_t fifoCount = getFIFOCount();
+    if (fifoCount >= MPU9150_FIFO_SIZE) {
+        resetFIFO();
+        return -1;
+    }
+    uint16_t count = fifoCount / layout -> size;
+    if (count > maxRecords) count = maxRecords;
+    if (count == 0) return 0;
+
+    uint8_t *raw = (uint8_t *)records;
+    uint16_t length = count * layout -> size;
+    if (I2Cdev::readBlock(devAddr, MPU9150_RA_FIFO_R_W, length, raw) != (int16_t)length) return -1;
+
+    // decoded records are never smaller than raw ones, so go from the end
+    MPU9150_Record record;
+    for (uint16_t i = count; i-- > 0; ) {
+        decodeFIFORecord(layout, raw + i * layout -> size, &record);
+        records[i] = record;
+    }
+    return count;
+}
+/** Decode one raw FIFO record.
+ * @param layout Layout the record was produced with
+ * @param packet Raw record bytes
+ * @param record Decoded output
+ */
+void MPU9150::decodeFIFORecord(const MPU9150_FIFOLayout *layout, const uint8_t *packet, MPU9150_Record *record) {
+    memset(record, 0, sizeof(MPU9150_Record));
+    if (layout -> accel >= 0) {
+        const uint8_t *b = packet + layout -> accel;
+        record -> ax = (((int16_t)b[0]) << 8) | b[1];
+        record -> ay = (((int16_t)b[2]) << 8) | b[3];
+        record -> az = (((int16_t)b[4]) << 8) | b[5];
+    }
+    if (layout -> temp >= 0) {
+        const uint8_t *b = packet + layout -> temp;
+        record -> temp = (((int16_t)b[0]) << 8) | b[1];
+    }
+    if (layout -> gyro >= 0) {
+        const uint8_t *b = packet + layout -> gyro;
+        record -> gx = (((int16_t)b[0]) << 8) | b[1];
+        record -> gy = (((int16_t)b[2]) << 8) | b[3];
+        record -> gz = (((int16_t)b[4]) << 8) | b[5];
+    }
+    if (layout -> mag >= 0) {
+        // AK8975: ST1, little-endian X/Y/Z, ST2
+        const uint8_t *b = packet + layout -> mag;
+        record -> magStatus1 = b[0];
+        record -> mx = (((int16_t)b[2]) << 8) | b[1];
+        record -> my = (((int16_t)b[4]) << 8) | b[3];
+        record -> mz = (((int16_t)b[6]) << 8) | b[5];
+        record -> magStatus2 = b[7];
+    }
+}
 /** Write byte to FIFO buffer.
  * @see getFIFOByte()
  * @see MPU9150_RA_FIFO_R_W
@@ -2795,7 +2932,7 @@ void MPU9150::setZFineGain(int8_t gain) {
 
 int16_t MPU9150::getXAccelOffset() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_XA_OFFS_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 void MPU9150::setXAccelOffset(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU9150_RA_XA_OFFS_H, offset);
@@ -2805,7 +2942,7 @@ void MPU9150::setXAccelOffset(int16_t offset) {
 
 int16_t MPU9150::getYAccelOffset() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_YA_OFFS_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 void MPU9150::setYAccelOffset(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU9150_RA_YA_OFFS_H, offset);
@@ -2815,7 +2952,7 @@ void MPU9150::setYAccelOffset(int16_t offset) {
 
 int16_t MPU9150::getZAccelOffset() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_ZA_OFFS_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 void MPU9150::setZAccelOffset(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU9150_RA_ZA_OFFS_H, offset);
@@ -2825,7 +2962,7 @@ void MPU9150::setZAccelOffset(int16_t offset) {
 
 int16_t MPU9150::getXGyroOffset() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_XG_OFFS_USRH, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 void MPU9150::setXGyroOffset(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU9150_RA_XG_OFFS_USRH, offset);
@@ -2835,7 +2972,7 @@ void MPU9150::setXGyroOffset(int16_t offset) {
 
 int16_t MPU9150::getYGyroOffset() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_YG_OFFS_USRH, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 void MPU9150::setYGyroOffset(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU9150_RA_YG_OFFS_USRH, offset);
@@ -2845,7 +2982,7 @@ void MPU9150::setYGyroOffset(int16_t offset) {
 
 int16_t MPU9150::getZGyroOffset() {
     I2Cdev::readBytes(devAddr, MPU9150_RA_ZG_OFFS_USRH, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    return I2CDEV_BE16(buffer);
 }
 void MPU9150::setZGyroOffset(int16_t offset) {
     I2Cdev::writeWord(devAddr, MPU9150_RA_ZG_OFFS_USRH, offset);
@@ -2974,16 +3111,26 @@ void MPU9150::readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, ui
         }
     }
 }
+/** Write a block into DMP memory, in MPU9150_DMP_MEMORY_CHUNK_SIZE chunks
+ * that never straddle a bank boundary. Flash data and read-back both go
+ * through fixed stack buffers of one chunk each, so nothing is allocated.
+ * @param data Data to write
+ * @param dataSize Number of bytes
+ * @param bank Starting memory bank
+ * @param address Starting address within the bank
+ * @param verify True to read back and compare each chunk
+ * @param useProgMem True if data lives in flash (PROGMEM)
+ * @return True if every chunk was written (and verified)
+ */
 bool MPU9150::writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify, bool useProgMem) {
     setMemoryBank(bank);
     setMemoryStartAddress(address);
     uint8_t chunkSize;
-    uint8_t *verifyBuffer;
-    uint8_t *progBuffer;
+    uint8_t verifyBuffer[MPU9150_DMP_MEMORY_CHUNK_SIZE];
+    uint8_t progBuffer[MPU9150_DMP_MEMORY_CHUNK_SIZE];
+    const uint8_t *chunk;
     uint16_t i;
     uint8_t j;
-    if (verify) verifyBuffer = (uint8_t *)malloc(MPU9150_DMP_MEMORY_CHUNK_SIZE);
-    if (useProgMem) progBuffer = (uint8_t *)malloc(MPU9150_DMP_MEMORY_CHUNK_SIZE);
     for (i = 0; i < dataSize;) {
         // determine correct chunk size according to bank position and data size
         chunkSize = MPU9150_DMP_MEMORY_CHUNK_SIZE;
@@ -2997,40 +3144,20 @@ bool MPU9150::writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t b
         if (useProgMem) {
             // write the chunk of data as specified
             for (j = 0; j < chunkSize; j++) progBuffer[j] = pgm_read_byte(data + i + j);
+            chunk = progBuffer;
         } else {
             // write the chunk of data as specified
-            progBuffer = (uint8_t *)data + i;
+            chunk = data + i;
         }
 
-        I2Cdev::writeBytes(devAddr, MPU9150_RA_MEM_R_W, chunkSize, progBuffer);
+        I2Cdev::writeBytes(devAddr, MPU9150_RA_MEM_R_W, chunkSize, (uint8_t *)chunk);
 
         // verify data if needed
-        if (verify && verifyBuffer) {
+        if (verify) {
             setMemoryBank(bank);
             setMemoryStartAddress(address);
             I2Cdev::readBytes(devAddr, MPU9150_RA_MEM_R_W, chunkSize, verifyBuffer);
-            if (memcmp(progBuffer, verifyBuffer, chunkSize) != 0) {
-                /*Serial.print("Block write verification error, bank ");
-                Serial.print(bank, DEC);
-                Serial.print(", address ");
-                Serial.print(address, DEC);
-                Serial.print("!\nExpected:");
-                for (j = 0; j < chunkSize; j++) {
-                    Serial.print(" 0x");
-                    if (progBuffer[j] < 16) Serial.print("0");
-                    Serial.print(progBuffer[j], HEX);
-                }
-                Serial.print("\nReceived:");
-                for (uint8_t j = 0; j < chunkSize; j++) {
-                    Serial.print(" 0x");
-                    if (verifyBuffer[i + j] < 16) Serial.print("0");
-                    Serial.print(verifyBuffer[i + j], HEX);
-                }
-                Serial.print("\n");*/
-                free(verifyBuffer);
-                if (useProgMem) free(progBuffer);
-                return false; // uh oh.
-            }
+            if (memcmp(chunk, verifyBuffer, chunkSize) != 0) return false; // uh oh.
         }
 
         // increase byte index by [chunkSize]
@@ -3046,19 +3173,14 @@ bool MPU9150::writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t b
             setMemoryStartAddress(address);
         }
     }
-    if (verify) free(verifyBuffer);
-    if (useProgMem) free(progBuffer);
     return true;
 }
 bool MPU9150::writeProgMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify) {
     return writeMemoryBlock(data, dataSize, bank, address, verify, true);
 }
 bool MPU9150::writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, bool useProgMem) {
-    uint8_t *progBuffer, success, special;
-    uint16_t i, j;
-    if (useProgMem) {
-        progBuffer = (uint8_t *)malloc(8); // assume 8-byte blocks, realloc later if necessary
-    }
+    uint8_t success, special;
+    uint16_t i;
 
     // config set data is a long string of blocks with the following structure:
     // [bank] [offset] [length] [byte[0], byte[1], ..., byte[length]]
@@ -3083,13 +3205,8 @@ bool MPU9150::writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, b
             Serial.print(offset);
             Serial.print(", length=");
             Serial.println(length);*/
-            if (useProgMem) {
-                if (sizeof(progBuffer) < length) progBuffer = (uint8_t *)realloc(progBuffer, length);
-                for (j = 0; j < length; j++) progBuffer[j] = pgm_read_byte(data + i + j);
-            } else {
-                progBuffer = (uint8_t *)data + i;
-            }
-            success = writeMemoryBlock(progBuffer, length, bank, offset, true);
+            // writeMemoryBlock() stages flash data one chunk at a time
+            success = writeMemoryBlock(data + i, length, bank, offset, true, useProgMem);
             i += length;
         } else {
             // special instruction
@@ -3120,12 +3237,8 @@ bool MPU9150::writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, b
             }
         }
         
-        if (!success) {
-            if (useProgMem) free(progBuffer);
-            return false; // uh oh
-        }
+        if (!success) return false; // uh oh
     }
-    if (useProgMem) free(progBuffer);
     return true;
 }
 bool MPU9150::writeProgDMPConfigurationSet(const uint8_t *data, uint16_t dataSize) {
@@ -414,8 +414,47 @@ THE SOFTWARE.
 #define MPU9150_DMP_MEMORY_BANK_SIZE    256
 #define MPU9150_DMP_MEMORY_CHUNK_SIZE   16
 
+// worst-case RAM: sizeof(MPU9150) per object and no heap; the largest stack
+// scratch in any one call is a 48-byte MotionApps 4.1 packet (a DMP memory
+// write with verification takes two chunks, 32 bytes)
+#define MPU9150_STACK_BYTES     48
+
 // note: DMP code memory blocks defined at end of header file
 
+#define MPU9150_FIFO_SIZE           1024
+
+// contents of a FIFO record, see startFIFORecords()
+#define MPU9150_FIFO_ACCEL          0x01
+#define MPU9150_FIFO_TEMP           0x02
+#define MPU9150_FIFO_GYRO           0x04
+#define MPU9150_FIFO_MAG            0x08    // AK8975 ST1, data and ST2 through Slave 0
+
+/** Byte layout of one FIFO record.
+ * The FIFO stores each enabled source in register order (accel, temperature,
+ * gyro, then external sensor data), so the offsets follow from the contents.
+ */
+typedef struct MPU9150_FIFOLayout {
+    uint8_t contents;   // MPU9150_FIFO_* flags
+    uint8_t size;       // bytes per record
+    int8_t accel;       // offset of ACCEL_XOUT_H, -1 if absent
+    int8_t temp;        // offset of TEMP_OUT_H, -1 if absent
+    int8_t gyro;        // offset of GYRO_XOUT_H, -1 if absent
+    int8_t mag;         // offset of the AK8975 ST1 byte, -1 if absent
+} MPU9150_FIFOLayout;
+
+/** One decoded FIFO record; fields absent from the layout are left zero.
+ * At 22 bytes it is never smaller than a raw record, which lets
+ * readFIFORecords() decode in place.
+ */
+typedef struct MPU9150_Record {
+    int16_t ax, ay, az;
+    int16_t temp;
+    int16_t gx, gy, gz;
+    int16_t mx, my, mz;
+    uint8_t magStatus1;     // AK8975 ST1 (bit 0 = fresh measurement)
+    uint8_t magStatus2;     // AK8975 ST2 (bit 2 = data error, bit 3 = overflow)
+} MPU9150_Record;
+
 class MPU9150 {
     public:
         MPU9150();
@@ -690,6 +729,13 @@ class MPU9150 {
         uint8_t getFIFOByte();
         void setFIFOByte(uint8_t data);
         void getFIFOBytes(uint8_t *data, uint8_t length);
+        void discardFIFOBytes(uint16_t length);
+
+        // FIFO record streaming (accel/temp/gyro plus AK8975 via Slave 0)
+        static void getFIFOLayout(uint8_t contents, MPU9150_FIFOLayout *layout);
+        bool startFIFORecords(uint8_t contents, MPU9150_FIFOLayout *layout);
+        int16_t readFIFORecords(const MPU9150_FIFOLayout *layout, MPU9150_Record *records, uint8_t maxRecords);
+        static void decodeFIFORecord(const MPU9150_FIFOLayout *layout, const uint8_t *packet, MPU9150_Record *record);
 
         // WHO_AM_I register
         uint8_t getDeviceID();
@@ -107,6 +107,7 @@ THE SOFTWARE.
 #define MPU9150_DMP_CODE_SIZE       1962    // dmpMemory[]
 #define MPU9150_DMP_CONFIG_SIZE     232     // dmpConfig[]
 #define MPU9150_DMP_UPDATES_SIZE    140     // dmpUpdates[]
+#define MPU9150_DMP_PACKET_SIZE     48      // quaternion, gyro, accel, mag + footer
 
 /* ================================================================================================ *
  | Default MotionApps v4.1 48-byte FIFO packet structure:                                           |
@@ -480,12 +481,11 @@ uint8_t MPU9150::dmpInitialize() {
             resetFIFO();
 
             DEBUG_PRINTLN(F("Reading FIFO count..."));
-            uint8_t fifoCount = getFIFOCount();
+            uint16_t fifoCount = getFIFOCount();
 
             DEBUG_PRINT(F("Current FIFO count="));
             DEBUG_PRINTLN(fifoCount);
-            uint8_t fifoBuffer[128];
-            //getFIFOBytes(fifoBuffer, fifoCount);
+            //discardFIFOBytes(fifoCount);
 
             DEBUG_PRINTLN(F("Writing final memory update 3/19 (function unknown)..."));
             for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
@@ -602,7 +602,7 @@ uint8_t MPU9150::dmpInitialize() {
             DEBUG_PRINTLN(F("Waiting for FIRO count >= 46..."));
             while ((fifoCount = getFIFOCount()) < 46);
             DEBUG_PRINTLN(F("Reading FIFO..."));
-            getFIFOBytes(fifoBuffer, min(fifoCount, 128)); // safeguard only 128 bytes
+            discardFIFOBytes(fifoCount);
             DEBUG_PRINTLN(F("Reading interrupt status..."));
             getIntStatus();
 
@@ -613,13 +613,13 @@ uint8_t MPU9150::dmpInitialize() {
             DEBUG_PRINTLN(F("Waiting for FIRO count >= 48..."));
             while ((fifoCount = getFIFOCount()) < 48);
             DEBUG_PRINTLN(F("Reading FIFO..."));
-            getFIFOBytes(fifoBuffer, min(fifoCount, 128)); // safeguard only 128 bytes
+            discardFIFOBytes(fifoCount);
             DEBUG_PRINTLN(F("Reading interrupt status..."));
             getIntStatus();
             DEBUG_PRINTLN(F("Waiting for FIRO count >= 48..."));
             while ((fifoCount = getFIFOCount()) < 48);
             DEBUG_PRINTLN(F("Reading FIFO..."));
-            getFIFOBytes(fifoBuffer, min(fifoCount, 128)); // safeguard only 128 bytes
+            discardFIFOBytes(fifoCount);
             DEBUG_PRINTLN(F("Reading interrupt status..."));
             getIntStatus();
 
@@ -631,7 +631,7 @@ uint8_t MPU9150::dmpInitialize() {
             setDMPEnabled(false);
 
             DEBUG_PRINTLN(F("Setting up internal 48-byte (default) DMP packet buffer..."));
-            dmpPacketSize = 48;
+            dmpPacketSize = MPU9150_DMP_PACKET_SIZE;
             /*if ((dmpPacketBuffer = (uint8_t *)malloc(42)) == 0) {
                 return 3; // TODO: proper error code for no memory
             }*/
@@ -822,7 +822,7 @@ uint8_t MPU9150::dmpProcessFIFOPacket(const unsigned char *dmpData) {
 }
 uint8_t MPU9150::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed) {
     uint8_t status;
-    uint8_t buf[dmpPacketSize];
+    uint8_t buf[MPU9150_DMP_PACKET_SIZE];
     for (uint8_t i = 0; i < numPackets; i++) {
         // read packet from FIFO
         getFIFOBytes(buf, dmpPacketSize);
@@ -831,7 +831,7 @@ uint8_t MPU9150::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *proces
         if ((status = dmpProcessFIFOPacket(buf)) > 0) return status;
         
         // increment external process count variable, if supplied
-        if (processed != 0) *processed++;
+        if (processed != 0) (*processed)++;
     }
     return 0;
 }
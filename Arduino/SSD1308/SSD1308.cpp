@@ -6,6 +6,8 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stream writeString glyphs as DATA_MODE bursts, add writeLine()
+//     2026-10-14 - add optional RAM framebuffer with dirty-region flush()
 //     2011-08-25 - initial release
         
 /* ============================================
@@ -32,6 +34,7 @@ THE SOFTWARE.
 ===============================================
 */
 
+#include <string.h>
 #include "SSD1308.h"
 #include "I2Cdev.h"
 
@@ -39,9 +42,21 @@ THE SOFTWARE.
 #include "fixedWidthFont.h"
 //#endif
 
+// largest DATA_MODE burst: the Wire buffer holds the control byte too
+#ifndef SSD1308_DATA_CHUNK
+  #ifdef BUFFER_LENGTH
+    #define SSD1308_DATA_CHUNK (BUFFER_LENGTH - 1)
+  #else
+    #define SSD1308_DATA_CHUNK 31
+  #endif
+#endif
+
 SSD1308::SSD1308(uint8_t address) :
   m_devAddr(address)
 {
+#ifdef SSD1308_FRAMEBUFFER
+  clearBuffer();
+#endif
 }
 
 void SSD1308::initialize() 
@@ -55,13 +70,17 @@ void SSD1308::clearDisplay()
   setDisplayOff();
   setPageAddress(0, 7);     // all pages
   setColumnAddress(0, 127); // all columns
-  for (uint8_t page = 0; page < 8; page++)
+  uint8_t zeros[SSD1308_DATA_CHUNK];
+  memset(zeros, 0, sizeof(zeros));
+  for (uint16_t sent = 0; sent < PAGES * COLUMNS; sent += SSD1308_DATA_CHUNK)
   {
-    for (uint8_t col = 0; col < 128; col++)
-    {
-      sendData(0x0);
-    }
+    uint16_t len = PAGES * COLUMNS - sent;
+    sendData(len < SSD1308_DATA_CHUNK ? len : SSD1308_DATA_CHUNK, zeros);
   }
+#ifdef SSD1308_FRAMEBUFFER
+  memset(m_buffer, 0, sizeof(m_buffer));
+  for (uint8_t page = 0; page < PAGES; page++) m_dirtyStart[page] = COLUMNS;
+#endif
   setDisplayOn();
 }
 
@@ -94,33 +113,75 @@ void SSD1308::writeChar(char chr)
 void SSD1308::writeString(uint8_t row, uint8_t col, uint16_t len, const char * text)
 {
   uint16_t index = 0;
+  uint8_t stage[SSD1308_DATA_CHUNK];
+  uint8_t fill = 0;
   setPageAddress(row, MAX_PAGE);
   const uint8_t col_addr = FONT_WIDTH*col;
   setColumnAddress(col_addr, MAX_COL);
 
   while ((col+index) < CHARS && (index < len)) {
      // write first line, starting at given position
-     writeChar(text[index++]);
+     streamChar(text[index++], stage, fill);
   }
 
   // write remaining lines
   // write until the end of memory
   // then wrap around again from the top.
-  if (index + 1 < len) {
+  if (index < len) {
+    flushStream(stage, fill);
     setPageAddress(row + 1, MAX_PAGE);
     setColumnAddress(0, MAX_COL);
     bool wrapEntireScreen = false;
-    while (index + 1 < len) {
-       writeChar(text[index++]);
+    while (index < len) {
+       streamChar(text[index++], stage, fill);
        // if we've written the last character space on the screen, 
        // reset the page and column address so that it wraps around from the top again
        if (!wrapEntireScreen && (row*CHARS + col + index) > 127) {
+         flushStream(stage, fill);
          setPageAddress(0, MAX_PAGE);
          setColumnAddress(0, MAX_COL);
          wrapEntireScreen = true;
        }
     }
   }
+  flushStream(stage, fill);
+}
+
+// refresh a fixed-width field of one text row (status lines, counters):
+// text is clipped to width cells and padded with spaces, and only that
+// span is addressed and sent, so nothing else on screen is touched
+void SSD1308::writeLine(uint8_t row, uint8_t col, uint8_t width, const char * text)
+{
+  if (col >= CHARS) return;
+  if (width > CHARS - col) width = CHARS - col;
+  uint8_t stage[SSD1308_DATA_CHUNK];
+  uint8_t fill = 0;
+  setPageAddress(row, row);
+  setColumnAddress(FONT_WIDTH*col, FONT_WIDTH*(col + width) - 1);
+  bool ended = false;
+  for (uint8_t i = 0; i < width; i++) {
+     if (!ended && text[i] == 0) ended = true;
+     streamChar(ended ? ' ' : text[i], stage, fill);
+  }
+  flushStream(stage, fill);
+}
+
+// append one glyph from PROGMEM to the staging buffer, sending the buffer
+// as a single DATA_MODE burst whenever it fills up
+void SSD1308::streamChar(char chr, uint8_t* stage, uint8_t& fill)
+{
+  const uint8_t char_index = chr - 0x20;
+  for (uint8_t i = 0; i < FONT_WIDTH; i++) {
+     stage[fill++] = pgm_read_byte( &fontData[char_index][i] );
+     if (fill == SSD1308_DATA_CHUNK) flushStream(stage, fill);
+  }
+}
+
+void SSD1308::flushStream(uint8_t* stage, uint8_t& fill)
+{
+  if (fill == 0) return;
+  sendData(fill, stage);
+  fill = 0;
 }
 
 void SSD1308::sendCommand(uint8_t command)
@@ -193,3 +254,98 @@ void SSD1308::setColumnAddress(uint8_t start, uint8_t end)
   sendCommands(3, data);  
 }
 
+#ifdef SSD1308_FRAMEBUFFER
+uint8_t* SSD1308::getFramebuffer()
+{
+  return &m_buffer[0][0];
+}
+
+// blank the buffer; the display changes on the next flush()
+void SSD1308::clearBuffer()
+{
+  memset(m_buffer, 0, sizeof(m_buffer));
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    m_dirtyStart[page] = 0;
+    m_dirtyEnd[page] = MAX_COL;
+  }
+}
+
+void SSD1308::setPixel(uint8_t x, uint8_t y, bool on)
+{
+  if (x >= COLUMNS || y >= ROWS) return;
+  uint8_t page = y >> 3;
+  uint8_t mask = 1 << (y & 7);
+  uint8_t old = m_buffer[page][x];
+  uint8_t b = on ? (old | mask) : (old & ~mask);
+  if (b == old) return;
+  m_buffer[page][x] = b;
+  markDirty(page, x, x);
+}
+
+bool SSD1308::getPixel(uint8_t x, uint8_t y)
+{
+  if (x >= COLUMNS || y >= ROWS) return false;
+  return m_buffer[y >> 3][x] & (1 << (y & 7));
+}
+
+// render text into the buffer, wrapping at the end of each row and
+// around to the top like writeString; unchanged glyphs stay clean
+void SSD1308::drawString(uint8_t row, uint8_t col, uint16_t len, const char* text)
+{
+  for (uint16_t index = 0; index < len; index++)
+  {
+    uint8_t* dst = &m_buffer[row][col * FONT_WIDTH];
+    const uint8_t char_index = text[index] - 0x20;
+    uint8_t first = COLUMNS, last = 0;
+    for (uint8_t i = 0; i < FONT_WIDTH; i++)
+    {
+      const uint8_t b = pgm_read_byte( &fontData[char_index][i] );
+      if (dst[i] != b)
+      {
+        dst[i] = b;
+        if (first == COLUMNS) first = i;
+        last = i;
+      }
+    }
+    if (first != COLUMNS) markDirty(row, col * FONT_WIDTH + first, col * FONT_WIDTH + last);
+    if (++col == CHARS)
+    {
+      col = 0;
+      if (++row == PAGES) row = 0;
+    }
+  }
+}
+
+void SSD1308::markDirty(uint8_t page, uint8_t startCol, uint8_t endCol)
+{
+  if (m_dirtyStart[page] == COLUMNS)
+  {
+    m_dirtyStart[page] = startCol;
+    m_dirtyEnd[page] = endCol;
+    return;
+  }
+  if (startCol < m_dirtyStart[page]) m_dirtyStart[page] = startCol;
+  if (endCol > m_dirtyEnd[page]) m_dirtyEnd[page] = endCol;
+}
+
+// send each page's changed column span as DATA_MODE bursts; a clean
+// screen costs no bus traffic at all
+void SSD1308::flush()
+{
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    if (m_dirtyStart[page] == COLUMNS) continue;
+    uint8_t start = m_dirtyStart[page];
+    uint8_t end = m_dirtyEnd[page];
+    setPageAddress(page, page);
+    setColumnAddress(start, end);
+    for (uint16_t col = start; col <= end; col += SSD1308_DATA_CHUNK)
+    {
+      uint16_t len = end + 1 - col;
+      sendData(len < SSD1308_DATA_CHUNK ? len : SSD1308_DATA_CHUNK, &m_buffer[page][col]);
+    }
+    m_dirtyStart[page] = COLUMNS;
+  }
+}
+#endif
@@ -6,6 +6,8 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - stream writeString glyphs as DATA_MODE bursts, add writeLine()
+//     2026-10-14 - add optional RAM framebuffer with dirty-region flush()
 //     2011-08-25 - initial release
         
 /* ============================================
@@ -55,6 +57,10 @@ THE SOFTWARE.
 #define MAX_PAGE (PAGES - 1)
 #define MAX_COL (COLUMNS - 1)
 
+// uncomment to keep a 1024-byte copy of display RAM for drawing and
+// dirty-region flush() (too large for 2 KB parts alongside much else)
+//#define SSD1308_FRAMEBUFFER
+
 #define HORIZONTAL_ADDRESSING_MODE 0x00
 #define VERTICAL_ADDRESSING_MODE   0x01
 #define PAGE_ADDRESSING_MODE       0x02
@@ -133,6 +139,10 @@ class SSD1308
     // x, y is position (x is row (i.e., page), y is character (0-15), starting at top-left)
     // text will wrap around until it is done.
     void writeString(uint8_t row, uint8_t col, uint16_t len, const char* txt);
+
+    // rewrite width character cells of one row (padding with spaces after
+    // the end of txt) without disturbing the rest of the display
+    void writeLine(uint8_t row, uint8_t col, uint8_t width, const char* txt);
     
     //void setXY(uint8_t, uint8_t y);
 
@@ -220,6 +230,19 @@ class SSD1308
 
     void sendData(uint8_t data);
     void sendData(uint8_t len, uint8_t* data);
+
+#ifdef SSD1308_FRAMEBUFFER
+    // drawing goes to RAM only; flush() sends what changed
+    uint8_t* getFramebuffer();
+    void clearBuffer();
+    void setPixel(uint8_t x, uint8_t y, bool on);
+    bool getPixel(uint8_t x, uint8_t y);
+    // same row/col character grid as writeString
+    void drawString(uint8_t row, uint8_t col, uint16_t len, const char* txt);
+    // for callers that write into getFramebuffer() directly
+    void markDirty(uint8_t page, uint8_t startCol, uint8_t endCol);
+    void flush();
+#endif
     // write the configuration registers in accordance with the datasheet and app note 3944
 //    void initialize();
     
@@ -237,8 +260,16 @@ class SSD1308
     void sendCommands(uint8_t len, uint8_t* buf);
 
     void writeChar(char chr);
+    void streamChar(char chr, uint8_t* stage, uint8_t& fill);
+    void flushStream(uint8_t* stage, uint8_t& fill);
     
     uint8_t m_devAddr; // contains the I2C address of the device
+
+#ifdef SSD1308_FRAMEBUFFER
+    uint8_t m_buffer[PAGES][COLUMNS];
+    uint8_t m_dirtyStart[PAGES]; // first changed column per page (COLUMNS = clean)
+    uint8_t m_dirtyEnd[PAGES];   // last changed column per page
+#endif
 };
 
 #endif
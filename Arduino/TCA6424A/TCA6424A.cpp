@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - add INT-gated input change detection with per-pin callbacks
+//     2026-10-14 - add output shadow with staged multi-pin updates committed in one burst
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -37,6 +39,11 @@ THE SOFTWARE.
  */
 TCA6424A::TCA6424A() {
     devAddr = TCA6424A_DEFAULT_ADDRESS;
+    outputsKnown = false;
+    inputsKnown = false;
+    interruptPin = -1;
+    changeCallback = 0;
+    changeMask = 0;
 }
 
 /** Specific address constructor.
@@ -47,14 +54,23 @@ TCA6424A::TCA6424A() {
  */
 TCA6424A::TCA6424A(uint8_t address) {
     devAddr = address;
+    outputsKnown = false;
+    inputsKnown = false;
+    interruptPin = -1;
+    changeCallback = 0;
+    changeMask = 0;
 }
 
 /** Power on and prepare for general usage.
  * The TCA6424A I/O expander requires no preparation after power-on. All pins
  * will be default to INPUT mode, and the device is ready for usage immediately.
- * This is an empty function for consistency and/or future expansion.
+ * The output shadow is loaded from the device here, so single-pin writes
+ * need no read-modify-write afterwards, and the input change baseline is
+ * taken (which also releases INT).
  */
 void TCA6424A::initialize() {
+    syncOutputs();
+    checkInputs();
 }
 
 /** Verify the I2C connection.
@@ -87,7 +103,7 @@ uint8_t TCA6424A::readBank(uint8_t bank) {
  * @param banks Container for all bank's pin values (P00-P27)
  */
 void TCA6424A::readAll(uint8_t *banks) {
-    I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0, 3, banks);
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks);
 }
 /** Get all pin logic levels from all banks.
  * Reads into individual 1-byte containers.
@@ -96,11 +112,59 @@ void TCA6424A::readAll(uint8_t *banks) {
  * @param bank2 Container for Bank 2's pin values (P20-P27)
  */
 void TCA6424A::readAll(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2) {
-    I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0, 3, buffer);
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
     *bank0 = buffer[0];
     *bank1 = buffer[1];
     *bank2 = buffer[2];
 }
+/** Watch the INT output instead of reading the inputs on every check.
+ * INT is pulled low when any input changes and released when the inputs are
+ * read, so checkInputs() only touches the bus when it is low. Input reads
+ * made with readPin()/readBank()/readAll() also release INT, and changes
+ * they see are not reported by checkInputs(). INT is open-drain; the
+ * internal pull-up is enabled.
+ * @param pin Arduino pin wired to INT, -1 to read on every check
+ */
+void TCA6424A::setInterruptPin(int8_t pin) {
+    interruptPin = pin;
+    if (pin >= 0) {
+        pinMode(pin, INPUT);
+        digitalWrite(pin, HIGH);
+    }
+}
+/** Set the handler for input changes found by checkInputs().
+ * @param callback Called once per changed pin in pinMask (0 to disable)
+ * @param pinMask Pins to report, bit n = pin n (P00 = bit 0 ... P27 = bit 23)
+ */
+void TCA6424A::setChangeCallback(TCA6424A_ChangeCallback callback, uint32_t pinMask) {
+    changeCallback = callback;
+    changeMask = pinMask;
+}
+/** Look for input changes since the last check.
+ * With an interrupt pin set this costs no bus traffic until INT goes low;
+ * then all three INPUT banks are read in one burst, compared with the
+ * previous levels and the change callback is called for each changed pin.
+ * The first check only records a baseline. Safe to call from loop() as
+ * often as liked; don't call it from an interrupt handler.
+ * @return Changed pins, bit n = pin n (0 if none or the read failed)
+ */
+uint32_t TCA6424A::checkInputs() {
+    if (interruptPin >= 0 && inputsKnown && digitalRead(interruptPin) != LOW) return 0;
+    if (I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer) != 3) return 0;
+    uint32_t changed = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        if (inputsKnown) changed |= (uint32_t)(uint8_t)(buffer[i] ^ inputs[i]) << (i * 8);
+        inputs[i] = buffer[i];
+    }
+    inputsKnown = true;
+    if (changeCallback) {
+        uint32_t report = changed & changeMask;
+        for (uint8_t pin = 0; report; pin++, report >>= 1) {
+            if (report & 1) changeCallback(pin, (inputs[pin / 8] >> (pin % 8)) & 1);
+        }
+    }
+    return changed;
+}
 
 // OUTPUT* registers (x4h - x6h)
 
@@ -128,7 +192,7 @@ uint8_t TCA6424A::getBankOutputLevel(uint8_t bank) {
  * @param banks Container for all bank's pin values (P00-P27)
  */
 void TCA6424A::getAllOutputLevel(uint8_t *banks) {
-    I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0, 3, banks);
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks);
 }
 /** Get all pin output settings from all banks.
  * Reads into individual 1-byte containers. Note that this returns the level
@@ -139,30 +203,49 @@ void TCA6424A::getAllOutputLevel(uint8_t *banks) {
  * @param bank2 Container for Bank 2's pin values (P20-P27)
  */
 void TCA6424A::getAllOutputLevel(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2) {
-    I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0, 3, buffer);
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
     *bank0 = buffer[0];
     *bank1 = buffer[1];
     *bank2 = buffer[2];
 }
 /** Set a single OUTPUT pin's logic level.
+ * Once the output shadow is loaded (see syncOutputs()) this is a single
+ * register write; before that it falls back to a read-modify-write. Staged
+ * changes to other pins are left staged.
  * @param pin Which pin to write (0-23)
  * @param value New pin output logic level (0 or 1)
  */
 void TCA6424A::writePin(uint16_t pin, bool value) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_OUTPUT0 + (pin / 8), pin % 8, value);
+    uint8_t bank = pin / 8, mask = 1 << (pin % 8);
+    if (!outputsKnown) {
+        I2Cdev::writeBit(devAddr, TCA6424A_RA_OUTPUT0 + bank, pin % 8, value);
+        return;
+    }
+    uint8_t b = value ? (outputs[bank] | mask) : (outputs[bank] & ~mask);
+    if (I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, b)) {
+        outputs[bank] = b;
+        staged[bank] = value ? (staged[bank] | mask) : (staged[bank] & ~mask);
+    }
 }
 /** Set all OUTPUT pins' logic levels in one bank.
+ * Discards any staged changes to the bank.
  * @param bank Which bank to write (0/1/2 for P0*, P1*, P2* respectively)
  * @param value New pins' output logic level (0 or 1 for each pin)
  */
 void TCA6424A::writeBank(uint8_t bank, uint8_t value) {
-    I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, value);
+    if (I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, value)) {
+        outputs[bank] = staged[bank] = value;
+    }
 }
 /** Set all OUTPUT pins' logic levels in all banks.
+ * Discards any staged changes and leaves the output shadow loaded.
  * @param banks All pins' new logic values (P00-P27) in 3-byte array
  */
 void TCA6424A::writeAll(uint8_t *banks) {
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks);
+    if (I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks)) {
+        for (uint8_t i = 0; i < 3; i++) outputs[i] = staged[i] = banks[i];
+        outputsKnown = true;
+    }
 }
 /** Set all OUTPUT pins' logic levels in all banks.
  * @param bank0 Bank 0's new logic values (P00-P07)
@@ -173,7 +256,70 @@ void TCA6424A::writeAll(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
     buffer[0] = bank0;
     buffer[1] = bank1;
     buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    writeAll(buffer);
+}
+
+/** Load the output shadow from the OUTPUT* registers in one burst read.
+ * Called by initialize(); call it again if something else (a reset, another
+ * bus master) may have changed the outputs. Discards any staged changes.
+ * @return True if the registers were read
+ */
+bool TCA6424A::syncOutputs() {
+    if (I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer) != 3) return false;
+    for (uint8_t i = 0; i < 3; i++) outputs[i] = staged[i] = buffer[i];
+    outputsKnown = true;
+    return true;
+}
+/** Stage a single OUTPUT pin's logic level for the next commitOutputs().
+ * No bus traffic happens until then, except for loading the output shadow
+ * on first use if initialize()/syncOutputs() haven't.
+ * @param pin Which pin to change (0-23)
+ * @param value New pin output logic level (0 or 1)
+ */
+void TCA6424A::stagePin(uint16_t pin, bool value) {
+    if (!outputsKnown) syncOutputs();
+    if (value) staged[pin / 8] |= 1 << (pin % 8);
+    else staged[pin / 8] &= ~(1 << (pin % 8));
+}
+/** Stage all OUTPUT pins' logic levels in one bank for the next commitOutputs().
+ * @param bank Which bank to change (0/1/2 for P0*, P1*, P2* respectively)
+ * @param value New pins' output logic level (0 or 1 for each pin)
+ */
+void TCA6424A::stageBank(uint8_t bank, uint8_t value) {
+    if (!outputsKnown) syncOutputs();
+    staged[bank] = value;
+}
+/** Stage many OUTPUT pins at once for the next commitOutputs().
+ * Bit n of each mask is pin n (P00 = bit 0 ... P27 = bit 23); pins in
+ * neither mask keep their staged level, clearMask wins over setMask.
+ * @param setMask Pins to drive high
+ * @param clearMask Pins to drive low
+ */
+void TCA6424A::stageMask(uint32_t setMask, uint32_t clearMask) {
+    if (!outputsKnown) syncOutputs();
+    for (uint8_t i = 0; i < 3; i++) {
+        staged[i] = (staged[i] | (uint8_t)(setMask >> (i * 8))) & ~(uint8_t)(clearMask >> (i * 8));
+    }
+}
+/** Write all staged OUTPUT changes to the device.
+ * Only the span of banks that actually changed is sent, as one
+ * auto-increment burst, so any number of pin changes costs at most one
+ * transaction (none if nothing changed).
+ * @return True if the device outputs now match the staged levels
+ */
+bool TCA6424A::commitOutputs() {
+    if (!outputsKnown) return false; // nothing was staged against a known state
+    uint8_t first = 3, last = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        if (staged[i] != outputs[i]) {
+            if (first == 3) first = i;
+            last = i;
+        }
+    }
+    if (first == 3) return true; // nothing changed
+    if (!I2Cdev::writeBytes(devAddr, (TCA6424A_RA_OUTPUT0 + first) | TCA6424A_AUTO_INCREMENT, last - first + 1, staged + first)) return false;
+    for (uint8_t i = first; i <= last; i++) outputs[i] = staged[i];
+    return true;
 }
 
 // POLARITY* registers (x8h - xAh)
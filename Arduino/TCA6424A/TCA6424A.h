@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - add INT-gated input change detection with per-pin callbacks
+//     2026-10-14 - add output shadow with staged multi-pin updates committed in one burst
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -88,6 +90,9 @@ THE SOFTWARE.
 #define TCA6424A_P26                22
 #define TCA6424A_P27                23
 
+/** Input change handler, called once per changed pin with its new level. */
+typedef void (*TCA6424A_ChangeCallback)(uint8_t pin, bool level);
+
 class TCA6424A {
     public:
         TCA6424A();
@@ -102,6 +107,11 @@ class TCA6424A {
         void readAll(uint8_t *banks);
         void readAll(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2);
 
+        // input change detection on the INT line
+        void setInterruptPin(int8_t pin);
+        void setChangeCallback(TCA6424A_ChangeCallback callback, uint32_t pinMask=0xFFFFFF);
+        uint32_t checkInputs();
+
         // OUTPUT* registers (x4h - x6h)
         bool getPinOutputLevel(uint16_t pin);
         uint8_t getBankOutputLevel(uint8_t bank);
@@ -112,6 +122,13 @@ class TCA6424A {
         void writeAll(uint8_t *banks);
         void writeAll(uint8_t bank0, uint8_t bank1, uint8_t bank2);
 
+        // OUTPUT* shadow: stage any number of pin changes, then commit them
+        bool syncOutputs();
+        void stagePin(uint16_t pin, bool value);
+        void stageBank(uint8_t bank, uint8_t value);
+        void stageMask(uint32_t setMask, uint32_t clearMask);
+        bool commitOutputs();
+
         // POLARITY* registers (x8h - xAh)
         bool getPinPolarity(uint16_t pin);
         uint8_t getBankPolarity(uint8_t bank);
@@ -135,6 +152,14 @@ class TCA6424A {
     private:
         uint8_t devAddr;
         uint8_t buffer[3];
+        uint8_t outputs[3];     // OUTPUT* registers as last written or read
+        uint8_t staged[3];      // outputs[] plus changes not yet committed
+        bool outputsKnown;      // outputs[] reflects the device
+        uint8_t inputs[3];      // INPUT* registers as of the last checkInputs()
+        bool inputsKnown;       // inputs[] holds a baseline
+        int8_t interruptPin;    // MCU pin wired to INT, -1 to read on every check
+        TCA6424A_ChangeCallback changeCallback;
+        uint32_t changeMask;    // pins reported to changeCallback
 };
 
 #endif /* _TCA6424A_H_ */
@@ -3,6 +3,11 @@
 // 6/9/2012 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//     2026-10-14 - implement readWords() for the MSP430 USCI driver
+//     2026-10-14 - unpack readWords() results with the shared big-endian word kernel
+//     2026-10-14 - add LPM/DMA-backed transfers and readBytesAsync() for the MSP430 USCI driver
+//     2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//     2026-10-14 - add 16-bit length readBlock()/writeBlock()
 //     2012-06-09 - fix major issue with reading > 32 bytes at a time with Arduino Wire
 //                - add compiler warnings when using outdated or IDE or limited I2Cdev implementation
 //     2011-11-01 - fix write*Bits mask calculation (thanks sasquatch @ Arduino forums)
@@ -93,6 +98,36 @@ I2Cdev::I2Cdev() {
 
 }
 
+// -----------------------------------------------------------------------------
+// Transport backend for the shared register core (I2Cdev_core.c)
+// -----------------------------------------------------------------------------
+
+static int16_t I2Cdev_transportRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    if (timeout == I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) timeout = I2Cdev::readTimeout;
+    if (length <= 0xFF) return I2Cdev::readBytes(devAddr, regAddr, length, data, timeout);
+    return I2Cdev::readBlock(devAddr, regAddr, length, data, timeout);
+}
+
+static uint8_t I2Cdev_transportWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    if (length <= 0xFF) return I2Cdev::writeBytes(devAddr, regAddr, length, data);
+    return I2Cdev::writeBlock(devAddr, regAddr, length, data);
+}
+
+static uint8_t I2Cdev_transportReadAsync(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2Cdev_TransportDone done, void *doneContext) {
+    return I2Cdev::readBytesAsync(devAddr, regAddr, length, data, done, doneContext);
+}
+
+/** Register-level transport used by the bit and word accessors. Drivers and
+ * other core code can call the I2Cdev_core*() functions with it directly.
+ */
+const I2Cdev_Transport I2Cdev::transport = {
+    I2Cdev_transportRead,
+    I2Cdev_transportWrite,
+    0,  // lookup
+    I2Cdev_transportReadAsync,
+    0   // context
+};
+
 /** Read a single bit from an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
@@ -102,10 +137,7 @@ I2Cdev::I2Cdev() {
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
-    uint8_t b;
-    uint8_t count = readByte(devAddr, regAddr, &b, timeout);
-    *data = b & (1 << bitNum);
-    return count;
+    return I2Cdev_coreReadBit(&transport, devAddr, regAddr, bitNum, data, timeout);
 }
 
 /** Read a single bit from a 16-bit device register.
@@ -117,10 +149,7 @@ int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
-    uint16_t b;
-    uint8_t count = readWord(devAddr, regAddr, &b, timeout);
-    *data = b & (1 << bitNum);
-    return count;
+    return I2Cdev_coreReadBitW(&transport, devAddr, regAddr, bitNum, data, timeout);
 }
 
 /** Read multiple bits from an 8-bit device register.
@@ -133,19 +162,7 @@ int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
-    // 01101001 read byte
-    // 76543210 bit numbers
-    //    xxx   args: bitStart=4, length=3
-    //    010   masked
-    //   -> 010 shifted
-    uint8_t count, b;
-    if ((count = readByte(devAddr, regAddr, &b, timeout)) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        b &= mask;
-        b >>= (bitStart - length + 1);
-        *data = b;
-    }
-    return count;
+    return I2Cdev_coreReadBits(&transport, devAddr, regAddr, bitStart, length, data, timeout);
 }
 
 /** Read multiple bits from a 16-bit device register.
@@ -158,20 +175,7 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
 int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
-    // 1101011001101001 read byte
-    // fedcba9876543210 bit numbers
-    //    xxx           args: bitStart=12, length=3
-    //    010           masked
-    //           -> 010 shifted
-    uint8_t count;
-    uint16_t w;
-    if ((count = readWord(devAddr, regAddr, &w, timeout)) != 0) {
-        uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        w &= mask;
-        w >>= (bitStart - length + 1);
-        *data = w;
-    }
-    return count;
+    return I2Cdev_coreReadBitsW(&transport, devAddr, regAddr, bitStart, length, data, timeout);
 }
 
 /** Read single byte from an 8-bit device register.
@@ -305,9 +309,7 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
         }
 	#elif (I2CDEV_IMPLEMENTATION == I2CDEV_MSP430)
 
-        I2C_readBytesFromAddress(devAddr, regAddr, length, data);
-
-		count = length; //TODO implement something meaningful, for now just making sure no error is thrown
+        count = I2C_readBytesFromAddress(devAddr, regAddr, length, data) ? length : -1;
 	
     #endif
 
@@ -347,6 +349,11 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
 
     #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE)
 
+        // word i only overlaps bytes 2i and 2i+1, so the caller's buffer
+        // holds the raw bytes and is converted in place afterwards
+        uint8_t *raw = (uint8_t *)data;
+        uint16_t received = 0;
+
         #if (ARDUINO < 100)
             // Arduino v00xx (before v1.0), Wire library
 
@@ -360,21 +367,9 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                 Wire.beginTransmission(devAddr);
                 Wire.requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
     
-                bool msb = true; // starts with MSB, then LSB
-                for (; Wire.available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
-                    if (msb) {
-                        // first byte is bits 15-8 (MSb=15)
-                        data[count] = Wire.receive() << 8;
-                    } else {
-                        // second byte is bits 7-0 (LSb=0)
-                        data[count] |= Wire.receive();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
-                        count++;
-                    }
-                    msb = !msb;
+                // collect raw big-endian bytes; they are unpacked in one pass below
+                for (; Wire.available() && received < length * 2 && (timeout == 0 || millis() - t1 < timeout); received++) {
+                    raw[received] = Wire.receive();
                 }
 
                 Wire.endTransmission();
@@ -393,21 +388,9 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                 Wire.beginTransmission(devAddr);
                 Wire.requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
     
-                bool msb = true; // starts with MSB, then LSB
-                for (; Wire.available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
-                    if (msb) {
-                        // first byte is bits 15-8 (MSb=15)
-                        data[count] = Wire.read() << 8;
-                    } else {
-                        // second byte is bits 7-0 (LSb=0)
-                        data[count] |= Wire.read();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
-                        count++;
-                    }
-                    msb = !msb;
+                // collect raw big-endian bytes; they are unpacked in one pass below
+                for (; Wire.available() && received < length * 2 && (timeout == 0 || millis() - t1 < timeout); received++) {
+                    raw[received] = Wire.read();
                 }
         
                 Wire.endTransmission();
@@ -426,44 +409,45 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                 Wire.beginTransmission(devAddr);
                 Wire.requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
         
-                bool msb = true; // starts with MSB, then LSB
-                for (; Wire.available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
-                    if (msb) {
-                        // first byte is bits 15-8 (MSb=15)
-                        data[count] = Wire.read() << 8;
-                    } else {
-                        // second byte is bits 7-0 (LSb=0)
-                        data[count] |= Wire.read();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
-                        count++;
-                    }
-                    msb = !msb;
+                // collect raw big-endian bytes; they are unpacked in one pass below
+                for (; Wire.available() && received < length * 2 && (timeout == 0 || millis() - t1 < timeout); received++) {
+                    raw[received] = Wire.read();
                 }
         
                 Wire.endTransmission();
             }
         #endif
 
+        count = received / 2;
+        I2Cdev_coreUnpackBE16(data, raw, count);
+        #ifdef I2CDEV_SERIAL_DEBUG
+            for (uint8_t i = 0; i < count; i++) {
+                Serial.print(data[i], HEX);
+                if (i + 1 < count) Serial.print(" ");
+            }
+        #endif
+
     #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
         // Fastwire library (STILL UNDER DEVELOPMENT, NON-FUNCTIONAL!)
 
-        // no loop required for fastwire
-        uint16_t intermediate[(uint8_t)length];
-        uint8_t status = Fastwire::readBuf(devAddr, regAddr, (uint8_t *)intermediate, (uint8_t)(length * 2));
+        // no loop required for fastwire; raw bytes land in the caller's buffer
+        // and are converted in place
+        uint8_t status = Fastwire::readBuf(devAddr, regAddr, (uint8_t *)data, (uint8_t)(length * 2));
         if (status == 0) {
             count = length; // success
-            for (uint8_t i = 0; i < length; i++) {
-                data[i] = (intermediate[2*i] << 8) | intermediate[2*i + 1];
-            }
+            I2Cdev_coreUnpackBE16(data, (uint8_t *)data, length);
         } else {
             count = -1; // error
         }
 
 	#elif (I2CDEV_IMPLEMENTATION == I2CDEV_MSP430)
-       //TODO implement
+
+        if (I2C_readBytesFromAddress(devAddr, regAddr, (uint16_t)length * 2, (uint8_t *)data)) {
+            I2Cdev_coreUnpackBE16(data, (uint8_t *)data, length);
+            count = length;
+        } else {
+            count = -1; // NACK
+        }
 
     #endif
 
@@ -486,10 +470,7 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-    uint8_t b;
-    readByte(devAddr, regAddr, &b);
-    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-    return writeByte(devAddr, regAddr, b);
+    return I2Cdev_coreWriteBit(&transport, devAddr, regAddr, bitNum, data);
 }
 
 /** write a single bit in a 16-bit device register.
@@ -500,10 +481,7 @@ bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
-    uint16_t w;
-    readWord(devAddr, regAddr, &w);
-    w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
-    return writeWord(devAddr, regAddr, w);
+    return I2Cdev_coreWriteBitW(&transport, devAddr, regAddr, bitNum, data);
 }
 
 /** Write multiple bits in an 8-bit device register.
@@ -515,24 +493,7 @@ bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
-    //      010 value to write
-    // 76543210 bit numbers
-    //    xxx   args: bitStart=4, length=3
-    // 00011100 mask byte
-    // 10101111 original value (sample)
-    // 10100011 original & ~mask
-    // 10101011 masked | value
-    uint8_t b;
-    if (readByte(devAddr, regAddr, &b) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        b &= ~(mask); // zero all important bits in existing byte
-        b |= data; // combine data with existing byte
-        return writeByte(devAddr, regAddr, b);
-    } else {
-        return false;
-    }
+    return I2Cdev_coreWriteBits(&transport, devAddr, regAddr, bitStart, length, data);
 }
 
 /** Write multiple bits in a 16-bit device register.
@@ -544,24 +505,7 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
-    //              010 value to write
-    // fedcba9876543210 bit numbers
-    //    xxx           args: bitStart=12, length=3
-    // 0001110000000000 mask byte
-    // 1010111110010110 original value (sample)
-    // 1010001110010110 original & ~mask
-    // 1010101110010110 masked | value
-    uint16_t w;
-    if (readWord(devAddr, regAddr, &w) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        w &= ~(mask); // zero all important bits in existing word
-        w |= data; // combine data with existing word
-        return writeWord(devAddr, regAddr, w);
-    } else {
-        return false;
-    }
+    return I2Cdev_coreWriteBitsW(&transport, devAddr, regAddr, bitStart, length, data);
 }
 
 /** Write single byte to an 8-bit device register.
@@ -642,7 +586,7 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
 //        while ( USCI_I2C_notready() );         // wait for bus to be free
 //        USCI_I2C_transmit(length,data);       // start transmitting
 
-        I2C_writeBytesToAddress(devAddr, regAddr, length, data);
+        if (!I2C_writeBytesToAddress(devAddr, regAddr, length, data)) status = 2; // NACK
 
 	#endif
     return status == 0;
@@ -751,6 +695,87 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
     return status == 0;
 }
 
+/** Read a block of bytes of any length in one logical transfer.
+ * With the MSP430 implementation this is a single addressed read; the other
+ * implementations split it into 32-byte readBytes() calls on the same
+ * register, which suits FIFO and memory ports.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int16_t I2Cdev::readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_MSP430)
+        return I2C_readBytesFromAddress(devAddr, regAddr, length, data) ? (int16_t)length : -1;
+    #else
+        int16_t count = 0;
+        while (count < (int16_t)length) {
+            uint8_t n = (length - count > 32) ? 32 : (uint8_t)(length - count);
+            if (readBytes(devAddr, regAddr, n, data + count, timeout) != (int8_t)n) return -1;
+            count += n;
+        }
+        return count;
+    #endif
+}
+
+/** Write a block of bytes of any length in one logical transfer.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ * @see readBlock()
+ */
+bool I2Cdev::writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_MSP430)
+        return I2C_writeBytesToAddress(devAddr, regAddr, length, data);
+    #else
+        for (uint16_t k = 0; k < length; ) {
+            uint8_t n = (length - k > 31) ? 31 : (uint8_t)(length - k);
+            if (!writeBytes(devAddr, regAddr, n, data + k)) return false;
+            k += n;
+        }
+        return true;
+    #endif
+}
+
+/** Start reading a block of registers without waiting for it to finish.
+ * With the MSP430 implementation the data phase runs from the USCI interrupt
+ * (or DMA, see I2C_DMA_RX_TRIGGER in msp430_i2c.h) so the caller can enter a
+ * low power mode; done is called from interrupt context on completion. Other
+ * implementations complete the read before returning and call done directly.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in (must stay valid until done)
+ * @param done Optional completion callback, given the byte count (-1 on failure)
+ * @param context Optional user pointer passed to done
+ * @return True if the read was started, false if a transfer is still running
+ * @see isTransferComplete()
+ */
+bool I2Cdev::readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2Cdev_TransportDone done, void *context) {
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_MSP430)
+        return I2C_readBytesFromAddressAsync(devAddr, regAddr, length, data, done, context);
+    #else
+        int16_t count = readBlock(devAddr, regAddr, length, data);
+        if (done) done(context, count);
+        return true;
+    #endif
+}
+
+/** Check whether the last readBytesAsync() transfer has finished.
+ * @return True if no transfer is running
+ */
+bool I2Cdev::isTransferComplete() {
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_MSP430)
+        return I2C_isTransferComplete();
+    #else
+        return true;
+    #endif
+}
+
 /** Default timeout value for read operations.
  * Set this to 0 to disable timeout detection.
  */
@@ -3,6 +3,10 @@
 // 6/9/2012 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//     2026-10-14 - add header-only I2Cdev_Ring single-producer/single-consumer sample ring
+//     2026-10-14 - add LPM/DMA-backed transfers and readBytesAsync() for the MSP430 USCI driver
+//     2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//     2026-10-14 - add 16-bit length readBlock()/writeBlock()
 //     2013-05-09 - added MSP430 implementation (zoellner)
 //     2012-06-09 - fix major issue with reading > 32 bytes at a time with Arduino Wire
 //                - add compiler warnings when using outdated or IDE or limited I2Cdev implementation
@@ -81,6 +85,12 @@ THE SOFTWARE.
     #include "ArduinoWrapper.h"
 #endif
 
+// shared register logic, identical in every port
+#include "I2Cdev_core.h"
+
+// lock-free sample ring shared by the streaming drivers
+#include "I2Cdev_ring.h"
+
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     0
 
@@ -106,7 +116,13 @@ class I2Cdev {
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
 
+        static int16_t readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static bool writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+        static bool readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2Cdev_TransportDone done=0, void *context=0);
+        static bool isTransferComplete();
+
         static uint16_t readTimeout;
+        static const I2Cdev_Transport transport;
 };
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
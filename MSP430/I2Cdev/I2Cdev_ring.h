@@ -0,0 +1,152 @@
+// I2Cdev library collection - single-producer/single-consumer sample ring
+// Header-only template drivers use to hand samples from an ISR or completion to the main loop
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// This file is identical in the C++ port directories (Arduino, MSP430);
+// change both copies together.
+//
+// Changelog:
+//     2026-10-14 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_RING_H_
+#define _I2CDEV_RING_H_
+
+#include <stdint.h>
+
+// Keeps the compiler from moving slot stores past the index store that
+// publishes them (or slot loads ahead of the index load that reveals them).
+// The 8-bit targets are single-core and keep program order in hardware.
+#if defined(__GNUC__)
+    #define I2CDEV_RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+    #define I2CDEV_RING_BARRIER()
+#endif
+
+/** Ring of samples shared by one producer and one consumer without locking.
+ * Storage is supplied by the caller and its size must be a power of 2 (up
+ * to 128). head and tail are single bytes that run freely and wrap at 256,
+ * so every index load and store is one indivisible access on AVR, MSP430
+ * and PIC18 alike; the producer (ISR or completion callback) only writes
+ * head and the consumer (main loop) only writes tail.
+ *
+ * Producers either push() a finished sample or, to decode straight into
+ * the ring, take a slot from reserve() / a run of slots from writeSpan() and
+ * publish it with commit(). dropped counts samples discarded because the
+ * ring was full; overruns is for the producer to count data lost upstream
+ * (hardware FIFO overflow, missed interrupts).
+ * @see I2Cdev_RingBuffer
+ */
+template <class T>
+struct I2Cdev_Ring {
+    T *samples;                 // caller-provided storage
+    uint8_t mask;               // storage size - 1
+    volatile uint8_t head;      // next slot written by the producer
+    volatile uint8_t tail;      // next slot read by the consumer
+    uint16_t dropped;           // samples discarded while the ring was full
+    uint16_t overruns;          // producer-side losses (FIFO overflow, missed edges)
+
+    void init(T *storage, uint8_t size) {
+        samples = storage;
+        mask = size - 1;
+        head = tail = 0;
+        dropped = overruns = 0;
+    }
+
+    // consumer side
+
+    uint8_t available() const {
+        return (uint8_t)(head - tail);
+    }
+    bool pop(T *sample) {
+        uint8_t t = tail;
+        if (head == t) return false;
+        I2CDEV_RING_BARRIER();
+        *sample = samples[t & mask];
+        I2CDEV_RING_BARRIER();
+        tail = t + 1;
+        return true;
+    }
+    T *peek() {
+        uint8_t t = tail;
+        if (head == t) return 0;
+        I2CDEV_RING_BARRIER();
+        return &samples[t & mask];
+    }
+    void release() {
+        I2CDEV_RING_BARRIER();
+        tail++;
+    }
+
+    // producer side
+
+    uint8_t space() const {
+        return mask + 1 - (uint8_t)(head - tail);
+    }
+    T *reserve() {
+        if ((uint8_t)(head - tail) > mask) {
+            dropped++;
+            return 0;
+        }
+        return &samples[head & mask];
+    }
+    /** Contiguous free slots starting at head (stops at the storage end).
+     * @param count Receives the number of slots available in the span
+     * @return First slot of the span
+     */
+    T *writeSpan(uint8_t *count) {
+        uint8_t h = head & mask;
+        uint8_t room = space();
+        *count = (room < mask + 1 - h) ? room : mask + 1 - h;
+        return &samples[h];
+    }
+    void commit(uint8_t count=1) {
+        I2CDEV_RING_BARRIER();
+        head += count;
+    }
+    bool push(const T &sample) {
+        T *slot = reserve();
+        if (!slot) return false;
+        *slot = sample;
+        commit();
+        return true;
+    }
+};
+
+/** I2Cdev_Ring that owns its storage; Size must be a power of 2 (up to 128).
+ * Pass it anywhere an I2Cdev_Ring<T> * is expected.
+ */
+template <class T, uint8_t Size>
+struct I2Cdev_RingBuffer : I2Cdev_Ring<T> {
+    typedef char sizeMustBePowerOfTwo[(Size > 0 && Size <= 128 && (Size & (Size - 1)) == 0) ? 1 : -1];
+    T storage[Size];
+
+    I2Cdev_RingBuffer() {
+        I2Cdev_Ring<T>::init(storage, Size);
+    }
+};
+
+#endif /* _I2CDEV_RING_H_ */
@@ -20,12 +20,19 @@
 //*****************************************************************************
 //#define MSP430_BUFFER_LENGTH 32
 //static uint8_t receiveBuffer[MSP430_BUFFER_LENGTH];
-static uint8_t receiveCount = 0;
+static volatile uint16_t receiveCount = 0;
 static uint8_t *receiveBufferPointer;
 
 static uint8_t *transmitData;
-static uint8_t transmitCounter = 0;
-static uint8_t TXLENGTH;
+static volatile uint16_t transmitCounter = 0;
+static uint16_t TXLENGTH;
+
+//Completion state shared by the blocking and asynchronous transfer calls
+static volatile uint8_t transferDone = 1;
+static volatile uint8_t transferError = 0;
+static uint16_t transferLength;
+static I2C_Callback doneCallback;
+static void *doneContext;
 
 
 //*****************************************************************************
@@ -271,8 +278,9 @@ void I2C_masterSendSingleByte ( unsigned char txData   )
     //Send single byte data.
     UCB1TXBUF = txData;
 
-    //Poll for transmit interrupt flag.
-    while (!(UC1IFG & UCB1TXIFG)) ;
+    //Poll for transmit interrupt flag. A NACKed address never sets it, so
+    //give up on UCNACKIFG as well; the caller checks the flag afterwards.
+    while (!(UC1IFG & UCB1TXIFG) && !(UCB1STAT & UCNACKIFG)) ;
 
     //Send stop condition.
     UCB1CTL1 |= UCTXSTP;
@@ -621,6 +629,55 @@ unsigned char I2C_masterSingleReceive ()
 ////		__bic_SR_register_on_exit(LPM0_bits);
 //	}
 //}
+//*****************************************************************************
+//
+//Signal the end of the current transfer from interrupt context. The ISR that
+//calls this exits LPM0 so a blocking caller in I2C_waitForTransfer() resumes.
+//The callback gets -1 if the slave NACKed, see USCIAB1RX_ISR.
+//
+//*****************************************************************************
+static void I2C_completeTransfer(void)
+{
+	I2C_Callback callback = doneCallback;
+	//A late NACK must not fail the next transfer
+	UCB1I2CIE &= ~UCNACKIE;
+	doneCallback = 0;
+	transferDone = 1;
+	if (callback) callback(doneContext, transferError ? -1 : (int16_t)transferLength);
+}
+
+//*****************************************************************************
+//
+//Clear a stale NACK and enable the NACK interrupt for the transfer's data
+//phase. Must follow I2C_enable(), since UCSWRST clears UCB1STAT.
+//
+//*****************************************************************************
+static void I2C_armNack(void)
+{
+	UCB1STAT &= ~UCNACKIFG;
+	UCB1I2CIE |= UCNACKIE;
+}
+
+#ifdef I2C_DMA_ENABLED
+//*****************************************************************************
+//
+//Point DMA channel 0 at the USCI buffer for the data phase of a transfer. The
+//DMA moves one byte per RXIFG/TXIFG trigger without waking the CPU; its
+//completion interrupt hands the last byte(s) back to the USCI ISR, which
+//generates the STOP condition exactly as the interrupt-only path does.
+//
+//*****************************************************************************
+static void I2C_startDMA(unsigned int trigger, unsigned int control, unsigned int src, unsigned int dst, uint16_t size)
+{
+	DMA0CTL = 0;
+	DMACTL0 = (DMACTL0 & ~I2C_DMA_TSEL_MASK) | trigger;
+	DMA0SA = src;
+	DMA0DA = dst;
+	DMA0SZ = size;
+	DMA0CTL = DMADT_0 + DMASRCBYTE + DMADSTBYTE + DMAIE + DMAEN + control;
+}
+#endif
+
 #if USCI_I2C==0
 //TODO implement
 #elif USCI_I2C==1
@@ -641,9 +698,11 @@ __interrupt void USCIAB1TX_ISR (void)
 
 			//Clear master interrupt status
 			I2C_clearInterruptFlag(I2C_TRANSMIT_INTERRUPT);
+			I2C_disableInterrupt(I2C_TRANSMIT_INTERRUPT);
+			I2C_completeTransfer();
 
 			//Exit LPM0 on interrupt return
-//			__bic_SR_register_on_exit(LPM0_bits);
+			__bic_SR_register_on_exit(LPM0_bits);
 		}
 	}
 	if(UC1IFG&UCB1RXIFG) {
@@ -663,15 +722,124 @@ __interrupt void USCIAB1TX_ISR (void)
 			//Receive last byte
 			*receiveBufferPointer = I2C_masterMultiByteReceiveNext();
 			//This is also the active branch for the SingleReceive mode.
-//			__bic_SR_register_on_exit(LPM0_bits);
+			I2C_disableInterrupt(I2C_RECEIVE_INTERRUPT);
+			I2C_completeTransfer();
+			__bic_SR_register_on_exit(LPM0_bits);
 		}
 	}
 }
+
+//In I2C mode the USCI_B1 state flags (NACK, arbitration lost, START, STOP)
+//are served by the RX vector; only NACK is enabled.
+#pragma vector=USCIAB1RX_VECTOR
+__interrupt void USCIAB1RX_ISR (void)
+{
+	if (UCB1STAT & UCNACKIFG) {
+		//Slave did not acknowledge: release the bus and fail the transfer,
+		//otherwise TXIFG/RXIFG never arrive and the caller sleeps forever
+		UCB1CTL1 |= UCTXSTP;
+		UCB1STAT &= ~UCNACKIFG;
+		I2C_disableInterrupt(I2C_TRANSMIT_INTERRUPT + I2C_RECEIVE_INTERRUPT);
+		#ifdef I2C_DMA_ENABLED
+		DMA0CTL &= ~(DMAIFG + DMAEN + DMAIE);
+		#endif
+		transferError = 1;
+		I2C_completeTransfer();
+
+		//Exit LPM0 on interrupt return
+		__bic_SR_register_on_exit(LPM0_bits);
+	}
+}
 #endif
 
-//todo move the next two functions to I2Cdev.cpp (as methods of new class)
-void I2C_readBytesFromAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data)
+#ifdef I2C_DMA_ENABLED
+#ifdef DMA_VECTOR
+#pragma vector=DMA_VECTOR
+#else
+#pragma vector=DACDMA_VECTOR
+#endif
+__interrupt void I2C_DMA_ISR (void)
+{
+	if (DMA0CTL & DMAIFG) {
+		DMA0CTL &= ~(DMAIFG + DMAEN + DMAIE);
+		//Hand the tail of the transfer back to the USCI ISR. The IE bits are
+		//set directly (not via I2C_enableInterrupt) so a flag that is already
+		//pending is not cleared and lost.
+		if (UCB1CTL1 & UCTR) {
+			transmitCounter = TXLENGTH;
+			UC1IE |= I2C_TRANSMIT_INTERRUPT;
+		} else {
+			receiveCount = 2;
+			UC1IE |= I2C_RECEIVE_INTERRUPT;
+		}
+	}
+}
+#endif
+
+//*****************************************************************************
+//
+//! Checks whether the last started transfer has finished.
+//!
+//! \return 1 if no transfer is running, 0 otherwise.
+//
+//*****************************************************************************
+unsigned char I2C_isTransferComplete ()
 {
+	return transferDone;
+}
+
+//*****************************************************************************
+//
+//! Sleeps in LPM0 until the running transfer completes.
+//!
+//! Interrupts are disabled around the check so a completion that lands
+//! between the test and entering LPM0 cannot be missed; entering LPM0 sets
+//! GIE again atomically.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void I2C_waitForTransfer ()
+{
+	__disable_interrupt();
+	while (!transferDone) {
+		__bis_SR_register(LPM0_bits + GIE);
+		__disable_interrupt();
+	}
+	__enable_interrupt();
+}
+
+//*****************************************************************************
+//
+//! Starts reading registers and returns once the data phase is running.
+//!
+//! The one-byte register address phase is still polled; the data phase runs
+//! from the USCI interrupt (or DMA when I2C_DMA_RX_TRIGGER is defined) with
+//! the CPU free to sleep. done, if not 0, is called from interrupt context
+//! with the byte count when the last byte has arrived, or with -1 if the
+//! slave NACKed (for a NACK in the register phase it is called before this
+//! function returns).
+//!
+//! \return 1 if the transfer was started, 0 if another one is still running.
+//
+//*****************************************************************************
+unsigned char I2C_readBytesFromAddressAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2C_Callback done, void *context)
+{
+	if (!transferDone) return 0;
+	transferError = 0;
+	if (length == 0) {
+		if (done) done(context, 0);
+		return 1;
+	}
+	transferDone = 0;
+	transferLength = length;
+	doneCallback = done;
+	doneContext = context;
+
+	//Let the previous transfer's STOP finish before resetting the module
+	while (I2C_isBusBusy()) ;
+	I2C_disable();
+
 	//Specify slave address
 	I2C_setSlaveAddress(devAddr);
 
@@ -681,23 +849,24 @@ void I2C_readBytesFromAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length,
 	//Enable I2C Module to start operations
 	I2C_enable();
 
-	//Enable TX interrupt
-//    I2C_enableInterrupt(I2C_TRANSMIT_INTERRUPT);
-
 	//Set transmit length
 	TXLENGTH = 0;
 	//Load TX byte counter
 	transmitCounter = 0;
 	I2C_masterSendSingleByte ( regAddr );
-	//Initiate start and send first character
-//	I2C_masterMultiByteSendStart(transmitData[0]);
-//	__bis_SR_register(LPM0_bits + GIE);
 
 	//Delay until transmission completes
 	while (I2C_isBusBusy()) ;
 
-	//Disable TX interrupt
-//    I2C_disableInterrupt(I2C_TRANSMIT_INTERRUPT);
+	//A NACK here has already been answered with STOP by
+	//I2C_masterSendSingleByte(); check before I2C_disable() clears the flag
+	if (UCB1STAT & UCNACKIFG) {
+		I2C_disable();
+		transferError = 1;
+		I2C_completeTransfer();
+		return 1;
+	}
+
 	//Disable I2C Module to stop operations
 	I2C_disable();
 
@@ -705,34 +874,58 @@ void I2C_readBytesFromAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length,
 	I2C_setMode(I2C_RECEIVE_MODE);
 	//Enable I2C Module to start operations
 	I2C_enable();
-	//Enable master Receive interrupt
-	I2C_clearInterruptFlag(I2C_RECEIVE_INTERRUPT);
-	I2C_enableInterrupt(I2C_RECEIVE_INTERRUPT);
+	I2C_armNack();
 
 	//set pointer to receive buffer at beginning of data
 	receiveBufferPointer = data;
 	receiveCount = length;
 
+	#ifdef I2C_DMA_RX_TRIGGER
+	if (length > 2) {
+		//DMA takes all but the last two bytes, see I2C_DMA_ISR
+		I2C_disableInterrupt(I2C_RECEIVE_INTERRUPT);
+		I2C_clearInterruptFlag(I2C_RECEIVE_INTERRUPT);
+		receiveBufferPointer = data + length - 2;
+		I2C_startDMA(I2C_DMA_RX_TRIGGER, DMASRCINCR_0 + DMADSTINCR_3, (unsigned int)&UCB1RXBUF, (unsigned int)data, length - 2);
+		I2C_masterMultiByteReceiveStart();
+		return 1;
+	}
+	#endif
+
+	//Enable master Receive interrupt
+	I2C_clearInterruptFlag(I2C_RECEIVE_INTERRUPT);
+	I2C_enableInterrupt(I2C_RECEIVE_INTERRUPT);
+
 	if (receiveCount==1) {
 		I2C_masterSingleReceiveStart();
 	} else {
 		//Initialize multi reception
 		I2C_masterMultiByteReceiveStart();
-		//Enter low power mode 0 with interrupts enabled.
-//        __bis_SR_register(LPM0_bits + GIE);
 	}
+	return 1;
+}
 
-	//Delay until transmission completes
+//*****************************************************************************
+//
+//! Starts writing registers and returns once the data phase is running.
+//!
+//! \return 1 if the transfer was started, 0 if another one is still running.
+//! \see I2C_readBytesFromAddressAsync()
+//
+//*****************************************************************************
+unsigned char I2C_writeBytesToAddressAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2C_Callback done, void *context)
+{
+	if (!transferDone) return 0;
+	transferError = 0;
+	transferDone = 0;
+	transferLength = length;
+	doneCallback = done;
+	doneContext = context;
+
+	//Let the previous transfer's STOP finish before resetting the module
 	while (I2C_isBusBusy()) ;
-
-	//Disable RX interrupt
-	I2C_disableInterrupt(I2C_RECEIVE_INTERRUPT);
-	//Disable I2C Module to stop operations
 	I2C_disable();
-}
 
-void I2C_writeBytesToAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data)
-{
 	//Specify slave address
 	I2C_setSlaveAddress(devAddr);
 
@@ -741,10 +934,7 @@ void I2C_writeBytesToAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length, u
 
 	//Enable I2C Module to start operations
 	I2C_enable();
-
-	//Enable TX interrupt
-	I2C_enableInterrupt(I2C_TRANSMIT_INTERRUPT);
-
+	I2C_armNack();
 
 	/* Note: It is not ok to send regAddr and data separately to MPU9150. Has to happen without a STOP condition in between.
 	 * This works without copying regAddr and data into one array by sending the first byte (regAddr) to the I2C routine and
@@ -756,16 +946,42 @@ void I2C_writeBytesToAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length, u
 	transmitCounter = 0;
 	transmitData = data;
 
+	#ifdef I2C_DMA_TX_TRIGGER
+	if (length > 1) {
+		//Send regAddr by hand; TXIFG is clear once it is in UCB1TXBUF, so
+		//the DMA's first trigger is the slot for data[0]
+		I2C_masterMultiByteSendStart(regAddr);
+		I2C_startDMA(I2C_DMA_TX_TRIGGER, DMASRCINCR_3 + DMADSTINCR_0, (unsigned int)data, (unsigned int)&UCB1TXBUF, length);
+		return 1;
+	}
+	#endif
+
+	//Enable TX interrupt
+	I2C_enableInterrupt(I2C_TRANSMIT_INTERRUPT);
+
 	//Initiate start and send first byte (regAddr), will be followed by TXLENGTH bytes of data
 	I2C_masterMultiByteSendStart(regAddr);
-//	__bis_SR_register(LPM0_bits + GIE);
+	return 1;
+}
 
-	//Delay until transmission completes
-	while (I2C_isBusBusy()) ;
+//todo move the next two functions to I2Cdev.cpp (as methods of new class)
+//Both return 1 on success and 0 if the slave NACKed.
+unsigned char I2C_readBytesFromAddress(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data)
+{
+	I2C_waitForTransfer();
+	I2C_readBytesFromAddressAsync(devAddr, regAddr, length, data, 0, 0);
 
-	//Disable TX interrupt
-	I2C_disableInterrupt(I2C_TRANSMIT_INTERRUPT);
-	//Disable I2C Module to stop operations
-	I2C_disable();
+	//Sleep until the ISR has received the last byte
+	I2C_waitForTransfer();
+	return !transferError;
 }
 
+unsigned char I2C_writeBytesToAddress(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data)
+{
+	I2C_waitForTransfer();
+	I2C_writeBytesToAddressAsync(devAddr, regAddr, length, data, 0, 0);
+
+	//Sleep until the ISR has queued the STOP condition
+	I2C_waitForTransfer();
+	return !transferError;
+}
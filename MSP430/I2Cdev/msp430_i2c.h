@@ -31,6 +31,22 @@ extern "C" {
 #define SCL_PIN BIT2                                  // msp430x261x UCB1SCL pin
 #endif
 
+//DMA-driven data phase: uncomment and set to the DMA0 trigger numbers of the
+//selected USCI_B RXIFG/TXIFG from the device datasheet (DMAxTSEL table).
+//Without them the data phase runs from the USCI interrupt; either way the
+//blocking calls sleep in LPM0 until the transfer completes.
+//#define I2C_DMA_RX_TRIGGER	DMA0TSEL_12
+//#define I2C_DMA_TX_TRIGGER	DMA0TSEL_13
+
+#if defined(I2C_DMA_RX_TRIGGER) || defined(I2C_DMA_TX_TRIGGER)
+#define I2C_DMA_ENABLED
+#ifdef DMA_VECTOR
+#define I2C_DMA_TSEL_MASK	0x001F		// F5xx: DMA0TSEL is 5 bits
+#else
+#define I2C_DMA_TSEL_MASK	0x000F		// F2xx: DMA0TSEL is 4 bits
+#endif
+#endif
+
 #define I2C_RX0_BUFF_SIZE	20
 #define I2C_TX0_BUFF_SIZE	20
 
@@ -99,8 +115,17 @@ extern unsigned char I2C_masterSingleReceive ();
 
 
 //todo move the next two functions to I2Cdev.cpp (as methods of new class)
-void I2C_readBytesFromAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
-void I2C_writeBytesToAddress(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+unsigned char I2C_readBytesFromAddress(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+unsigned char I2C_writeBytesToAddress(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+
+//Completion callback for the asynchronous transfers, called from interrupt
+//context with the byte count, or -1 if the slave NACKed
+typedef void (*I2C_Callback)(void *context, int16_t result);
+
+unsigned char I2C_readBytesFromAddressAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2C_Callback done, void *context);
+unsigned char I2C_writeBytesToAddressAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2C_Callback done, void *context);
+unsigned char I2C_isTransferComplete ();
+void I2C_waitForTransfer ();
 
 #ifdef __cplusplus
 }
@@ -675,7 +675,7 @@ class MPU6050 {
         // FIFO_R_W register
         uint8_t getFIFOByte();
         void setFIFOByte(uint8_t data);
-        void getFIFOBytes(uint8_t *data, uint8_t length);
+        void getFIFOBytes(uint8_t *data, uint16_t length);
 
         // WHO_AM_I register
         uint8_t getDeviceID();
@@ -865,6 +865,14 @@ class MPU6050 {
             uint8_t dmpGetEuler(float *data, Quaternion *q);
             uint8_t dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gravity);
 
+            #ifdef HELPER_3DMATH_FIXED
+                // Get fixed-point math helper data from FIFO
+                uint8_t dmpGetQuaternion(QuaternionFixed *q, const uint8_t* packet=0);
+                uint8_t dmpGetGravity(VectorFixed *v, QuaternionFixed *q);
+                uint8_t dmpGetLinearAccel(VectorInt16 *v, VectorInt16 *vRaw, VectorFixed *gravity);
+                uint8_t dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, QuaternionFixed *q);
+            #endif
+
             // Get Floating Point data from FIFO
             uint8_t dmpGetAccelFloat(float *data, const uint8_t* packet=0);
             uint8_t dmpGetQuaternionFloat(float *data, const uint8_t* packet=0);
@@ -984,6 +992,14 @@ class MPU6050 {
             uint32_t dmpGetAccelSumOfSquare();
             void dmpOverrideQuaternion(long *q);
             uint16_t dmpGetFIFOPacketSize();
+
+            // INT-driven LPM3 streaming (see MPU6050_INT_PORT)
+            void dmpStartStream();
+            void dmpStopStream();
+            void dmpStreamNotify();
+            bool dmpStreamPending();
+            void dmpStreamWait();
+            uint8_t dmpStreamRead(uint8_t *data, uint8_t maxPackets);
         #endif
 
     private:
@@ -631,6 +631,39 @@ uint8_t MPU6050::dmpGetGravity(VectorFloat *v, Quaternion *q) {
     v -> z = q -> w*q -> w - q -> x*q -> x - q -> y*q -> y + q -> z*q -> z;
     return 0;
 }
+
+#ifdef HELPER_3DMATH_FIXED
+uint8_t MPU6050::dmpGetQuaternion(QuaternionFixed *q, const uint8_t* packet) {
+    // DMP quaternion is already Q30, so only the byte order needs handling
+    // (widened before shifting so this also holds where int is 16 bits)
+    if (packet == 0) packet = dmpPacketBuffer;
+    int32_t *qI[4] = { &q -> w, &q -> x, &q -> y, &q -> z };
+    for (uint8_t i = 0; i < 4; i++, packet += 4) {
+        *qI[i] = ((int32_t)packet[0] << 24) | ((int32_t)packet[1] << 16) | ((int32_t)packet[2] << 8) | packet[3];
+    }
+    return 0;
+}
+uint8_t MPU6050::dmpGetGravity(VectorFixed *v, QuaternionFixed *q) {
+    // Q30 * Q30 = Q60, down to Q15; +1g lands on 32768 so clamp z
+    v -> x = ((int64_t)q -> x*q -> z - (int64_t)q -> w*q -> y) >> 44;
+    v -> y = ((int64_t)q -> w*q -> x + (int64_t)q -> y*q -> z) >> 44;
+    int32_t z = ((int64_t)q -> w*q -> w - (int64_t)q -> x*q -> x - (int64_t)q -> y*q -> y + (int64_t)q -> z*q -> z) >> 45;
+    v -> z = z > 32767 ? 32767 : (z < -32767 ? -32767 : z);
+    return 0;
+}
+uint8_t MPU6050::dmpGetLinearAccel(VectorInt16 *v, VectorInt16 *vRaw, VectorFixed *gravity) {
+    // gravity is Q15, +1g = +4096 in standard DMP FIFO packet
+    v -> x = vRaw -> x - (gravity -> x >> 3);
+    v -> y = vRaw -> y - (gravity -> y >> 3);
+    v -> z = vRaw -> z - (gravity -> z >> 3);
+    return 0;
+}
+uint8_t MPU6050::dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, QuaternionFixed *q) {
+    memcpy(v, vReal, sizeof(VectorInt16));
+    v -> rotate(q);
+    return 0;
+}
+#endif
 // uint8_t MPU6050::dmpGetUnquantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetQuantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetExternalSensorData(long *data, int size, const uint8_t* packet);
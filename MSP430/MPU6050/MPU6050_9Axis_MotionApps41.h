@@ -64,6 +64,47 @@ THE SOFTWARE.
 #define MPU6050_DMP_CONFIG_SIZE     232     // dmpConfig[]
 #define MPU6050_DMP_UPDATES_SIZE    140     // dmpUpdates[]
 
+// Low-power streaming: define MPU6050_INT_PORT (1 or 2) and MPU6050_INT_BIT
+// (BIT0..BIT7) to the MCU pin wired to the MPU's INT output before including
+// this header. The port ISR below then wakes dmpStreamWait() out of LPM3 on
+// each DMP interrupt pulse. Define MPU6050_INT_NO_ISR if the sketch owns the
+// port vector and call dmpStreamNotify() from it instead.
+#if defined(MPU6050_INT_PORT) && defined(MPU6050_INT_BIT)
+    #define MPU6050_STREAM_ENABLED
+    #if MPU6050_INT_PORT == 1
+        #define MPU6050_INT_DIR     P1DIR
+        #define MPU6050_INT_IES     P1IES
+        #define MPU6050_INT_IFG     P1IFG
+        #define MPU6050_INT_IE      P1IE
+    #elif MPU6050_INT_PORT == 2
+        #define MPU6050_INT_DIR     P2DIR
+        #define MPU6050_INT_IES     P2IES
+        #define MPU6050_INT_IFG     P2IFG
+        #define MPU6050_INT_IE      P2IE
+    #else
+        #error "MPU6050_INT_PORT must be 1 or 2 (interrupt-capable ports)"
+    #endif
+
+volatile uint8_t mpu6050StreamPending = 0;
+
+#ifndef MPU6050_INT_NO_ISR
+#if MPU6050_INT_PORT == 1
+#pragma vector=PORT1_VECTOR
+#else
+#pragma vector=PORT2_VECTOR
+#endif
+__interrupt void MPU6050_INT_ISR (void)
+{
+    if (MPU6050_INT_IFG & MPU6050_INT_BIT) {
+        MPU6050_INT_IFG &= ~MPU6050_INT_BIT;
+        mpu6050StreamPending = 1;
+        // resume dmpStreamWait()
+        __bic_SR_register_on_exit(LPM3_bits);
+    }
+}
+#endif
+#endif
+
 /* ================================================================================================ *
  | Default MotionApps v4.1 48-byte FIFO packet structure:                                           |
  |                                                                                                  |
@@ -805,4 +846,81 @@ uint16_t MPU6050::dmpGetFIFOPacketSize() {
     return dmpPacketSize;
 }
 
+#ifdef MPU6050_STREAM_ENABLED
+/** Arm the INT-driven streaming path.
+ * The MPU's INT pin keeps its default configuration (active high, push-pull,
+ * 50us pulse cleared on status read), so each DMP packet raises one rising
+ * edge on the MCU pin. Call after dmpInitialize() and setDMPEnabled(true).
+ * @see dmpStreamWait()
+ * @see dmpStreamRead()
+ */
+void MPU6050::dmpStartStream() {
+    MPU6050_INT_IE &= ~MPU6050_INT_BIT;
+    MPU6050_INT_DIR &= ~MPU6050_INT_BIT;
+    MPU6050_INT_IES &= ~MPU6050_INT_BIT;    // rising edge
+    setInterruptMode(false);
+    setInterruptLatch(false);
+    setIntEnabled((1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT) | (1 << MPU6050_INTERRUPT_DMP_INT_BIT));
+    resetFIFO();
+    getIntStatus();
+    mpu6050StreamPending = 0;
+    MPU6050_INT_IFG &= ~MPU6050_INT_BIT;
+    MPU6050_INT_IE |= MPU6050_INT_BIT;
+}
+/** Disarm the INT pin; the DMP keeps filling the FIFO for polled reads. */
+void MPU6050::dmpStopStream() {
+    MPU6050_INT_IE &= ~MPU6050_INT_BIT;
+    MPU6050_INT_IFG &= ~MPU6050_INT_BIT;
+    mpu6050StreamPending = 0;
+}
+/** Record a DMP interrupt from a sketch-owned port ISR (MPU6050_INT_NO_ISR). */
+void MPU6050::dmpStreamNotify() {
+    mpu6050StreamPending = 1;
+}
+/** Check whether an INT edge has arrived since the last dmpStreamRead(). */
+bool MPU6050::dmpStreamPending() {
+    return mpu6050StreamPending;
+}
+/** Sleep in LPM3 until the next DMP interrupt.
+ * Interrupts are disabled around the flag test so an edge landing between
+ * the test and entering LPM3 cannot be missed; entering LPM3 sets GIE again
+ * atomically. The I2C transfers in dmpStreamRead() run from SMCLK and so
+ * sleep in LPM0 while they complete, not LPM3.
+ */
+void MPU6050::dmpStreamWait() {
+    __disable_interrupt();
+    while (!mpu6050StreamPending) {
+        __bis_SR_register(LPM3_bits + GIE);
+        __disable_interrupt();
+    }
+    __enable_interrupt();
+}
+/** Drain whole DMP packets from the FIFO.
+ * Reads the FIFO count once and then every complete packet that fits in the
+ * caller's buffer in one block transfer (DMA-driven when the USCI driver has
+ * I2C_DMA_RX_TRIGGER configured). The pending flag is cleared before the count
+ * is read and set again if packets remain, so nothing is stranded between
+ * wakes. On FIFO overflow the FIFO is reset and nothing is returned, since
+ * the packet boundaries are lost.
+ * @param data Buffer of at least maxPackets * dmpGetFIFOPacketSize() bytes
+ * @param maxPackets Maximum number of packets to read
+ * @return Number of packets read
+ */
+uint8_t MPU6050::dmpStreamRead(uint8_t *data, uint8_t maxPackets) {
+    mpu6050StreamPending = 0;
+    if (getIntStatus() & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) {
+        resetFIFO();
+        return 0;
+    }
+    uint16_t count = getFIFOCount();
+    uint16_t packets = count / dmpPacketSize;
+    if (packets > maxPackets) {
+        packets = maxPackets;
+        mpu6050StreamPending = 1;
+    }
+    if (packets > 0) getFIFOBytes(data, packets * dmpPacketSize);
+    return packets;
+}
+#endif
+
 #endif /* _MPU6050_9AXIS_MOTIONAPPS41_H_ */
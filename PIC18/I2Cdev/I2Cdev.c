@@ -4,6 +4,10 @@
 // 11/28/2014 by Marton Sebok <sebokmarton@gmail.com>
 //
 // Changelog:
+//     2026-10-14 - unpack readWords() results with the shared big-endian word kernel
+//     2026-10-14 - add interrupt-driven MSSP transaction queue (I2Cdev_submit()/I2Cdev_service())
+//     2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//     2026-10-14 - add 16-bit length I2Cdev_readBlock()/I2Cdev_writeBlock()
 //     2014-11-28 - ported to PIC18 peripheral library from Arduino code
 
 /* ============================================
@@ -33,6 +37,256 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 
+// -----------------------------------------------------------------------------
+// MSSP master state machine
+// -----------------------------------------------------------------------------
+// Every step of a transfer (START, address, data byte, ACK, repeated START,
+// STOP) ends with SSPIF set, so the engine issues one step, returns, and
+// picks up again on the next flag. With I2Cdev_setInterruptDriven(true) the
+// application's interrupt routine calls I2Cdev_service(); otherwise blocking
+// calls and I2Cdev_poll() advance it from the main loop.
+
+#define I2CDEV_PHASE_IDLE           0
+#define I2CDEV_PHASE_START          1
+#define I2CDEV_PHASE_ADDRESS_W      2
+#define I2CDEV_PHASE_REGISTER       3
+#define I2CDEV_PHASE_WRITE          4
+#define I2CDEV_PHASE_RESTART        5
+#define I2CDEV_PHASE_ADDRESS_R      6
+#define I2CDEV_PHASE_RECEIVE        7
+#define I2CDEV_PHASE_ACK            8
+#define I2CDEV_PHASE_STOP           9
+
+static I2Cdev_Transaction *I2Cdev_queue[I2CDEV_QUEUE_LENGTH];
+static volatile uint8_t I2Cdev_queueHead = 0;
+static volatile uint8_t I2Cdev_queueTail = 0;
+static I2Cdev_Transaction *volatile I2Cdev_current = 0;
+static uint8_t I2Cdev_phase = I2CDEV_PHASE_IDLE;
+static uint8_t I2Cdev_status = 0;
+static uint16_t I2Cdev_index = 0;
+
+/** Take the next queued transaction and issue its START condition.
+ * Must be called with the MSSP interrupt masked or from the engine itself.
+ */
+static void I2Cdev_startNext(void) {
+    I2Cdev_Transaction *txn;
+
+    if (I2Cdev_queueHead == I2Cdev_queueTail) {
+        I2Cdev_current = 0;
+        I2Cdev_phase = I2CDEV_PHASE_IDLE;
+        return;
+    }
+    txn = I2Cdev_queue[I2Cdev_queueTail];
+    I2Cdev_queueTail = (I2Cdev_queueTail + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+    txn -> state = I2CDEV_TXN_ACTIVE;
+    I2Cdev_current = txn;
+    I2Cdev_index = 0;
+    I2Cdev_status = 0;
+    I2Cdev_phase = I2CDEV_PHASE_START;
+    SSPCON2bits.SEN = 1;
+}
+
+/** Issue a STOP condition, recording why the transfer is ending.
+ * @param status 0 on success, I2CDEV_ERROR_* otherwise
+ */
+static void I2Cdev_stop(uint8_t status) {
+    I2Cdev_status = status;
+    I2Cdev_phase = I2CDEV_PHASE_STOP;
+    SSPCON2bits.PEN = 1;
+}
+
+/** Mark the current transaction finished and move on to the next one. */
+static void I2Cdev_finish(void) {
+    I2Cdev_Transaction *txn = I2Cdev_current;
+
+    txn -> error = I2Cdev_status;
+    txn -> state = I2Cdev_status ? I2CDEV_TXN_ERROR : I2CDEV_TXN_DONE;
+    I2Cdev_startNext();
+    if (txn -> callback) txn -> callback(txn);
+}
+
+/** Advance the state machine by one MSSP event. */
+static void I2Cdev_step(void) {
+    I2Cdev_Transaction *txn = I2Cdev_current;
+
+    if (PIR2bits.BCLIF) {
+        // the MSSP has already abandoned the transfer and released the bus
+        PIR2bits.BCLIF = 0;
+        PIR1bits.SSPIF = 0;
+        if (txn) {
+            I2Cdev_status = I2CDEV_ERROR_COLLISION;
+            I2Cdev_finish();
+        }
+        return;
+    }
+    if (!PIR1bits.SSPIF) return;
+    PIR1bits.SSPIF = 0;
+    if (!txn) return;
+
+    switch (I2Cdev_phase) {
+        case I2CDEV_PHASE_START:
+            SSPBUF = txn -> devAddr << 1 | 0x00;
+            I2Cdev_phase = I2CDEV_PHASE_ADDRESS_W;
+            break;
+
+        case I2CDEV_PHASE_ADDRESS_W:
+            if (SSPCON2bits.ACKSTAT) {
+                I2Cdev_stop(I2CDEV_ERROR_ADDRESS_NACK);
+                break;
+            }
+            SSPBUF = txn -> regAddr;
+            I2Cdev_phase = I2CDEV_PHASE_REGISTER;
+            break;
+
+        case I2CDEV_PHASE_REGISTER:
+            if (SSPCON2bits.ACKSTAT) {
+                I2Cdev_stop(I2CDEV_ERROR_DATA_NACK);
+            } else if (txn -> flags & I2CDEV_TXN_READ) {
+                SSPCON2bits.RSEN = 1;
+                I2Cdev_phase = I2CDEV_PHASE_RESTART;
+            } else if (txn -> length) {
+                SSPBUF = txn -> data[I2Cdev_index++];
+                I2Cdev_phase = I2CDEV_PHASE_WRITE;
+            } else {
+                I2Cdev_stop(0);
+            }
+            break;
+
+        case I2CDEV_PHASE_WRITE:
+            if (SSPCON2bits.ACKSTAT) {
+                I2Cdev_stop(I2CDEV_ERROR_DATA_NACK);
+            } else if (I2Cdev_index < txn -> length) {
+                SSPBUF = txn -> data[I2Cdev_index++];
+            } else {
+                I2Cdev_stop(0);
+            }
+            break;
+
+        case I2CDEV_PHASE_RESTART:
+            SSPBUF = txn -> devAddr << 1 | 0x01;
+            I2Cdev_phase = I2CDEV_PHASE_ADDRESS_R;
+            break;
+
+        case I2CDEV_PHASE_ADDRESS_R:
+            if (SSPCON2bits.ACKSTAT) {
+                I2Cdev_stop(I2CDEV_ERROR_ADDRESS_NACK);
+                break;
+            }
+            SSPCON2bits.RCEN = 1;
+            I2Cdev_phase = I2CDEV_PHASE_RECEIVE;
+            break;
+
+        case I2CDEV_PHASE_RECEIVE:
+            txn -> data[I2Cdev_index++] = SSPBUF;
+            // NACK the last byte, ACK the rest
+            SSPCON2bits.ACKDT = (I2Cdev_index == txn -> length);
+            SSPCON2bits.ACKEN = 1;
+            I2Cdev_phase = I2CDEV_PHASE_ACK;
+            break;
+
+        case I2CDEV_PHASE_ACK:
+            if (I2Cdev_index < txn -> length) {
+                SSPCON2bits.RCEN = 1;
+                I2Cdev_phase = I2CDEV_PHASE_RECEIVE;
+            } else {
+                I2Cdev_stop(0);
+            }
+            break;
+
+        case I2CDEV_PHASE_STOP:
+            I2Cdev_finish();
+            break;
+    }
+}
+
+/** Select how the transaction engine is advanced.
+ * When enabled, the MSSP and bus collision interrupts are unmasked and the
+ * application's interrupt routine must call I2Cdev_service(); GIE is left to
+ * the application. When disabled (the default), blocking calls run the
+ * engine themselves and asynchronous users call I2Cdev_poll().
+ * @param enabled True to drive transfers from the interrupt routine
+ */
+void I2Cdev_setInterruptDriven(bool enabled) {
+    PIR1bits.SSPIF = 0;
+    PIR2bits.BCLIF = 0;
+    PIE2bits.BCLIE = enabled;
+    PIE1bits.SSPIE = enabled;
+    if (enabled) INTCONbits.PEIE = 1;
+}
+
+/** Queue a transaction for the bus.
+ * Returns immediately; completion is signalled by txn -> state (see
+ * I2Cdev_isComplete()) and the optional callback.
+ * @param txn Transaction descriptor, owned by the caller until completion
+ * @return True if queued, false if the queue is full or txn is invalid
+ */
+bool I2Cdev_submit(I2Cdev_Transaction *txn) {
+    bool masked = PIE1bits.SSPIE;
+    uint8_t next;
+
+    if (!txn || (txn -> length && !txn -> data)) return false;
+    if ((txn -> flags & I2CDEV_TXN_READ) && !txn -> length) return false;
+
+    PIE1bits.SSPIE = 0;
+    next = (I2Cdev_queueHead + 1) & (I2CDEV_QUEUE_LENGTH - 1);
+    if (next == I2Cdev_queueTail) {
+        PIE1bits.SSPIE = masked;
+        return false;
+    }
+    txn -> error = 0;
+    txn -> state = I2CDEV_TXN_QUEUED;
+    I2Cdev_queue[I2Cdev_queueHead] = txn;
+    I2Cdev_queueHead = next;
+    if (!I2Cdev_current) I2Cdev_startNext();
+    PIE1bits.SSPIE = masked;
+    return true;
+}
+
+/** Check whether a submitted transaction has finished (successfully or not).
+ * @param txn Transaction descriptor
+ * @return True once the transaction is done or has failed
+ */
+bool I2Cdev_isComplete(const I2Cdev_Transaction *txn) {
+    return txn -> state >= I2CDEV_TXN_DONE;
+}
+
+/** Block until a submitted transaction finishes.
+ * @param txn Transaction descriptor
+ * @return Number of bytes transferred (-1 indicates failure)
+ */
+int16_t I2Cdev_wait(I2Cdev_Transaction *txn) {
+    while (!I2Cdev_isComplete(txn)) I2Cdev_poll();
+    return txn -> state == I2CDEV_TXN_DONE ? (int16_t)txn -> length : -1;
+}
+
+/** Queue a transaction for a blocking call and wait for it to finish.
+ * A full queue only means other transfers are ahead of this one, so the
+ * engine is run until a slot frees up instead of failing the call.
+ * @param txn Transaction descriptor
+ * @return Number of bytes transferred (-1 indicates failure)
+ */
+static int16_t I2Cdev_run(I2Cdev_Transaction *txn) {
+    if (txn -> length && !txn -> data) return -1;
+    if ((txn -> flags & I2CDEV_TXN_READ) && !txn -> length) return -1;
+    while (!I2Cdev_submit(txn)) I2Cdev_poll();
+    return I2Cdev_wait(txn);
+}
+
+/** MSSP interrupt handler. Call from the application's interrupt routine;
+ * it does nothing unless I2Cdev_setInterruptDriven(true) was called, so it
+ * is safe to call unconditionally from a shared handler.
+ */
+void I2Cdev_service(void) {
+    if (PIE1bits.SSPIE) I2Cdev_step();
+}
+
+/** Advance the engine from the main loop while not interrupt-driven.
+ * Does nothing when I2Cdev_setInterruptDriven(true) is in effect.
+ */
+void I2Cdev_poll(void) {
+    if (!PIE1bits.SSPIE) I2Cdev_step();
+}
+
 /** Read multiple bytes from an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
@@ -41,49 +295,26 @@ THE SOFTWARE.
  * @return Number of bytes read (-1 indicates failure)
  */
 int8_t I2Cdev_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
-    int8_t count = 0;
-
-    // S
-    IdleI2C();
-    StartI2C();
-
-    // Device write address
-    IdleI2C();
-    WriteI2C(devAddr << 1 | 0x00);
-
-    // Register address
-    IdleI2C();
-    WriteI2C(regAddr);
-
-    // R
-    IdleI2C();
-    RestartI2C();
-
-    // Device read address
-    IdleI2C();
-    WriteI2C(devAddr << 1 | 0x01);
-
-    for (count = 0; count < length; count++) {
-        // Data byte
-        IdleI2C();
-        data[count] = ReadI2C();
-
-        if (count == length - 1) {
-            // NACK
-            IdleI2C();
-            NotAckI2C();
-        } else {
-            // ACK
-            IdleI2C();
-            AckI2C();
-        }
-    }
-
-    // P
-    IdleI2C();
-    StopI2C();
+    return (int8_t)I2Cdev_readBlock(devAddr, regAddr, length, data);
+}
 
-    return count;
+/** Read a block of bytes of any length in a single transaction.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int16_t I2Cdev_readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    I2Cdev_Transaction txn;
+
+    txn.devAddr = devAddr;
+    txn.regAddr = regAddr;
+    txn.flags = I2CDEV_TXN_READ;
+    txn.length = length;
+    txn.data = data;
+    txn.callback = 0;
+    return I2Cdev_run(&txn);
 }
 
 /** Read single byte from an 8-bit device register.
@@ -104,57 +335,12 @@ int8_t I2Cdev_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
  * @return Number of words read (-1 indicates failure)
  */
 int8_t I2Cdev_readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
-    int8_t count = 0;
-
-    // S
-    IdleI2C();
-    StartI2C();
-
-    // Device write address
-    IdleI2C();
-    WriteI2C(devAddr << 1 | 0x00);
-
-    // Register address
-    IdleI2C();
-    WriteI2C(regAddr);
-
-    // R
-    IdleI2C();
-    RestartI2C();
-
-    // Device read address
-    IdleI2C();
-    WriteI2C(devAddr << 1 | 0x01);
-
-    for (count = 0; count < length; count++) {
-        // First byte is bits 15-8 (MSb=15)
-        IdleI2C();
-        data[count] = ReadI2C() << 8;
-
-        // NACK
-        IdleI2C();
-        NotAckI2C();
-
-        // Second byte is bits 7-0 (LSb=0)
-        IdleI2C();
-        data[count] |= ReadI2C();
-
-        if (count == length - 1) {
-            // NACK
-            IdleI2C();
-            NotAckI2C();
-        } else {
-            // ACK
-            IdleI2C();
-            AckI2C();
-        }
-    }
-
-    // P
-    IdleI2C();
-    StopI2C();
+    uint8_t *bytes = (uint8_t *)data;
 
-    return count;
+    if (I2Cdev_readBlock(devAddr, regAddr, (uint16_t)length << 1, bytes) < 0) return -1;
+    // big-endian on the wire; word i only overlaps bytes 2i and 2i+1, so in place is safe
+    I2Cdev_coreUnpackBE16(data, bytes, length);
+    return length;
 }
 
 /** Read single word from a 16-bit device register.
@@ -175,10 +361,7 @@ int8_t I2Cdev_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data) {
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data) {
-    uint8_t b;
-    uint8_t count = I2Cdev_readByte(devAddr, regAddr, &b);
-    *data = b & (1 << bitNum);
-    return count;
+    return I2Cdev_coreReadBit(&I2Cdev_transport, devAddr, regAddr, bitNum, data, 0);
 }
 
 /** Read a single bit from a 16-bit device register.
@@ -189,10 +372,7 @@ int8_t I2Cdev_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev_readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data) {
-    uint16_t b;
-    uint8_t count = I2Cdev_readWord(devAddr, regAddr, &b);
-    *data = b & (1 << bitNum);
-    return count;
+    return I2Cdev_coreReadBitW(&I2Cdev_transport, devAddr, regAddr, bitNum, data, 0);
 }
 
 /** Read multiple bits from an 8-bit device register.
@@ -204,19 +384,7 @@ int8_t I2Cdev_readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev_readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data) {
-    // 01101001 read byte
-    // 76543210 bit numbers
-    //    xxx   args: bitStart=4, length=3
-    //    010   masked
-    //   -> 010 shifted
-    uint8_t count, b;
-    if ((count = I2Cdev_readByte(devAddr, regAddr, &b)) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        b &= mask;
-        b >>= (bitStart - length + 1);
-        *data = b;
-    }
-    return count;
+    return I2Cdev_coreReadBits(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data, 0);
 }
 
 /** Read multiple bits from a 16-bit device register.
@@ -228,20 +396,7 @@ int8_t I2Cdev_readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
 int8_t I2Cdev_readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data) {
-    // 1101011001101001 read byte
-    // fedcba9876543210 bit numbers
-    //    xxx           args: bitStart=12, length=3
-    //    010           masked
-    //           -> 010 shifted
-    uint8_t count;
-    uint16_t w;
-    if ((count = I2Cdev_readWord(devAddr, regAddr, &w)) != 0) {
-        uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        w &= mask;
-        w >>= (bitStart - length + 1);
-        *data = w;
-    }
-    return count;
+    return I2Cdev_coreReadBitsW(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data, 0);
 }
 
 /** Write multiple bytes to an 8-bit device register.
@@ -252,29 +407,26 @@ int8_t I2Cdev_readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @return Status of operation (true = success)
  */
 bool I2Cdev_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
-    // S
-    IdleI2C();
-    StartI2C();
-
-    // Device write address
-    IdleI2C();
-    WriteI2C(devAddr << 1 | 0x00);
-
-    // Register address
-    IdleI2C();
-    WriteI2C(regAddr);
-
-    for (uint8_t i = 0; i < length; i++) {
-        // Data byte
-        IdleI2C();
-        WriteI2C(data[i]);
-    }
-    
-    // P
-    IdleI2C();
-    StopI2C();
+    return I2Cdev_writeBlock(devAddr, regAddr, length, data);
+}
 
-    return true;
+/** Write a block of bytes of any length in a single transaction.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev_writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t* data) {
+    I2Cdev_Transaction txn;
+
+    txn.devAddr = devAddr;
+    txn.regAddr = regAddr;
+    txn.flags = I2CDEV_TXN_WRITE;
+    txn.length = length;
+    txn.data = data;
+    txn.callback = 0;
+    return I2Cdev_run(&txn) >= 0;
 }
 
 /** Write single byte to an 8-bit device register.
@@ -295,33 +447,13 @@ bool I2Cdev_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  * @return Status of operation (true = success)
  */
 bool I2Cdev_writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
-    // S
-    IdleI2C();
-    StartI2C();
-
-    // Device write address
-    IdleI2C();
-    WriteI2C(devAddr << 1 | 0x00);
-
-    // Register address
-    IdleI2C();
-    WriteI2C(regAddr);
-
-    for (uint8_t i = 0; i < length; i++) {
-        // Send MSB
-        IdleI2C();
-        WriteI2C(data[i] >> 8);
-
-        // Send LSB
-        IdleI2C();
-        WriteI2C(data[i] & 0xFF);
-    }
-
-    // P
-    IdleI2C();
-    StopI2C();
+    bool status;
 
-    return true;
+    // swap to big-endian in place for the transfer, then restore the caller's buffer
+    for (uint8_t i = 0; i < length; i++) data[i] = (data[i] << 8) | (data[i] >> 8);
+    status = I2Cdev_writeBlock(devAddr, regAddr, (uint16_t)length << 1, (uint8_t *)data);
+    for (uint8_t i = 0; i < length; i++) data[i] = (data[i] << 8) | (data[i] >> 8);
+    return status;
 }
 
 /** Write single word to a 16-bit device register.
@@ -342,10 +474,7 @@ bool I2Cdev_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
  * @return Status of operation (true = success)
  */
 bool I2Cdev_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-    uint8_t b;
-    I2Cdev_readByte(devAddr, regAddr, &b);
-    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-    return I2Cdev_writeByte(devAddr, regAddr, b);
+    return I2Cdev_coreWriteBit(&I2Cdev_transport, devAddr, regAddr, bitNum, data);
 }
 
 /** write a single bit in a 16-bit device register.
@@ -356,10 +485,7 @@ bool I2Cdev_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t d
  * @return Status of operation (true = success)
  */
 bool I2Cdev_writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
-    uint16_t w;
-    I2Cdev_readWord(devAddr, regAddr, &w);
-    w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
-    return I2Cdev_writeWord(devAddr, regAddr, w);
+    return I2Cdev_coreWriteBitW(&I2Cdev_transport, devAddr, regAddr, bitNum, data);
 }
 
 /** Write multiple bits in an 8-bit device register.
@@ -371,24 +497,7 @@ bool I2Cdev_writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t
  * @return Status of operation (true = success)
  */
 bool I2Cdev_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
-    //      010 value to write
-    // 76543210 bit numbers
-    //    xxx   args: bitStart=4, length=3
-    // 00011100 mask byte
-    // 10101111 original value (sample)
-    // 10100011 original & ~mask
-    // 10101011 masked | value
-    uint8_t b;
-    if (I2Cdev_readByte(devAddr, regAddr, &b) != 0) {
-        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        b &= ~(mask); // zero all important bits in existing byte
-        b |= data; // combine data with existing byte
-        return I2Cdev_writeByte(devAddr, regAddr, b);
-    } else {
-        return false;
-    }
+    return I2Cdev_coreWriteBits(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data);
 }
 
 /** Write multiple bits in a 16-bit device register.
@@ -400,22 +509,53 @@ bool I2Cdev_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_
  * @return Status of operation (true = success)
  */
 bool I2Cdev_writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
-    //              010 value to write
-    // fedcba9876543210 bit numbers
-    //    xxx           args: bitStart=12, length=3
-    // 0001110000000000 mask word
-    // 1010111110010110 original value (sample)
-    // 1010001110010110 original & ~mask
-    // 1010101110010110 masked | value
-    uint16_t w;
-    if (I2Cdev_readWord(devAddr, regAddr, &w) != 0) {
-        uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-        data <<= (bitStart - length + 1); // shift data into correct position
-        data &= mask; // zero all non-important bits in data
-        w &= ~(mask); // zero all important bits in existing word
-        w |= data; // combine data with existing word
-        return I2Cdev_writeWord(devAddr, regAddr, w);
-    } else {
-        return false;
+    return I2Cdev_coreWriteBitsW(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data);
+}
+
+// -----------------------------------------------------------------------------
+// Transport backend for the shared register core (I2Cdev_core.c)
+// -----------------------------------------------------------------------------
+
+static int16_t I2Cdev_transportRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    return I2Cdev_readBlock(devAddr, regAddr, length, data);
+}
+
+static uint8_t I2Cdev_transportWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    return I2Cdev_writeBlock(devAddr, regAddr, length, data);
+}
+
+static I2Cdev_Transaction I2Cdev_asyncTxn;
+static I2Cdev_TransportDone I2Cdev_asyncDone;
+
+static void I2Cdev_transportAsyncComplete(I2Cdev_Transaction *txn) {
+    if (I2Cdev_asyncDone) {
+        I2Cdev_asyncDone(txn -> context, txn -> state == I2CDEV_TXN_DONE ? (int16_t)txn -> length : -1);
     }
 }
+
+static uint8_t I2Cdev_transportReadAsync(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2Cdev_TransportDone done, void *doneContext) {
+    uint8_t state = I2Cdev_asyncTxn.state;
+
+    // one transport read in flight at a time
+    if (state == I2CDEV_TXN_QUEUED || state == I2CDEV_TXN_ACTIVE) return 0;
+    I2Cdev_asyncTxn.devAddr = devAddr;
+    I2Cdev_asyncTxn.regAddr = regAddr;
+    I2Cdev_asyncTxn.flags = I2CDEV_TXN_READ;
+    I2Cdev_asyncTxn.length = length;
+    I2Cdev_asyncTxn.data = data;
+    I2Cdev_asyncTxn.callback = I2Cdev_transportAsyncComplete;
+    I2Cdev_asyncTxn.context = doneContext;
+    I2Cdev_asyncDone = done;
+    return I2Cdev_submit(&I2Cdev_asyncTxn);
+}
+
+/** Register-level transport used by the bit accessors. Drivers and other
+ * core code can call the I2Cdev_core*() functions with it directly.
+ */
+const I2Cdev_Transport I2Cdev_transport = {
+    I2Cdev_transportRead,
+    I2Cdev_transportWrite,
+    0,  // lookup
+    I2Cdev_transportReadAsync,
+    0   // context
+};
@@ -4,6 +4,9 @@
 // 11/28/2014 by Marton Sebok <sebokmarton@gmail.com>
 //
 // Changelog:
+//     2026-10-14 - add interrupt-driven MSSP transaction queue (I2Cdev_submit()/I2Cdev_service())
+//     2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//     2026-10-14 - add 16-bit length I2Cdev_readBlock()/I2Cdev_writeBlock()
 //     2014-11-28 - ported to PIC18 peripheral library from Arduino code
 
 /* ============================================
@@ -42,6 +45,48 @@ THE SOFTWARE.
 #include <stdint.h>
 #include <stdbool.h>
 #include <plib/i2c.h>
+#include "I2Cdev_core.h"
+
+// -----------------------------------------------------------------------------
+// Interrupt-driven MSSP transaction queue
+// -----------------------------------------------------------------------------
+// Number of slots in the pending transaction ring (must be a power of 2; one
+// slot is always kept free, so up to I2CDEV_QUEUE_LENGTH - 1 can be pending).
+#define I2CDEV_QUEUE_LENGTH         4
+
+#define I2CDEV_TXN_WRITE            0x00 // write data[] starting at regAddr
+#define I2CDEV_TXN_READ             0x01 // read data[] starting at regAddr
+
+#define I2CDEV_TXN_IDLE             0 // never submitted
+#define I2CDEV_TXN_QUEUED           1 // waiting for the bus
+#define I2CDEV_TXN_ACTIVE           2 // currently on the bus
+#define I2CDEV_TXN_DONE             3 // completed successfully
+#define I2CDEV_TXN_ERROR            4 // failed, see error member
+
+#define I2CDEV_ERROR_ADDRESS_NACK   1 // slave did not acknowledge its address
+#define I2CDEV_ERROR_DATA_NACK      2 // slave did not acknowledge a register or data byte
+#define I2CDEV_ERROR_COLLISION      3 // bus collision (BCLIF), another master or a stuck line
+
+struct I2Cdev_Transaction;
+typedef void (*I2Cdev_Callback)(struct I2Cdev_Transaction *txn);
+
+/** Descriptor for a single queued register read or write.
+ * The descriptor and its data buffer are owned by the caller and must stay
+ * valid until the transaction completes. The callback, if any, is called
+ * from wherever the engine is advanced: the interrupt routine when
+ * interrupt-driven, I2Cdev_poll() otherwise.
+ */
+typedef struct I2Cdev_Transaction {
+    uint8_t devAddr;            // 7-bit slave address
+    uint8_t regAddr;            // first register to read or write
+    uint8_t flags;              // I2CDEV_TXN_READ or I2CDEV_TXN_WRITE
+    uint16_t length;            // number of data bytes
+    uint8_t *data;              // transfer buffer
+    I2Cdev_Callback callback;   // optional completion callback (may be 0)
+    void *context;              // optional user pointer for the callback
+    volatile uint8_t state;     // I2CDEV_TXN_* progress
+    volatile uint8_t error;     // I2CDEV_ERROR_* on failure, 0 on success
+} I2Cdev_Transaction;
 
 int8_t I2Cdev_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data);
 int8_t I2Cdev_readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data);
@@ -51,6 +96,7 @@ int8_t I2Cdev_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data);
 int8_t I2Cdev_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data);
 int8_t I2Cdev_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
 int8_t I2Cdev_readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+int16_t I2Cdev_readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
 
 bool I2Cdev_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
 bool I2Cdev_writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
@@ -60,5 +106,15 @@ bool I2Cdev_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data);
 bool I2Cdev_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
 bool I2Cdev_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
 bool I2Cdev_writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+bool I2Cdev_writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+
+void I2Cdev_setInterruptDriven(bool enabled);
+bool I2Cdev_submit(I2Cdev_Transaction *txn);
+bool I2Cdev_isComplete(const I2Cdev_Transaction *txn);
+int16_t I2Cdev_wait(I2Cdev_Transaction *txn);
+void I2Cdev_service(void);
+void I2Cdev_poll(void);
+
+extern const I2Cdev_Transport I2Cdev_transport;
 
 #endif /* _I2CDEV_H_ */
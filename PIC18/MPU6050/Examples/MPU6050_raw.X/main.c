@@ -5,6 +5,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-14 - sample through the interrupt-driven I2Cdev queue
 //     2014-11-28 - ported to PIC18 peripheral library from Arduino code
 
 /* ============================================
@@ -76,11 +77,20 @@ void putch(char data) {
     Write1USART(data);
 }
 
+/**
+ * Interrupt routine, advances the I2Cdev transaction engine
+ */
+void interrupt isr(void) {
+    I2Cdev_service();
+}
+
 /**
  * Main function
  */
 int main() {
     int16_t ax, ay, az, gx, gy, gz;
+    uint8_t sample[14];
+    I2Cdev_Transaction motion;
     
     // Initialize system
     // PLL (24 MHz)
@@ -121,9 +131,33 @@ int main() {
     printf("%d\t", MPU6050_getYGyroOffset());
     printf("%d\t\n", MPU6050_getZGyroOffset());
 
+    // Hand the bus over to the MSSP interrupt
+    I2Cdev_setInterruptDriven(true);
+    INTCONbits.GIE = 1;
+
+    motion.devAddr = MPU6050_ADDRESS_AD0_LOW;
+    motion.regAddr = MPU6050_RA_ACCEL_XOUT_H;
+    motion.flags = I2CDEV_TXN_READ;
+    motion.length = sizeof(sample);
+    motion.data = sample;
+    motion.callback = 0;
+    I2Cdev_submit(&motion);
+
     while (true) {
-        // Read raw accel/gyro measurements from device
-        MPU6050_getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
+        // Wait for the raw accel/gyro burst queued on the previous pass
+        if (I2Cdev_wait(&motion) < 0) {
+            I2Cdev_submit(&motion);
+            continue;
+        }
+        ax = (((int16_t)sample[0]) << 8) | sample[1];
+        ay = (((int16_t)sample[2]) << 8) | sample[3];
+        az = (((int16_t)sample[4]) << 8) | sample[5];
+        gx = (((int16_t)sample[8]) << 8) | sample[9];
+        gy = (((int16_t)sample[10]) << 8) | sample[11];
+        gz = (((int16_t)sample[12]) << 8) | sample[13];
+
+        // Start the next read; it runs from the interrupt while we print
+        I2Cdev_submit(&motion);
 
         // Display tab-separated accel/gyro x/y/z values
         printf("a/g:\t%d\t%d\t%d\t%d\t%d\t%d\r\n", ax, ay, az, gx, gy, gz);
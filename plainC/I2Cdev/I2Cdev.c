@@ -3,6 +3,10 @@
 // 6/9/2012 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-14 - unpack readWords() results with the shared big-endian word kernel
+//      2026-10-14 - replace millis()/iteration-count timeouts with cycle-counted Fastwire bus step timeouts
+//      2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//      2026-10-14 - add 16-bit length I2Cdev_readBlock()/I2Cdev_writeBlock()
 //      2013-05-06 - add Francesco Ferrara's Fastwire v0.24 implementation with small modifications
 //      2013-05-05 - fix issue with writing bit values to words (Sasquatch/Farzanegan)
 //      2012-06-09 - fix major issue with reading > 32 bytes at a time with Arduino Wire
@@ -48,6 +52,11 @@ THE SOFTWARE.
 // private functions
 uint8_t Fastwire_waitInt(void);
 
+/** Load the configured read timeout into Fastwire if it has changed. */
+static void I2Cdev_applyTimeout(uint16_t timeout) {
+	if (Fastwire_getTimeout() != timeout) Fastwire_setTimeout(timeout);
+}
+
 /** Read a single bit from an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
@@ -56,10 +65,7 @@ uint8_t Fastwire_waitInt(void);
  * @return Status of read operation (true = success)
  */
 uint8_t I2Cdev_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data) {
-	uint8_t b;
-	uint8_t count = I2Cdev_readByte(devAddr, regAddr, &b);
-	*data = b & (1 << bitNum);
-	return count;
+	return I2Cdev_coreReadBit(&I2Cdev_transport, devAddr, regAddr, bitNum, data, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT);
 }
 
 /** Read a single bit from a 16-bit device register.
@@ -70,10 +76,7 @@ uint8_t I2Cdev_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @return Status of read operation (true = success)
  */
 uint8_t I2Cdev_readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data) {
-	uint16_t b;
-	uint8_t count = I2Cdev_readWord(devAddr, regAddr, &b);
-	*data = b & (1 << bitNum);
-	return count;
+	return I2Cdev_coreReadBitW(&I2Cdev_transport, devAddr, regAddr, bitNum, data, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT);
 }
 
 /** Read multiple bits from an 8-bit device register.
@@ -85,19 +88,7 @@ uint8_t I2Cdev_readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16
  * @return Status of read operation (true = success)
  */
 uint8_t I2Cdev_readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data) {
-	// 01101001 read byte
-	// 76543210 bit numbers
-	//    xxx   args: bitStart=4, length=3
-	//    010   masked
-	//   -> 010 shifted
-	uint8_t count, b;
-	if ((count = I2Cdev_readByte(devAddr, regAddr, &b)) != 0) {
-		uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-		b &= mask;
-		b >>= (bitStart - length + 1);
-		*data = b;
-	}
-	return count;
+	return I2Cdev_coreReadBits(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT);
 }
 
 /** Read multiple bits from a 16-bit device register.
@@ -109,20 +100,7 @@ uint8_t I2Cdev_readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
 uint8_t I2Cdev_readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data) {
-	// 1101011001101001 read byte
-	// fedcba9876543210 bit numbers
-	//    xxx           args: bitStart=12, length=3
-	//    010           masked
-	//           -> 010 shifted
-	uint8_t count;
-	uint16_t w;
-	if ((count = I2Cdev_readWord(devAddr, regAddr, &w)) != 0) {
-		uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-		w &= mask;
-		w >>= (bitStart - length + 1);
-		*data = w;
-	}
-	return count;
+	return I2Cdev_coreReadBitsW(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT);
 }
 
 /** Read single byte from an 8-bit device register.
@@ -153,6 +131,17 @@ uint8_t I2Cdev_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data) {
  * @return Number of bytes read (-1 indicates failure)
  */
 uint8_t I2Cdev_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+	return (uint8_t)I2Cdev_readBlock(devAddr, regAddr, length, data);
+}
+
+/** Read a block of bytes of any length in a single transaction.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int16_t I2Cdev_readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
 	#ifdef I2CDEV_SERIAL_DEBUG
 		Serial.print("I2C (0x");
 		Serial.print(devAddr, HEX);
@@ -163,22 +152,18 @@ uint8_t I2Cdev_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
 		Serial.print("...");
 	#endif
 
-	int8_t count = 0;
-	uint16_t timeout = I2Cdev_readTimeout;
-	uint32_t t1 = millis();
+	int16_t count = 0;
 
 	// Fastwire library
-	// no loop required for fastwire
+	// no loop required for fastwire; each bus step is bounded by the timeout
+	I2Cdev_applyTimeout(I2Cdev_readTimeout);
 	uint8_t status = Fastwire_readBuf(devAddr << 1, regAddr, data, length);
 	if (status == 0) {
 		count = length; // success
 	} else {
-		count = -1; // error
+		count = -1; // error or timeout
 	}
 
-	// check for timeout
-	if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
-
 	#ifdef I2CDEV_SERIAL_DEBUG
 		Serial.print(". Done (");
 		Serial.print(count, DEC);
@@ -207,24 +192,20 @@ uint8_t I2Cdev_readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
 	#endif
 
 	int8_t count = 0;
-	uint16_t timeout = I2Cdev_readTimeout;
-	uint32_t t1 = millis();
 
 	// Fastwire library
-	// no loop required for fastwire
-	uint16_t intermediate[(uint8_t)length];
-	uint8_t status = Fastwire_readBuf(devAddr << 1, regAddr, (uint8_t *)intermediate, (uint8_t)(length * 2));
+	// no loop required for fastwire; read big-endian bytes straight into the
+	// word buffer (word i only overlaps bytes 2i and 2i+1, so in place is safe)
+	uint8_t *bytes = (uint8_t *)data;
+	I2Cdev_applyTimeout(I2Cdev_readTimeout);
+	uint8_t status = Fastwire_readBuf(devAddr << 1, regAddr, bytes, (uint16_t)length * 2);
 	if (status == 0) {
 		count = length; // success
-		for (uint8_t i = 0; i < length; i++) {
-			data[i] = (intermediate[2*i] << 8) | intermediate[2*i + 1];
-		}
+		I2Cdev_coreUnpackBE16(data, bytes, length);
 	} else {
-		count = -1; // error
+		count = -1; // error or timeout
 	}
 
-	if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
-
 	#ifdef I2CDEV_SERIAL_DEBUG
 		Serial.print(". Done (");
 		Serial.print(count, DEC);
@@ -242,10 +223,7 @@ uint8_t I2Cdev_readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
  * @return Status of operation (true = success)
  */
 uint8_t I2Cdev_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-	uint8_t b;
-	I2Cdev_readByte(devAddr, regAddr, &b);
-	b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-	return I2Cdev_writeByte(devAddr, regAddr, b);
+	return I2Cdev_coreWriteBit(&I2Cdev_transport, devAddr, regAddr, bitNum, data);
 }
 
 /** write a single bit in a 16-bit device register.
@@ -256,10 +234,7 @@ uint8_t I2Cdev_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_
  * @return Status of operation (true = success)
  */
 uint8_t I2Cdev_writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
-	uint16_t w;
-	I2Cdev_readWord(devAddr, regAddr, &w);
-	w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
-	return I2Cdev_writeWord(devAddr, regAddr, w);
+	return I2Cdev_coreWriteBitW(&I2Cdev_transport, devAddr, regAddr, bitNum, data);
 }
 
 /** Write multiple bits in an 8-bit device register.
@@ -271,24 +246,7 @@ uint8_t I2Cdev_writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint1
  * @return Status of operation (true = success)
  */
 uint8_t I2Cdev_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
-	//      010 value to write
-	// 76543210 bit numbers
-	//    xxx   args: bitStart=4, length=3
-	// 00011100 mask byte
-	// 10101111 original value (sample)
-	// 10100011 original & ~mask
-	// 10101011 masked | value
-	uint8_t b;
-	if (I2Cdev_readByte(devAddr, regAddr, &b) != 0) {
-		uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-		data <<= (bitStart - length + 1); // shift data into correct position
-		data &= mask; // zero all non-important bits in data
-		b &= ~(mask); // zero all important bits in existing byte
-		b |= data; // combine data with existing byte
-		return I2Cdev_writeByte(devAddr, regAddr, b);
-	} else {
-		return 0;
-	}
+	return I2Cdev_coreWriteBits(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data);
 }
 
 /** Write multiple bits in a 16-bit device register.
@@ -300,24 +258,7 @@ uint8_t I2Cdev_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uin
  * @return Status of operation (true = success)
  */
 uint8_t I2Cdev_writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
-	//              010 value to write
-	// fedcba9876543210 bit numbers
-	//    xxx           args: bitStart=12, length=3
-	// 0001110000000000 mask word
-	// 1010111110010110 original value (sample)
-	// 1010001110010110 original & ~mask
-	// 1010101110010110 masked | value
-	uint16_t w;
-	if (I2Cdev_readWord(devAddr, regAddr, &w) != 0) {
-		uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
-		data <<= (bitStart - length + 1); // shift data into correct position
-		data &= mask; // zero all non-important bits in data
-		w &= ~(mask); // zero all important bits in existing word
-		w |= data; // combine data with existing word
-		return I2Cdev_writeWord(devAddr, regAddr, w);
-	} else {
-		return 0;
-	}
+	return I2Cdev_coreWriteBitsW(&I2Cdev_transport, devAddr, regAddr, bitStart, length, data);
 }
 
 /** Write single byte to an 8-bit device register.
@@ -348,6 +289,17 @@ uint8_t I2Cdev_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
  * @return Status of operation (true = success)
  */
 uint8_t I2Cdev_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
+	return I2Cdev_writeBlock(devAddr, regAddr, length, data);
+}
+
+/** Write a block of bytes of any length in a single transaction.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t* data) {
 	#ifdef I2CDEV_SERIAL_DEBUG
 		Serial.print("I2C (0x");
 		Serial.print(devAddr, HEX);
@@ -358,20 +310,9 @@ uint8_t I2Cdev_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint
 		Serial.print("...");
 	#endif
 
-	uint8_t status = 0;
-	Fastwire_beginTransmission(devAddr);
-	Fastwire_write(regAddr);
-
-	for (uint8_t i = 0; i < length; i++) {
-		#ifdef I2CDEV_SERIAL_DEBUG
-			Serial.print(data[i], HEX);
-			if (i + 1 < length) Serial.print(" ");
-		#endif
-		Fastwire_write((uint8_t) data[i]);
-	}
-
+	I2Cdev_applyTimeout(I2Cdev_readTimeout);
+	uint8_t status = Fastwire_writeBuf(devAddr << 1, regAddr, data, length);
 	Fastwire_stop();
-	//status = Fastwire_endTransmission();
 
 	#ifdef I2CDEV_SERIAL_DEBUG
 		Serial.println(". Done.");
@@ -399,6 +340,7 @@ uint8_t I2Cdev_writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint
 	#endif
 
 	uint8_t status = 0;
+	I2Cdev_applyTimeout(I2Cdev_readTimeout);
 	Fastwire_beginTransmission(devAddr);
 	Fastwire_write(regAddr);
 
@@ -422,11 +364,41 @@ uint8_t I2Cdev_writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint
 	return status == 0;
 }
 
-/** Default timeout value for read operations.
- * Set this to 0 to disable timeout detection.
+/** Timeout for each bus step of a transfer, in microseconds.
+ * 0 (the default) derives it from the bus clock set by Fastwire_setup().
  */
 uint16_t I2Cdev_readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
 
+// -----------------------------------------------------------------------------
+// Transport backend for the shared register core (I2Cdev_core.c)
+// -----------------------------------------------------------------------------
+
+static int16_t I2Cdev_transportRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+	int16_t count;
+	uint16_t saved = I2Cdev_readTimeout;
+
+	// explicit timeouts are per bus step in microseconds on this port
+	if (timeout != I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) I2Cdev_readTimeout = timeout;
+	count = I2Cdev_readBlock(devAddr, regAddr, length, data);
+	I2Cdev_readTimeout = saved;
+	return count;
+}
+
+static uint8_t I2Cdev_transportWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+	return I2Cdev_writeBlock(devAddr, regAddr, length, data);
+}
+
+/** Register-level transport used by the bit accessors. Drivers and other
+ * core code can call the I2Cdev_core*() functions with it directly.
+ */
+const I2Cdev_Transport I2Cdev_transport = {
+	I2Cdev_transportRead,
+	I2Cdev_transportWrite,
+	0,  // lookup
+	0,  // readAsync
+	0   // context
+};
+
 
 // I2C library
 //////////////////////
@@ -446,10 +418,62 @@ FastWire
  [used by Jeff Rowberg for I2Cdevlib with permission]
  */
 
+static int16_t Fastwire_khz = 100;
+static uint16_t Fastwire_timeoutUs = 0;
+static uint16_t Fastwire_timeoutLoops = 1;
+
+/** Recompute the TWINT poll count from the timeout and bus clock. */
+static void Fastwire_updateTimeout(void) {
+	uint32_t us = Fastwire_timeoutUs;
+	uint32_t loops;
+
+	if (us == 0) us = (FASTWIRE_DEFAULT_TIMEOUT_BITS * 1000L + Fastwire_khz - 1) / Fastwire_khz;
+	loops = (us * (F_CPU / 1000000UL) + FASTWIRE_WAIT_LOOP_CYCLES - 1) / FASTWIRE_WAIT_LOOP_CYCLES;
+	if (loops == 0) loops = 1;
+	if (loops > 0xFFFF) loops = 0xFFFF; // about 32ms at 16MHz
+	Fastwire_timeoutLoops = (uint16_t)loops;
+}
+
+/** Set how long any single bus step may take before it is abandoned.
+ * Applies to every Fastwire_* primitive; no timer or interrupt is used.
+ * @param us Timeout in microseconds, 0 for FASTWIRE_DEFAULT_TIMEOUT_BITS bus clocks
+ */
+void Fastwire_setTimeout(uint16_t us) {
+	Fastwire_timeoutUs = us;
+	Fastwire_updateTimeout();
+}
+
+/** Get the bus step timeout last passed to Fastwire_setTimeout().
+ * @return Timeout in microseconds (0 = derived from the bus clock)
+ */
+uint16_t Fastwire_getTimeout(void) {
+	return Fastwire_timeoutUs;
+}
+
 uint8_t Fastwire_waitInt(void) {
-	int l = 250;
-	while (!(TWCR & (1 << TWINT)) && l-- > 0);
-	return l > 0;
+#if defined(__AVR__) && defined(__GNUC__)
+	uint16_t l = Fastwire_timeoutLoops;
+
+	// lds (2) + sbrc skipping rjmp (2) + sbiw (2) + brne taken (2) = 8
+	// cycles per poll, see FASTWIRE_WAIT_LOOP_CYCLES
+	__asm__ __volatile__ (
+		"1:	lds __tmp_reg__, %[twcr]"	"\n\t"
+		"sbrc __tmp_reg__, %[twint]"	"\n\t"
+		"rjmp 2f"			"\n\t"
+		"sbiw %[l], 1"			"\n\t"
+		"brne 1b"			"\n\t"
+		"2:"
+		: [l] "+w" (l)
+		: [twcr] "n" (_SFR_MEM_ADDR(TWCR)), [twint] "I" (TWINT)
+	);
+	return l != 0;
+#else
+	uint16_t l = Fastwire_timeoutLoops;
+	while (!(TWCR & (1 << TWINT))) {
+		if (--l == 0) return 0;
+	}
+	return 1;
+#endif
 }
 
 void Fastwire_setup(int16_t khz, uint8_t pullup) {
@@ -463,6 +487,9 @@ void Fastwire_setup(int16_t khz, uint8_t pullup) {
 	TWSR = 0; // no prescaler => prescaler = 1
 	TWBR = ((16000L / khz) - 16) / 2; // change the I2C clock rate
 	TWCR = 1 << TWEN; // enable twi module, no interrupt
+
+	Fastwire_khz = khz;
+	Fastwire_updateTimeout();
 }
 
 // added by Jeff Rowberg 2013-05-07:
@@ -488,7 +515,7 @@ uint8_t Fastwire_beginTransmission(uint8_t device) {
 	return 0;
 }
 
-uint8_t Fastwire_writeBuf(uint8_t device, uint8_t address, uint8_t *data, uint8_t num) {
+uint8_t Fastwire_writeBuf(uint8_t device, uint8_t address, uint8_t *data, uint16_t num) {
 	uint8_t twst, retry;
 
 	retry = 2;
@@ -515,7 +542,7 @@ uint8_t Fastwire_writeBuf(uint8_t device, uint8_t address, uint8_t *data, uint8_
 	twst = TWSR & 0xF8;
 	if (twst != TW_MT_DATA_ACK) return 6;
 
-	for (uint8_t i = 0; i < num; i++) {
+	for (uint16_t i = 0; i < num; i++) {
 		//Serial.print(data[i], HEX);
 		//Serial.print(" ");
 		TWDR = data[i]; // send data to the previously addressed device
@@ -540,7 +567,7 @@ uint8_t Fastwire_write(uint8_t value) {
 	return 0;
 }
 
-uint8_t Fastwire_readBuf(uint8_t device, uint8_t address, uint8_t *data, uint8_t num) {
+uint8_t Fastwire_readBuf(uint8_t device, uint8_t address, uint8_t *data, uint16_t num) {
 	uint8_t twst, retry;
 
 	retry = 2;
@@ -585,7 +612,7 @@ uint8_t Fastwire_readBuf(uint8_t device, uint8_t address, uint8_t *data, uint8_t
 	} while (twst == TW_MR_SLA_NACK && retry-- > 0);
 	if (twst != TW_MR_SLA_ACK) return 25;
 
-	for (uint8_t i = 0; i < num; i++) {
+	for (uint16_t i = 0; i < num; i++) {
 		if (i == num - 1)
 			TWCR = (1 << TWINT) | (1 << TWEN);
 		else
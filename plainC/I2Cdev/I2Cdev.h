@@ -3,6 +3,9 @@
 // 6/9/2012 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-14 - replace millis()/iteration-count timeouts with cycle-counted Fastwire bus step timeouts
+//      2026-10-14 - route bit accessors through the shared I2Cdev_core transport layer
+//      2026-10-14 - add 16-bit length I2Cdev_readBlock()/I2Cdev_writeBlock()
 //      2013-05-06 - add Francesco Ferrara's Fastwire v0.24 implementation with small modifications
 //      2013-05-05 - fix issue with writing bit values to words (Sasquatch/Farzanegan)
 //      2012-06-09 - fix major issue with reading > 32 bytes at a time with Arduino Wire
@@ -48,7 +51,7 @@ THE SOFTWARE.
 #define __I2CDEV_H__
 
 #include <avr/io.h>
-#include "msec.h"
+#include "I2Cdev_core.h"
 
 // comment this out if you are using a non-optimal IDE/implementation setting
 // but want the compiler to shut up about it
@@ -59,8 +62,9 @@ THE SOFTWARE.
 // -----------------------------------------------------------------------------
 //#define I2CDEV_SERIAL_DEBUG
 
-// 1000ms default read timeout (modify with "I2Cdev_readTimeout = [ms];")
-#define I2CDEV_DEFAULT_READ_TIMEOUT     1000
+// per bus step timeout in microseconds, 0 derives it from the bus clock
+// (modify with "I2Cdev_readTimeout = [us];")
+#define I2CDEV_DEFAULT_READ_TIMEOUT     0
 
 
 uint8_t I2Cdev_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data);
@@ -71,6 +75,7 @@ uint8_t I2Cdev_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data);
 uint8_t I2Cdev_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data);
 uint8_t I2Cdev_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
 uint8_t I2Cdev_readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+int16_t I2Cdev_readBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
 
 uint8_t I2Cdev_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
 uint8_t I2Cdev_writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
@@ -80,8 +85,11 @@ uint8_t I2Cdev_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data);
 uint8_t I2Cdev_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
 uint8_t I2Cdev_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
 uint8_t I2Cdev_writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+uint8_t I2Cdev_writeBlock(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
 
-uint16_t I2Cdev_readTimeout;
+extern const I2Cdev_Transport I2Cdev_transport;
+
+extern uint16_t I2Cdev_readTimeout;
 
 
 //////////////////////
@@ -112,11 +120,24 @@ uint16_t I2Cdev_readTimeout;
 #define TW_OK                   0
 #define TW_ERROR                1
 
+#ifndef F_CPU
+    #define F_CPU               16000000UL
+#endif
+
+// Each bus step (START, address, data byte, STOP) is bounded by a busy-wait
+// on TWINT whose loop runs in exactly FASTWIRE_WAIT_LOOP_CYCLES CPU cycles,
+// so timeouts need no timer or interrupt. The default allows this many SCL
+// periods per step: four bytes with ACK, enough for modest clock stretching.
+#define FASTWIRE_WAIT_LOOP_CYCLES       8
+#define FASTWIRE_DEFAULT_TIMEOUT_BITS   36
+
 void Fastwire_setup(int16_t khz, uint8_t pullup);
+void Fastwire_setTimeout(uint16_t us);
+uint16_t Fastwire_getTimeout(void);
 uint8_t Fastwire_beginTransmission(uint8_t device);
 uint8_t Fastwire_write(uint8_t value);
-uint8_t Fastwire_writeBuf(uint8_t device, uint8_t address, uint8_t *data, uint8_t num);
-uint8_t Fastwire_readBuf(uint8_t device, uint8_t address, uint8_t *data, uint8_t num);
+uint8_t Fastwire_writeBuf(uint8_t device, uint8_t address, uint8_t *data, uint16_t num);
+uint8_t Fastwire_readBuf(uint8_t device, uint8_t address, uint8_t *data, uint16_t num);
 void Fastwire_reset(void);
 uint8_t Fastwire_stop(void);
 
@@ -0,0 +1,467 @@
+// I2Cdev library collection - Platform-independent register access core
+// Shared bit/word register logic used by every I2Cdev port over a pluggable transport
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// This file is identical in every port directory (Arduino, MSP430, PIC18,
+// plainC); change all copies together.
+//
+// Changelog:
+//     2026-10-14 - add register scripts (I2Cdev_coreRunScript()) with coalesced burst writes
+//     2026-10-14 - add shared big/little-endian word unpack kernel
+//     2026-10-14 - add bus multiplexer (TCA9548A-style) channel transports
+//     2026-10-14 - initial release, factored out of the per-port I2Cdev code
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2Cdev_core.h"
+
+/** Read a single bit from an 8-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param bitNum Bit position to read (0-7)
+ * @param data Container for single bit value
+ * @param timeout Read timeout in milliseconds (0 to disable)
+ * @return Status of read operation (true = success)
+ */
+int8_t I2Cdev_coreReadBit(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
+    uint8_t b;
+    int8_t count = (int8_t)bus -> read(bus -> context, devAddr, regAddr, 1, &b, timeout);
+    if (count > 0) *data = b & (1 << bitNum);
+    return count;
+}
+
+/** Read a single bit from a 16-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param bitNum Bit position to read (0-15)
+ * @param data Container for single bit value
+ * @param timeout Read timeout in milliseconds (0 to disable)
+ * @return Status of read operation (true = success)
+ */
+int8_t I2Cdev_coreReadBitW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout) {
+    uint16_t b;
+    int8_t count = I2Cdev_coreReadWord(bus, devAddr, regAddr, &b, timeout);
+    if (count > 0) *data = b & (1 << bitNum);
+    return count;
+}
+
+/** Read multiple bits from an 8-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param bitStart First bit position to read (0-7)
+ * @param length Number of bits to read (not more than 8)
+ * @param data Container for right-aligned value (i.e. '101' read from any bitStart position will equal 0x05)
+ * @param timeout Read timeout in milliseconds (0 to disable)
+ * @return Status of read operation (true = success)
+ */
+int8_t I2Cdev_coreReadBits(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
+    // 01101001 read byte
+    // 76543210 bit numbers
+    //    xxx   args: bitStart=4, length=3
+    //    010   masked
+    //   -> 010 shifted
+    uint8_t b;
+    int8_t count = (int8_t)bus -> read(bus -> context, devAddr, regAddr, 1, &b, timeout);
+    if (count > 0) {
+        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+        *data = (b & mask) >> (bitStart - length + 1);
+    }
+    return count;
+}
+
+/** Read multiple bits from a 16-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param bitStart First bit position to read (0-15)
+ * @param length Number of bits to read (not more than 16)
+ * @param data Container for right-aligned value (i.e. '101' read from any bitStart position will equal 0x05)
+ * @param timeout Read timeout in milliseconds (0 to disable)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev_coreReadBitsW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout) {
+    // 1101011001101001 read byte
+    // fedcba9876543210 bit numbers
+    //    xxx           args: bitStart=12, length=3
+    //    010           masked
+    //           -> 010 shifted
+    uint16_t w;
+    int8_t count = I2Cdev_coreReadWord(bus, devAddr, regAddr, &w, timeout);
+    if (count > 0) {
+        uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+        *data = (w & mask) >> (bitStart - length + 1);
+    }
+    return count;
+}
+
+/** Read a single big-endian word from a 16-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param data Container for word value read from device
+ * @param timeout Read timeout in milliseconds (0 to disable)
+ * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
+ */
+int8_t I2Cdev_coreReadWord(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
+    uint8_t b[2];
+    int16_t count = bus -> read(bus -> context, devAddr, regAddr, 2, b, timeout);
+    if (count < 0) return -1;
+    if (count < 2) return 0;
+    *data = (uint16_t)I2CDEV_BE16(b);
+    return 1;
+}
+
+/** Fetch the current value of a register ahead of a read-modify-write.
+ * Uses the transport's lookup hook when it knows the value, otherwise reads
+ * the device.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read
+ * @param data Container for current register value
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreFetch(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
+    if (bus -> lookup != 0 && bus -> lookup(bus -> context, devAddr, regAddr, data)) return 1;
+    return bus -> read(bus -> context, devAddr, regAddr, 1, data, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) > 0;
+}
+
+/** Write a single bit in an 8-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param bitNum Bit position to write (0-7)
+ * @param data New bit value to write
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreWriteBit(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
+    uint8_t b;
+    if (!I2Cdev_coreFetch(bus, devAddr, regAddr, &b)) return 0;
+    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
+    return bus -> write(bus -> context, devAddr, regAddr, 1, &b);
+}
+
+/** Write a single bit in a 16-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param bitNum Bit position to write (0-15)
+ * @param data New bit value to write
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreWriteBitW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data) {
+    uint16_t w;
+    if (I2Cdev_coreReadWord(bus, devAddr, regAddr, &w, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) <= 0) return 0;
+    w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
+    return I2Cdev_coreWriteWord(bus, devAddr, regAddr, w);
+}
+
+/** Write multiple bits in an 8-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param bitStart First bit position to write (0-7)
+ * @param length Number of bits to write (not more than 8)
+ * @param data Right-aligned value to write
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreWriteBits(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+    //      010 value to write
+    // 76543210 bit numbers
+    //    xxx   args: bitStart=4, length=3
+    // 00011100 mask byte
+    // 10101111 original value (sample)
+    // 10100011 original & ~mask
+    // 10101011 masked | value
+    uint8_t b;
+    if (!I2Cdev_coreFetch(bus, devAddr, regAddr, &b)) return 0;
+    uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    data <<= (bitStart - length + 1); // shift data into correct position
+    data &= mask; // zero all non-important bits in data
+    b &= ~(mask); // zero all important bits in existing byte
+    b |= data; // combine data with existing byte
+    return bus -> write(bus -> context, devAddr, regAddr, 1, &b);
+}
+
+/** Write multiple bits in a 16-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param bitStart First bit position to write (0-15)
+ * @param length Number of bits to write (not more than 16)
+ * @param data Right-aligned value to write
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreWriteBitsW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data) {
+    //              010 value to write
+    // fedcba9876543210 bit numbers
+    //    xxx           args: bitStart=12, length=3
+    // 0001110000000000 mask word
+    // 1010111110010110 original value (sample)
+    // 1010001110010110 original & ~mask
+    // 1010101110010110 masked | value
+    uint16_t w;
+    if (I2Cdev_coreReadWord(bus, devAddr, regAddr, &w, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) <= 0) return 0;
+    uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    data <<= (bitStart - length + 1); // shift data into correct position
+    data &= mask; // zero all non-important bits in data
+    w &= ~(mask); // zero all important bits in existing word
+    w |= data; // combine data with existing word
+    return I2Cdev_coreWriteWord(bus, devAddr, regAddr, w);
+}
+
+/** Write a single big-endian word to a 16-bit device register.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param regAddr Register address to write to
+ * @param data New word value to write
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreWriteWord(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint16_t data) {
+    uint8_t b[2];
+    b[0] = data >> 8;
+    b[1] = data & 0xFF;
+    return bus -> write(bus -> context, devAddr, regAddr, 2, b);
+}
+
+// -----------------------------------------------------------------------------
+// Word unpacking
+// -----------------------------------------------------------------------------
+
+// host byte order, where the compiler tells us
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && defined(__ORDER_BIG_ENDIAN__)
+    #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        #define I2CDEV_HOST_LITTLE_ENDIAN
+    #elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        #define I2CDEV_HOST_BIG_ENDIAN
+    #endif
+#endif
+
+// word-wise swapping pays off where loads are 16 bits or wider and byte swap
+// is one instruction; 8-bit cores are already optimal with byte moves
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8)) \
+    && !defined(__AVR__) && !defined(__MSP430__)
+    #define I2CDEV_HAVE_BSWAP16
+#endif
+
+/** Convert a raw burst of MSB-first byte pairs to host-order words.
+ * Safe in place (words may alias bytes), since word i only ever overwrites
+ * the two bytes it was built from.
+ * @param words Output words
+ * @param bytes Raw bytes, 2 per word
+ * @param count Number of words
+ */
+void I2Cdev_coreUnpackBE16(uint16_t *words, const uint8_t *bytes, uint16_t count) {
+    uint16_t i;
+#if defined(I2CDEV_HOST_BIG_ENDIAN)
+    if ((const uint8_t *)words == bytes) return;
+#endif
+#if defined(I2CDEV_HAVE_BSWAP16) && defined(I2CDEV_HOST_LITTLE_ENDIAN)
+    for (i = 0; i < count; i++) {
+        uint16_t w;
+        __builtin_memcpy(&w, bytes + 2*i, 2);
+        words[i] = __builtin_bswap16(w);
+    }
+#else
+    for (i = 0; i < count; i++) words[i] = ((uint16_t)bytes[2*i] << 8) | bytes[2*i + 1];
+#endif
+}
+
+/** Convert a raw burst of LSB-first byte pairs to host-order words.
+ * Safe in place, as I2Cdev_coreUnpackBE16().
+ * @param words Output words
+ * @param bytes Raw bytes, 2 per word
+ * @param count Number of words
+ */
+void I2Cdev_coreUnpackLE16(uint16_t *words, const uint8_t *bytes, uint16_t count) {
+    uint16_t i;
+#if defined(I2CDEV_HOST_LITTLE_ENDIAN)
+    if ((const uint8_t *)words == bytes) return;
+#endif
+#if defined(I2CDEV_HAVE_BSWAP16) && defined(I2CDEV_HOST_BIG_ENDIAN)
+    for (i = 0; i < count; i++) {
+        uint16_t w;
+        __builtin_memcpy(&w, bytes + 2*i, 2);
+        words[i] = __builtin_bswap16(w);
+    }
+#else
+    for (i = 0; i < count; i++) words[i] = ((uint16_t)bytes[2*i + 1] << 8) | bytes[2*i];
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Bus multiplexer channels
+// -----------------------------------------------------------------------------
+
+static int16_t I2Cdev_muxRead(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    I2Cdev_MuxChannel *channel = (I2Cdev_MuxChannel *)context;
+    const I2Cdev_Transport *parent = channel -> mux -> parent;
+    if (!I2Cdev_coreMuxSelect(channel -> mux, channel -> mask)) return -1;
+    return parent -> read(parent -> context, devAddr, regAddr, length, data, timeout);
+}
+
+static uint8_t I2Cdev_muxWrite(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    I2Cdev_MuxChannel *channel = (I2Cdev_MuxChannel *)context;
+    const I2Cdev_Transport *parent = channel -> mux -> parent;
+    if (!I2Cdev_coreMuxSelect(channel -> mux, channel -> mask)) return 0;
+    return parent -> write(parent -> context, devAddr, regAddr, length, data);
+}
+
+static uint8_t I2Cdev_muxReadAsync(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2Cdev_TransportDone done, void *doneContext) {
+    I2Cdev_MuxChannel *channel = (I2Cdev_MuxChannel *)context;
+    const I2Cdev_Transport *parent = channel -> mux -> parent;
+    // the select itself is blocking; only the data transfer runs in the background
+    if (!I2Cdev_coreMuxSelect(channel -> mux, channel -> mask)) return 0;
+    return parent -> readAsync(parent -> context, devAddr, regAddr, length, data, done, doneContext);
+}
+
+/** Set up a bus multiplexer descriptor. No bus traffic is generated; the
+ * first transfer on any channel writes the control register.
+ * @param mux Descriptor to initialize (caller-owned)
+ * @param parent Upstream transport the mux sits on
+ * @param muxAddr 7-bit mux address (0x70-0x77 for TCA9548A)
+ */
+void I2Cdev_coreMuxInit(I2Cdev_Mux *mux, const I2Cdev_Transport *parent, uint8_t muxAddr) {
+    mux -> parent = parent;
+    mux -> muxAddr = muxAddr;
+    mux -> selected = I2CDEV_MUX_UNKNOWN;
+}
+
+/** Bind a channel transport to one downstream port of a mux.
+ * @param channel Descriptor to initialize (caller-owned, must outlive its users)
+ * @param mux Mux the channel belongs to
+ * @param channelNum Downstream port number (0-7)
+ */
+void I2Cdev_coreMuxChannel(I2Cdev_MuxChannel *channel, I2Cdev_Mux *mux, uint8_t channelNum) {
+    channel -> transport.read = I2Cdev_muxRead;
+    channel -> transport.write = I2Cdev_muxWrite;
+    channel -> transport.lookup = 0;
+    channel -> transport.readAsync = mux -> parent -> readAsync ? I2Cdev_muxReadAsync : 0;
+    channel -> transport.context = channel;
+    channel -> mux = mux;
+    channel -> mask = 1 << channelNum;
+}
+
+/** Write the mux channel-enable register unless it already holds mask.
+ * @param mux Mux to update
+ * @param mask Channel-enable bits (0 disconnects every channel)
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreMuxSelect(I2Cdev_Mux *mux, uint8_t mask) {
+    if (mux -> selected == mask) return 1;
+    // the control byte goes out where a register address normally would
+    if (!mux -> parent -> write(mux -> parent -> context, mux -> muxAddr, mask, 0, &mask)) {
+        mux -> selected = I2CDEV_MUX_UNKNOWN;
+        return 0;
+    }
+    mux -> selected = mask;
+    return 1;
+}
+
+/** Forget the cached channel selection, e.g. after a bus recovery, a mux
+ * reset or another master touching the mux. The next transfer reselects.
+ * @param mux Mux to invalidate
+ */
+void I2Cdev_coreMuxInvalidate(I2Cdev_Mux *mux) {
+    mux -> selected = I2CDEV_MUX_UNKNOWN;
+}
+
+// -----------------------------------------------------------------------------
+// Register scripts
+// -----------------------------------------------------------------------------
+
+#if defined(__AVR__)
+    #define I2CDEV_SCRIPT_BYTE(p)   pgm_read_byte(p)
+#else
+    #define I2CDEV_SCRIPT_BYTE(p)   (*(p))
+#endif
+
+// write out a pending burst; bursts of more than one register get the
+// address bits set by I2CDEV_SCRIPT_INCREMENT()
+static uint8_t I2Cdev_scriptFlush(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t start, uint8_t *count, uint8_t *burst, uint8_t increment) {
+    uint8_t n = *count;
+    *count = 0;
+    if (n == 0) return 1;
+    return bus -> write(bus -> context, devAddr, n > 1 ? (start | increment) : start, n, burst);
+}
+
+/** Apply a register script (see I2CDEV_SCRIPT_WRITE() and friends).
+ * Entries take effect in script order: a partial-mask entry writes out any
+ * pending burst before it reads the register (unless the transport's lookup
+ * hook already knows the value), so a read never overtakes an earlier write.
+ * Stops at the first failed transfer.
+ * @param bus Transport to use
+ * @param devAddr I2C slave device address
+ * @param script Entries ending with I2CDEV_SCRIPT_END, in I2CDEV_SCRIPT_PROGMEM
+ * @return Status of operation (true = success)
+ */
+uint8_t I2Cdev_coreRunScript(const I2Cdev_Transport *bus, uint8_t devAddr, const uint8_t *script) {
+    uint8_t burst[I2CDEV_SCRIPT_BURST];
+    uint8_t start = 0, count = 0, increment = 0;
+    uint8_t regAddr = I2CDEV_SCRIPT_BYTE(script);
+    uint8_t mask = I2CDEV_SCRIPT_BYTE(script + 1);
+    uint8_t value = I2CDEV_SCRIPT_BYTE(script + 2);
+
+    while (1) {
+        uint8_t b;
+        if (mask == 0) {
+            // control code
+            if (!I2Cdev_scriptFlush(bus, devAddr, start, &count, burst, increment)) return 0;
+            if (value == 0) return 1;
+            if (value == 2) increment = regAddr;
+            script += 3;
+        } else {
+            // merge following entries for the same register
+            b = value & mask;
+            for (script += 3; I2CDEV_SCRIPT_BYTE(script) == regAddr && I2CDEV_SCRIPT_BYTE(script + 1) != 0; script += 3) {
+                uint8_t nextMask = I2CDEV_SCRIPT_BYTE(script + 1);
+                b = (b & ~nextMask) | (I2CDEV_SCRIPT_BYTE(script + 2) & nextMask);
+                mask |= nextMask;
+            }
+
+            if (mask != 0xFF) {
+                uint8_t current;
+                if ((uint8_t)(regAddr - start) < count) {
+                    current = burst[regAddr - start]; // written earlier, still pending
+                } else if (bus -> lookup == 0 || !bus -> lookup(bus -> context, devAddr, regAddr, &current)) {
+                    if (!I2Cdev_scriptFlush(bus, devAddr, start, &count, burst, increment)) return 0;
+                    if (bus -> read(bus -> context, devAddr, regAddr, 1, &current, I2CDEV_TRANSPORT_DEFAULT_TIMEOUT) <= 0) return 0;
+                }
+                b |= current & ~mask;
+            }
+
+            if (count == 0 || count == I2CDEV_SCRIPT_BURST || regAddr != (uint8_t)(start + count)) {
+                if (!I2Cdev_scriptFlush(bus, devAddr, start, &count, burst, increment)) return 0;
+                start = regAddr;
+            }
+            burst[count++] = b;
+        }
+        regAddr = I2CDEV_SCRIPT_BYTE(script);
+        mask = I2CDEV_SCRIPT_BYTE(script + 1);
+        value = I2CDEV_SCRIPT_BYTE(script + 2);
+    }
+}
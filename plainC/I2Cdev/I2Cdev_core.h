@@ -0,0 +1,185 @@
+// I2Cdev library collection - Platform-independent register access core
+// Shared bit/word register logic used by every I2Cdev port over a pluggable transport
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// This file is identical in every port directory (Arduino, MSP430, PIC18,
+// plainC); change all copies together.
+//
+// Changelog:
+//     2026-10-14 - add register scripts (I2Cdev_coreRunScript()) with coalesced burst writes
+//     2026-10-14 - add shared big/little-endian word unpack kernel
+//     2026-10-14 - add bus multiplexer (TCA9548A-style) channel transports
+//     2026-10-14 - initial release, factored out of the per-port I2Cdev code
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_CORE_H_
+#define _I2CDEV_CORE_H_
+
+#include <stdint.h>
+#if defined(__AVR__)
+    #include <avr/pgmspace.h> // register scripts in program memory
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// timeout value asking the backend to apply its own default read timeout
+#define I2CDEV_TRANSPORT_DEFAULT_TIMEOUT    0xFFFF
+
+/** Completion callback for asynchronous transport reads.
+ * @param context Caller-supplied pointer given to readAsync()
+ * @param result Number of bytes transferred (-1 indicates failure)
+ */
+typedef void (*I2Cdev_TransportDone)(void *context, int16_t result);
+
+/** Register-level bus access supplied by each platform backend.
+ * read and write are required; everything else may be left 0. All of the
+ * shared register logic (bit fields, 16-bit words, read-modify-write) runs
+ * on top of these, so an improvement to a backend's burst transfer speeds
+ * up every accessor built on it.
+ */
+typedef struct I2Cdev_Transport {
+    // burst register read: returns bytes read, -1 on failure
+    int16_t (*read)(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout);
+    // burst register write: returns nonzero on success
+    uint8_t (*write)(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+    // optional: known register value (e.g. a shadow cache) to skip the read of a read-modify-write
+    uint8_t (*lookup)(void *context, uint8_t devAddr, uint8_t regAddr, uint8_t *data);
+    // optional: start a read and return immediately (interrupt or DMA driven), nonzero if started
+    uint8_t (*readAsync)(void *context, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2Cdev_TransportDone done, void *doneContext);
+    void *context;              // passed to every hook
+} I2Cdev_Transport;
+
+int8_t I2Cdev_coreReadBit(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout);
+int8_t I2Cdev_coreReadBitW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout);
+int8_t I2Cdev_coreReadBits(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout);
+int8_t I2Cdev_coreReadBitsW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t timeout);
+int8_t I2Cdev_coreReadWord(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout);
+
+uint8_t I2Cdev_coreFetch(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t *data);
+uint8_t I2Cdev_coreWriteBit(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
+uint8_t I2Cdev_coreWriteBitW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
+uint8_t I2Cdev_coreWriteBits(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
+uint8_t I2Cdev_coreWriteBitsW(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data);
+uint8_t I2Cdev_coreWriteWord(const I2Cdev_Transport *bus, uint8_t devAddr, uint8_t regAddr, uint16_t data);
+
+// -----------------------------------------------------------------------------
+// Word unpacking
+// -----------------------------------------------------------------------------
+
+// signed 16-bit value from two bytes of a raw burst, MSB or LSB first; both
+// compile to plain byte moves on 8-bit targets and a single REV16/ROL on
+// 32-bit ones
+#define I2CDEV_BE16(b)  ((int16_t)(((uint16_t)(b)[0] << 8) | (b)[1]))
+#define I2CDEV_LE16(b)  ((int16_t)(((uint16_t)(b)[1] << 8) | (b)[0]))
+
+void I2Cdev_coreUnpackBE16(uint16_t *words, const uint8_t *bytes, uint16_t count);
+void I2Cdev_coreUnpackLE16(uint16_t *words, const uint8_t *bytes, uint16_t count);
+
+// channel mask meaning "mux state not known", forcing the next select to write
+#define I2CDEV_MUX_UNKNOWN                  0xFF
+
+/** Bus multiplexer with a single channel-enable control register (TCA9548A,
+ * PCA9546A and friends: one byte written with no register address, bit n
+ * connecting downstream channel n). The mux remembers the last mask it
+ * wrote, so back-to-back transfers on the same channel cost no extra bus
+ * traffic.
+ */
+typedef struct I2Cdev_Mux {
+    const I2Cdev_Transport *parent; // upstream bus (may itself be a mux channel)
+    uint8_t muxAddr;            // 7-bit mux address
+    uint8_t selected;           // last channel mask written, I2CDEV_MUX_UNKNOWN if not known
+} I2Cdev_Mux;
+
+/** Transport for one downstream channel of an I2Cdev_Mux. Pass &transport
+ * anywhere an I2Cdev_Transport is taken; each transfer selects the channel
+ * first if it isn't already. There is no lookup hook, since a register cache
+ * keyed only by device address can't tell apart twin devices on different
+ * channels.
+ */
+typedef struct I2Cdev_MuxChannel {
+    I2Cdev_Transport transport; // hooks bound to this channel
+    I2Cdev_Mux *mux;
+    uint8_t mask;               // channel-enable bits written to select this channel
+} I2Cdev_MuxChannel;
+
+void I2Cdev_coreMuxInit(I2Cdev_Mux *mux, const I2Cdev_Transport *parent, uint8_t muxAddr);
+void I2Cdev_coreMuxChannel(I2Cdev_MuxChannel *channel, I2Cdev_Mux *mux, uint8_t channelNum);
+uint8_t I2Cdev_coreMuxSelect(I2Cdev_Mux *mux, uint8_t mask);
+void I2Cdev_coreMuxInvalidate(I2Cdev_Mux *mux);
+
+// -----------------------------------------------------------------------------
+// Register scripts
+// -----------------------------------------------------------------------------
+
+// A script is a flat byte table of (regAddr, mask, value) entries: the bits
+// set in mask are replaced with those of value and the rest keep their
+// current contents, so mask 0xFF writes the whole register without reading
+// it first. Consecutive entries for the same register are merged; runs of
+// fully known values for consecutive registers go out as one burst write,
+// so a block of configuration registers costs a single transaction. An
+// entry with mask 0 is a control code; I2CDEV_SCRIPT_INCREMENT(0x80) suits
+// parts that only auto-increment with the address MSB set (the ST sensors).
+// Keep scripts in flash with I2CDEV_SCRIPT_PROGMEM (program memory on AVR,
+// plain const elsewhere).
+//
+//     static const uint8_t setup[] I2CDEV_SCRIPT_PROGMEM = {
+//         I2CDEV_SCRIPT_WRITE(0x19, 9),           // whole register
+//         I2CDEV_SCRIPT_BITS(0x1A, 2, 3, 3),      // bits 2..0 only
+//         I2CDEV_SCRIPT_BIT(0x6B, 6, 0),          // single bit
+//         I2CDEV_SCRIPT_END
+//     };
+//     I2Cdev_coreRunScript(bus, devAddr, setup);
+
+#define I2CDEV_SCRIPT_WRITE(regAddr, value)                     (regAddr), 0xFF, (value)
+#define I2CDEV_SCRIPT_BITS(regAddr, bitStart, length, value)   (regAddr), \
+    (uint8_t)(((1 << (length)) - 1) << ((bitStart) - (length) + 1)), \
+    (uint8_t)((value) << ((bitStart) - (length) + 1))
+#define I2CDEV_SCRIPT_BIT(regAddr, bitNum, value)               (regAddr), (uint8_t)(1 << (bitNum)), \
+    (uint8_t)((value) ? (1 << (bitNum)) : 0)
+#define I2CDEV_SCRIPT_END                                       0, 0, 0 // end of script
+#define I2CDEV_SCRIPT_FLUSH                                     0, 0, 1 // finish pending writes, merge nothing across
+#define I2CDEV_SCRIPT_INCREMENT(bits)                           (bits), 0, 2 // OR bits into the address of multi-register bursts
+
+// longest burst a script run builds up before writing it out (stack bytes)
+#ifndef I2CDEV_SCRIPT_BURST
+    #define I2CDEV_SCRIPT_BURST     16
+#endif
+
+#if defined(__AVR__)
+    #define I2CDEV_SCRIPT_PROGMEM   PROGMEM
+#else
+    #define I2CDEV_SCRIPT_PROGMEM
+#endif
+
+uint8_t I2Cdev_coreRunScript(const I2Cdev_Transport *bus, uint8_t devAddr, const uint8_t *script);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _I2CDEV_CORE_H_ */
@@ -2671,8 +2671,8 @@ uint8_t MPU6050_getFIFOByte(void) {
 	I2Cdev_readByte(MPU6050_devAddr, MPU6050_RA_FIFO_R_W, MPU6050_buffer);
 	return MPU6050_buffer[0];
 }
-void MPU6050_getFIFOBytes(uint8_t *data, uint8_t length) {
-	I2Cdev_readBytes(MPU6050_devAddr, MPU6050_RA_FIFO_R_W, length, data);
+void MPU6050_getFIFOBytes(uint8_t *data, uint16_t length) {
+	I2Cdev_readBlock(MPU6050_devAddr, MPU6050_RA_FIFO_R_W, length, data);
 }
 /** Write byte to FIFO buffer.
  * @see getFIFOByte()